@@ -581,6 +581,515 @@ static const std::unordered_map<std::string, uint32_t> device_extension_map = {
     {"VK_EXT_mesh_shader", VK_EXT_MESH_SHADER_SPEC_VERSION},
 };
 
+// Handle types tracked by the live-object census
+enum class CensusType : uint32_t {
+    AccelerationStructureKHR,
+    AccelerationStructureNV,
+    Buffer,
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    BufferCollectionFUCHSIA,
+#endif
+    BufferView,
+    CommandBuffer,
+    CommandPool,
+    CuFunctionNVX,
+    CuModuleNVX,
+    CudaFunctionNV,
+    CudaModuleNV,
+    DataGraphPipelineSessionARM,
+    DebugReportCallbackEXT,
+    DebugUtilsMessengerEXT,
+    DeferredOperationKHR,
+    DescriptorPool,
+    DescriptorSet,
+    DescriptorSetLayout,
+    DescriptorUpdateTemplate,
+    Device,
+    DeviceMemory,
+    DisplayKHR,
+    DisplayModeKHR,
+    Event,
+    ExternalComputeQueueNV,
+    Fence,
+    Framebuffer,
+    GpaSessionAMD,
+    Image,
+    ImageView,
+    IndirectCommandsLayoutEXT,
+    IndirectCommandsLayoutNV,
+    IndirectExecutionSetEXT,
+    Instance,
+    MicromapEXT,
+    OpticalFlowSessionNV,
+    PerformanceConfigurationINTEL,
+    PhysicalDevice,
+    Pipeline,
+    PipelineBinaryKHR,
+    PipelineCache,
+    PipelineLayout,
+    PrivateDataSlot,
+    QueryPool,
+    Queue,
+    RenderPass,
+    Sampler,
+    SamplerYcbcrConversion,
+    Semaphore,
+    ShaderEXT,
+    ShaderInstrumentationARM,
+    ShaderModule,
+    SurfaceKHR,
+    SwapchainKHR,
+    TensorARM,
+    TensorViewARM,
+    ValidationCacheEXT,
+    VideoSessionKHR,
+    VideoSessionParametersKHR,
+    Count,
+};
+static const char* const census_type_names[] = {
+    "VkAccelerationStructureKHR",
+    "VkAccelerationStructureNV",
+    "VkBuffer",
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    "VkBufferCollectionFUCHSIA",
+#endif
+    "VkBufferView",
+    "VkCommandBuffer",
+    "VkCommandPool",
+    "VkCuFunctionNVX",
+    "VkCuModuleNVX",
+    "VkCudaFunctionNV",
+    "VkCudaModuleNV",
+    "VkDataGraphPipelineSessionARM",
+    "VkDebugReportCallbackEXT",
+    "VkDebugUtilsMessengerEXT",
+    "VkDeferredOperationKHR",
+    "VkDescriptorPool",
+    "VkDescriptorSet",
+    "VkDescriptorSetLayout",
+    "VkDescriptorUpdateTemplate",
+    "VkDevice",
+    "VkDeviceMemory",
+    "VkDisplayKHR",
+    "VkDisplayModeKHR",
+    "VkEvent",
+    "VkExternalComputeQueueNV",
+    "VkFence",
+    "VkFramebuffer",
+    "VkGpaSessionAMD",
+    "VkImage",
+    "VkImageView",
+    "VkIndirectCommandsLayoutEXT",
+    "VkIndirectCommandsLayoutNV",
+    "VkIndirectExecutionSetEXT",
+    "VkInstance",
+    "VkMicromapEXT",
+    "VkOpticalFlowSessionNV",
+    "VkPerformanceConfigurationINTEL",
+    "VkPhysicalDevice",
+    "VkPipeline",
+    "VkPipelineBinaryKHR",
+    "VkPipelineCache",
+    "VkPipelineLayout",
+    "VkPrivateDataSlot",
+    "VkQueryPool",
+    "VkQueue",
+    "VkRenderPass",
+    "VkSampler",
+    "VkSamplerYcbcrConversion",
+    "VkSemaphore",
+    "VkShaderEXT",
+    "VkShaderInstrumentationARM",
+    "VkShaderModule",
+    "VkSurfaceKHR",
+    "VkSwapchainKHR",
+    "VkTensorARM",
+    "VkTensorViewARM",
+    "VkValidationCacheEXT",
+    "VkVideoSessionKHR",
+    "VkVideoSessionParametersKHR",
+};
+
+// Texel block of a single-plane format: its size in bytes and its extent in texels (1x1x1 for uncompressed formats).
+// Multi-planar and unknown formats report a size of 0.
+struct TexelBlock {
+    uint32_t size;
+    uint32_t width;
+    uint32_t height;
+    uint32_t depth;
+};
+
+static TexelBlock GetTexelBlock(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_A8_UNORM:
+        case VK_FORMAT_R4G4_UNORM_PACK8:
+        case VK_FORMAT_R8_BOOL_ARM:
+        case VK_FORMAT_R8_SFLOAT_FPENCODING_FLOAT8E4M3_ARM:
+        case VK_FORMAT_R8_SFLOAT_FPENCODING_FLOAT8E5M2_ARM:
+        case VK_FORMAT_R8_SINT:
+        case VK_FORMAT_R8_SNORM:
+        case VK_FORMAT_R8_SRGB:
+        case VK_FORMAT_R8_SSCALED:
+        case VK_FORMAT_R8_UINT:
+        case VK_FORMAT_R8_UNORM:
+        case VK_FORMAT_R8_USCALED:
+        case VK_FORMAT_S8_UINT:
+            return {1, 1, 1, 1};
+        case VK_FORMAT_A1B5G5R5_UNORM_PACK16:
+        case VK_FORMAT_A1R5G5B5_UNORM_PACK16:
+        case VK_FORMAT_A4B4G4R4_UNORM_PACK16:
+        case VK_FORMAT_A4R4G4B4_UNORM_PACK16:
+        case VK_FORMAT_B4G4R4A4_UNORM_PACK16:
+        case VK_FORMAT_B5G5R5A1_UNORM_PACK16:
+        case VK_FORMAT_B5G6R5_UNORM_PACK16:
+        case VK_FORMAT_D16_UNORM:
+        case VK_FORMAT_R10X6_UINT_PACK16_ARM:
+        case VK_FORMAT_R10X6_UNORM_PACK16:
+        case VK_FORMAT_R12X4_UINT_PACK16_ARM:
+        case VK_FORMAT_R12X4_UNORM_PACK16:
+        case VK_FORMAT_R14X2_UINT_PACK16_ARM:
+        case VK_FORMAT_R14X2_UNORM_PACK16_ARM:
+        case VK_FORMAT_R16_SFLOAT:
+        case VK_FORMAT_R16_SFLOAT_FPENCODING_BFLOAT16_ARM:
+        case VK_FORMAT_R16_SINT:
+        case VK_FORMAT_R16_SNORM:
+        case VK_FORMAT_R16_SSCALED:
+        case VK_FORMAT_R16_UINT:
+        case VK_FORMAT_R16_UNORM:
+        case VK_FORMAT_R16_USCALED:
+        case VK_FORMAT_R4G4B4A4_UNORM_PACK16:
+        case VK_FORMAT_R5G5B5A1_UNORM_PACK16:
+        case VK_FORMAT_R5G6B5_UNORM_PACK16:
+        case VK_FORMAT_R8G8_SINT:
+        case VK_FORMAT_R8G8_SNORM:
+        case VK_FORMAT_R8G8_SRGB:
+        case VK_FORMAT_R8G8_SSCALED:
+        case VK_FORMAT_R8G8_UINT:
+        case VK_FORMAT_R8G8_UNORM:
+        case VK_FORMAT_R8G8_USCALED:
+            return {2, 1, 1, 1};
+        case VK_FORMAT_B8G8R8_SINT:
+        case VK_FORMAT_B8G8R8_SNORM:
+        case VK_FORMAT_B8G8R8_SRGB:
+        case VK_FORMAT_B8G8R8_SSCALED:
+        case VK_FORMAT_B8G8R8_UINT:
+        case VK_FORMAT_B8G8R8_UNORM:
+        case VK_FORMAT_B8G8R8_USCALED:
+        case VK_FORMAT_D16_UNORM_S8_UINT:
+        case VK_FORMAT_R8G8B8_SINT:
+        case VK_FORMAT_R8G8B8_SNORM:
+        case VK_FORMAT_R8G8B8_SRGB:
+        case VK_FORMAT_R8G8B8_SSCALED:
+        case VK_FORMAT_R8G8B8_UINT:
+        case VK_FORMAT_R8G8B8_UNORM:
+        case VK_FORMAT_R8G8B8_USCALED:
+            return {3, 1, 1, 1};
+        case VK_FORMAT_A2B10G10R10_SINT_PACK32:
+        case VK_FORMAT_A2B10G10R10_SNORM_PACK32:
+        case VK_FORMAT_A2B10G10R10_SSCALED_PACK32:
+        case VK_FORMAT_A2B10G10R10_UINT_PACK32:
+        case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+        case VK_FORMAT_A2B10G10R10_USCALED_PACK32:
+        case VK_FORMAT_A2R10G10B10_SINT_PACK32:
+        case VK_FORMAT_A2R10G10B10_SNORM_PACK32:
+        case VK_FORMAT_A2R10G10B10_SSCALED_PACK32:
+        case VK_FORMAT_A2R10G10B10_UINT_PACK32:
+        case VK_FORMAT_A2R10G10B10_UNORM_PACK32:
+        case VK_FORMAT_A2R10G10B10_USCALED_PACK32:
+        case VK_FORMAT_A8B8G8R8_SINT_PACK32:
+        case VK_FORMAT_A8B8G8R8_SNORM_PACK32:
+        case VK_FORMAT_A8B8G8R8_SRGB_PACK32:
+        case VK_FORMAT_A8B8G8R8_SSCALED_PACK32:
+        case VK_FORMAT_A8B8G8R8_UINT_PACK32:
+        case VK_FORMAT_A8B8G8R8_UNORM_PACK32:
+        case VK_FORMAT_A8B8G8R8_USCALED_PACK32:
+        case VK_FORMAT_B10G11R11_UFLOAT_PACK32:
+        case VK_FORMAT_B8G8R8A8_SINT:
+        case VK_FORMAT_B8G8R8A8_SNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+        case VK_FORMAT_B8G8R8A8_SSCALED:
+        case VK_FORMAT_B8G8R8A8_UINT:
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_USCALED:
+        case VK_FORMAT_D24_UNORM_S8_UINT:
+        case VK_FORMAT_D32_SFLOAT:
+        case VK_FORMAT_E5B9G9R9_UFLOAT_PACK32:
+        case VK_FORMAT_R10X6G10X6_UINT_2PACK16_ARM:
+        case VK_FORMAT_R10X6G10X6_UNORM_2PACK16:
+        case VK_FORMAT_R12X4G12X4_UINT_2PACK16_ARM:
+        case VK_FORMAT_R12X4G12X4_UNORM_2PACK16:
+        case VK_FORMAT_R14X2G14X2_UINT_2PACK16_ARM:
+        case VK_FORMAT_R14X2G14X2_UNORM_2PACK16_ARM:
+        case VK_FORMAT_R16G16_SFIXED5_NV:
+        case VK_FORMAT_R16G16_SFLOAT:
+        case VK_FORMAT_R16G16_SINT:
+        case VK_FORMAT_R16G16_SNORM:
+        case VK_FORMAT_R16G16_SSCALED:
+        case VK_FORMAT_R16G16_UINT:
+        case VK_FORMAT_R16G16_UNORM:
+        case VK_FORMAT_R16G16_USCALED:
+        case VK_FORMAT_R32_SFLOAT:
+        case VK_FORMAT_R32_SINT:
+        case VK_FORMAT_R32_UINT:
+        case VK_FORMAT_R8G8B8A8_SINT:
+        case VK_FORMAT_R8G8B8A8_SNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+        case VK_FORMAT_R8G8B8A8_SSCALED:
+        case VK_FORMAT_R8G8B8A8_UINT:
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_USCALED:
+        case VK_FORMAT_X8_D24_UNORM_PACK32:
+            return {4, 1, 1, 1};
+        case VK_FORMAT_B8G8R8G8_422_UNORM:
+        case VK_FORMAT_G8B8G8R8_422_UNORM:
+            return {4, 2, 1, 1};
+        case VK_FORMAT_D32_SFLOAT_S8_UINT:
+            return {5, 1, 1, 1};
+        case VK_FORMAT_R16G16B16_SFLOAT:
+        case VK_FORMAT_R16G16B16_SINT:
+        case VK_FORMAT_R16G16B16_SNORM:
+        case VK_FORMAT_R16G16B16_SSCALED:
+        case VK_FORMAT_R16G16B16_UINT:
+        case VK_FORMAT_R16G16B16_UNORM:
+        case VK_FORMAT_R16G16B16_USCALED:
+            return {6, 1, 1, 1};
+        case VK_FORMAT_R10X6G10X6B10X6A10X6_UINT_4PACK16_ARM:
+        case VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16:
+        case VK_FORMAT_R12X4G12X4B12X4A12X4_UINT_4PACK16_ARM:
+        case VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16:
+        case VK_FORMAT_R14X2G14X2B14X2A14X2_UINT_4PACK16_ARM:
+        case VK_FORMAT_R14X2G14X2B14X2A14X2_UNORM_4PACK16_ARM:
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+        case VK_FORMAT_R16G16B16A16_SINT:
+        case VK_FORMAT_R16G16B16A16_SNORM:
+        case VK_FORMAT_R16G16B16A16_SSCALED:
+        case VK_FORMAT_R16G16B16A16_UINT:
+        case VK_FORMAT_R16G16B16A16_UNORM:
+        case VK_FORMAT_R16G16B16A16_USCALED:
+        case VK_FORMAT_R32G32_SFLOAT:
+        case VK_FORMAT_R32G32_SINT:
+        case VK_FORMAT_R32G32_UINT:
+        case VK_FORMAT_R64_SFLOAT:
+        case VK_FORMAT_R64_SINT:
+        case VK_FORMAT_R64_UINT:
+            return {8, 1, 1, 1};
+        case VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16:
+        case VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16:
+        case VK_FORMAT_B16G16R16G16_422_UNORM:
+        case VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16:
+        case VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16:
+        case VK_FORMAT_G16B16G16R16_422_UNORM:
+            return {8, 2, 1, 1};
+        case VK_FORMAT_BC1_RGBA_SRGB_BLOCK:
+        case VK_FORMAT_BC1_RGBA_UNORM_BLOCK:
+        case VK_FORMAT_BC1_RGB_SRGB_BLOCK:
+        case VK_FORMAT_BC1_RGB_UNORM_BLOCK:
+        case VK_FORMAT_BC4_SNORM_BLOCK:
+        case VK_FORMAT_BC4_UNORM_BLOCK:
+        case VK_FORMAT_EAC_R11_SNORM_BLOCK:
+        case VK_FORMAT_EAC_R11_UNORM_BLOCK:
+        case VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK:
+        case VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK:
+        case VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK:
+        case VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK:
+        case VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG:
+        case VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG:
+        case VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG:
+        case VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG:
+            return {8, 4, 4, 1};
+        case VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG:
+        case VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG:
+        case VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG:
+        case VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG:
+            return {8, 8, 4, 1};
+        case VK_FORMAT_R32G32B32_SFLOAT:
+        case VK_FORMAT_R32G32B32_SINT:
+        case VK_FORMAT_R32G32B32_UINT:
+            return {12, 1, 1, 1};
+        case VK_FORMAT_R32G32B32A32_SFLOAT:
+        case VK_FORMAT_R32G32B32A32_SINT:
+        case VK_FORMAT_R32G32B32A32_UINT:
+        case VK_FORMAT_R64G64_SFLOAT:
+        case VK_FORMAT_R64G64_SINT:
+        case VK_FORMAT_R64G64_UINT:
+            return {16, 1, 1, 1};
+        case VK_FORMAT_ASTC_3x3x3_SFLOAT_BLOCK_EXT:
+        case VK_FORMAT_ASTC_3x3x3_SRGB_BLOCK_EXT:
+        case VK_FORMAT_ASTC_3x3x3_UNORM_BLOCK_EXT:
+            return {16, 3, 3, 3};
+        case VK_FORMAT_ASTC_4x3x3_SFLOAT_BLOCK_EXT:
+        case VK_FORMAT_ASTC_4x3x3_SRGB_BLOCK_EXT:
+        case VK_FORMAT_ASTC_4x3x3_UNORM_BLOCK_EXT:
+            return {16, 4, 3, 3};
+        case VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_4x4_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_4x4_UNORM_BLOCK:
+        case VK_FORMAT_BC2_SRGB_BLOCK:
+        case VK_FORMAT_BC2_UNORM_BLOCK:
+        case VK_FORMAT_BC3_SRGB_BLOCK:
+        case VK_FORMAT_BC3_UNORM_BLOCK:
+        case VK_FORMAT_BC5_SNORM_BLOCK:
+        case VK_FORMAT_BC5_UNORM_BLOCK:
+        case VK_FORMAT_BC6H_SFLOAT_BLOCK:
+        case VK_FORMAT_BC6H_UFLOAT_BLOCK:
+        case VK_FORMAT_BC7_SRGB_BLOCK:
+        case VK_FORMAT_BC7_UNORM_BLOCK:
+        case VK_FORMAT_EAC_R11G11_SNORM_BLOCK:
+        case VK_FORMAT_EAC_R11G11_UNORM_BLOCK:
+        case VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK:
+        case VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK:
+            return {16, 4, 4, 1};
+        case VK_FORMAT_ASTC_4x4x3_SFLOAT_BLOCK_EXT:
+        case VK_FORMAT_ASTC_4x4x3_SRGB_BLOCK_EXT:
+        case VK_FORMAT_ASTC_4x4x3_UNORM_BLOCK_EXT:
+            return {16, 4, 4, 3};
+        case VK_FORMAT_ASTC_4x4x4_SFLOAT_BLOCK_EXT:
+        case VK_FORMAT_ASTC_4x4x4_SRGB_BLOCK_EXT:
+        case VK_FORMAT_ASTC_4x4x4_UNORM_BLOCK_EXT:
+            return {16, 4, 4, 4};
+        case VK_FORMAT_ASTC_5x4_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_5x4_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_5x4_UNORM_BLOCK:
+            return {16, 5, 4, 1};
+        case VK_FORMAT_ASTC_5x4x4_SFLOAT_BLOCK_EXT:
+        case VK_FORMAT_ASTC_5x4x4_SRGB_BLOCK_EXT:
+        case VK_FORMAT_ASTC_5x4x4_UNORM_BLOCK_EXT:
+            return {16, 5, 4, 4};
+        case VK_FORMAT_ASTC_5x5_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_5x5_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_5x5_UNORM_BLOCK:
+            return {16, 5, 5, 1};
+        case VK_FORMAT_ASTC_5x5x4_SFLOAT_BLOCK_EXT:
+        case VK_FORMAT_ASTC_5x5x4_SRGB_BLOCK_EXT:
+        case VK_FORMAT_ASTC_5x5x4_UNORM_BLOCK_EXT:
+            return {16, 5, 5, 4};
+        case VK_FORMAT_ASTC_5x5x5_SFLOAT_BLOCK_EXT:
+        case VK_FORMAT_ASTC_5x5x5_SRGB_BLOCK_EXT:
+        case VK_FORMAT_ASTC_5x5x5_UNORM_BLOCK_EXT:
+            return {16, 5, 5, 5};
+        case VK_FORMAT_ASTC_6x5_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_6x5_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_6x5_UNORM_BLOCK:
+            return {16, 6, 5, 1};
+        case VK_FORMAT_ASTC_6x5x5_SFLOAT_BLOCK_EXT:
+        case VK_FORMAT_ASTC_6x5x5_SRGB_BLOCK_EXT:
+        case VK_FORMAT_ASTC_6x5x5_UNORM_BLOCK_EXT:
+            return {16, 6, 5, 5};
+        case VK_FORMAT_ASTC_6x6_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_6x6_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_6x6_UNORM_BLOCK:
+            return {16, 6, 6, 1};
+        case VK_FORMAT_ASTC_6x6x5_SFLOAT_BLOCK_EXT:
+        case VK_FORMAT_ASTC_6x6x5_SRGB_BLOCK_EXT:
+        case VK_FORMAT_ASTC_6x6x5_UNORM_BLOCK_EXT:
+            return {16, 6, 6, 5};
+        case VK_FORMAT_ASTC_6x6x6_SFLOAT_BLOCK_EXT:
+        case VK_FORMAT_ASTC_6x6x6_SRGB_BLOCK_EXT:
+        case VK_FORMAT_ASTC_6x6x6_UNORM_BLOCK_EXT:
+            return {16, 6, 6, 6};
+        case VK_FORMAT_ASTC_8x5_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_8x5_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_8x5_UNORM_BLOCK:
+            return {16, 8, 5, 1};
+        case VK_FORMAT_ASTC_8x6_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_8x6_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_8x6_UNORM_BLOCK:
+            return {16, 8, 6, 1};
+        case VK_FORMAT_ASTC_8x8_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_8x8_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_8x8_UNORM_BLOCK:
+            return {16, 8, 8, 1};
+        case VK_FORMAT_ASTC_10x5_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_10x5_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_10x5_UNORM_BLOCK:
+            return {16, 10, 5, 1};
+        case VK_FORMAT_ASTC_10x6_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_10x6_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_10x6_UNORM_BLOCK:
+            return {16, 10, 6, 1};
+        case VK_FORMAT_ASTC_10x8_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_10x8_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_10x8_UNORM_BLOCK:
+            return {16, 10, 8, 1};
+        case VK_FORMAT_ASTC_10x10_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_10x10_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_10x10_UNORM_BLOCK:
+            return {16, 10, 10, 1};
+        case VK_FORMAT_ASTC_12x10_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_12x10_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_12x10_UNORM_BLOCK:
+            return {16, 12, 10, 1};
+        case VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK:
+        case VK_FORMAT_ASTC_12x12_SRGB_BLOCK:
+        case VK_FORMAT_ASTC_12x12_UNORM_BLOCK:
+            return {16, 12, 12, 1};
+        case VK_FORMAT_R64G64B64_SFLOAT:
+        case VK_FORMAT_R64G64B64_SINT:
+        case VK_FORMAT_R64G64B64_UINT:
+            return {24, 1, 1, 1};
+        case VK_FORMAT_R64G64B64A64_SFLOAT:
+        case VK_FORMAT_R64G64B64A64_SINT:
+        case VK_FORMAT_R64G64B64A64_UINT:
+            return {32, 1, 1, 1};
+        default:
+            return {0, 1, 1, 1};
+    }
+}
+
+// Planes of a multi-planar format: 2 or 3, with components of 1 byte (8-bit) or 2 bytes (10 to 16-bit), and the chroma planes
+// subsampled by the given divisors. Single-plane formats report one plane.
+struct PlaneLayout {
+    uint32_t plane_count;
+    uint32_t component_size;
+    uint32_t chroma_width_divisor;
+    uint32_t chroma_height_divisor;
+};
+
+static PlaneLayout GetPlaneLayout(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16:
+        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16:
+        case VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM:
+            return {3, 2, 2, 2};
+        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16:
+        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16:
+        case VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM:
+            return {3, 2, 2, 1};
+        case VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16:
+        case VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16:
+        case VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM:
+            return {3, 2, 1, 1};
+        case VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM:
+            return {3, 1, 2, 2};
+        case VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM:
+            return {3, 1, 2, 1};
+        case VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM:
+            return {3, 1, 1, 1};
+        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16:
+        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16:
+        case VK_FORMAT_G14X2_B14X2R14X2_2PLANE_420_UNORM_3PACK16_ARM:
+        case VK_FORMAT_G16_B16R16_2PLANE_420_UNORM:
+            return {2, 2, 2, 2};
+        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16:
+        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16:
+        case VK_FORMAT_G14X2_B14X2R14X2_2PLANE_422_UNORM_3PACK16_ARM:
+        case VK_FORMAT_G16_B16R16_2PLANE_422_UNORM:
+            return {2, 2, 2, 1};
+        case VK_FORMAT_G10X6_B10X6R10X6_2PLANE_444_UNORM_3PACK16:
+        case VK_FORMAT_G12X4_B12X4R12X4_2PLANE_444_UNORM_3PACK16:
+        case VK_FORMAT_G16_B16R16_2PLANE_444_UNORM:
+            return {2, 2, 1, 1};
+        case VK_FORMAT_G8_B8R8_2PLANE_420_UNORM:
+            return {2, 1, 2, 2};
+        case VK_FORMAT_G8_B8R8_2PLANE_422_UNORM:
+            return {2, 1, 2, 1};
+        case VK_FORMAT_G8_B8R8_2PLANE_444_UNORM:
+            return {2, 1, 1, 1};
+        default:
+            return {1, 0, 1, 1};
+    }
+}
+
 static VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreateInfo,
                                                      const VkAllocationCallbacks* pAllocator, VkInstance* pInstance);
 
@@ -31,19 +31,49 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo*
     if (loader_interface_version <= 4) {
         return VK_ERROR_INCOMPATIBLE_DRIVER;
     }
-    *pInstance = (VkInstance)CreateDispObjHandle();
-    for (auto& physical_device : physical_device_map[*pInstance]) physical_device = (VkPhysicalDevice)CreateDispObjHandle();
+    *pInstance = (VkInstance)CreateDispObjHandle(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (!*pInstance) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    unique_lock_t lock(global_lock);
+    const HostAllocator<VkDisplayKHR> instance_allocator(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    auto& physical_devices = physical_device_map[*pInstance];
+    try {
+        for (auto& physical_device : physical_devices) {
+            physical_device = (VkPhysicalDevice)CreateDispObjHandle(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (!physical_device) {
+                throw std::bad_alloc();
+            }
+            display_map[physical_device] = host_unordered_set<VkDisplayKHR>(instance_allocator);
+        }
+    } catch (const std::bad_alloc&) {
+        for (const auto physical_device : physical_devices) {
+            if (physical_device) {
+                display_map.erase(physical_device);
+                DestroyDispObjHandle((void*)physical_device);
+            }
+        }
+        physical_device_map.erase(*pInstance);
+        DestroyDispObjHandle((void*)*pInstance);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    CensusAdd(CensusType::Instance);
+    CensusAdd(CensusType::PhysicalDevice, icd_physical_device_count);
     // TODO: If emulating specific device caps, will need to add intelligence here
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocationCallbacks* pAllocator) {
     if (instance) {
+        unique_lock_t lock(global_lock);
         for (const auto physical_device : physical_device_map.at(instance)) {
             display_map.erase(physical_device);
             DestroyDispObjHandle((void*)physical_device);
         }
         physical_device_map.erase(instance);
         DestroyDispObjHandle((void*)instance);
+        CensusRemove(CensusType::PhysicalDevice, icd_physical_device_count);
+        CensusRemove(CensusType::Instance);
+        ReportObjectCensus("vkDestroyInstance");
     }
 }
 static VKAPI_ATTR VkResult VKAPI_CALL EnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount,
@@ -185,7 +215,54 @@ static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice devic
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo* pCreateInfo,
                                                    const VkAllocationCallbacks* pAllocator, VkDevice* pDevice) {
-    *pDevice = (VkDevice)CreateDispObjHandle();
+    *pDevice = (VkDevice)CreateDispObjHandle(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+    if (!*pDevice) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    // Per-device bookkeeping is charged to the device's allocation callbacks
+    unique_lock_t lock(global_lock);
+    const HostAllocator<VkDevice> device_allocator(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+    try {
+        queue_map[*pDevice] = host_unordered_map<uint64_t, VkQueue>(device_allocator);
+        buffer_map[*pDevice] = host_unordered_map<VkBuffer, BufferState>(device_allocator);
+        image_memory_size_map[*pDevice] = host_unordered_map<VkImage, VkDeviceSize>(device_allocator);
+        image_create_info_map[*pDevice] = host_unordered_map<VkImage, VkImageCreateInfo>(device_allocator);
+        command_pool_map[*pDevice] = host_unordered_set<VkCommandPool>(device_allocator);
+        // The queues the device is created with exist from the start, since vkGetDeviceQueue can't report a failure
+        auto& queues = queue_map[*pDevice];
+        for (uint32_t i = 0; i < pCreateInfo->queueCreateInfoCount; ++i) {
+            const VkDeviceQueueCreateInfo& queue_create_info = pCreateInfo->pQueueCreateInfos[i];
+            for (uint32_t queue_index = 0; queue_index < queue_create_info.queueCount; ++queue_index) {
+                auto& queue = queues[QueueKey(queue_create_info.queueFamilyIndex, queue_index)];
+                if (queue) {
+                    continue;
+                }
+                queue = (VkQueue)CreateDispObjHandle(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+                if (!queue) {
+                    throw std::bad_alloc();
+                }
+                CensusAdd(CensusType::Queue);
+            }
+        }
+    } catch (const std::bad_alloc&) {
+        auto queues = queue_map.find(*pDevice);
+        if (queues != queue_map.end()) {
+            for (const auto& queue_pair : queues->second) {
+                if (queue_pair.second) {
+                    DestroyDispObjHandle((void*)queue_pair.second);
+                    CensusRemove(CensusType::Queue);
+                }
+            }
+            queue_map.erase(queues);
+        }
+        buffer_map.erase(*pDevice);
+        image_memory_size_map.erase(*pDevice);
+        image_create_info_map.erase(*pDevice);
+        command_pool_map.erase(*pDevice);
+        DestroyDispObjHandle((void*)*pDevice);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    CensusAdd(CensusType::Device);
     // TODO: If emulating specific device caps, will need to add intelligence here
     return VK_SUCCESS;
 }
@@ -193,25 +270,31 @@ static VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocat
     unique_lock_t lock(global_lock);
     // First destroy sub-device objects
     // Destroy Queues
-    for (auto queue_family_map_pair : queue_map[device]) {
-        for (auto index_queue_pair : queue_map[device][queue_family_map_pair.first]) {
-            DestroyDispObjHandle((void*)index_queue_pair.second);
-        }
+    for (const auto& queue_pair : queue_map[device]) {
+        DestroyDispObjHandle((void*)queue_pair.second);
+        CensusRemove(CensusType::Queue);
     }
 
     for (auto& cp : command_pool_map[device]) {
         for (auto& cb : command_pool_buffer_map[cp]) {
-            DestroyDispObjHandle((void*)cb);
+            DestroyCommandBufferHandle(cb);
         }
         command_pool_buffer_map.erase(cp);
     }
-    command_pool_map[device].clear();
+
+    // Page tables of leaked sparse resources hold the device's allocation callbacks
+    for (const auto& buffer : buffer_map[device]) sparse_page_tables.erase((uint64_t)buffer.first);
+    for (const auto& image : image_memory_size_map[device]) sparse_page_tables.erase((uint64_t)image.first);
 
     queue_map.erase(device);
     buffer_map.erase(device);
     image_memory_size_map.erase(device);
+    image_create_info_map.erase(device);
+    command_pool_map.erase(device);
     // Now destroy device
     DestroyDispObjHandle((void*)device);
+    CensusRemove(CensusType::Device);
+    ReportObjectCensus("vkDestroyDevice");
     // TODO: If emulating specific device caps, will need to add intelligence here
 }
 static VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceExtensionProperties(const char* pLayerName, uint32_t* pPropertyCount,
@@ -275,11 +358,16 @@ static VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceLayerProperties(VkPhysicalD
 }
 static VKAPI_ATTR void VKAPI_CALL GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
     unique_lock_t lock(global_lock);
-    auto queue = queue_map[device][queueFamilyIndex][queueIndex];
-    if (queue) {
+    // Queues the device wasn't created with are made on first use, which returns no queue if that runs out of host memory
+    try {
+        auto& queue = queue_map[device][QueueKey(queueFamilyIndex, queueIndex)];
+        if (!queue) {
+            queue = (VkQueue)CreateDispObjHandle(GetDispObjAllocator(device), VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+            if (queue) CensusAdd(CensusType::Queue);
+        }
         *pQueue = queue;
-    } else {
-        *pQueue = queue_map[device][queueFamilyIndex][queueIndex] = (VkQueue)CreateDispObjHandle();
+    } catch (const std::bad_alloc&) {
+        *pQueue = VK_NULL_HANDLE;
     }
     // TODO: If emulating specific device caps, will need to add intelligence here
     return;
@@ -296,6 +384,22 @@ static VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(VkQueue queue, uint32_t submit
             return VK_ERROR_DEVICE_LOST;
         }
     }
+    // Submissions execute synchronously: waits, recorded event commands and signals take effect in submission order
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        const VkSubmitInfo& submit = pSubmits[i];
+        const auto* timeline_info = lvl_find_in_chain<VkTimelineSemaphoreSubmitInfo>(submit.pNext);
+        for (uint32_t j = 0; j < submit.waitSemaphoreCount; ++j) {
+            ConsumeSemaphoreState(submit.pWaitSemaphores[j]);
+        }
+        for (uint32_t j = 0; j < submit.commandBufferCount; ++j) {
+            ExecuteRecordedCommands(submit.pCommandBuffers[j]);
+        }
+        for (uint32_t j = 0; j < submit.signalSemaphoreCount; ++j) {
+            const bool has_value =
+                timeline_info && timeline_info->pSignalSemaphoreValues && j < timeline_info->signalSemaphoreValueCount;
+            SignalSemaphoreState(submit.pSignalSemaphores[j], has_value ? timeline_info->pSignalSemaphoreValues[j] : 0);
+        }
+    }
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL QueueWaitIdle(VkQueue queue) {
@@ -310,14 +414,24 @@ static VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(VkDevice device, const VkMe
                                                      const VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
     unique_lock_t lock(global_lock);
     allocated_memory_size_map[(VkDeviceMemory)global_unique_handle] = pAllocateInfo->allocationSize;
+    try {
+        mapped_memory_map[(VkDeviceMemory)global_unique_handle] =
+            host_vector<void*>(HostAllocator<void*>(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));
+    } catch (const std::bad_alloc&) {
+        allocated_memory_size_map.erase((VkDeviceMemory)global_unique_handle);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
     *pMemory = (VkDeviceMemory)global_unique_handle++;
+    CensusAdd(CensusType::DeviceMemory);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (memory) CensusRemove(CensusType::DeviceMemory);
     UnmapMemory(device, memory);
     unique_lock_t lock(global_lock);
     allocated_memory_size_map.erase(memory);
+    mapped_memory_map.erase(memory);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size,
                                                 VkMemoryMapFlags flags, void** ppData) {
@@ -328,17 +442,30 @@ static VKAPI_ATTR VkResult VKAPI_CALL MapMemory(VkDevice device, VkDeviceMemory
         else
             size = 0x10000;
     }
-    void* map_addr = malloc((size_t)size);
-    mapped_memory_map[memory].push_back(map_addr);
+    // Mappings are charged to the allocation callbacks the memory object was allocated with
+    auto& mappings = mapped_memory_map[memory];
+    void* map_addr = HostAllocate(mappings.get_allocator().callbacks(), (size_t)size, 64, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    if (!map_addr) {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+    try {
+        mappings.push_back(map_addr);
+    } catch (const std::bad_alloc&) {
+        HostFree(mappings.get_allocator().callbacks(), map_addr);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
     *ppData = map_addr;
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL UnmapMemory(VkDevice device, VkDeviceMemory memory) {
     unique_lock_t lock(global_lock);
-    for (auto map_addr : mapped_memory_map[memory]) {
-        free(map_addr);
+    auto it = mapped_memory_map.find(memory);
+    if (it != mapped_memory_map.end()) {
+        for (auto map_addr : it->second) {
+            HostFree(it->second.get_allocator().callbacks(), map_addr);
+        }
+        it->second.clear();
     }
-    mapped_memory_map.erase(memory);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount,
                                                               const VkMappedMemoryRange* pMemoryRanges) {
@@ -377,6 +504,11 @@ static VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements(VkDevice device, V
         auto iter = d_iter->second.find(buffer);
         if (iter != d_iter->second.end()) {
             pMemoryRequirements->size = ((iter->second.size + 4095) / 4096) * 4096;
+            // Sparse buffers are bound a whole page at a time
+            if (iter->second.flags & VK_BUFFER_CREATE_SPARSE_BINDING_BIT) {
+                pMemoryRequirements->size = (iter->second.size + sparse_page_size - 1) / sparse_page_size * sparse_page_size;
+                pMemoryRequirements->alignment = sparse_page_size;
+            }
         }
     }
 }
@@ -393,25 +525,38 @@ static VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements(VkDevice device, Vk
             pMemoryRequirements->size = iter->second;
         }
     }
+    // Sparse images are bound a whole page at a time
+    auto info_iter = image_create_info_map.find(device);
+    if (info_iter != image_create_info_map.end()) {
+        auto iter = info_iter->second.find(image);
+        if (iter != info_iter->second.end() && (iter->second.flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT)) {
+            pMemoryRequirements->alignment = sparse_page_size;
+        }
+    }
     // Here we hard-code that the memory type at index 3 doesn't support this image.
     pMemoryRequirements->memoryTypeBits = 0xFFFF & ~(0x1 << 3);
 }
 static VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements(VkDevice device, VkImage image,
                                                                    uint32_t* pSparseMemoryRequirementCount,
                                                                    VkSparseImageMemoryRequirements* pSparseMemoryRequirements) {
-    if (!pSparseMemoryRequirements) {
+    // Only images with a standard sparse block shape have requirements
+    VkSparseImageMemoryRequirements requirements{};
+    bool supported = false;
+    {
+        unique_lock_t lock(global_lock);
+        auto d_iter = image_create_info_map.find(device);
+        if (d_iter != image_create_info_map.end()) {
+            auto iter = d_iter->second.find(image);
+            supported = iter != d_iter->second.end() && GetSparseImageMemoryRequirements(iter->second, &requirements);
+        }
+    }
+    if (!supported) {
+        *pSparseMemoryRequirementCount = 0;
+    } else if (!pSparseMemoryRequirements) {
+        *pSparseMemoryRequirementCount = 1;
+    } else if (*pSparseMemoryRequirementCount > 0) {
+        *pSparseMemoryRequirements = requirements;
         *pSparseMemoryRequirementCount = 1;
-    } else {
-        // arbitrary
-        pSparseMemoryRequirements->imageMipTailFirstLod = 0;
-        pSparseMemoryRequirements->imageMipTailSize = 8;
-        pSparseMemoryRequirements->imageMipTailOffset = 0;
-        pSparseMemoryRequirements->imageMipTailStride = 4;
-        pSparseMemoryRequirements->formatProperties.imageGranularity = {4, 4, 4};
-        pSparseMemoryRequirements->formatProperties.flags = VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT;
-        // Would need to track the VkImage to know format for better value here
-        pSparseMemoryRequirements->formatProperties.aspectMask =
-            VK_IMAGE_ASPECT_COLOR_BIT | VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT | VK_IMAGE_ASPECT_METADATA_BIT;
     }
 }
 static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format,
@@ -419,45 +564,74 @@ static VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties(V
                                                                                VkImageUsageFlags usage, VkImageTiling tiling,
                                                                                uint32_t* pPropertyCount,
                                                                                VkSparseImageFormatProperties* pProperties) {
-    if (!pProperties) {
+    VkExtent3D granularity{};
+    if (!GetStandardSparseImageGranularity(format, type, samples, &granularity)) {
+        *pPropertyCount = 0;
+    } else if (!pProperties) {
         *pPropertyCount = 1;
-    } else {
-        // arbitrary
-        pProperties->imageGranularity = {4, 4, 4};
+    } else if (*pPropertyCount > 0) {
+        pProperties->imageGranularity = granularity;
         pProperties->flags = VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT;
-        switch (format) {
-            case VK_FORMAT_D16_UNORM:
-            case VK_FORMAT_D32_SFLOAT:
-                pProperties->aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
-                break;
-            case VK_FORMAT_S8_UINT:
-                pProperties->aspectMask = VK_IMAGE_ASPECT_STENCIL_BIT;
-                break;
-            case VK_FORMAT_X8_D24_UNORM_PACK32:
-            case VK_FORMAT_D16_UNORM_S8_UINT:
-            case VK_FORMAT_D24_UNORM_S8_UINT:
-            case VK_FORMAT_D32_SFLOAT_S8_UINT:
-                pProperties->aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
-                break;
-            default:
-                pProperties->aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-                break;
-        }
+        pProperties->aspectMask = GetFormatAspectMask(format);
+        *pPropertyCount = 1;
     }
 }
 static VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo* pBindInfo,
                                                       VkFence fence) {
-    // Not a CREATE or DESTROY function
+    // Binds are applied in order and take effect immediately, like the rest of the mock's queue work
+    unique_lock_t lock(global_lock);
+    const VkDevice device = GetQueueDevice(queue);
+    ++sparse_bind_stats.bind_sparse_calls;
+    sparse_bind_stats.bind_infos += bindInfoCount;
+    for (uint32_t i = 0; i < bindInfoCount; ++i) {
+        const VkBindSparseInfo& bind_info = pBindInfo[i];
+        const auto* timeline_info = lvl_find_in_chain<VkTimelineSemaphoreSubmitInfo>(bind_info.pNext);
+        for (uint32_t j = 0; j < bind_info.waitSemaphoreCount; ++j) {
+            ConsumeSemaphoreState(bind_info.pWaitSemaphores[j]);
+        }
+        for (uint32_t j = 0; j < bind_info.bufferBindCount; ++j) {
+            const VkSparseBufferMemoryBindInfo& buffer_bind = bind_info.pBufferBinds[j];
+            sparse_bind_stats.bind_ranges += buffer_bind.bindCount;
+            for (uint32_t k = 0; k < buffer_bind.bindCount; ++k) {
+                const VkSparseMemoryBind& bind = buffer_bind.pBinds[k];
+                if (!BindSparsePages(device, (uint64_t)buffer_bind.buffer, bind.resourceOffset / sparse_page_size,
+                                     (bind.size + sparse_page_size - 1) / sparse_page_size, bind.memory, bind.memoryOffset)) {
+                    return VK_ERROR_OUT_OF_HOST_MEMORY;
+                }
+            }
+        }
+        for (uint32_t j = 0; j < bind_info.imageOpaqueBindCount; ++j) {
+            const VkSparseImageOpaqueMemoryBindInfo& image_bind = bind_info.pImageOpaqueBinds[j];
+            sparse_bind_stats.bind_ranges += image_bind.bindCount;
+            for (uint32_t k = 0; k < image_bind.bindCount; ++k) {
+                const VkSparseMemoryBind& bind = image_bind.pBinds[k];
+                if (!BindSparsePages(device, (uint64_t)image_bind.image, bind.resourceOffset / sparse_page_size,
+                                     (bind.size + sparse_page_size - 1) / sparse_page_size, bind.memory, bind.memoryOffset)) {
+                    return VK_ERROR_OUT_OF_HOST_MEMORY;
+                }
+            }
+        }
+        for (uint32_t j = 0; j < bind_info.imageBindCount; ++j) {
+            if (!BindSparseImagePages(device, bind_info.pImageBinds[j])) return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        for (uint32_t j = 0; j < bind_info.signalSemaphoreCount; ++j) {
+            const bool has_value =
+                timeline_info && timeline_info->pSignalSemaphoreValues && j < timeline_info->signalSemaphoreValueCount;
+            SignalSemaphoreState(bind_info.pSignalSemaphores[j], has_value ? timeline_info->pSignalSemaphoreValues[j] : 0);
+        }
+    }
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateFence(VkDevice device, const VkFenceCreateInfo* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
     unique_lock_t lock(global_lock);
     *pFence = (VkFence)global_unique_handle++;
+    CensusAdd(CensusType::Fence);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (fence) CensusRemove(CensusType::Fence);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL ResetFences(VkDevice device, uint32_t fenceCount, const VkFence* pFences) {
     // Not a CREATE or DESTROY function
@@ -474,23 +648,37 @@ static VKAPI_ATTR VkResult VKAPI_CALL WaitForFences(VkDevice device, uint32_t fe
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo* pCreateInfo,
                                                       const VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) {
-    unique_lock_t lock(global_lock);
-    *pSemaphore = (VkSemaphore)global_unique_handle++;
+    auto state = CreateSyncObject<SemaphoreState>(pAllocator);
+    if (!state) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    const auto* type_info = lvl_find_in_chain<VkSemaphoreTypeCreateInfo>(pCreateInfo->pNext);
+    if (type_info && type_info->semaphoreType == VK_SEMAPHORE_TYPE_TIMELINE) {
+        state->timeline = true;
+        state->value.store(type_info->initialValue, std::memory_order_relaxed);
+    }
+    *pSemaphore = reinterpret_cast<VkSemaphore>(state);
+    CensusAdd(CensusType::Semaphore);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice device, VkSemaphore semaphore,
                                                    const VkAllocationCallbacks* pAllocator) {
-    // Destroy object
+    if (semaphore) {
+        DestroySyncObject(GetSyncObject<SemaphoreState>(semaphore));
+        CensusRemove(CensusType::Semaphore);
+    }
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo* pCreateInfo,
                                                       const VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) {
     unique_lock_t lock(global_lock);
     *pQueryPool = (VkQueryPool)global_unique_handle++;
+    CensusAdd(CensusType::QueryPool);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(VkDevice device, VkQueryPool queryPool,
                                                    const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (queryPool) CensusRemove(CensusType::QueryPool);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery,
                                                           uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride,
@@ -502,50 +690,91 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(VkDevice device, const VkBuff
                                                    const VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) {
     unique_lock_t lock(global_lock);
     *pBuffer = (VkBuffer)global_unique_handle++;
-    buffer_map[device][*pBuffer] = {pCreateInfo->size, current_available_address};
+    try {
+        buffer_map[device][*pBuffer] = {pCreateInfo->size, current_available_address, pCreateInfo->flags};
+    } catch (const std::bad_alloc&) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
     current_available_address += pCreateInfo->size;
     // Always align to next 64-bit pointer
     const uint64_t alignment = current_available_address % 64;
     if (alignment != 0) {
         current_available_address += (64 - alignment);
     }
+    CensusAdd(CensusType::Buffer);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks* pAllocator) {
     unique_lock_t lock(global_lock);
     buffer_map[device].erase(buffer);
+    sparse_page_tables.erase((uint64_t)buffer);
+    if (buffer) CensusRemove(CensusType::Buffer);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateImage(VkDevice device, const VkImageCreateInfo* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkImage* pImage) {
     unique_lock_t lock(global_lock);
     *pImage = (VkImage)global_unique_handle++;
-    image_memory_size_map[device][*pImage] = GetImageSizeFromCreateInfo(pCreateInfo);
+    try {
+        image_memory_size_map[device][*pImage] = GetImageSizeFromCreateInfo(pCreateInfo);
+        VkImageCreateInfo& create_info = image_create_info_map[device][*pImage];
+        create_info = *pCreateInfo;
+        create_info.pNext = nullptr;
+        create_info.queueFamilyIndexCount = 0;
+        create_info.pQueueFamilyIndices = nullptr;
+    } catch (const std::bad_alloc&) {
+        image_memory_size_map[device].erase(*pImage);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    CensusAdd(CensusType::Image);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks* pAllocator) {
     unique_lock_t lock(global_lock);
     image_memory_size_map[device].erase(image);
+    image_create_info_map[device].erase(image);
+    sparse_page_tables.erase((uint64_t)image);
+    if (image) CensusRemove(CensusType::Image);
 }
 static VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource* pSubresource,
                                                             VkSubresourceLayout* pLayout) {
     // Need safe values. Callers are computing memory offsets from pLayout, with no return code to flag failure.
     *pLayout = VkSubresourceLayout();  // Default constructor zero values.
+    unique_lock_t lock(global_lock);
+    auto d_iter = image_create_info_map.find(device);
+    if (d_iter != image_create_info_map.end()) {
+        auto iter = d_iter->second.find(image);
+        if (iter != d_iter->second.end()) {
+            *pLayout = GetLinearSubresourceLayout(iter->second, pSubresource->aspectMask, pSubresource->mipLevel,
+                                                  pSubresource->arrayLayer);
+        }
+    }
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(VkDevice device, const VkImageViewCreateInfo* pCreateInfo,
                                                       const VkAllocationCallbacks* pAllocator, VkImageView* pView) {
     unique_lock_t lock(global_lock);
     *pView = (VkImageView)global_unique_handle++;
+    CensusAdd(CensusType::ImageView);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyImageView(VkDevice device, VkImageView imageView,
                                                    const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (imageView) CensusRemove(CensusType::ImageView);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) {
     unique_lock_t lock(global_lock);
     *pCommandPool = (VkCommandPool)global_unique_handle++;
-    command_pool_map[device].insert(*pCommandPool);
+    const HostAllocator<VkCommandBuffer> pool_allocator(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    try {
+        command_pool_map[device].insert(*pCommandPool);
+        command_pool_buffer_map[*pCommandPool] = host_vector<VkCommandBuffer>(pool_allocator);
+    } catch (const std::bad_alloc&) {
+        command_pool_map[device].erase(*pCommandPool);
+        command_pool_buffer_map.erase(*pCommandPool);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    CensusAdd(CensusType::CommandPool);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandPool commandPool,
@@ -555,23 +784,52 @@ static VKAPI_ATTR void VKAPI_CALL DestroyCommandPool(VkDevice device, VkCommandP
     auto it = command_pool_buffer_map.find(commandPool);
     if (it != command_pool_buffer_map.end()) {
         for (auto& cb : it->second) {
-            DestroyDispObjHandle((void*)cb);
+            DestroyCommandBufferHandle(cb);
         }
+        CensusRemove(CensusType::CommandBuffer, it->second.size());
         command_pool_buffer_map.erase(it);
     }
     command_pool_map[device].erase(commandPool);
+    if (commandPool) CensusRemove(CensusType::CommandPool);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL ResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
-    // Not a CREATE or DESTROY function
+    unique_lock_t lock(global_lock);
+    auto it = command_pool_buffer_map.find(commandPool);
+    if (it != command_pool_buffer_map.end()) {
+        for (auto& cb : it->second) {
+            ResetRecordedCommands(cb);
+        }
+    }
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo* pAllocateInfo,
                                                              VkCommandBuffer* pCommandBuffers) {
     unique_lock_t lock(global_lock);
+    auto& command_buffers = command_pool_buffer_map[pAllocateInfo->commandPool];
+    try {
+        command_buffers.reserve(command_buffers.size() + pAllocateInfo->commandBufferCount);
+    } catch (const std::bad_alloc&) {
+        for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+            pCommandBuffers[i] = VK_NULL_HANDLE;
+        }
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
     for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
-        pCommandBuffers[i] = (VkCommandBuffer)CreateDispObjHandle();
-        command_pool_buffer_map[pAllocateInfo->commandPool].push_back(pCommandBuffers[i]);
+        pCommandBuffers[i] = (VkCommandBuffer)CreateCommandBufferHandle(command_buffers.get_allocator().callbacks());
+        if (!pCommandBuffers[i]) {
+            // Either all of the command buffers are allocated or none of them
+            for (uint32_t j = 0; j < i; ++j) {
+                DestroyCommandBufferHandle(pCommandBuffers[j]);
+            }
+            for (uint32_t j = 0; j < pAllocateInfo->commandBufferCount; ++j) {
+                pCommandBuffers[j] = VK_NULL_HANDLE;
+            }
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
     }
+    // The storage was reserved above, so this can't throw
+    command_buffers.insert(command_buffers.end(), pCommandBuffers, pCommandBuffers + pAllocateInfo->commandBufferCount);
+    CensusAdd(CensusType::CommandBuffer, pAllocateInfo->commandBufferCount);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount,
@@ -590,20 +848,21 @@ static VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandP
             }
         }
 
-        DestroyDispObjHandle((void*)pCommandBuffers[i]);
+        DestroyCommandBufferHandle(pCommandBuffers[i]);
+        CensusRemove(CensusType::CommandBuffer);
     }
 }
 static VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
                                                          const VkCommandBufferBeginInfo* pBeginInfo) {
-    // Not a CREATE or DESTROY function
+    // Beginning a command buffer implicitly resets it
+    ResetRecordedCommands(commandBuffer);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL EndCommandBuffer(VkCommandBuffer commandBuffer) {
-    // Not a CREATE or DESTROY function
-    return VK_SUCCESS;
+    return GetCommandBufferObj(commandBuffer)->out_of_host_memory ? VK_ERROR_OUT_OF_HOST_MEMORY : VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
-    // Not a CREATE or DESTROY function
+    ResetRecordedCommands(commandBuffer);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer,
@@ -664,59 +923,73 @@ static VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer comman
 }
 static VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount,
                                                      const VkCommandBuffer* pCommandBuffers) {
-    // Not a CREATE or DESTROY function
+    for (uint32_t i = 0; i < commandBufferCount; ++i) {
+        RecordCommand(commandBuffer, {VK_NULL_HANDLE, false, pCommandBuffers[i]});
+    }
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(VkDevice device, const VkEventCreateInfo* pCreateInfo,
                                                   const VkAllocationCallbacks* pAllocator, VkEvent* pEvent) {
-    unique_lock_t lock(global_lock);
-    *pEvent = (VkEvent)global_unique_handle++;
+    auto state = CreateSyncObject<EventState>(pAllocator);
+    if (!state) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    *pEvent = reinterpret_cast<VkEvent>(state);
+    CensusAdd(CensusType::Event);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks* pAllocator) {
-    // Destroy object
+    if (event) {
+        DestroySyncObject(GetSyncObject<EventState>(event));
+        CensusRemove(CensusType::Event);
+    }
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetEventStatus(VkDevice device, VkEvent event) {
-    // Not a CREATE or DESTROY function
-    return VK_EVENT_SET;
+    return GetSyncObject<EventState>(event)->signaled.load(std::memory_order_acquire) ? VK_EVENT_SET : VK_EVENT_RESET;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL SetEvent(VkDevice device, VkEvent event) {
-    // Not a CREATE or DESTROY function
+    SetEventState(event, true);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL ResetEvent(VkDevice device, VkEvent event) {
-    // Not a CREATE or DESTROY function
+    SetEventState(event, false);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(VkDevice device, const VkBufferViewCreateInfo* pCreateInfo,
                                                        const VkAllocationCallbacks* pAllocator, VkBufferView* pView) {
     unique_lock_t lock(global_lock);
     *pView = (VkBufferView)global_unique_handle++;
+    CensusAdd(CensusType::BufferView);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyBufferView(VkDevice device, VkBufferView bufferView,
                                                     const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (bufferView) CensusRemove(CensusType::BufferView);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo* pCreateInfo,
                                                          const VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) {
     unique_lock_t lock(global_lock);
     *pShaderModule = (VkShaderModule)global_unique_handle++;
+    CensusAdd(CensusType::ShaderModule);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(VkDevice device, VkShaderModule shaderModule,
                                                       const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (shaderModule) CensusRemove(CensusType::ShaderModule);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo* pCreateInfo,
                                                           const VkAllocationCallbacks* pAllocator,
                                                           VkPipelineCache* pPipelineCache) {
     unique_lock_t lock(global_lock);
     *pPipelineCache = (VkPipelineCache)global_unique_handle++;
+    CensusAdd(CensusType::PipelineCache);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache,
                                                        const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (pipelineCache) CensusRemove(CensusType::PipelineCache);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize,
                                                            void* pData) {
@@ -736,56 +1009,76 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(VkDevice device, Vk
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pPipelines[i] = (VkPipeline)global_unique_handle++;
     }
+    CensusAdd(CensusType::Pipeline, createInfoCount);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (pipeline) CensusRemove(CensusType::Pipeline);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator,
                                                            VkPipelineLayout* pPipelineLayout) {
     unique_lock_t lock(global_lock);
     *pPipelineLayout = (VkPipelineLayout)global_unique_handle++;
+    CensusAdd(CensusType::PipelineLayout);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout,
                                                         const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (pipelineLayout) CensusRemove(CensusType::PipelineLayout);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(VkDevice device, const VkSamplerCreateInfo* pCreateInfo,
                                                     const VkAllocationCallbacks* pAllocator, VkSampler* pSampler) {
     unique_lock_t lock(global_lock);
     *pSampler = (VkSampler)global_unique_handle++;
+    CensusAdd(CensusType::Sampler);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (sampler) CensusRemove(CensusType::Sampler);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo* pCreateInfo,
                                                                 const VkAllocationCallbacks* pAllocator,
                                                                 VkDescriptorSetLayout* pSetLayout) {
     unique_lock_t lock(global_lock);
     *pSetLayout = (VkDescriptorSetLayout)global_unique_handle++;
+    CensusAdd(CensusType::DescriptorSetLayout);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout,
                                                              const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (descriptorSetLayout) CensusRemove(CensusType::DescriptorSetLayout);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo* pCreateInfo,
                                                            const VkAllocationCallbacks* pAllocator,
                                                            VkDescriptorPool* pDescriptorPool) {
     unique_lock_t lock(global_lock);
     *pDescriptorPool = (VkDescriptorPool)global_unique_handle++;
+    CensusAdd(CensusType::DescriptorPool);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                         const VkAllocationCallbacks* pAllocator) {
-    // Destroy object
+    if (descriptorPool) CensusRemove(CensusType::DescriptorPool);
+    unique_lock_t lock(global_lock);
+    auto it = descriptor_pool_set_count_map.find(descriptorPool);
+    if (it != descriptor_pool_set_count_map.end()) {
+        CensusRemove(CensusType::DescriptorSet, it->second);
+        descriptor_pool_set_count_map.erase(it);
+    }
 }
 static VKAPI_ATTR VkResult VKAPI_CALL ResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
                                                           VkDescriptorPoolResetFlags flags) {
-    // Not a CREATE or DESTROY function
+    unique_lock_t lock(global_lock);
+    auto it = descriptor_pool_set_count_map.find(descriptorPool);
+    if (it != descriptor_pool_set_count_map.end()) {
+        CensusRemove(CensusType::DescriptorSet, it->second);
+        it->second = 0;
+    }
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo* pAllocateInfo,
@@ -794,11 +1087,19 @@ static VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(VkDevice device, co
     for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i) {
         pDescriptorSets[i] = (VkDescriptorSet)global_unique_handle++;
     }
+    descriptor_pool_set_count_map[pAllocateInfo->descriptorPool] += pAllocateInfo->descriptorSetCount;
+    CensusAdd(CensusType::DescriptorSet, pAllocateInfo->descriptorSetCount);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL FreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool,
                                                          uint32_t descriptorSetCount, const VkDescriptorSet* pDescriptorSets) {
-    // Destroy object
+    uint64_t freed = 0;
+    for (uint32_t i = 0; i < descriptorSetCount; ++i) {
+        if (pDescriptorSets[i]) ++freed;
+    }
+    unique_lock_t lock(global_lock);
+    descriptor_pool_set_count_map[descriptorPool] -= freed;
+    CensusRemove(CensusType::DescriptorSet, freed);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount,
@@ -829,10 +1130,10 @@ static VKAPI_ATTR void VKAPI_CALL CmdDispatchIndirect(VkCommandBuffer commandBuf
     // Not a CREATE or DESTROY function
 }
 static VKAPI_ATTR void VKAPI_CALL CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
-    // Not a CREATE or DESTROY function
+    RecordCommand(commandBuffer, {event, true, VK_NULL_HANDLE});
 }
 static VKAPI_ATTR void VKAPI_CALL CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
-    // Not a CREATE or DESTROY function
+    RecordCommand(commandBuffer, {event, false, VK_NULL_HANDLE});
 }
 static VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                                 VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask,
@@ -856,27 +1157,32 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, V
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pPipelines[i] = (VkPipeline)global_unique_handle++;
     }
+    CensusAdd(CensusType::Pipeline, createInfoCount);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo* pCreateInfo,
                                                         const VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
     unique_lock_t lock(global_lock);
     *pFramebuffer = (VkFramebuffer)global_unique_handle++;
+    CensusAdd(CensusType::Framebuffer);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer,
                                                      const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (framebuffer) CensusRemove(CensusType::Framebuffer);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderPassCreateInfo* pCreateInfo,
                                                        const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
     unique_lock_t lock(global_lock);
     *pRenderPass = (VkRenderPass)global_unique_handle++;
+    CensusAdd(CensusType::RenderPass);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(VkDevice device, VkRenderPass renderPass,
                                                     const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (renderPass) CensusRemove(CensusType::RenderPass);
 }
 static VKAPI_ATTR void VKAPI_CALL GetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) {
     pGranularity->width = 1;
@@ -1097,12 +1403,14 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(VkDevice de
                                                                      VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
     unique_lock_t lock(global_lock);
     *pDescriptorUpdateTemplate = (VkDescriptorUpdateTemplate)global_unique_handle++;
+    CensusAdd(CensusType::DescriptorUpdateTemplate);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplate(VkDevice device,
                                                                   VkDescriptorUpdateTemplate descriptorUpdateTemplate,
                                                                   const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (descriptorUpdateTemplate) CensusRemove(CensusType::DescriptorUpdateTemplate);
 }
 static VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet,
                                                                   VkDescriptorUpdateTemplate descriptorUpdateTemplate,
@@ -1121,25 +1429,26 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(VkDevice devi
                                                                    VkSamplerYcbcrConversion* pYcbcrConversion) {
     unique_lock_t lock(global_lock);
     *pYcbcrConversion = (VkSamplerYcbcrConversion)global_unique_handle++;
+    CensusAdd(CensusType::SamplerYcbcrConversion);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversion(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion,
                                                                 const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (ycbcrConversion) CensusRemove(CensusType::SamplerYcbcrConversion);
 }
 static VKAPI_ATTR void VKAPI_CALL ResetQueryPool(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
     // Not a CREATE or DESTROY function
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
-    // Not a CREATE or DESTROY function
+    *pValue = GetSyncObject<SemaphoreState>(semaphore)->value.load(std::memory_order_acquire);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
-    // Not a CREATE or DESTROY function
-    return VK_SUCCESS;
+    return WaitForSemaphoreValues(pWaitInfo, timeout);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) {
-    // Not a CREATE or DESTROY function
+    SignalSemaphoreState(pSignalInfo->semaphore, pSignalInfo->value);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(VkDevice device, const VkBufferDeviceAddressInfo* pInfo) {
@@ -1176,6 +1485,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(VkDevice device, const V
                                                         const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
     unique_lock_t lock(global_lock);
     *pRenderPass = (VkRenderPass)global_unique_handle++;
+    CensusAdd(CensusType::RenderPass);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo* pRenderPassBegin,
@@ -1199,11 +1509,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlot(VkDevice device, con
                                                             VkPrivateDataSlot* pPrivateDataSlot) {
     unique_lock_t lock(global_lock);
     *pPrivateDataSlot = (VkPrivateDataSlot)global_unique_handle++;
+    CensusAdd(CensusType::PrivateDataSlot);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlot(VkDevice device, VkPrivateDataSlot privateDataSlot,
                                                          const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (privateDataSlot) CensusRemove(CensusType::PrivateDataSlot);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL SetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
                                                      VkPrivateDataSlot privateDataSlot, uint64_t data) {
@@ -1223,7 +1535,18 @@ static VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2(VkCommandBuffer commandBuff
 }
 static VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits,
                                                    VkFence fence) {
-    // Not a CREATE or DESTROY function
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        const VkSubmitInfo2& submit = pSubmits[i];
+        for (uint32_t j = 0; j < submit.waitSemaphoreInfoCount; ++j) {
+            ConsumeSemaphoreState(submit.pWaitSemaphoreInfos[j].semaphore);
+        }
+        for (uint32_t j = 0; j < submit.commandBufferInfoCount; ++j) {
+            ExecuteRecordedCommands(submit.pCommandBufferInfos[j].commandBuffer);
+        }
+        for (uint32_t j = 0; j < submit.signalSemaphoreInfoCount; ++j) {
+            SignalSemaphoreState(submit.pSignalSemaphoreInfos[j].semaphore, submit.pSignalSemaphoreInfos[j].value);
+        }
+    }
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfo) {
@@ -1248,25 +1571,32 @@ static VKAPI_ATTR void VKAPI_CALL GetDeviceBufferMemoryRequirements(VkDevice dev
 
     // Return a size based on the buffer size from the create info.
     pMemoryRequirements->memoryRequirements.size = ((pInfo->pCreateInfo->size + 4095) / 4096) * 4096;
+    // Sparse buffers are bound a whole page at a time
+    if (pInfo->pCreateInfo->flags & VK_BUFFER_CREATE_SPARSE_BINDING_BIT) {
+        pMemoryRequirements->memoryRequirements.size =
+            (pInfo->pCreateInfo->size + sparse_page_size - 1) / sparse_page_size * sparse_page_size;
+        pMemoryRequirements->memoryRequirements.alignment = sparse_page_size;
+    }
 }
 static VKAPI_ATTR void VKAPI_CALL GetDeviceImageMemoryRequirements(VkDevice device, const VkDeviceImageMemoryRequirements* pInfo,
                                                                    VkMemoryRequirements2* pMemoryRequirements) {
     pMemoryRequirements->memoryRequirements.size = GetImageSizeFromCreateInfo(pInfo->pCreateInfo);
-    pMemoryRequirements->memoryRequirements.alignment = 1;
+    pMemoryRequirements->memoryRequirements.alignment =
+        (pInfo->pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) ? sparse_page_size : 1;
     // Here we hard-code that the memory type at index 3 doesn't support this image.
     pMemoryRequirements->memoryRequirements.memoryTypeBits = 0xFFFF & ~(0x1 << 3);
 }
 static VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirements(
     VkDevice device, const VkDeviceImageMemoryRequirements* pInfo, uint32_t* pSparseMemoryRequirementCount,
     VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
-    // Not a CREATE or DESTROY function
+    GetDeviceImageSparseMemoryRequirementsKHR(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event,
                                                const VkDependencyInfo* pDependencyInfo) {
-    // Not a CREATE or DESTROY function
+    RecordCommand(commandBuffer, {event, true, VK_NULL_HANDLE});
 }
 static VKAPI_ATTR void VKAPI_CALL CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
-    // Not a CREATE or DESTROY function
+    RecordCommand(commandBuffer, {event, false, VK_NULL_HANDLE});
 }
 static VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                                  const VkDependencyInfo* pDependencyInfos) {
@@ -1342,12 +1672,12 @@ static VKAPI_ATTR VkResult VKAPI_CALL UnmapMemory2(VkDevice device, const VkMemo
 }
 static VKAPI_ATTR void VKAPI_CALL GetDeviceImageSubresourceLayout(VkDevice device, const VkDeviceImageSubresourceInfo* pInfo,
                                                                   VkSubresourceLayout2* pLayout) {
-    // Not a CREATE or DESTROY function
+    GetDeviceImageSubresourceLayoutKHR(device, pInfo, pLayout);
 }
 static VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout2(VkDevice device, VkImage image,
                                                              const VkImageSubresource2* pSubresource,
                                                              VkSubresourceLayout2* pLayout) {
-    // Not a CREATE or DESTROY function
+    GetImageSubresourceLayout2KHR(device, image, pSubresource, pLayout);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToImage(VkDevice device, const VkCopyMemoryToImageInfo* pCopyMemoryToImageInfo) {
     // Not a CREATE or DESTROY function
@@ -1414,6 +1744,7 @@ static VKAPI_ATTR void VKAPI_CALL CmdSetRenderingInputAttachmentIndices(
 static VKAPI_ATTR void VKAPI_CALL DestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface,
                                                     const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (surface) CensusRemove(CensusType::SurfaceKHR);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex,
                                                                          VkSurfaceKHR surface, VkBool32* pSupported) {
@@ -1489,12 +1820,14 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(VkDevice device, const
     for (uint32_t i = 0; i < icd_swapchain_image_count; ++i) {
         swapchain_image_map[*pSwapchain][i] = (VkImage)global_unique_handle++;
     }
+    CensusAdd(CensusType::SwapchainKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain,
                                                       const VkAllocationCallbacks* pAllocator) {
     unique_lock_t lock(global_lock);
     swapchain_image_map.clear();
+    if (swapchain) CensusRemove(CensusType::SwapchainKHR);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain,
                                                             uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) {
@@ -1516,10 +1849,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainImagesKHR(VkDevice device, VkS
 static VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout,
                                                           VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) {
     *pImageIndex = 0;
+    SignalSemaphoreState(semaphore, 0);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR* pPresentInfo) {
-    // Not a CREATE or DESTROY function
+    for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
+        ConsumeSemaphoreState(pPresentInfo->pWaitSemaphores[i]);
+    }
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL
@@ -1540,6 +1876,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDevicePresentRectanglesKHR(VkPh
 static VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR* pAcquireInfo,
                                                            uint32_t* pImageIndex) {
     *pImageIndex = 0;
+    SignalSemaphoreState(pAcquireInfo->semaphore, 0);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice,
@@ -1552,7 +1889,11 @@ static VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceDisplayPropertiesKHR(VkPh
         *pPropertyCount = 1;
         pProperties[0].display = (VkDisplayKHR)global_unique_handle++;
         pProperties[0].displayName = "Vulkan Mock Display";
-        display_map[physicalDevice].insert(pProperties[0].display);
+        try {
+            display_map[physicalDevice].insert(pProperties[0].display);
+        } catch (const std::bad_alloc&) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
     }
     return VK_SUCCESS;
 }
@@ -1588,6 +1929,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayModeKHR(VkPhysicalDevice phys
                                                            const VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode) {
     unique_lock_t lock(global_lock);
     *pMode = (VkDisplayModeKHR)global_unique_handle++;
+    CensusAdd(CensusType::DisplayModeKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode,
@@ -1602,6 +1944,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurfaceKHR(VkInstance in
                                                                    VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount,
@@ -1612,6 +1955,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(VkDevice device,
     for (uint32_t i = 0; i < swapchainCount; ++i) {
         pSwapchains[i] = (VkSwapchainKHR)global_unique_handle++;
     }
+    CensusAdd(CensusType::SwapchainKHR, swapchainCount);
     return VK_SUCCESS;
 }
 #ifdef VK_USE_PLATFORM_XLIB_KHR
@@ -1619,6 +1963,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateXlibSurfaceKHR(VkInstance instance,
                                                            const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXlibPresentationSupportKHR(VkPhysicalDevice physicalDevice,
@@ -1634,6 +1979,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateXcbSurfaceKHR(VkInstance instance, c
                                                           const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceXcbPresentationSupportKHR(VkPhysicalDevice physicalDevice,
@@ -1650,6 +1996,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateWaylandSurfaceKHR(VkInstance instanc
                                                               const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWaylandPresentationSupportKHR(VkPhysicalDevice physicalDevice,
@@ -1665,6 +2012,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateAndroidSurfaceKHR(VkInstance instanc
                                                               const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 #endif /* VK_USE_PLATFORM_ANDROID_KHR */
@@ -1674,6 +2022,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateWin32SurfaceKHR(VkInstance instance,
                                                             const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceWin32PresentationSupportKHR(VkPhysicalDevice physicalDevice,
@@ -1697,11 +2046,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionKHR(VkDevice device, con
                                                             VkVideoSessionKHR* pVideoSession) {
     unique_lock_t lock(global_lock);
     *pVideoSession = (VkVideoSessionKHR)global_unique_handle++;
+    CensusAdd(CensusType::VideoSessionKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionKHR(VkDevice device, VkVideoSessionKHR videoSession,
                                                          const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (videoSession) CensusRemove(CensusType::VideoSessionKHR);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL
 GetVideoSessionMemoryRequirementsKHR(VkDevice device, VkVideoSessionKHR videoSession, uint32_t* pMemoryRequirementsCount,
@@ -1729,6 +2080,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateVideoSessionParametersKHR(VkDevice d
                                                                       VkVideoSessionParametersKHR* pVideoSessionParameters) {
     unique_lock_t lock(global_lock);
     *pVideoSessionParameters = (VkVideoSessionParametersKHR)global_unique_handle++;
+    CensusAdd(CensusType::VideoSessionParametersKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL UpdateVideoSessionParametersKHR(VkDevice device,
@@ -1741,6 +2093,7 @@ static VKAPI_ATTR void VKAPI_CALL DestroyVideoSessionParametersKHR(VkDevice devi
                                                                    VkVideoSessionParametersKHR videoSessionParameters,
                                                                    const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (videoSessionParameters) CensusRemove(CensusType::VideoSessionParametersKHR);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer,
                                                          const VkVideoBeginCodingInfoKHR* pBeginInfo) {
@@ -2156,12 +2509,14 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(VkDevice
                                                                         VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
     unique_lock_t lock(global_lock);
     *pDescriptorUpdateTemplate = (VkDescriptorUpdateTemplate)global_unique_handle++;
+    CensusAdd(CensusType::DescriptorUpdateTemplate);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyDescriptorUpdateTemplateKHR(VkDevice device,
                                                                      VkDescriptorUpdateTemplate descriptorUpdateTemplate,
                                                                      const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (descriptorUpdateTemplate) CensusRemove(CensusType::DescriptorUpdateTemplate);
 }
 static VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet,
                                                                      VkDescriptorUpdateTemplate descriptorUpdateTemplate,
@@ -2172,6 +2527,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(VkDevice device, cons
                                                            const VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
     unique_lock_t lock(global_lock);
     *pRenderPass = (VkRenderPass)global_unique_handle++;
+    CensusAdd(CensusType::RenderPass);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer,
@@ -2354,11 +2710,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(VkDevice d
                                                                       VkSamplerYcbcrConversion* pYcbcrConversion) {
     unique_lock_t lock(global_lock);
     *pYcbcrConversion = (VkSamplerYcbcrConversion)global_unique_handle++;
+    CensusAdd(CensusType::SamplerYcbcrConversion);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion,
                                                                    const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (ycbcrConversion) CensusRemove(CensusType::SamplerYcbcrConversion);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount,
                                                            const VkBindBufferMemoryInfo* pBindInfos) {
@@ -2387,16 +2745,13 @@ static VKAPI_ATTR void VKAPI_CALL CmdDrawIndexedIndirectCountKHR(VkCommandBuffer
     // Not a CREATE or DESTROY function
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreCounterValueKHR(VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
-    // Not a CREATE or DESTROY function
-    return VK_SUCCESS;
+    return GetSemaphoreCounterValue(device, semaphore, pValue);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
-    // Not a CREATE or DESTROY function
-    return VK_SUCCESS;
+    return WaitSemaphores(device, pWaitInfo, timeout);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphoreKHR(VkDevice device, const VkSemaphoreSignalInfo* pSignalInfo) {
-    // Not a CREATE or DESTROY function
-    return VK_SUCCESS;
+    return SignalSemaphore(device, pSignalInfo);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL
 GetPhysicalDeviceFragmentShadingRatesKHR(VkPhysicalDevice physicalDevice, uint32_t* pFragmentShadingRateCount,
@@ -2443,11 +2798,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDeferredOperationKHR(VkDevice device
                                                                  VkDeferredOperationKHR* pDeferredOperation) {
     unique_lock_t lock(global_lock);
     *pDeferredOperation = (VkDeferredOperationKHR)global_unique_handle++;
+    CensusAdd(CensusType::DeferredOperationKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyDeferredOperationKHR(VkDevice device, VkDeferredOperationKHR operation,
                                                               const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (operation) CensusRemove(CensusType::DeferredOperationKHR);
 }
 static VKAPI_ATTR uint32_t VKAPI_CALL GetDeferredOperationMaxConcurrencyKHR(VkDevice device, VkDeferredOperationKHR operation) {
     // Not a CREATE or DESTROY function
@@ -2504,10 +2861,10 @@ static VKAPI_ATTR void VKAPI_CALL CmdEncodeVideoKHR(VkCommandBuffer commandBuffe
 }
 static VKAPI_ATTR void VKAPI_CALL CmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event,
                                                   const VkDependencyInfo* pDependencyInfo) {
-    // Not a CREATE or DESTROY function
+    CmdSetEvent2(commandBuffer, event, pDependencyInfo);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
-    // Not a CREATE or DESTROY function
+    CmdResetEvent2(commandBuffer, event, stageMask);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent* pEvents,
                                                     const VkDependencyInfo* pDependencyInfos) {
@@ -2522,8 +2879,7 @@ static VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp2KHR(VkCommandBuffer commandB
 }
 static VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2* pSubmits,
                                                       VkFence fence) {
-    // Not a CREATE or DESTROY function
-    return VK_SUCCESS;
+    return QueueSubmit2(queue, submitCount, pSubmits, fence);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer3KHR(VkCommandBuffer commandBuffer, const VkBindIndexBuffer3InfoKHR* pInfo) {
     // Not a CREATE or DESTROY function
@@ -2617,6 +2973,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructure2KHR(VkDevice d
                                                                       VkAccelerationStructureKHR* pAccelerationStructure) {
     unique_lock_t lock(global_lock);
     *pAccelerationStructure = (VkAccelerationStructureKHR)global_unique_handle++;
+    CensusAdd(CensusType::AccelerationStructureKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2* pCopyBufferInfo) {
@@ -2654,7 +3011,15 @@ static VKAPI_ATTR void VKAPI_CALL GetDeviceImageMemoryRequirementsKHR(VkDevice d
 static VKAPI_ATTR void VKAPI_CALL GetDeviceImageSparseMemoryRequirementsKHR(
     VkDevice device, const VkDeviceImageMemoryRequirements* pInfo, uint32_t* pSparseMemoryRequirementCount,
     VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
-    // Not a CREATE or DESTROY function
+    VkSparseImageMemoryRequirements requirements{};
+    if (!GetSparseImageMemoryRequirements(*pInfo->pCreateInfo, &requirements)) {
+        *pSparseMemoryRequirementCount = 0;
+    } else if (!pSparseMemoryRequirements) {
+        *pSparseMemoryRequirementCount = 1;
+    } else if (*pSparseMemoryRequirementCount > 0) {
+        pSparseMemoryRequirements->memoryRequirements = requirements;
+        *pSparseMemoryRequirementCount = 1;
+    }
 }
 static VKAPI_ATTR void VKAPI_CALL CmdBindIndexBuffer2KHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset,
                                                          VkDeviceSize size, VkIndexType indexType) {
@@ -2666,12 +3031,22 @@ static VKAPI_ATTR void VKAPI_CALL GetRenderingAreaGranularityKHR(VkDevice device
 }
 static VKAPI_ATTR void VKAPI_CALL GetDeviceImageSubresourceLayoutKHR(VkDevice device, const VkDeviceImageSubresourceInfo* pInfo,
                                                                      VkSubresourceLayout2* pLayout) {
-    // Not a CREATE or DESTROY function
+    const VkImageSubresource& subresource = pInfo->pSubresource->imageSubresource;
+    pLayout->subresourceLayout =
+        GetLinearSubresourceLayout(*pInfo->pCreateInfo, subresource.aspectMask, subresource.mipLevel, subresource.arrayLayer);
+    auto* host_memcpy_size = lvl_find_mod_in_chain<VkSubresourceHostMemcpySize>(pLayout->pNext);
+    if (host_memcpy_size) {
+        host_memcpy_size->size = pLayout->subresourceLayout.size;
+    }
 }
 static VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout2KHR(VkDevice device, VkImage image,
                                                                 const VkImageSubresource2* pSubresource,
                                                                 VkSubresourceLayout2* pLayout) {
-    // Not a CREATE or DESTROY function
+    GetImageSubresourceLayout(device, image, &pSubresource->imageSubresource, &pLayout->subresourceLayout);
+    auto* host_memcpy_size = lvl_find_mod_in_chain<VkSubresourceHostMemcpySize>(pLayout->pNext);
+    if (host_memcpy_size) {
+        host_memcpy_size->size = pLayout->subresourceLayout.size;
+    }
 }
 static VKAPI_ATTR VkResult VKAPI_CALL WaitForPresent2KHR(VkDevice device, VkSwapchainKHR swapchain,
                                                          const VkPresentWait2InfoKHR* pPresentWait2Info) {
@@ -2686,6 +3061,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineBinariesKHR(VkDevice device,
         for (uint32_t i = 0; i < pBinaries->pipelineBinaryCount; ++i) {
             pBinaries->pPipelineBinaries[i] = (VkPipelineBinaryKHR)global_unique_handle++;
         }
+        CensusAdd(CensusType::PipelineBinaryKHR, pBinaries->pipelineBinaryCount);
     } else {
         // In this case, we need to return a return count, let's set it to 3
         pBinaries->pipelineBinaryCount = 3;
@@ -2695,6 +3071,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineBinariesKHR(VkDevice device,
 static VKAPI_ATTR void VKAPI_CALL DestroyPipelineBinaryKHR(VkDevice device, VkPipelineBinaryKHR pipelineBinary,
                                                            const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (pipelineBinary) CensusRemove(CensusType::PipelineBinaryKHR);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetPipelineKeyKHR(VkDevice device, const VkPipelineCreateInfoKHR* pPipelineCreateInfo,
                                                         VkPipelineBinaryKeyKHR* pPipelineKey) {
@@ -2821,11 +3198,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(VkInstance in
                                                                    VkDebugReportCallbackEXT* pCallback) {
     unique_lock_t lock(global_lock);
     *pCallback = (VkDebugReportCallbackEXT)global_unique_handle++;
+    CensusAdd(CensusType::DebugReportCallbackEXT);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback,
                                                                 const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (callback) CensusRemove(CensusType::DebugReportCallbackEXT);
 }
 static VKAPI_ATTR void VKAPI_CALL DebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags,
                                                         VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location,
@@ -2885,21 +3264,25 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateCuModuleNVX(VkDevice device, const V
                                                         const VkAllocationCallbacks* pAllocator, VkCuModuleNVX* pModule) {
     unique_lock_t lock(global_lock);
     *pModule = (VkCuModuleNVX)global_unique_handle++;
+    CensusAdd(CensusType::CuModuleNVX);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateCuFunctionNVX(VkDevice device, const VkCuFunctionCreateInfoNVX* pCreateInfo,
                                                           const VkAllocationCallbacks* pAllocator, VkCuFunctionNVX* pFunction) {
     unique_lock_t lock(global_lock);
     *pFunction = (VkCuFunctionNVX)global_unique_handle++;
+    CensusAdd(CensusType::CuFunctionNVX);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyCuModuleNVX(VkDevice device, VkCuModuleNVX module,
                                                      const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (module) CensusRemove(CensusType::CuModuleNVX);
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyCuFunctionNVX(VkDevice device, VkCuFunctionNVX function,
                                                        const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (function) CensusRemove(CensusType::CuFunctionNVX);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdCuLaunchKernelNVX(VkCommandBuffer commandBuffer, const VkCuLaunchInfoNVX* pLaunchInfo) {
     // Not a CREATE or DESTROY function
@@ -2945,6 +3328,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateStreamDescriptorSurfaceGGP(VkInstanc
                                                                        VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 #endif /* VK_USE_PLATFORM_GGP */
@@ -2968,6 +3352,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateViSurfaceNN(VkInstance instance, con
                                                         const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 #endif /* VK_USE_PLATFORM_VI_NN */
@@ -3018,6 +3403,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(VkDevice device, V
                                                               const VkAllocationCallbacks* pAllocator, VkFence* pFence) {
     unique_lock_t lock(global_lock);
     *pFence = (VkFence)global_unique_handle++;
+    CensusAdd(CensusType::Fence);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetSwapchainCounterEXT(VkDevice device, VkSwapchainKHR swapchain,
@@ -3056,6 +3442,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateIOSSurfaceMVK(VkInstance instance, c
                                                           const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 #endif /* VK_USE_PLATFORM_IOS_MVK */
@@ -3065,6 +3452,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateMacOSSurfaceMVK(VkInstance instance,
                                                             const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 #endif /* VK_USE_PLATFORM_MACOS_MVK */
@@ -3102,11 +3490,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDebugUtilsMessengerEXT(VkInstance in
                                                                    VkDebugUtilsMessengerEXT* pMessenger) {
     unique_lock_t lock(global_lock);
     *pMessenger = (VkDebugUtilsMessengerEXT)global_unique_handle++;
+    CensusAdd(CensusType::DebugUtilsMessengerEXT);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT messenger,
                                                                 const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (messenger) CensusRemove(CensusType::DebugUtilsMessengerEXT);
 }
 static VKAPI_ATTR void VKAPI_CALL SubmitDebugUtilsMessageEXT(VkInstance instance,
                                                              VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity,
@@ -3143,11 +3533,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateGpaSessionAMD(VkDevice device, const
                                                           const VkAllocationCallbacks* pAllocator, VkGpaSessionAMD* pGpaSession) {
     unique_lock_t lock(global_lock);
     *pGpaSession = (VkGpaSessionAMD)global_unique_handle++;
+    CensusAdd(CensusType::GpaSessionAMD);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyGpaSessionAMD(VkDevice device, VkGpaSessionAMD gpaSession,
                                                        const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (gpaSession) CensusRemove(CensusType::GpaSessionAMD);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL SetGpaDeviceClockModeAMD(VkDevice device, VkGpaDeviceClockModeInfoAMD* pInfo) {
     // Not a CREATE or DESTROY function
@@ -3200,6 +3592,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateExecutionGraphPipelinesAMDX(VkDevice
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pPipelines[i] = (VkPipeline)global_unique_handle++;
     }
+    CensusAdd(CensusType::Pipeline, createInfoCount);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetExecutionGraphPipelineScratchSizeAMDX(VkDevice device, VkPipeline executionGraph,
@@ -3297,11 +3690,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateValidationCacheEXT(VkDevice device,
                                                                VkValidationCacheEXT* pValidationCache) {
     unique_lock_t lock(global_lock);
     *pValidationCache = (VkValidationCacheEXT)global_unique_handle++;
+    CensusAdd(CensusType::ValidationCacheEXT);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache,
                                                             const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (validationCache) CensusRemove(CensusType::ValidationCacheEXT);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL MergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache,
                                                                uint32_t srcCacheCount, const VkValidationCacheEXT* pSrcCaches) {
@@ -3334,11 +3729,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(VkDevice dev
                                                                     VkAccelerationStructureNV* pAccelerationStructure) {
     unique_lock_t lock(global_lock);
     *pAccelerationStructure = (VkAccelerationStructureNV)global_unique_handle++;
+    CensusAdd(CensusType::AccelerationStructureNV);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureNV(VkDevice device, VkAccelerationStructureNV accelerationStructure,
                                                                  const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (accelerationStructure) CensusRemove(CensusType::AccelerationStructureNV);
 }
 static VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
     VkDevice device, const VkAccelerationStructureMemoryRequirementsInfoNV* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
@@ -3381,6 +3778,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(VkDevice devic
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pPipelines[i] = (VkPipeline)global_unique_handle++;
     }
+    CensusAdd(CensusType::Pipeline, createInfoCount);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline, uint32_t firstGroup,
@@ -3549,6 +3947,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateImagePipeSurfaceFUCHSIA(VkInstance i
                                                                     VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 #endif /* VK_USE_PLATFORM_FUCHSIA */
@@ -3558,6 +3957,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateMetalSurfaceEXT(VkInstance instance,
                                                             const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 #endif /* VK_USE_PLATFORM_METAL_EXT */
@@ -3608,6 +4008,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateHeadlessSurfaceEXT(VkInstance instan
                                                                const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL CmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor,
@@ -3680,7 +4081,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL TransitionImageLayoutEXT(VkDevice device,
 static VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout2EXT(VkDevice device, VkImage image,
                                                                 const VkImageSubresource2* pSubresource,
                                                                 VkSubresourceLayout2* pLayout) {
-    // Not a CREATE or DESTROY function
+    GetImageSubresourceLayout2KHR(device, image, pSubresource, pLayout);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL ReleaseSwapchainImagesEXT(VkDevice device,
                                                                 const VkReleaseSwapchainImagesInfoKHR* pReleaseInfo) {
@@ -3710,12 +4111,14 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(VkDevice de
                                                                      VkIndirectCommandsLayoutNV* pIndirectCommandsLayout) {
     unique_lock_t lock(global_lock);
     *pIndirectCommandsLayout = (VkIndirectCommandsLayoutNV)global_unique_handle++;
+    CensusAdd(CensusType::IndirectCommandsLayoutNV);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutNV(VkDevice device,
                                                                   VkIndirectCommandsLayoutNV indirectCommandsLayout,
                                                                   const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (indirectCommandsLayout) CensusRemove(CensusType::IndirectCommandsLayoutNV);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdSetDepthBias2EXT(VkCommandBuffer commandBuffer, const VkDepthBiasInfoEXT* pDepthBiasInfo) {
     // Not a CREATE or DESTROY function
@@ -3734,11 +4137,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlotEXT(VkDevice device,
                                                                VkPrivateDataSlot* pPrivateDataSlot) {
     unique_lock_t lock(global_lock);
     *pPrivateDataSlot = (VkPrivateDataSlot)global_unique_handle++;
+    CensusAdd(CensusType::PrivateDataSlot);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyPrivateDataSlotEXT(VkDevice device, VkPrivateDataSlot privateDataSlot,
                                                             const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (privateDataSlot) CensusRemove(CensusType::PrivateDataSlot);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL SetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle,
                                                         VkPrivateDataSlot privateDataSlot, uint64_t data) {
@@ -3758,6 +4163,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateCudaModuleNV(VkDevice device, const
                                                          const VkAllocationCallbacks* pAllocator, VkCudaModuleNV* pModule) {
     unique_lock_t lock(global_lock);
     *pModule = (VkCudaModuleNV)global_unique_handle++;
+    CensusAdd(CensusType::CudaModuleNV);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetCudaModuleCacheNV(VkDevice device, VkCudaModuleNV module, size_t* pCacheSize,
@@ -3769,15 +4175,18 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateCudaFunctionNV(VkDevice device, cons
                                                            const VkAllocationCallbacks* pAllocator, VkCudaFunctionNV* pFunction) {
     unique_lock_t lock(global_lock);
     *pFunction = (VkCudaFunctionNV)global_unique_handle++;
+    CensusAdd(CensusType::CudaFunctionNV);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyCudaModuleNV(VkDevice device, VkCudaModuleNV module,
                                                       const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (module) CensusRemove(CensusType::CudaModuleNV);
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyCudaFunctionNV(VkDevice device, VkCudaFunctionNV function,
                                                         const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (function) CensusRemove(CensusType::CudaFunctionNV);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdCudaLaunchKernelNV(VkCommandBuffer commandBuffer, const VkCudaLaunchInfoNV* pLaunchInfo) {
     // Not a CREATE or DESTROY function
@@ -3906,6 +4315,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDirectFBSurfaceEXT(VkInstance instan
                                                                const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceDirectFBPresentationSupportEXT(VkPhysicalDevice physicalDevice,
@@ -3949,6 +4359,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateBufferCollectionFUCHSIA(VkDevice dev
                                                                     VkBufferCollectionFUCHSIA* pCollection) {
     unique_lock_t lock(global_lock);
     *pCollection = (VkBufferCollectionFUCHSIA)global_unique_handle++;
+    CensusAdd(CensusType::BufferCollectionFUCHSIA);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionImageConstraintsFUCHSIA(
@@ -3964,6 +4375,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL SetBufferCollectionBufferConstraintsFUCHSI
 static VKAPI_ATTR void VKAPI_CALL DestroyBufferCollectionFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection,
                                                                  const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (collection) CensusRemove(CensusType::BufferCollectionFUCHSIA);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetBufferCollectionPropertiesFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection,
                                                                            VkBufferCollectionPropertiesFUCHSIA* pProperties) {
@@ -4015,6 +4427,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateScreenSurfaceQNX(VkInstance instance
                                                              const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceScreenPresentationSupportQNX(VkPhysicalDevice physicalDevice,
@@ -4042,11 +4455,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateMicromapEXT(VkDevice device, const V
                                                         const VkAllocationCallbacks* pAllocator, VkMicromapEXT* pMicromap) {
     unique_lock_t lock(global_lock);
     *pMicromap = (VkMicromapEXT)global_unique_handle++;
+    CensusAdd(CensusType::MicromapEXT);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyMicromapEXT(VkDevice device, VkMicromapEXT micromap,
                                                      const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (micromap) CensusRemove(CensusType::MicromapEXT);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoCount,
                                                        const VkMicromapBuildInfoEXT* pInfos) {
@@ -4289,20 +4704,24 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateTensorARM(VkDevice device, const VkT
                                                       const VkAllocationCallbacks* pAllocator, VkTensorARM* pTensor) {
     unique_lock_t lock(global_lock);
     *pTensor = (VkTensorARM)global_unique_handle++;
+    CensusAdd(CensusType::TensorARM);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyTensorARM(VkDevice device, VkTensorARM tensor, const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (tensor) CensusRemove(CensusType::TensorARM);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateTensorViewARM(VkDevice device, const VkTensorViewCreateInfoARM* pCreateInfo,
                                                           const VkAllocationCallbacks* pAllocator, VkTensorViewARM* pView) {
     unique_lock_t lock(global_lock);
     *pView = (VkTensorViewARM)global_unique_handle++;
+    CensusAdd(CensusType::TensorViewARM);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyTensorViewARM(VkDevice device, VkTensorViewARM tensorView,
                                                        const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (tensorView) CensusRemove(CensusType::TensorViewARM);
 }
 static VKAPI_ATTR void VKAPI_CALL GetTensorMemoryRequirementsARM(VkDevice device, const VkTensorMemoryRequirementsInfoARM* pInfo,
                                                                  VkMemoryRequirements2* pMemoryRequirements) {
@@ -4362,11 +4781,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateOpticalFlowSessionNV(VkDevice device
                                                                  VkOpticalFlowSessionNV* pSession) {
     unique_lock_t lock(global_lock);
     *pSession = (VkOpticalFlowSessionNV)global_unique_handle++;
+    CensusAdd(CensusType::OpticalFlowSessionNV);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyOpticalFlowSessionNV(VkDevice device, VkOpticalFlowSessionNV session,
                                                               const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (session) CensusRemove(CensusType::OpticalFlowSessionNV);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL BindOpticalFlowSessionImageNV(VkDevice device, VkOpticalFlowSessionNV session,
                                                                     VkOpticalFlowSessionBindingPointNV bindingPoint,
@@ -4388,10 +4809,12 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateShadersEXT(VkDevice device, uint32_t
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pShaders[i] = (VkShaderEXT)global_unique_handle++;
     }
+    CensusAdd(CensusType::ShaderEXT, createInfoCount);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (shader) CensusRemove(CensusType::ShaderEXT);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetShaderBinaryDataEXT(VkDevice device, VkShaderEXT shader, size_t* pDataSize, void* pData) {
     // Not a CREATE or DESTROY function
@@ -4460,6 +4883,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDataGraphPipelinesARM(VkDevice devic
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pPipelines[i] = (VkPipeline)global_unique_handle++;
     }
+    CensusAdd(CensusType::Pipeline, createInfoCount);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateDataGraphPipelineSessionARM(VkDevice device,
@@ -4468,6 +4892,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateDataGraphPipelineSessionARM(VkDevice
                                                                         VkDataGraphPipelineSessionARM* pSession) {
     unique_lock_t lock(global_lock);
     *pSession = (VkDataGraphPipelineSessionARM)global_unique_handle++;
+    CensusAdd(CensusType::DataGraphPipelineSessionARM);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetDataGraphPipelineSessionBindPointRequirementsARM(
@@ -4488,6 +4913,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL BindDataGraphPipelineSessionMemoryARM(
 static VKAPI_ATTR void VKAPI_CALL DestroyDataGraphPipelineSessionARM(VkDevice device, VkDataGraphPipelineSessionARM session,
                                                                      const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (session) CensusRemove(CensusType::DataGraphPipelineSessionARM);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdDispatchDataGraphARM(VkCommandBuffer commandBuffer, VkDataGraphPipelineSessionARM session,
                                                           const VkDataGraphPipelineDispatchInfoARM* pInfo) {
@@ -4557,11 +4983,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateExternalComputeQueueNV(VkDevice devi
                                                                    VkExternalComputeQueueNV* pExternalQueue) {
     unique_lock_t lock(global_lock);
     *pExternalQueue = (VkExternalComputeQueueNV)global_unique_handle++;
+    CensusAdd(CensusType::ExternalComputeQueueNV);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyExternalComputeQueueNV(VkDevice device, VkExternalComputeQueueNV externalQueue,
                                                                 const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (externalQueue) CensusRemove(CensusType::ExternalComputeQueueNV);
 }
 static VKAPI_ATTR void VKAPI_CALL GetExternalComputeQueueDataNV(VkExternalComputeQueueNV externalQueue,
                                                                 VkExternalComputeQueueDataParamsNV* params, void* pData) {
@@ -4603,12 +5031,14 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutEXT(VkDevice d
                                                                       VkIndirectCommandsLayoutEXT* pIndirectCommandsLayout) {
     unique_lock_t lock(global_lock);
     *pIndirectCommandsLayout = (VkIndirectCommandsLayoutEXT)global_unique_handle++;
+    CensusAdd(CensusType::IndirectCommandsLayoutEXT);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyIndirectCommandsLayoutEXT(VkDevice device,
                                                                    VkIndirectCommandsLayoutEXT indirectCommandsLayout,
                                                                    const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (indirectCommandsLayout) CensusRemove(CensusType::IndirectCommandsLayoutEXT);
 }
 static VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectExecutionSetEXT(VkDevice device,
                                                                     const VkIndirectExecutionSetCreateInfoEXT* pCreateInfo,
@@ -4616,11 +5046,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectExecutionSetEXT(VkDevice dev
                                                                     VkIndirectExecutionSetEXT* pIndirectExecutionSet) {
     unique_lock_t lock(global_lock);
     *pIndirectExecutionSet = (VkIndirectExecutionSetEXT)global_unique_handle++;
+    CensusAdd(CensusType::IndirectExecutionSetEXT);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyIndirectExecutionSetEXT(VkDevice device, VkIndirectExecutionSetEXT indirectExecutionSet,
                                                                  const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (indirectExecutionSet) CensusRemove(CensusType::IndirectExecutionSetEXT);
 }
 static VKAPI_ATTR void VKAPI_CALL UpdateIndirectExecutionSetPipelineEXT(
     VkDevice device, VkIndirectExecutionSetEXT indirectExecutionSet, uint32_t executionSetWriteCount,
@@ -4637,6 +5069,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateSurfaceOHOS(VkInstance instance, con
                                                         const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 #endif /* VK_USE_PLATFORM_OHOS */
@@ -4676,11 +5109,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateShaderInstrumentationARM(VkDevice de
                                                                      VkShaderInstrumentationARM* pInstrumentation) {
     unique_lock_t lock(global_lock);
     *pInstrumentation = (VkShaderInstrumentationARM)global_unique_handle++;
+    CensusAdd(CensusType::ShaderInstrumentationARM);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyShaderInstrumentationARM(VkDevice device, VkShaderInstrumentationARM instrumentation,
                                                                   const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (instrumentation) CensusRemove(CensusType::ShaderInstrumentationARM);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdBeginShaderInstrumentationARM(VkCommandBuffer commandBuffer,
                                                                    VkShaderInstrumentationARM instrumentation) {
@@ -4730,6 +5165,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateUbmSurfaceSEC(VkInstance instance, c
                                                           const VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
     unique_lock_t lock(global_lock);
     *pSurface = (VkSurfaceKHR)global_unique_handle++;
+    CensusAdd(CensusType::SurfaceKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkBool32 VKAPI_CALL GetPhysicalDeviceUbmPresentationSupportSEC(VkPhysicalDevice physicalDevice,
@@ -4748,11 +5184,13 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(VkDevice de
                                                                      VkAccelerationStructureKHR* pAccelerationStructure) {
     unique_lock_t lock(global_lock);
     *pAccelerationStructure = (VkAccelerationStructureKHR)global_unique_handle++;
+    CensusAdd(CensusType::AccelerationStructureKHR);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR void VKAPI_CALL DestroyAccelerationStructureKHR(VkDevice device, VkAccelerationStructureKHR accelerationStructure,
                                                                   const VkAllocationCallbacks* pAllocator) {
     // Destroy object
+    if (accelerationStructure) CensusRemove(CensusType::AccelerationStructureKHR);
 }
 static VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresKHR(
     VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR* pInfos,
@@ -4845,6 +5283,7 @@ static VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(VkDevice devi
     for (uint32_t i = 0; i < createInfoCount; ++i) {
         pPipelines[i] = (VkPipeline)global_unique_handle++;
     }
+    CensusAdd(CensusType::Pipeline, createInfoCount);
     return VK_SUCCESS;
 }
 static VKAPI_ATTR VkResult VKAPI_CALL GetRayTracingCaptureReplayShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline,
@@ -15,6 +15,8 @@
 */
 
 #include "mock_icd.h"
+#include "mock_icd_census.h"
+#include "mock_icd_sparse.h"
 #include "function_definitions.h"
 
 namespace vkmock {
@@ -29,6 +31,60 @@ static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInst
     return nullptr;
 }
 
+static VkResult GetObjectCensus(uint32_t* pEntryCount, VkMockObjectCensusEntry* pEntries) {
+    const uint32_t type_count = static_cast<uint32_t>(object_census.size());
+    if (!pEntries) {
+        *pEntryCount = type_count;
+        return VK_SUCCESS;
+    }
+    const uint32_t return_count = (std::min)(*pEntryCount, type_count);
+    for (uint32_t i = 0; i < return_count; ++i) {
+        pEntries[i].typeName = census_type_names[i];
+        pEntries[i].liveCount = object_census[i].live.load(std::memory_order_relaxed);
+        pEntries[i].highWaterMark = object_census[i].high_water_mark.load(std::memory_order_relaxed);
+        pEntries[i].totalCreated = object_census[i].total_created.load(std::memory_order_relaxed);
+    }
+    *pEntryCount = return_count;
+    return return_count < type_count ? VK_INCOMPLETE : VK_SUCCESS;
+}
+
+static void ResetObjectCensusPeaks() {
+    for (auto& counter : object_census) {
+        counter.high_water_mark.store(counter.live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+static void GetSparseBindStatistics(VkMockSparseBindStatistics* pStatistics) {
+    unique_lock_t lock(global_lock);
+    pStatistics->bindSparseCalls = sparse_bind_stats.bind_sparse_calls;
+    pStatistics->bindInfos = sparse_bind_stats.bind_infos;
+    pStatistics->bindRanges = sparse_bind_stats.bind_ranges;
+    pStatistics->pagesBound = sparse_bind_stats.pages_bound;
+    pStatistics->pagesUnbound = sparse_bind_stats.pages_unbound;
+    pStatistics->residentPages = 0;
+    for (const auto& table : sparse_page_tables) {
+        pStatistics->residentPages += table.second.ResidentPageCount();
+    }
+}
+
+static VkBool32 ResolveSparseAddress(uint64_t resource, VkDeviceSize resourceOffset, VkDeviceMemory* pMemory,
+                                     VkDeviceSize* pMemoryOffset) {
+    unique_lock_t lock(global_lock);
+    const auto it = sparse_page_tables.find(resource);
+    if (it == sparse_page_tables.end()) return VK_FALSE;
+    const SparsePageTable::Page* page = it->second.Lookup(resourceOffset / sparse_page_size);
+    if (!page) return VK_FALSE;
+    *pMemory = page->memory;
+    *pMemoryOffset = page->memory_offset + resourceOffset % sparse_page_size;
+    return VK_TRUE;
+}
+
+static uint64_t GetSparseResidentPageCount(uint64_t resource) {
+    unique_lock_t lock(global_lock);
+    const auto it = sparse_page_tables.find(resource);
+    return it != sparse_page_tables.end() ? it->second.ResidentPageCount() : 0;
+}
+
 #if defined(__GNUC__) && __GNUC__ >= 4
 #define EXPORT __attribute__((visibility("default")))
 #elif defined(__SUNPRO_C) && (__SUNPRO_C >= 0x590)
@@ -61,6 +117,25 @@ EXPORT VKAPI_ATTR VkResult VKAPI_CALL vk_icdNegotiateLoaderICDInterfaceVersion(u
     return VK_SUCCESS;
 }
 
+EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkmockGetObjectCensus(uint32_t* pEntryCount, VkMockObjectCensusEntry* pEntries) {
+    return vkmock::GetObjectCensus(pEntryCount, pEntries);
+}
+
+EXPORT VKAPI_ATTR void VKAPI_CALL vkmockResetObjectCensusPeaks() { vkmock::ResetObjectCensusPeaks(); }
+
+EXPORT VKAPI_ATTR void VKAPI_CALL vkmockGetSparseBindStatistics(VkMockSparseBindStatistics* pStatistics) {
+    vkmock::GetSparseBindStatistics(pStatistics);
+}
+
+EXPORT VKAPI_ATTR VkBool32 VKAPI_CALL vkmockResolveSparseAddress(uint64_t resource, VkDeviceSize resourceOffset,
+                                                                 VkDeviceMemory* pMemory, VkDeviceSize* pMemoryOffset) {
+    return vkmock::ResolveSparseAddress(resource, resourceOffset, pMemory, pMemoryOffset);
+}
+
+EXPORT VKAPI_ATTR uint64_t VKAPI_CALL vkmockGetSparseResidentPageCount(uint64_t resource) {
+    return vkmock::GetSparseResidentPageCount(resource);
+}
+
 EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface,
                                                       const VkAllocationCallbacks* pAllocator) {
     vkmock::DestroySurfaceKHR(instance, surface, pAllocator);
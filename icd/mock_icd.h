@@ -21,7 +21,15 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <climits>
+#include <cstdio>
+#include <memory>
 #include <mutex>
+#include <new>
+#include <type_traits>
 #include <unordered_set>
 #include <unordered_map>
 #include <string>
@@ -37,7 +45,18 @@
 #include "vulkan/vulkan.h"
 
 #include "vulkan/vk_icd.h"
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#include <malloc.h>
+#else
+#include <condition_variable>
+#endif
 #include "vk_typemap_helper.h"
+#include "function_declarations.h"
 
 namespace vkmock {
 
@@ -50,37 +69,524 @@ static uint64_t global_unique_handle = 1;
 static const uint32_t SUPPORTED_LOADER_ICD_INTERFACE_VERSION = 5;
 static uint32_t loader_interface_version = 0;
 static bool negotiate_loader_icd_interface_called = false;
-static void* CreateDispObjHandle() {
-    auto handle = new VK_LOADER_DATA;
+
+// Route a host allocation through the application's callbacks, falling back to an aligned allocation from the global heap
+// when there are none
+static void* HostAllocate(const VkAllocationCallbacks* pAllocator, size_t size, size_t alignment, VkSystemAllocationScope scope) {
+    if (pAllocator) {
+        return pAllocator->pfnAllocation(pAllocator->pUserData, size, alignment, scope);
+    }
+    alignment = (std::max)(alignment, sizeof(void*));
+#if defined(_WIN32)
+    return _aligned_malloc(size, alignment);
+#else
+    // aligned_alloc requires the size to be a multiple of the alignment
+    return aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+}
+static void HostFree(const VkAllocationCallbacks* pAllocator, void* memory) {
+    if (pAllocator) {
+        pAllocator->pfnFree(pAllocator->pUserData, memory);
+    } else {
+#if defined(_WIN32)
+        _aligned_free(memory);
+#else
+        free(memory);
+#endif
+    }
+}
+
+// Standard allocator adaptor so container storage owned by an object is charged to that object's allocation callbacks.
+// The callbacks are copied, as the application only has to keep them valid, not the VkAllocationCallbacks struct itself.
+template <typename T>
+class HostAllocator {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    HostAllocator() = default;
+    HostAllocator(const VkAllocationCallbacks* pAllocator, VkSystemAllocationScope scope) : scope_(scope) {
+        if (pAllocator) {
+            callbacks_ = *pAllocator;
+            has_callbacks_ = true;
+        }
+    }
+    template <typename U>
+    HostAllocator(const HostAllocator<U>& other)
+        : callbacks_(other.callbacks_), has_callbacks_(other.has_callbacks_), scope_(other.scope_) {}
+
+    // Throws std::bad_alloc like std::allocator when the callbacks return NULL. No exception may leave an entry point, so
+    // every entry point that grows a container catches it and returns VK_ERROR_OUT_OF_HOST_MEMORY.
+    T* allocate(size_t n) {
+        void* memory = HostAllocate(callbacks(), n * sizeof(T), alignof(T), scope_);
+        if (!memory) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(memory);
+    }
+    void deallocate(T* p, size_t) { HostFree(callbacks(), p); }
+
+    const VkAllocationCallbacks* callbacks() const { return has_callbacks_ ? &callbacks_ : nullptr; }
+    VkSystemAllocationScope scope() const { return scope_; }
+
+    template <typename U>
+    bool operator==(const HostAllocator<U>& other) const {
+        if (has_callbacks_ != other.has_callbacks_) return false;
+        return !has_callbacks_ || (callbacks_.pUserData == other.callbacks_.pUserData &&
+                                   callbacks_.pfnAllocation == other.callbacks_.pfnAllocation &&
+                                   callbacks_.pfnFree == other.callbacks_.pfnFree);
+    }
+    template <typename U>
+    bool operator!=(const HostAllocator<U>& other) const {
+        return !(*this == other);
+    }
+
+  private:
+    template <typename U>
+    friend class HostAllocator;
+
+    VkAllocationCallbacks callbacks_{};
+    bool has_callbacks_ = false;
+    VkSystemAllocationScope scope_ = VK_SYSTEM_ALLOCATION_SCOPE_OBJECT;
+};
+
+template <typename T>
+using host_vector = std::vector<T, HostAllocator<T>>;
+template <typename K>
+using host_unordered_set = std::unordered_set<K, std::hash<K>, std::equal_to<K>, HostAllocator<K>>;
+template <typename K, typename V>
+using host_unordered_map = std::unordered_map<K, V, std::hash<K>, std::equal_to<K>, HostAllocator<std::pair<const K, V>>>;
+
+// A command whose effect the mock applies when the command buffer is submitted. Only event commands have an effect the
+// application can observe; an entry with a secondary command buffer replays that command buffer in place.
+struct RecordedCommand {
+    VkEvent event;
+    bool set_event;
+    VkCommandBuffer secondary;
+};
+
+// Dispatchable objects remember the callbacks they were allocated with, so children (physical devices, queues) can
+// inherit them and the object can be released through the same callbacks regardless of what is passed to destroy.
+struct DispObj {
+    VK_LOADER_DATA loader_data;
+    VkAllocationCallbacks allocator;
+    bool has_allocator;
+};
+// Command buffers also keep the commands they recorded. Recording is externally synchronized, so this needs no lock.
+struct CommandBufferObj : DispObj {
+    host_vector<RecordedCommand> recorded_commands;
+    // vkCmd* commands can't return an error, so a command that couldn't be recorded is reported by vkEndCommandBuffer
+    bool out_of_host_memory = false;
+};
+template <typename T = DispObj>
+static void* CreateDispObjHandle(const VkAllocationCallbacks* pAllocator = nullptr,
+                                 VkSystemAllocationScope scope = VK_SYSTEM_ALLOCATION_SCOPE_OBJECT) {
+    void* memory = HostAllocate(pAllocator, sizeof(T), alignof(T), scope);
+    if (!memory) {
+        return nullptr;
+    }
+    auto handle = new (memory) T();
+    if (pAllocator) {
+        handle->allocator = *pAllocator;
+        handle->has_allocator = true;
+    }
     set_loader_magic_value(handle);
     return handle;
 }
-static void DestroyDispObjHandle(void* handle) { delete reinterpret_cast<VK_LOADER_DATA*>(handle); }
+static void* CreateCommandBufferHandle(const VkAllocationCallbacks* pAllocator) {
+    auto handle = static_cast<CommandBufferObj*>(CreateDispObjHandle<CommandBufferObj>(pAllocator));
+    if (handle) {
+        handle->recorded_commands =
+            host_vector<RecordedCommand>(HostAllocator<RecordedCommand>(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));
+    }
+    return handle;
+}
+static CommandBufferObj* GetCommandBufferObj(VkCommandBuffer handle) { return reinterpret_cast<CommandBufferObj*>(handle); }
+static const VkAllocationCallbacks* GetDispObjAllocator(const void* handle) {
+    auto disp_obj = reinterpret_cast<const DispObj*>(handle);
+    return disp_obj->has_allocator ? &disp_obj->allocator : nullptr;
+}
+template <typename T = DispObj>
+static void DestroyDispObjHandle(void* handle) {
+    auto disp_obj = reinterpret_cast<T*>(handle);
+    const VkAllocationCallbacks allocator = disp_obj->allocator;
+    const bool has_allocator = disp_obj->has_allocator;
+    disp_obj->~T();
+    HostFree(has_allocator ? &allocator : nullptr, disp_obj);
+}
+static void DestroyCommandBufferHandle(VkCommandBuffer handle) { DestroyDispObjHandle<CommandBufferObj>(handle); }
+
+// Events and semaphores are non-dispatchable handles that point straight at their state, so host and queue operations on
+// them are single atomic accesses with no map lookup and no global_lock.
+struct SyncObject {
+    VkAllocationCallbacks allocator;
+    bool has_allocator;
+};
+struct EventState : SyncObject {
+    std::atomic<uint32_t> signaled{0};
+};
+struct SemaphoreState : SyncObject {
+    bool timeline = false;
+    // Timeline counter, or 1/0 for a signaled/unsignaled binary semaphore
+    std::atomic<uint64_t> value{0};
+};
+template <typename T>
+static T* CreateSyncObject(const VkAllocationCallbacks* pAllocator) {
+    void* memory = HostAllocate(pAllocator, sizeof(T), alignof(T), VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    if (!memory) {
+        return nullptr;
+    }
+    auto object = new (memory) T();
+    object->has_allocator = pAllocator != nullptr;
+    if (pAllocator) {
+        object->allocator = *pAllocator;
+    }
+    return object;
+}
+template <typename T>
+static void DestroySyncObject(T* object) {
+    const VkAllocationCallbacks allocator = object->allocator;
+    const bool has_allocator = object->has_allocator;
+    object->~T();
+    HostFree(has_allocator ? &allocator : nullptr, object);
+}
+template <typename T, typename Handle>
+static T* GetSyncObject(Handle handle) {
+    return reinterpret_cast<T*>(handle);
+}
+
+// Host waits sleep on host_wait_epoch, which every timeline signal bumps: a futex on Linux, WaitOnAddress on Windows and a
+// condition variable elsewhere. Signalers skip the wake entirely while nobody is waiting.
+static std::atomic<uint32_t> host_wait_epoch{0};
+static std::atomic<uint32_t> host_waiter_count{0};
+#if !defined(__linux__) && !defined(_WIN32)
+static mutex_t host_wait_lock;
+static std::condition_variable host_wait_cv;
+#endif
+
+// Returns once host_wait_epoch no longer holds epoch, on timeout, or spuriously; callers re-check their condition
+static void SleepOnHostWaitEpoch(uint32_t epoch, uint64_t timeout_ns) {
+#if defined(__linux__)
+    static_assert(sizeof(host_wait_epoch) == sizeof(uint32_t), "futex needs a plain 32-bit word");
+    struct timespec relative_timeout;
+    relative_timeout.tv_sec = static_cast<time_t>((std::min)(timeout_ns / 1000000000, uint64_t(INT32_MAX)));
+    relative_timeout.tv_nsec = static_cast<long>(timeout_ns % 1000000000);
+    syscall(SYS_futex, &host_wait_epoch, FUTEX_WAIT_PRIVATE, epoch, timeout_ns == UINT64_MAX ? nullptr : &relative_timeout,
+            nullptr, 0);
+#elif defined(_WIN32)
+    const DWORD timeout_ms = timeout_ns == UINT64_MAX
+                                 ? INFINITE
+                                 : static_cast<DWORD>((std::min)((timeout_ns + 999999) / 1000000, uint64_t(INFINITE - 1)));
+    WaitOnAddress(&host_wait_epoch, &epoch, sizeof(epoch), timeout_ms);
+#else
+    unique_lock_t lock(host_wait_lock);
+    const auto epoch_changed = [epoch] { return host_wait_epoch.load() != epoch; };
+    if (timeout_ns == UINT64_MAX) {
+        host_wait_cv.wait(lock, epoch_changed);
+    } else {
+        host_wait_cv.wait_for(lock, std::chrono::nanoseconds(timeout_ns), epoch_changed);
+    }
+#endif
+}
+static void WakeHostWaiters() {
+    host_wait_epoch.fetch_add(1);
+    if (host_waiter_count.load() == 0) {
+        return;
+    }
+#if defined(__linux__)
+    syscall(SYS_futex, &host_wait_epoch, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#elif defined(_WIN32)
+    WakeByAddressAll(&host_wait_epoch);
+#else
+    { lock_guard_t lock(host_wait_lock); }
+    host_wait_cv.notify_all();
+#endif
+}
+
+static void SetEventState(VkEvent event, bool signaled) {
+    GetSyncObject<EventState>(event)->signaled.store(signaled ? 1 : 0, std::memory_order_release);
+}
+static void ExecuteRecordedCommands(VkCommandBuffer command_buffer) {
+    for (const auto& command : GetCommandBufferObj(command_buffer)->recorded_commands) {
+        if (command.secondary) {
+            ExecuteRecordedCommands(command.secondary);
+        } else {
+            SetEventState(command.event, command.set_event);
+        }
+    }
+}
+static void RecordCommand(VkCommandBuffer command_buffer, const RecordedCommand& command) {
+    auto command_buffer_obj = GetCommandBufferObj(command_buffer);
+    try {
+        command_buffer_obj->recorded_commands.push_back(command);
+    } catch (const std::bad_alloc&) {
+        command_buffer_obj->out_of_host_memory = true;
+    }
+}
+static void ResetRecordedCommands(VkCommandBuffer command_buffer) {
+    auto command_buffer_obj = GetCommandBufferObj(command_buffer);
+    command_buffer_obj->recorded_commands.clear();
+    command_buffer_obj->out_of_host_memory = false;
+}
+
+// Timeline semaphores only ever move forward; the value is ignored for binary semaphores
+static void SignalSemaphoreState(VkSemaphore semaphore, uint64_t value) {
+    if (!semaphore) return;
+    auto state = GetSyncObject<SemaphoreState>(semaphore);
+    if (!state->timeline) {
+        state->value.store(1, std::memory_order_release);
+        return;
+    }
+    uint64_t current = state->value.load(std::memory_order_relaxed);
+    while (value > current && !state->value.compare_exchange_weak(current, value, std::memory_order_release)) {
+    }
+    WakeHostWaiters();
+}
+// A queue wait on a binary semaphore unsignals it; timeline waits leave the value alone
+static void ConsumeSemaphoreState(VkSemaphore semaphore) {
+    if (!semaphore) return;
+    auto state = GetSyncObject<SemaphoreState>(semaphore);
+    if (!state->timeline) {
+        state->value.store(0, std::memory_order_release);
+    }
+}
+static bool SemaphoreWaitSatisfied(const VkSemaphoreWaitInfo* pWaitInfo) {
+    const bool wait_any = (pWaitInfo->flags & VK_SEMAPHORE_WAIT_ANY_BIT) != 0;
+    for (uint32_t i = 0; i < pWaitInfo->semaphoreCount; ++i) {
+        const auto state = GetSyncObject<SemaphoreState>(pWaitInfo->pSemaphores[i]);
+        const bool reached = state->value.load(std::memory_order_acquire) >= pWaitInfo->pValues[i];
+        if (reached == wait_any) return wait_any;
+    }
+    return !wait_any;
+}
+static VkResult WaitForSemaphoreValues(const VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
+    if (SemaphoreWaitSatisfied(pWaitInfo)) {
+        return VK_SUCCESS;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    VkResult result = VK_TIMEOUT;
+    host_waiter_count.fetch_add(1);
+    for (;;) {
+        const uint32_t epoch = host_wait_epoch.load();
+        if (SemaphoreWaitSatisfied(pWaitInfo)) {
+            result = VK_SUCCESS;
+            break;
+        }
+        const auto elapsed_time = std::chrono::steady_clock::now() - start;
+        const uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed_time).count());
+        if (elapsed >= timeout) {
+            break;
+        }
+        SleepOnHostWaitEpoch(epoch, timeout == UINT64_MAX ? UINT64_MAX : timeout - elapsed);
+    }
+    host_waiter_count.fetch_sub(1);
+    return result;
+}
 
 static constexpr uint32_t icd_physical_device_count = 1;
 static std::unordered_map<VkInstance, std::array<VkPhysicalDevice, icd_physical_device_count>> physical_device_map;
-static std::unordered_map<VkPhysicalDevice, std::unordered_set<VkDisplayKHR>> display_map;
+static std::unordered_map<VkPhysicalDevice, host_unordered_set<VkDisplayKHR>> display_map;
 
 // Map device memory handle to any mapped allocations that we'll need to free on unmap
-static std::unordered_map<VkDeviceMemory, std::vector<void*>> mapped_memory_map;
+// The vector is created with the memory object's allocation callbacks, which the mapped allocations also use
+static std::unordered_map<VkDeviceMemory, host_vector<void*>> mapped_memory_map;
 
 // Map device memory allocation handle to the size
 static std::unordered_map<VkDeviceMemory, VkDeviceSize> allocated_memory_size_map;
 
-static std::unordered_map<VkDevice, std::unordered_map<uint32_t, std::unordered_map<uint32_t, VkQueue>>> queue_map;
+// Queues are keyed by (queueFamilyIndex << 32 | queueIndex)
+static inline uint64_t QueueKey(uint32_t queue_family_index, uint32_t queue_index) {
+    return (static_cast<uint64_t>(queue_family_index) << 32) | queue_index;
+}
+static std::unordered_map<VkDevice, host_unordered_map<uint64_t, VkQueue>> queue_map;
+// Caller holds global_lock
+static VkDevice GetQueueDevice(VkQueue queue) {
+    for (const auto& device_queues : queue_map) {
+        for (const auto& queue_entry : device_queues.second) {
+            if (queue_entry.second == queue) return device_queues.first;
+        }
+    }
+    return VK_NULL_HANDLE;
+}
 static VkDeviceAddress current_available_address = 0x10000000;
 struct BufferState {
     VkDeviceSize size;
     VkDeviceAddress address;
+    VkBufferCreateFlags flags;
 };
-static std::unordered_map<VkDevice, std::unordered_map<VkBuffer, BufferState>> buffer_map;
-static std::unordered_map<VkDevice, std::unordered_map<VkImage, VkDeviceSize>> image_memory_size_map;
-static std::unordered_map<VkDevice, std::unordered_set<VkCommandPool>> command_pool_map;
-static std::unordered_map<VkCommandPool, std::vector<VkCommandBuffer>> command_pool_buffer_map;
+static std::unordered_map<VkDevice, host_unordered_map<VkBuffer, BufferState>> buffer_map;
+static std::unordered_map<VkDevice, host_unordered_map<VkImage, VkDeviceSize>> image_memory_size_map;
+// Create info of every image, with pNext and pQueueFamilyIndices cleared, for queries that depend on the image's shape
+static std::unordered_map<VkDevice, host_unordered_map<VkImage, VkImageCreateInfo>> image_create_info_map;
+static std::unordered_map<VkDevice, host_unordered_set<VkCommandPool>> command_pool_map;
+// The vector is created with the command pool's allocation callbacks, which its command buffers also use
+static std::unordered_map<VkCommandPool, host_vector<VkCommandBuffer>> command_pool_buffer_map;
 
 static constexpr uint32_t icd_swapchain_image_count = 1;
 static std::unordered_map<VkSwapchainKHR, VkImage[icd_swapchain_image_count]> swapchain_image_map;
 
+// Sparse resources are bound in 64 KiB pages, which is also the size of a standard sparse image block
+static constexpr VkDeviceSize sparse_page_size = 65536;
+
+// Page table of one sparse buffer or image: a three-level radix tree indexed by page number within the resource's opaque
+// address range. Nodes are only allocated once a page under them is bound, so a large, sparsely resident resource stays cheap.
+// They are allocated with the callbacks of the resource's device, like the rest of the device's bookkeeping.
+class SparsePageTable {
+  public:
+    struct Page {
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VkDeviceSize memory_offset = 0;
+    };
+
+    explicit SparsePageTable(const VkAllocationCallbacks* pAllocator) : allocator(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT) {}
+    ~SparsePageTable() {
+        for (InnerNode* inner : root) {
+            if (!inner) continue;
+            for (LeafNode* leaf : inner->children) {
+                if (leaf) DestroyNode(leaf);
+            }
+            DestroyNode(inner);
+        }
+    }
+    SparsePageTable(const SparsePageTable&) = delete;
+    SparsePageTable& operator=(const SparsePageTable&) = delete;
+
+    // Binds page_count pages starting at first_page to consecutive pages of memory starting at memory_offset; a null memory
+    // handle unbinds them instead. Pages past the end of the table are ignored. Returns false if a node could not be
+    // allocated, the pages before it are bound.
+    bool Bind(uint64_t first_page, uint64_t page_count, VkDeviceMemory memory, VkDeviceSize memory_offset) {
+        const uint64_t end_page = (std::min)(first_page + page_count, max_page_count);
+        for (uint64_t page = first_page; page < end_page; ++page) {
+            if (memory == VK_NULL_HANDLE) {
+                // Unbinding never allocates, a resident page already has its nodes
+                Page* entry = const_cast<Page*>(Find(page));
+                if (entry && entry->memory != VK_NULL_HANDLE) {
+                    *entry = Page{};
+                    --resident_page_count;
+                }
+            } else {
+                Page* entry = FindOrCreate(page);
+                if (!entry) return false;
+                if (entry->memory == VK_NULL_HANDLE) ++resident_page_count;
+                entry->memory = memory;
+                entry->memory_offset = memory_offset + (page - first_page) * sparse_page_size;
+            }
+        }
+        return true;
+    }
+    // Returns the binding of a page, or nullptr if it is not resident
+    const Page* Lookup(uint64_t page) const {
+        const Page* entry = page < max_page_count ? Find(page) : nullptr;
+        return entry && entry->memory != VK_NULL_HANDLE ? entry : nullptr;
+    }
+    uint64_t ResidentPageCount() const { return resident_page_count; }
+
+  private:
+    static constexpr uint32_t node_bits = 9;
+    static constexpr uint64_t node_size = uint64_t(1) << node_bits;
+    static constexpr uint64_t max_page_count = node_size * node_size * node_size;
+    struct LeafNode {
+        std::array<Page, node_size> pages;
+    };
+    struct InnerNode {
+        std::array<LeafNode*, node_size> children{};
+    };
+
+    template <typename Node>
+    Node* CreateNode() {
+        void* memory = HostAllocate(allocator.callbacks(), sizeof(Node), alignof(Node), allocator.scope());
+        return memory ? new (memory) Node() : nullptr;
+    }
+    template <typename Node>
+    void DestroyNode(Node* node) {
+        node->~Node();
+        HostFree(allocator.callbacks(), node);
+    }
+
+    const Page* Find(uint64_t page) const {
+        const InnerNode* inner = root[page >> (2 * node_bits)];
+        if (!inner) return nullptr;
+        const LeafNode* leaf = inner->children[(page >> node_bits) & (node_size - 1)];
+        if (!leaf) return nullptr;
+        return &leaf->pages[page & (node_size - 1)];
+    }
+    // Returns nullptr if a node could not be allocated
+    Page* FindOrCreate(uint64_t page) {
+        InnerNode*& inner = root[page >> (2 * node_bits)];
+        if (!inner) inner = CreateNode<InnerNode>();
+        if (!inner) return nullptr;
+        LeafNode*& leaf = inner->children[(page >> node_bits) & (node_size - 1)];
+        if (!leaf) leaf = CreateNode<LeafNode>();
+        if (!leaf) return nullptr;
+        return &leaf->pages[page & (node_size - 1)];
+    }
+
+    HostAllocator<Page> allocator;
+    std::array<InnerNode*, node_size> root{};
+    uint64_t resident_page_count = 0;
+};
+// Keyed by the VkBuffer or VkImage handle value, created on the first bind and dropped when the resource is destroyed
+static std::unordered_map<uint64_t, SparsePageTable> sparse_page_tables;
+
+// Running totals over every vkQueueBindSparse call, guarded by global_lock
+struct SparseBindStats {
+    uint64_t bind_sparse_calls = 0;
+    uint64_t bind_infos = 0;
+    uint64_t bind_ranges = 0;
+    uint64_t pages_bound = 0;
+    uint64_t pages_unbound = 0;
+};
+static SparseBindStats sparse_bind_stats;
+
+// Live-object census: per handle type, how many objects are alive now, the most that were alive at once, and how many were
+// ever created. Counters are lock free so they can be bumped from the create/destroy paths that don't take global_lock.
+// Children destroyed implicitly with their parent (command buffers with their pool, descriptor sets with pool reset/destroy,
+// queues with their device, physical devices with their instance) are removed too; anything else the application didn't
+// destroy stays live, so the report at vkDestroyDevice/vkDestroyInstance lists what was leaked.
+struct CensusCounter {
+    std::atomic<uint64_t> live{0};
+    std::atomic<uint64_t> high_water_mark{0};
+    std::atomic<uint64_t> total_created{0};
+};
+static std::array<CensusCounter, static_cast<size_t>(CensusType::Count)> object_census;
+
+// Descriptor sets currently allocated from each pool, so resetting or destroying the pool can retire them
+static std::unordered_map<VkDescriptorPool, uint64_t> descriptor_pool_set_count_map;
+
+static void CensusAdd(CensusType type, uint64_t count = 1) {
+    if (count == 0) return;
+    auto& counter = object_census[static_cast<size_t>(type)];
+    counter.total_created.fetch_add(count, std::memory_order_relaxed);
+    const uint64_t live = counter.live.fetch_add(count, std::memory_order_relaxed) + count;
+    uint64_t peak = counter.high_water_mark.load(std::memory_order_relaxed);
+    while (live > peak && !counter.high_water_mark.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+static void CensusRemove(CensusType type, uint64_t count = 1) {
+    if (count == 0) return;
+    object_census[static_cast<size_t>(type)].live.fetch_sub(count, std::memory_order_relaxed);
+}
+
+// Set VK_MOCK_ICD_OBJECT_CENSUS to a non-zero value to print the census to stderr when a device or instance is destroyed
+static const bool object_census_report_enabled = [] {
+    const char* value = getenv("VK_MOCK_ICD_OBJECT_CENSUS");
+    return value && *value && strcmp(value, "0") != 0;
+}();
+static void ReportObjectCensus(const char* event) {
+    if (!object_census_report_enabled) return;
+    fprintf(stderr, "Mock ICD object census at %s:\n", event);
+    fprintf(stderr, "    %-36s %10s %10s %10s\n", "type", "live", "peak", "created");
+    for (size_t i = 0; i < object_census.size(); ++i) {
+        const uint64_t created = object_census[i].total_created.load(std::memory_order_relaxed);
+        if (created == 0) continue;
+        fprintf(stderr, "    %-36s %10" PRIu64 " %10" PRIu64 " %10" PRIu64 "\n", census_type_names[i],
+                object_census[i].live.load(std::memory_order_relaxed),
+                object_census[i].high_water_mark.load(std::memory_order_relaxed), created);
+    }
+}
+
 // TODO: Would like to codegen this but limits aren't in XML
 static VkPhysicalDeviceLimits SetLimits(VkPhysicalDeviceLimits* limits) {
     limits->maxImageDimension1D = 4096;
@@ -207,6 +713,233 @@ void SetBoolArrayTrue(VkBool32* bool_array, uint32_t num_bools) {
     }
 }
 
+static VkImageAspectFlags GetFormatAspectMask(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_D16_UNORM:
+        case VK_FORMAT_X8_D24_UNORM_PACK32:
+        case VK_FORMAT_D32_SFLOAT:
+            return VK_IMAGE_ASPECT_DEPTH_BIT;
+        case VK_FORMAT_S8_UINT:
+            return VK_IMAGE_ASPECT_STENCIL_BIT;
+        case VK_FORMAT_D16_UNORM_S8_UINT:
+        case VK_FORMAT_D24_UNORM_S8_UINT:
+        case VK_FORMAT_D32_SFLOAT_S8_UINT:
+            return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+        default:
+            return VK_IMAGE_ASPECT_COLOR_BIT;
+    }
+}
+
+static uint32_t Log2(uint32_t power_of_two) {
+    uint32_t log2 = 0;
+    while ((1u << log2) < power_of_two) ++log2;
+    return log2;
+}
+
+// Standard sparse image block shapes: one 64 KiB block is 256x256 texels of an 8-bit format in 2D and 64x32x32 in 3D, with
+// one dimension halved for every doubling of the texel block size or of the sample count. Compressed formats are shaped by
+// block, then scaled to texels. Returns false where no standard shape exists: 1D images, multisampled 3D images and texel
+// blocks that are not a power of two from 1 to 16 bytes.
+static bool GetStandardSparseImageGranularity(VkFormat format, VkImageType type, VkSampleCountFlagBits samples,
+                                              VkExtent3D* granularity) {
+    const TexelBlock block = GetTexelBlock(format);
+    if (block.size == 0 || block.size > 16 || (block.size & (block.size - 1)) != 0) return false;
+    if (samples == 0 || samples > VK_SAMPLE_COUNT_16_BIT || (samples & (samples - 1)) != 0) return false;
+    const uint32_t size_log2 = Log2(block.size);
+    if (type == VK_IMAGE_TYPE_2D) {
+        *granularity = {256, 256, 1};
+        for (uint32_t i = 0; i < size_log2; ++i) (i % 2 == 0 ? granularity->height : granularity->width) /= 2;
+        for (uint32_t i = 0; i < Log2(samples); ++i) (i % 2 == 0 ? granularity->width : granularity->height) /= 2;
+        granularity->width *= block.width;
+        granularity->height *= block.height;
+        return true;
+    }
+    if (type == VK_IMAGE_TYPE_3D && samples == VK_SAMPLE_COUNT_1_BIT) {
+        *granularity = {64, 32, 32};
+        uint32_t VkExtent3D::*const halving_order[] = {&VkExtent3D::width, &VkExtent3D::depth, &VkExtent3D::height,
+                                                        &VkExtent3D::width};
+        for (uint32_t i = 0; i < size_log2; ++i) granularity->*halving_order[i] /= 2;
+        granularity->width *= block.width;
+        granularity->height *= block.height;
+        granularity->depth *= block.depth;
+        return true;
+    }
+    return false;
+}
+
+static VkExtent3D GetMipLevelExtent(const VkImageCreateInfo& create_info, uint32_t mip_level) {
+    return {(std::max)(create_info.extent.width >> mip_level, 1u), (std::max)(create_info.extent.height >> mip_level, 1u),
+            (std::max)(create_info.extent.depth >> mip_level, 1u)};
+}
+
+// Number of granularity-sized tiles needed to cover extent
+static VkDeviceSize CountTiles(VkExtent3D extent, VkExtent3D granularity) {
+    return VkDeviceSize((extent.width + granularity.width - 1) / granularity.width) *
+           ((extent.height + granularity.height - 1) / granularity.height) *
+           ((extent.depth + granularity.depth - 1) / granularity.depth);
+}
+
+// Sparse-resident images are laid out in their opaque page range one array layer after the other, each layer holding the
+// tiles of its mip levels larger than the block shape in order, followed by a single mip tail shared by all layers.
+static bool GetSparseImageMemoryRequirements(const VkImageCreateInfo& create_info, VkSparseImageMemoryRequirements* requirements) {
+    VkExtent3D granularity{};
+    if (!GetStandardSparseImageGranularity(create_info.format, create_info.imageType, create_info.samples, &granularity)) {
+        return false;
+    }
+    const TexelBlock block = GetTexelBlock(create_info.format);
+    requirements->formatProperties.aspectMask = GetFormatAspectMask(create_info.format);
+    requirements->formatProperties.imageGranularity = granularity;
+    requirements->formatProperties.flags = VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT;
+    requirements->imageMipTailFirstLod = create_info.mipLevels;
+    VkDeviceSize layer_tile_count = 0;
+    VkDeviceSize mip_tail_size = 0;
+    for (uint32_t level = 0; level < create_info.mipLevels; ++level) {
+        const VkExtent3D extent = GetMipLevelExtent(create_info, level);
+        if (level < requirements->imageMipTailFirstLod && extent.width >= granularity.width &&
+            extent.height >= granularity.height && extent.depth >= granularity.depth) {
+            layer_tile_count += CountTiles(extent, granularity);
+        } else {
+            requirements->imageMipTailFirstLod = (std::min)(requirements->imageMipTailFirstLod, level);
+            mip_tail_size += CountTiles(extent, {block.width, block.height, block.depth}) * block.size * create_info.samples;
+        }
+    }
+    mip_tail_size *= create_info.arrayLayers;
+    requirements->imageMipTailOffset = layer_tile_count * create_info.arrayLayers * sparse_page_size;
+    requirements->imageMipTailSize = (mip_tail_size + sparse_page_size - 1) / sparse_page_size * sparse_page_size;
+    requirements->imageMipTailStride = 0;
+    return true;
+}
+
+// Opaque page holding the tile at (tile_x, tile_y, tile_z) of a mip level outside the mip tail
+static VkDeviceSize GetSparseImageTilePage(const VkImageCreateInfo& create_info,
+                                           const VkSparseImageMemoryRequirements& requirements, uint32_t array_layer,
+                                           uint32_t mip_level, uint32_t tile_x, uint32_t tile_y, uint32_t tile_z) {
+    const VkExtent3D& granularity = requirements.formatProperties.imageGranularity;
+    VkDeviceSize layer_tile_count = 0;
+    VkDeviceSize level_first_page = 0;
+    for (uint32_t level = 0; level < requirements.imageMipTailFirstLod; ++level) {
+        if (level == mip_level) level_first_page = layer_tile_count;
+        layer_tile_count += CountTiles(GetMipLevelExtent(create_info, level), granularity);
+    }
+    const VkExtent3D extent = GetMipLevelExtent(create_info, mip_level);
+    const VkDeviceSize tiles_x = (extent.width + granularity.width - 1) / granularity.width;
+    const VkDeviceSize tiles_y = (extent.height + granularity.height - 1) / granularity.height;
+    return array_layer * layer_tile_count + level_first_page + (tile_z * tiles_y + tile_y) * tiles_x + tile_x;
+}
+
+// Applies one vkQueueBindSparse bind to the resource's page table; caller holds global_lock. Returns false if the page table
+// ran out of host memory.
+static bool BindSparsePages(VkDevice device, uint64_t resource, VkDeviceSize first_page, VkDeviceSize page_count,
+                            VkDeviceMemory memory, VkDeviceSize memory_offset) {
+    auto table = sparse_page_tables.try_emplace(resource, GetDispObjAllocator(device)).first;
+    (memory != VK_NULL_HANDLE ? sparse_bind_stats.pages_bound : sparse_bind_stats.pages_unbound) += page_count;
+    return table->second.Bind(first_page, page_count, memory, memory_offset);
+}
+
+static bool BindSparseImagePages(VkDevice device, const VkSparseImageMemoryBindInfo& bind_info) {
+    sparse_bind_stats.bind_ranges += bind_info.bindCount;
+    const auto device_images = image_create_info_map.find(device);
+    if (device_images == image_create_info_map.end()) return true;
+    const auto create_info = device_images->second.find(bind_info.image);
+    VkSparseImageMemoryRequirements requirements{};
+    if (create_info == device_images->second.end() || !GetSparseImageMemoryRequirements(create_info->second, &requirements)) {
+        return true;
+    }
+    const VkExtent3D& granularity = requirements.formatProperties.imageGranularity;
+    for (uint32_t i = 0; i < bind_info.bindCount; ++i) {
+        const VkSparseImageMemoryBind& bind = bind_info.pBinds[i];
+        if (bind.subresource.mipLevel >= requirements.imageMipTailFirstLod) continue;
+        const uint32_t first_x = bind.offset.x / granularity.width;
+        const uint32_t first_y = bind.offset.y / granularity.height;
+        const uint32_t first_z = bind.offset.z / granularity.depth;
+        const uint32_t end_x = (bind.offset.x + bind.extent.width + granularity.width - 1) / granularity.width;
+        const uint32_t end_y = (bind.offset.y + bind.extent.height + granularity.height - 1) / granularity.height;
+        const uint32_t end_z = (bind.offset.z + bind.extent.depth + granularity.depth - 1) / granularity.depth;
+        VkDeviceSize memory_offset = bind.memoryOffset;
+        for (uint32_t z = first_z; z < end_z; ++z) {
+            for (uint32_t y = first_y; y < end_y; ++y) {
+                for (uint32_t x = first_x; x < end_x; ++x) {
+                    const VkDeviceSize page = GetSparseImageTilePage(create_info->second, requirements, bind.subresource.arrayLayer,
+                                                                     bind.subresource.mipLevel, x, y, z);
+                    if (!BindSparsePages(device, (uint64_t)bind_info.image, page, 1, bind.memory, memory_offset)) return false;
+                    memory_offset += sparse_page_size;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+// Texel block of one plane of a format and how much smaller than the image that plane is
+static TexelBlock GetPlaneTexelBlock(VkFormat format, uint32_t plane, uint32_t* width_divisor, uint32_t* height_divisor) {
+    const PlaneLayout planes = GetPlaneLayout(format);
+    *width_divisor = 1;
+    *height_divisor = 1;
+    if (planes.plane_count == 1) return GetTexelBlock(format);
+    if (plane == 0) return {planes.component_size, 1, 1, 1};
+    *width_divisor = planes.chroma_width_divisor;
+    *height_divisor = planes.chroma_height_divisor;
+    // The second plane of a 2-plane format interleaves both chroma components
+    return {planes.component_size * (planes.plane_count == 2 ? 2 : 1), 1, 1, 1};
+}
+
+static uint32_t GetAspectPlane(VkImageAspectFlags aspect) {
+    if (aspect & (VK_IMAGE_ASPECT_PLANE_1_BIT | VK_IMAGE_ASPECT_MEMORY_PLANE_1_BIT_EXT)) return 1;
+    if (aspect & (VK_IMAGE_ASPECT_PLANE_2_BIT | VK_IMAGE_ASPECT_MEMORY_PLANE_2_BIT_EXT)) return 2;
+    return 0;
+}
+
+// Row pitch alignment of linear images: VK_MOCK_ICD_LINEAR_ROW_PITCH_ALIGNMENT if it is set to a power of two, otherwise
+// 256 bytes, which is what most desktop drivers require
+static const VkDeviceSize linear_row_pitch_alignment = [] {
+    const char* value = getenv("VK_MOCK_ICD_LINEAR_ROW_PITCH_ALIGNMENT");
+    const unsigned long long alignment = value ? strtoull(value, nullptr, 0) : 0;
+    return (alignment != 0 && (alignment & (alignment - 1)) == 0) ? static_cast<VkDeviceSize>(alignment) : VkDeviceSize(256);
+}();
+
+static VkDeviceSize AlignUp(VkDeviceSize value, VkDeviceSize alignment) { return (value + alignment - 1) / alignment * alignment; }
+
+// Pitches and size of one mip level of one plane; offset and arrayPitch are left to the caller. Zero for unknown formats.
+static VkSubresourceLayout GetLinearMipLevelLayout(const VkImageCreateInfo& create_info, uint32_t plane, uint32_t mip_level) {
+    VkSubresourceLayout layout{};
+    uint32_t width_divisor = 1;
+    uint32_t height_divisor = 1;
+    const TexelBlock block = GetPlaneTexelBlock(create_info.format, plane, &width_divisor, &height_divisor);
+    if (block.size == 0) return layout;
+    const VkExtent3D extent = GetMipLevelExtent(create_info, mip_level);
+    const VkDeviceSize blocks_x = ((extent.width + width_divisor - 1) / width_divisor + block.width - 1) / block.width;
+    const VkDeviceSize blocks_y = ((extent.height + height_divisor - 1) / height_divisor + block.height - 1) / block.height;
+    const VkDeviceSize blocks_z = (extent.depth + block.depth - 1) / block.depth;
+    layout.rowPitch = AlignUp(blocks_x * block.size, linear_row_pitch_alignment);
+    layout.depthPitch = layout.rowPitch * blocks_y;
+    layout.size = layout.depthPitch * blocks_z;
+    return layout;
+}
+
+// Linear images are laid out one array layer after the other. Within a layer each plane holds its mip levels in order, and
+// every subresource starts on a row pitch alignment boundary. Depth and stencil share the same interleaved texels.
+static VkSubresourceLayout GetLinearSubresourceLayout(const VkImageCreateInfo& create_info, VkImageAspectFlags aspect,
+                                                      uint32_t mip_level, uint32_t array_layer) {
+    const uint32_t plane_count = GetPlaneLayout(create_info.format).plane_count;
+    const uint32_t aspect_plane = GetAspectPlane(aspect);
+    VkSubresourceLayout layout{};
+    VkDeviceSize layer_size = 0;
+    for (uint32_t plane = 0; plane < plane_count; ++plane) {
+        for (uint32_t level = 0; level < create_info.mipLevels; ++level) {
+            const VkSubresourceLayout level_layout = GetLinearMipLevelLayout(create_info, plane, level);
+            layer_size = AlignUp(layer_size, linear_row_pitch_alignment);
+            if (plane == aspect_plane && level == mip_level) {
+                layout = level_layout;
+                layout.offset = layer_size;
+            }
+            layer_size += level_layout.size;
+        }
+    }
+    layout.arrayPitch = AlignUp(layer_size, linear_row_pitch_alignment);
+    layout.offset += array_layer * layout.arrayPitch;
+    return layout;
+}
+
 VkDeviceSize GetImageSizeFromCreateInfo(const VkImageCreateInfo* pCreateInfo) {
     VkDeviceSize size = pCreateInfo->extent.width;
     size *= pCreateInfo->extent.height;
@@ -246,6 +979,18 @@ VkDeviceSize GetImageSizeFromCreateInfo(const VkImageCreateInfo* pCreateInfo) {
             break;
     }
 
+    // Linear images need room for their padded rows
+    if (pCreateInfo->tiling == VK_IMAGE_TILING_LINEAR) {
+        size = (std::max)(size, GetLinearSubresourceLayout(*pCreateInfo, 0, 0, 0).arrayPitch * pCreateInfo->arrayLayers);
+    }
+
+    // The opaque range of a sparse-resident image has to hold all of its tiles and the mip tail
+    VkSparseImageMemoryRequirements sparse_requirements{};
+    if ((pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT) &&
+        GetSparseImageMemoryRequirements(*pCreateInfo, &sparse_requirements)) {
+        size = (std::max)(size, sparse_requirements.imageMipTailOffset + sparse_requirements.imageMipTailSize);
+    }
+
     return size;
 }
 
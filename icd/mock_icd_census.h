@@ -0,0 +1,42 @@
+/*
+** Copyright (c) 2015-2018, 2023 The Khronos Group Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+// Query interface for the mock ICD's live-object census. These entry points are exported from the mock ICD library itself
+// (they are not Vulkan commands and are not reachable through the loader), so look them up with dlsym/GetProcAddress.
+
+#pragma once
+
+#include "vulkan/vulkan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct VkMockObjectCensusEntry {
+    const char* typeName;    // Vulkan handle type name, e.g. "VkFence"
+    uint64_t liveCount;      // Objects currently alive
+    uint64_t highWaterMark;  // Most objects alive at once since load or the last peak reset
+    uint64_t totalCreated;   // Objects ever created
+} VkMockObjectCensusEntry;
+
+// Two-call idiom: returns one entry per handle type, VK_INCOMPLETE if pEntries is too small
+typedef VkResult(VKAPI_PTR* PFN_vkmockGetObjectCensus)(uint32_t* pEntryCount, VkMockObjectCensusEntry* pEntries);
+// Lowers every high-water mark to the current live count
+typedef void(VKAPI_PTR* PFN_vkmockResetObjectCensusPeaks)(void);
+
+#ifdef __cplusplus
+}
+#endif
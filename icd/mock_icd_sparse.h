@@ -0,0 +1,47 @@
+/*
+** Copyright (c) 2015-2018, 2023 The Khronos Group Inc.
+**
+** Licensed under the Apache License, Version 2.0 (the "License");
+** you may not use this file except in compliance with the License.
+** You may obtain a copy of the License at
+**
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS,
+** WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+** See the License for the specific language governing permissions and
+** limitations under the License.
+*/
+
+// Query interface for the mock ICD's sparse binding page tables. Like the census entry points these are exported from the
+// mock ICD library itself and have to be looked up with dlsym/GetProcAddress.
+
+#pragma once
+
+#include "vulkan/vulkan.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct VkMockSparseBindStatistics {
+    uint64_t bindSparseCalls;  // vkQueueBindSparse calls
+    uint64_t bindInfos;        // VkBindSparseInfo structures processed
+    uint64_t bindRanges;       // VkSparseMemoryBind and VkSparseImageMemoryBind entries processed
+    uint64_t pagesBound;       // 64 KiB pages bound to memory
+    uint64_t pagesUnbound;     // 64 KiB pages bound to VK_NULL_HANDLE
+    uint64_t residentPages;    // Pages currently bound across all live resources
+} VkMockSparseBindStatistics;
+
+typedef void(VKAPI_PTR* PFN_vkmockGetSparseBindStatistics)(VkMockSparseBindStatistics* pStatistics);
+// Resolves an offset into a sparse buffer or image (the handle cast to uint64_t; image offsets are in the opaque range the
+// sparse memory requirements describe) to the memory bound there. Returns VK_FALSE if that page is not resident.
+typedef VkBool32(VKAPI_PTR* PFN_vkmockResolveSparseAddress)(uint64_t resource, VkDeviceSize resourceOffset,
+                                                           VkDeviceMemory* pMemory, VkDeviceSize* pMemoryOffset);
+// Number of 64 KiB pages of a sparse buffer or image currently bound to memory
+typedef uint64_t(VKAPI_PTR* PFN_vkmockGetSparseResidentPageCount)(uint64_t resource);
+
+#ifdef __cplusplus
+}
+#endif
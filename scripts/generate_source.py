@@ -91,11 +91,21 @@ def RunGenerators(api: str, registry: str, video_registry: str, directory: str,
             'genCombined': False,
             'directory' : mock_icd_generated_directory,
         },
+        'vulkaninfo_chains.hpp': {
+            'generator' : VulkanInfoGenerator,
+            'genCombined': False,
+            'directory' : vulkaninfo_generated_directory,
+        },
         'vulkaninfo.hpp': {
             'generator' : VulkanInfoGenerator,
             'genCombined': False,
             'directory' : vulkaninfo_generated_directory,
         },
+        'vulkaninfo_extensions.hpp': {
+            'generator' : VulkanInfoGenerator,
+            'genCombined': False,
+            'directory' : vulkaninfo_generated_directory,
+        },
     })
 
     unknownTargets = [x for x in (targetFilter if targetFilter else []) if x not in generators.keys()]
@@ -35,28 +35,78 @@ CUSTOM_C_INTERCEPTS = {
     if (loader_interface_version <= 4) {
         return VK_ERROR_INCOMPATIBLE_DRIVER;
     }
-    *pInstance = (VkInstance)CreateDispObjHandle();
-    for (auto& physical_device : physical_device_map[*pInstance])
-        physical_device = (VkPhysicalDevice)CreateDispObjHandle();
+    *pInstance = (VkInstance)CreateDispObjHandle(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    if (!*pInstance) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    unique_lock_t lock(global_lock);
+    const HostAllocator<VkDisplayKHR> instance_allocator(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+    auto& physical_devices = physical_device_map[*pInstance];
+    try {
+        for (auto& physical_device : physical_devices) {
+            physical_device = (VkPhysicalDevice)CreateDispObjHandle(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE);
+            if (!physical_device) {
+                throw std::bad_alloc();
+            }
+            display_map[physical_device] = host_unordered_set<VkDisplayKHR>(instance_allocator);
+        }
+    } catch (const std::bad_alloc&) {
+        for (const auto physical_device : physical_devices) {
+            if (physical_device) {
+                display_map.erase(physical_device);
+                DestroyDispObjHandle((void*)physical_device);
+            }
+        }
+        physical_device_map.erase(*pInstance);
+        DestroyDispObjHandle((void*)*pInstance);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    CensusAdd(CensusType::Instance);
+    CensusAdd(CensusType::PhysicalDevice, icd_physical_device_count);
     // TODO: If emulating specific device caps, will need to add intelligence here
     return VK_SUCCESS;
 ''',
 'vkDestroyInstance': '''
     if (instance) {
+        unique_lock_t lock(global_lock);
         for (const auto physical_device : physical_device_map.at(instance)) {
             display_map.erase(physical_device);
             DestroyDispObjHandle((void*)physical_device);
         }
         physical_device_map.erase(instance);
         DestroyDispObjHandle((void*)instance);
+        CensusRemove(CensusType::PhysicalDevice, icd_physical_device_count);
+        CensusRemove(CensusType::Instance);
+        ReportObjectCensus("vkDestroyInstance");
     }
 ''',
 'vkAllocateCommandBuffers': '''
     unique_lock_t lock(global_lock);
+    auto& command_buffers = command_pool_buffer_map[pAllocateInfo->commandPool];
+    try {
+        command_buffers.reserve(command_buffers.size() + pAllocateInfo->commandBufferCount);
+    } catch (const std::bad_alloc&) {
+        for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
+            pCommandBuffers[i] = VK_NULL_HANDLE;
+        }
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
     for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; ++i) {
-        pCommandBuffers[i] = (VkCommandBuffer)CreateDispObjHandle();
-        command_pool_buffer_map[pAllocateInfo->commandPool].push_back(pCommandBuffers[i]);
+        pCommandBuffers[i] = (VkCommandBuffer)CreateCommandBufferHandle(command_buffers.get_allocator().callbacks());
+        if (!pCommandBuffers[i]) {
+            // Either all of the command buffers are allocated or none of them
+            for (uint32_t j = 0; j < i; ++j) {
+                DestroyCommandBufferHandle(pCommandBuffers[j]);
+            }
+            for (uint32_t j = 0; j < pAllocateInfo->commandBufferCount; ++j) {
+                pCommandBuffers[j] = VK_NULL_HANDLE;
+            }
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
     }
+    // The storage was reserved above, so this can't throw
+    command_buffers.insert(command_buffers.end(), pCommandBuffers, pCommandBuffers + pAllocateInfo->commandBufferCount);
+    CensusAdd(CensusType::CommandBuffer, pAllocateInfo->commandBufferCount);
     return VK_SUCCESS;
 ''',
 'vkFreeCommandBuffers': '''
@@ -74,13 +124,23 @@ CUSTOM_C_INTERCEPTS = {
             }
         }
 
-        DestroyDispObjHandle((void*) pCommandBuffers[i]);
+        DestroyCommandBufferHandle(pCommandBuffers[i]);
+        CensusRemove(CensusType::CommandBuffer);
     }
 ''',
 'vkCreateCommandPool': '''
     unique_lock_t lock(global_lock);
     *pCommandPool = (VkCommandPool)global_unique_handle++;
-    command_pool_map[device].insert(*pCommandPool);
+    const HostAllocator<VkCommandBuffer> pool_allocator(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    try {
+        command_pool_map[device].insert(*pCommandPool);
+        command_pool_buffer_map[*pCommandPool] = host_vector<VkCommandBuffer>(pool_allocator);
+    } catch (const std::bad_alloc&) {
+        command_pool_map[device].erase(*pCommandPool);
+        command_pool_buffer_map.erase(*pCommandPool);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    CensusAdd(CensusType::CommandPool);
     return VK_SUCCESS;
 ''',
 'vkDestroyCommandPool': '''
@@ -89,11 +149,13 @@ CUSTOM_C_INTERCEPTS = {
     auto it = command_pool_buffer_map.find(commandPool);
     if (it != command_pool_buffer_map.end()) {
         for (auto& cb : it->second) {
-            DestroyDispObjHandle((void*) cb);
+            DestroyCommandBufferHandle(cb);
         }
+        CensusRemove(CensusType::CommandBuffer, it->second.size());
         command_pool_buffer_map.erase(it);
     }
     command_pool_map[device].erase(commandPool);
+    if (commandPool) CensusRemove(CensusType::CommandPool);
 ''',
 'vkEnumeratePhysicalDevices': '''
     VkResult result_code = VK_SUCCESS;
@@ -108,7 +170,54 @@ CUSTOM_C_INTERCEPTS = {
     return result_code;
 ''',
 'vkCreateDevice': '''
-    *pDevice = (VkDevice)CreateDispObjHandle();
+    *pDevice = (VkDevice)CreateDispObjHandle(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+    if (!*pDevice) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    // Per-device bookkeeping is charged to the device's allocation callbacks
+    unique_lock_t lock(global_lock);
+    const HostAllocator<VkDevice> device_allocator(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+    try {
+        queue_map[*pDevice] = host_unordered_map<uint64_t, VkQueue>(device_allocator);
+        buffer_map[*pDevice] = host_unordered_map<VkBuffer, BufferState>(device_allocator);
+        image_memory_size_map[*pDevice] = host_unordered_map<VkImage, VkDeviceSize>(device_allocator);
+        image_create_info_map[*pDevice] = host_unordered_map<VkImage, VkImageCreateInfo>(device_allocator);
+        command_pool_map[*pDevice] = host_unordered_set<VkCommandPool>(device_allocator);
+        // The queues the device is created with exist from the start, since vkGetDeviceQueue can't report a failure
+        auto& queues = queue_map[*pDevice];
+        for (uint32_t i = 0; i < pCreateInfo->queueCreateInfoCount; ++i) {
+            const VkDeviceQueueCreateInfo& queue_create_info = pCreateInfo->pQueueCreateInfos[i];
+            for (uint32_t queue_index = 0; queue_index < queue_create_info.queueCount; ++queue_index) {
+                auto& queue = queues[QueueKey(queue_create_info.queueFamilyIndex, queue_index)];
+                if (queue) {
+                    continue;
+                }
+                queue = (VkQueue)CreateDispObjHandle(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+                if (!queue) {
+                    throw std::bad_alloc();
+                }
+                CensusAdd(CensusType::Queue);
+            }
+        }
+    } catch (const std::bad_alloc&) {
+        auto queues = queue_map.find(*pDevice);
+        if (queues != queue_map.end()) {
+            for (const auto& queue_pair : queues->second) {
+                if (queue_pair.second) {
+                    DestroyDispObjHandle((void*)queue_pair.second);
+                    CensusRemove(CensusType::Queue);
+                }
+            }
+            queue_map.erase(queues);
+        }
+        buffer_map.erase(*pDevice);
+        image_memory_size_map.erase(*pDevice);
+        image_create_info_map.erase(*pDevice);
+        command_pool_map.erase(*pDevice);
+        DestroyDispObjHandle((void*)*pDevice);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    CensusAdd(CensusType::Device);
     // TODO: If emulating specific device caps, will need to add intelligence here
     return VK_SUCCESS;
 ''',
@@ -116,34 +225,45 @@ CUSTOM_C_INTERCEPTS = {
     unique_lock_t lock(global_lock);
     // First destroy sub-device objects
     // Destroy Queues
-    for (auto queue_family_map_pair : queue_map[device]) {
-        for (auto index_queue_pair : queue_map[device][queue_family_map_pair.first]) {
-            DestroyDispObjHandle((void*)index_queue_pair.second);
-        }
+    for (const auto& queue_pair : queue_map[device]) {
+        DestroyDispObjHandle((void*)queue_pair.second);
+        CensusRemove(CensusType::Queue);
     }
 
     for (auto& cp : command_pool_map[device]) {
         for (auto& cb : command_pool_buffer_map[cp]) {
-            DestroyDispObjHandle((void*) cb);
+            DestroyCommandBufferHandle(cb);
         }
         command_pool_buffer_map.erase(cp);
     }
-    command_pool_map[device].clear();
+
+    // Page tables of leaked sparse resources hold the device's allocation callbacks
+    for (const auto& buffer : buffer_map[device]) sparse_page_tables.erase((uint64_t)buffer.first);
+    for (const auto& image : image_memory_size_map[device]) sparse_page_tables.erase((uint64_t)image.first);
 
     queue_map.erase(device);
     buffer_map.erase(device);
     image_memory_size_map.erase(device);
+    image_create_info_map.erase(device);
+    command_pool_map.erase(device);
     // Now destroy device
     DestroyDispObjHandle((void*)device);
+    CensusRemove(CensusType::Device);
+    ReportObjectCensus("vkDestroyDevice");
     // TODO: If emulating specific device caps, will need to add intelligence here
 ''',
 'vkGetDeviceQueue': '''
     unique_lock_t lock(global_lock);
-    auto queue = queue_map[device][queueFamilyIndex][queueIndex];
-    if (queue) {
+    // Queues the device wasn't created with are made on first use, which returns no queue if that runs out of host memory
+    try {
+        auto& queue = queue_map[device][QueueKey(queueFamilyIndex, queueIndex)];
+        if (!queue) {
+            queue = (VkQueue)CreateDispObjHandle(GetDispObjAllocator(device), VK_SYSTEM_ALLOCATION_SCOPE_DEVICE);
+            if (queue) CensusAdd(CensusType::Queue);
+        }
         *pQueue = queue;
-    } else {
-        *pQueue = queue_map[device][queueFamilyIndex][queueIndex] = (VkQueue)CreateDispObjHandle();
+    } catch (const std::bad_alloc&) {
+        *pQueue = VK_NULL_HANDLE;
     }
     // TODO: If emulating specific device caps, will need to add intelligence here
     return;
@@ -546,30 +666,16 @@ CUSTOM_C_INTERCEPTS = {
     return VK_SUCCESS;
 ''',
 'vkGetPhysicalDeviceSparseImageFormatProperties': '''
-    if (!pProperties) {
+    VkExtent3D granularity{};
+    if (!GetStandardSparseImageGranularity(format, type, samples, &granularity)) {
+        *pPropertyCount = 0;
+    } else if (!pProperties) {
         *pPropertyCount = 1;
-    } else {
-        // arbitrary
-        pProperties->imageGranularity = {4, 4, 4};
+    } else if (*pPropertyCount > 0) {
+        pProperties->imageGranularity = granularity;
         pProperties->flags = VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT;
-        switch (format) {
-            case VK_FORMAT_D16_UNORM:
-            case VK_FORMAT_D32_SFLOAT:
-                pProperties->aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
-                break;
-            case VK_FORMAT_S8_UINT:
-                pProperties->aspectMask = VK_IMAGE_ASPECT_STENCIL_BIT;
-                break;
-            case VK_FORMAT_X8_D24_UNORM_PACK32:
-            case VK_FORMAT_D16_UNORM_S8_UINT:
-            case VK_FORMAT_D24_UNORM_S8_UINT:
-            case VK_FORMAT_D32_SFLOAT_S8_UINT:
-                pProperties->aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
-                break;
-            default:
-                pProperties->aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-                break;
-        }
+        pProperties->aspectMask = GetFormatAspectMask(format);
+        *pPropertyCount = 1;
     }
 ''',
 'vkGetPhysicalDeviceSparseImageFormatProperties2KHR': '''
@@ -793,6 +899,11 @@ CUSTOM_C_INTERCEPTS = {
         auto iter = d_iter->second.find(buffer);
         if (iter != d_iter->second.end()) {
             pMemoryRequirements->size = ((iter->second.size + 4095) / 4096) * 4096;
+            // Sparse buffers are bound a whole page at a time
+            if (iter->second.flags & VK_BUFFER_CREATE_SPARSE_BINDING_BIT) {
+                pMemoryRequirements->size = (iter->second.size + sparse_page_size - 1) / sparse_page_size * sparse_page_size;
+                pMemoryRequirements->alignment = sparse_page_size;
+            }
         }
     }
 ''',
@@ -806,6 +917,12 @@ CUSTOM_C_INTERCEPTS = {
 
     // Return a size based on the buffer size from the create info.
     pMemoryRequirements->memoryRequirements.size = ((pInfo->pCreateInfo->size + 4095) / 4096) * 4096;
+    // Sparse buffers are bound a whole page at a time
+    if (pInfo->pCreateInfo->flags & VK_BUFFER_CREATE_SPARSE_BINDING_BIT) {
+        pMemoryRequirements->memoryRequirements.size =
+            (pInfo->pCreateInfo->size + sparse_page_size - 1) / sparse_page_size * sparse_page_size;
+        pMemoryRequirements->memoryRequirements.alignment = sparse_page_size;
+    }
 ''',
 'vkGetDeviceBufferMemoryRequirementsKHR': '''
     GetDeviceBufferMemoryRequirements(device, pInfo, pMemoryRequirements);
@@ -822,6 +939,14 @@ CUSTOM_C_INTERCEPTS = {
             pMemoryRequirements->size = iter->second;
         }
     }
+    // Sparse images are bound a whole page at a time
+    auto info_iter = image_create_info_map.find(device);
+    if (info_iter != image_create_info_map.end()) {
+        auto iter = info_iter->second.find(image);
+        if (iter != info_iter->second.end() && (iter->second.flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT)) {
+            pMemoryRequirements->alignment = sparse_page_size;
+        }
+    }
     // Here we hard-code that the memory type at index 3 doesn't support this image.
     pMemoryRequirements->memoryTypeBits = 0xFFFF & ~(0x1 << 3);
 ''',
@@ -830,7 +955,8 @@ CUSTOM_C_INTERCEPTS = {
 ''',
 'vkGetDeviceImageMemoryRequirements': '''
     pMemoryRequirements->memoryRequirements.size = GetImageSizeFromCreateInfo(pInfo->pCreateInfo);
-    pMemoryRequirements->memoryRequirements.alignment = 1;
+    pMemoryRequirements->memoryRequirements.alignment =
+        (pInfo->pCreateInfo->flags & VK_IMAGE_CREATE_SPARSE_BINDING_BIT) ? sparse_page_size : 1;
     // Here we hard-code that the memory type at index 3 doesn't support this image.
     pMemoryRequirements->memoryRequirements.memoryTypeBits = 0xFFFF & ~(0x1 << 3);
 ''',
@@ -845,8 +971,18 @@ CUSTOM_C_INTERCEPTS = {
         else
             size = 0x10000;
     }
-    void* map_addr = malloc((size_t)size);
-    mapped_memory_map[memory].push_back(map_addr);
+    // Mappings are charged to the allocation callbacks the memory object was allocated with
+    auto& mappings = mapped_memory_map[memory];
+    void* map_addr = HostAllocate(mappings.get_allocator().callbacks(), (size_t)size, 64, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT);
+    if (!map_addr) {
+        return VK_ERROR_MEMORY_MAP_FAILED;
+    }
+    try {
+        mappings.push_back(map_addr);
+    } catch (const std::bad_alloc&) {
+        HostFree(mappings.get_allocator().callbacks(), map_addr);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
     *ppData = map_addr;
     return VK_SUCCESS;
 ''',
@@ -855,10 +991,13 @@ CUSTOM_C_INTERCEPTS = {
 ''',
 'vkUnmapMemory': '''
     unique_lock_t lock(global_lock);
-    for (auto map_addr : mapped_memory_map[memory]) {
-        free(map_addr);
+    auto it = mapped_memory_map.find(memory);
+    if (it != mapped_memory_map.end()) {
+        for (auto map_addr : it->second) {
+            HostFree(it->second.get_allocator().callbacks(), map_addr);
+        }
+        it->second.clear();
     }
-    mapped_memory_map.erase(memory);
 ''',
 'vkUnmapMemory2KHR': '''
     UnmapMemory(device, pMemoryUnmapInfo->memory);
@@ -867,6 +1006,34 @@ CUSTOM_C_INTERCEPTS = {
 'vkGetImageSubresourceLayout': '''
     // Need safe values. Callers are computing memory offsets from pLayout, with no return code to flag failure.
     *pLayout = VkSubresourceLayout(); // Default constructor zero values.
+    unique_lock_t lock(global_lock);
+    auto d_iter = image_create_info_map.find(device);
+    if (d_iter != image_create_info_map.end()) {
+        auto iter = d_iter->second.find(image);
+        if (iter != d_iter->second.end()) {
+            *pLayout = GetLinearSubresourceLayout(iter->second, pSubresource->aspectMask, pSubresource->mipLevel,
+                                                  pSubresource->arrayLayer);
+        }
+    }
+''',
+'vkGetImageSubresourceLayout2KHR': '''
+    GetImageSubresourceLayout(device, image, &pSubresource->imageSubresource, &pLayout->subresourceLayout);
+    auto* host_memcpy_size = lvl_find_mod_in_chain<VkSubresourceHostMemcpySize>(pLayout->pNext);
+    if (host_memcpy_size) {
+        host_memcpy_size->size = pLayout->subresourceLayout.size;
+    }
+''',
+'vkGetImageSubresourceLayout2EXT': '''
+    GetImageSubresourceLayout2KHR(device, image, pSubresource, pLayout);
+''',
+'vkGetDeviceImageSubresourceLayoutKHR': '''
+    const VkImageSubresource& subresource = pInfo->pSubresource->imageSubresource;
+    pLayout->subresourceLayout =
+        GetLinearSubresourceLayout(*pInfo->pCreateInfo, subresource.aspectMask, subresource.mipLevel, subresource.arrayLayer);
+    auto* host_memcpy_size = lvl_find_mod_in_chain<VkSubresourceHostMemcpySize>(pLayout->pNext);
+    if (host_memcpy_size) {
+        host_memcpy_size->size = pLayout->subresourceLayout.size;
+    }
 ''',
 'vkCreateSwapchainKHR': '''
     unique_lock_t lock(global_lock);
@@ -874,11 +1041,13 @@ CUSTOM_C_INTERCEPTS = {
     for(uint32_t i = 0; i < icd_swapchain_image_count; ++i){
         swapchain_image_map[*pSwapchain][i] = (VkImage)global_unique_handle++;
     }
+    CensusAdd(CensusType::SwapchainKHR);
     return VK_SUCCESS;
 ''',
 'vkDestroySwapchainKHR': '''
     unique_lock_t lock(global_lock);
     swapchain_image_map.clear();
+    if (swapchain) CensusRemove(CensusType::SwapchainKHR);
 ''',
 'vkGetSwapchainImagesKHR': '''
     if (!pSwapchainImages) {
@@ -896,40 +1065,97 @@ CUSTOM_C_INTERCEPTS = {
 ''',
 'vkAcquireNextImageKHR': '''
     *pImageIndex = 0;
+    SignalSemaphoreState(semaphore, 0);
     return VK_SUCCESS;
 ''',
 'vkAcquireNextImage2KHR': '''
     *pImageIndex = 0;
+    SignalSemaphoreState(pAcquireInfo->semaphore, 0);
     return VK_SUCCESS;
 ''',
 'vkCreateBuffer': '''
     unique_lock_t lock(global_lock);
     *pBuffer = (VkBuffer)global_unique_handle++;
-     buffer_map[device][*pBuffer] = {
-         pCreateInfo->size,
-         current_available_address
-     };
+    try {
+        buffer_map[device][*pBuffer] = {pCreateInfo->size, current_available_address, pCreateInfo->flags};
+    } catch (const std::bad_alloc&) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
      current_available_address += pCreateInfo->size;
      // Always align to next 64-bit pointer
      const uint64_t alignment = current_available_address % 64;
      if (alignment != 0) {
          current_available_address += (64 - alignment);
      }
+    CensusAdd(CensusType::Buffer);
     return VK_SUCCESS;
 ''',
 'vkDestroyBuffer': '''
     unique_lock_t lock(global_lock);
     buffer_map[device].erase(buffer);
+    sparse_page_tables.erase((uint64_t)buffer);
+    if (buffer) CensusRemove(CensusType::Buffer);
 ''',
 'vkCreateImage': '''
     unique_lock_t lock(global_lock);
     *pImage = (VkImage)global_unique_handle++;
-    image_memory_size_map[device][*pImage] = GetImageSizeFromCreateInfo(pCreateInfo);
+    try {
+        image_memory_size_map[device][*pImage] = GetImageSizeFromCreateInfo(pCreateInfo);
+        VkImageCreateInfo& create_info = image_create_info_map[device][*pImage];
+        create_info = *pCreateInfo;
+        create_info.pNext = nullptr;
+        create_info.queueFamilyIndexCount = 0;
+        create_info.pQueueFamilyIndices = nullptr;
+    } catch (const std::bad_alloc&) {
+        image_memory_size_map[device].erase(*pImage);
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    CensusAdd(CensusType::Image);
     return VK_SUCCESS;
 ''',
 'vkDestroyImage': '''
     unique_lock_t lock(global_lock);
     image_memory_size_map[device].erase(image);
+    image_create_info_map[device].erase(image);
+    sparse_page_tables.erase((uint64_t)image);
+    if (image) CensusRemove(CensusType::Image);
+''',
+'vkDestroyDescriptorPool': '''
+    if (descriptorPool) CensusRemove(CensusType::DescriptorPool);
+    unique_lock_t lock(global_lock);
+    auto it = descriptor_pool_set_count_map.find(descriptorPool);
+    if (it != descriptor_pool_set_count_map.end()) {
+        CensusRemove(CensusType::DescriptorSet, it->second);
+        descriptor_pool_set_count_map.erase(it);
+    }
+''',
+'vkResetDescriptorPool': '''
+    unique_lock_t lock(global_lock);
+    auto it = descriptor_pool_set_count_map.find(descriptorPool);
+    if (it != descriptor_pool_set_count_map.end()) {
+        CensusRemove(CensusType::DescriptorSet, it->second);
+        it->second = 0;
+    }
+    return VK_SUCCESS;
+''',
+'vkAllocateDescriptorSets': '''
+    unique_lock_t lock(global_lock);
+    for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; ++i) {
+        pDescriptorSets[i] = (VkDescriptorSet)global_unique_handle++;
+    }
+    descriptor_pool_set_count_map[pAllocateInfo->descriptorPool] += pAllocateInfo->descriptorSetCount;
+    CensusAdd(CensusType::DescriptorSet, pAllocateInfo->descriptorSetCount);
+    return VK_SUCCESS;
+''',
+'vkFreeDescriptorSets': '''
+    uint64_t freed = 0;
+    for (uint32_t i = 0; i < descriptorSetCount; ++i) {
+        if (pDescriptorSets[i]) ++freed;
+    }
+    unique_lock_t lock(global_lock);
+    descriptor_pool_set_count_map[descriptorPool] -= freed;
+    CensusRemove(CensusType::DescriptorSet, freed);
+    return VK_SUCCESS;
 ''',
 'vkEnumeratePhysicalDeviceGroupsKHR': '''
     if (!pPhysicalDeviceGroupProperties) {
@@ -1028,20 +1254,25 @@ CUSTOM_C_INTERCEPTS = {
     }
 ''',
 'vkGetImageSparseMemoryRequirements': '''
-    if (!pSparseMemoryRequirements) {
+    // Only images with a standard sparse block shape have requirements
+    VkSparseImageMemoryRequirements requirements{};
+    bool supported = false;
+    {
+        unique_lock_t lock(global_lock);
+        auto d_iter = image_create_info_map.find(device);
+        if (d_iter != image_create_info_map.end()) {
+            auto iter = d_iter->second.find(image);
+            supported = iter != d_iter->second.end() && GetSparseImageMemoryRequirements(iter->second, &requirements);
+        }
+    }
+    if (!supported) {
+        *pSparseMemoryRequirementCount = 0;
+    } else if (!pSparseMemoryRequirements) {
+        *pSparseMemoryRequirementCount = 1;
+    } else if (*pSparseMemoryRequirementCount > 0) {
+        *pSparseMemoryRequirements = requirements;
         *pSparseMemoryRequirementCount = 1;
-    } else {
-        // arbitrary
-        pSparseMemoryRequirements->imageMipTailFirstLod = 0;
-        pSparseMemoryRequirements->imageMipTailSize = 8;
-        pSparseMemoryRequirements->imageMipTailOffset = 0;
-        pSparseMemoryRequirements->imageMipTailStride = 4;
-        pSparseMemoryRequirements->formatProperties.imageGranularity = {4, 4, 4};
-        pSparseMemoryRequirements->formatProperties.flags = VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT;
-        // Would need to track the VkImage to know format for better value here
-        pSparseMemoryRequirements->formatProperties.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT | VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT | VK_IMAGE_ASPECT_METADATA_BIT;
     }
-
 ''',
 'vkGetImageSparseMemoryRequirements2KHR': '''
     if (pSparseMemoryRequirementCount && pSparseMemoryRequirements) {
@@ -1050,6 +1281,17 @@ CUSTOM_C_INTERCEPTS = {
         GetImageSparseMemoryRequirements(device, pInfo->image, pSparseMemoryRequirementCount, nullptr);
     }
 ''',
+'vkGetDeviceImageSparseMemoryRequirementsKHR': '''
+    VkSparseImageMemoryRequirements requirements{};
+    if (!GetSparseImageMemoryRequirements(*pInfo->pCreateInfo, &requirements)) {
+        *pSparseMemoryRequirementCount = 0;
+    } else if (!pSparseMemoryRequirements) {
+        *pSparseMemoryRequirementCount = 1;
+    } else if (*pSparseMemoryRequirementCount > 0) {
+        pSparseMemoryRequirements->memoryRequirements = requirements;
+        *pSparseMemoryRequirementCount = 1;
+    }
+''',
 'vkGetBufferDeviceAddress': '''
     VkDeviceAddress address = 0;
     auto d_iter = buffer_map.find(device);
@@ -1170,7 +1412,11 @@ CUSTOM_C_INTERCEPTS = {
         *pPropertyCount = 1;
         pProperties[0].display = (VkDisplayKHR)global_unique_handle++;
         pProperties[0].displayName = "Vulkan Mock Display";
-        display_map[physicalDevice].insert(pProperties[0].display);
+        try {
+            display_map[physicalDevice].insert(pProperties[0].display);
+        } catch (const std::bad_alloc&) {
+            return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
     }
     return VK_SUCCESS;
 ''',
@@ -1199,8 +1445,120 @@ CUSTOM_C_INTERCEPTS = {
 'vkRegisterDisplayEventEXT': '''
     unique_lock_t lock(global_lock);
     *pFence = (VkFence)global_unique_handle++;
+    CensusAdd(CensusType::Fence);
     return VK_SUCCESS;
 ''',
+'vkBeginCommandBuffer': '''
+    // Beginning a command buffer implicitly resets it
+    ResetRecordedCommands(commandBuffer);
+    return VK_SUCCESS;
+''',
+'vkEndCommandBuffer': '''
+    return GetCommandBufferObj(commandBuffer)->out_of_host_memory ? VK_ERROR_OUT_OF_HOST_MEMORY : VK_SUCCESS;
+''',
+'vkResetCommandBuffer': '''
+    ResetRecordedCommands(commandBuffer);
+    return VK_SUCCESS;
+''',
+'vkResetCommandPool': '''
+    unique_lock_t lock(global_lock);
+    auto it = command_pool_buffer_map.find(commandPool);
+    if (it != command_pool_buffer_map.end()) {
+        for (auto& cb : it->second) {
+            ResetRecordedCommands(cb);
+        }
+    }
+    return VK_SUCCESS;
+''',
+'vkCmdExecuteCommands': '''
+    for (uint32_t i = 0; i < commandBufferCount; ++i) {
+        RecordCommand(commandBuffer, {VK_NULL_HANDLE, false, pCommandBuffers[i]});
+    }
+''',
+'vkCreateEvent': '''
+    auto state = CreateSyncObject<EventState>(pAllocator);
+    if (!state) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    *pEvent = reinterpret_cast<VkEvent>(state);
+    CensusAdd(CensusType::Event);
+    return VK_SUCCESS;
+''',
+'vkDestroyEvent': '''
+    if (event) {
+        DestroySyncObject(GetSyncObject<EventState>(event));
+        CensusRemove(CensusType::Event);
+    }
+''',
+'vkGetEventStatus': '''
+    return GetSyncObject<EventState>(event)->signaled.load(std::memory_order_acquire) ? VK_EVENT_SET : VK_EVENT_RESET;
+''',
+'vkSetEvent': '''
+    SetEventState(event, true);
+    return VK_SUCCESS;
+''',
+'vkResetEvent': '''
+    SetEventState(event, false);
+    return VK_SUCCESS;
+''',
+'vkCmdSetEvent': '''
+    RecordCommand(commandBuffer, {event, true, VK_NULL_HANDLE});
+''',
+'vkCmdResetEvent': '''
+    RecordCommand(commandBuffer, {event, false, VK_NULL_HANDLE});
+''',
+'vkCmdSetEvent2': '''
+    RecordCommand(commandBuffer, {event, true, VK_NULL_HANDLE});
+''',
+'vkCmdSetEvent2KHR': '''
+    CmdSetEvent2(commandBuffer, event, pDependencyInfo);
+''',
+'vkCmdResetEvent2': '''
+    RecordCommand(commandBuffer, {event, false, VK_NULL_HANDLE});
+''',
+'vkCmdResetEvent2KHR': '''
+    CmdResetEvent2(commandBuffer, event, stageMask);
+''',
+'vkCreateSemaphore': '''
+    auto state = CreateSyncObject<SemaphoreState>(pAllocator);
+    if (!state) {
+        return VK_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    const auto* type_info = lvl_find_in_chain<VkSemaphoreTypeCreateInfo>(pCreateInfo->pNext);
+    if (type_info && type_info->semaphoreType == VK_SEMAPHORE_TYPE_TIMELINE) {
+        state->timeline = true;
+        state->value.store(type_info->initialValue, std::memory_order_relaxed);
+    }
+    *pSemaphore = reinterpret_cast<VkSemaphore>(state);
+    CensusAdd(CensusType::Semaphore);
+    return VK_SUCCESS;
+''',
+'vkDestroySemaphore': '''
+    if (semaphore) {
+        DestroySyncObject(GetSyncObject<SemaphoreState>(semaphore));
+        CensusRemove(CensusType::Semaphore);
+    }
+''',
+'vkGetSemaphoreCounterValue': '''
+    *pValue = GetSyncObject<SemaphoreState>(semaphore)->value.load(std::memory_order_acquire);
+    return VK_SUCCESS;
+''',
+'vkGetSemaphoreCounterValueKHR': '''
+    return GetSemaphoreCounterValue(device, semaphore, pValue);
+''',
+'vkWaitSemaphores': '''
+    return WaitForSemaphoreValues(pWaitInfo, timeout);
+''',
+'vkWaitSemaphoresKHR': '''
+    return WaitSemaphores(device, pWaitInfo, timeout);
+''',
+'vkSignalSemaphore': '''
+    SignalSemaphoreState(pSignalInfo->semaphore, pSignalInfo->value);
+    return VK_SUCCESS;
+''',
+'vkSignalSemaphoreKHR': '''
+    return SignalSemaphore(device, pSignalInfo);
+''',
 'vkQueueSubmit': '''
     // Special way to cause DEVICE_LOST
     // Picked VkExportFenceCreateInfo because needed some struct that wouldn't get cleared by validation Safe Struct
@@ -1212,6 +1570,91 @@ CUSTOM_C_INTERCEPTS = {
             return VK_ERROR_DEVICE_LOST;
         }
     }
+    // Submissions execute synchronously: waits, recorded event commands and signals take effect in submission order
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        const VkSubmitInfo& submit = pSubmits[i];
+        const auto* timeline_info = lvl_find_in_chain<VkTimelineSemaphoreSubmitInfo>(submit.pNext);
+        for (uint32_t j = 0; j < submit.waitSemaphoreCount; ++j) {
+            ConsumeSemaphoreState(submit.pWaitSemaphores[j]);
+        }
+        for (uint32_t j = 0; j < submit.commandBufferCount; ++j) {
+            ExecuteRecordedCommands(submit.pCommandBuffers[j]);
+        }
+        for (uint32_t j = 0; j < submit.signalSemaphoreCount; ++j) {
+            const bool has_value =
+                timeline_info && timeline_info->pSignalSemaphoreValues && j < timeline_info->signalSemaphoreValueCount;
+            SignalSemaphoreState(submit.pSignalSemaphores[j], has_value ? timeline_info->pSignalSemaphoreValues[j] : 0);
+        }
+    }
+    return VK_SUCCESS;
+''',
+'vkQueueSubmit2': '''
+    for (uint32_t i = 0; i < submitCount; ++i) {
+        const VkSubmitInfo2& submit = pSubmits[i];
+        for (uint32_t j = 0; j < submit.waitSemaphoreInfoCount; ++j) {
+            ConsumeSemaphoreState(submit.pWaitSemaphoreInfos[j].semaphore);
+        }
+        for (uint32_t j = 0; j < submit.commandBufferInfoCount; ++j) {
+            ExecuteRecordedCommands(submit.pCommandBufferInfos[j].commandBuffer);
+        }
+        for (uint32_t j = 0; j < submit.signalSemaphoreInfoCount; ++j) {
+            SignalSemaphoreState(submit.pSignalSemaphoreInfos[j].semaphore, submit.pSignalSemaphoreInfos[j].value);
+        }
+    }
+    return VK_SUCCESS;
+''',
+'vkQueueSubmit2KHR': '''
+    return QueueSubmit2(queue, submitCount, pSubmits, fence);
+''',
+'vkQueueBindSparse': '''
+    // Binds are applied in order and take effect immediately, like the rest of the mock's queue work
+    unique_lock_t lock(global_lock);
+    const VkDevice device = GetQueueDevice(queue);
+    ++sparse_bind_stats.bind_sparse_calls;
+    sparse_bind_stats.bind_infos += bindInfoCount;
+    for (uint32_t i = 0; i < bindInfoCount; ++i) {
+        const VkBindSparseInfo& bind_info = pBindInfo[i];
+        const auto* timeline_info = lvl_find_in_chain<VkTimelineSemaphoreSubmitInfo>(bind_info.pNext);
+        for (uint32_t j = 0; j < bind_info.waitSemaphoreCount; ++j) {
+            ConsumeSemaphoreState(bind_info.pWaitSemaphores[j]);
+        }
+        for (uint32_t j = 0; j < bind_info.bufferBindCount; ++j) {
+            const VkSparseBufferMemoryBindInfo& buffer_bind = bind_info.pBufferBinds[j];
+            sparse_bind_stats.bind_ranges += buffer_bind.bindCount;
+            for (uint32_t k = 0; k < buffer_bind.bindCount; ++k) {
+                const VkSparseMemoryBind& bind = buffer_bind.pBinds[k];
+                if (!BindSparsePages(device, (uint64_t)buffer_bind.buffer, bind.resourceOffset / sparse_page_size,
+                                     (bind.size + sparse_page_size - 1) / sparse_page_size, bind.memory, bind.memoryOffset)) {
+                    return VK_ERROR_OUT_OF_HOST_MEMORY;
+                }
+            }
+        }
+        for (uint32_t j = 0; j < bind_info.imageOpaqueBindCount; ++j) {
+            const VkSparseImageOpaqueMemoryBindInfo& image_bind = bind_info.pImageOpaqueBinds[j];
+            sparse_bind_stats.bind_ranges += image_bind.bindCount;
+            for (uint32_t k = 0; k < image_bind.bindCount; ++k) {
+                const VkSparseMemoryBind& bind = image_bind.pBinds[k];
+                if (!BindSparsePages(device, (uint64_t)image_bind.image, bind.resourceOffset / sparse_page_size,
+                                     (bind.size + sparse_page_size - 1) / sparse_page_size, bind.memory, bind.memoryOffset)) {
+                    return VK_ERROR_OUT_OF_HOST_MEMORY;
+                }
+            }
+        }
+        for (uint32_t j = 0; j < bind_info.imageBindCount; ++j) {
+            if (!BindSparseImagePages(device, bind_info.pImageBinds[j])) return VK_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        for (uint32_t j = 0; j < bind_info.signalSemaphoreCount; ++j) {
+            const bool has_value =
+                timeline_info && timeline_info->pSignalSemaphoreValues && j < timeline_info->signalSemaphoreValueCount;
+            SignalSemaphoreState(bind_info.pSignalSemaphores[j], has_value ? timeline_info->pSignalSemaphoreValues[j] : 0);
+        }
+    }
+    return VK_SUCCESS;
+''',
+'vkQueuePresentKHR': '''
+    for (uint32_t i = 0; i < pPresentInfo->waitSemaphoreCount; ++i) {
+        ConsumeSemaphoreState(pPresentInfo->pWaitSemaphores[i]);
+    }
     return VK_SUCCESS;
 ''',
 'vkGetMemoryWin32HandlePropertiesKHR': '''
@@ -1225,6 +1668,7 @@ CUSTOM_C_INTERCEPTS = {
         for (uint32_t i = 0; i < pBinaries->pipelineBinaryCount; ++i) {
             pBinaries->pPipelineBinaries[i] = (VkPipelineBinaryKHR)global_unique_handle++;
         }
+        CensusAdd(CensusType::PipelineBinaryKHR, pBinaries->pipelineBinaryCount);
     }
     else
     {
@@ -1301,6 +1745,29 @@ class MockICDOutputGenerator(BaseGenerator):
                 out.append('#endif\n')
         out.append('};\n')
 
+        # Dense index of every handle type for the live-object census
+        handles = sorted(self.vk.handles.values(), key=lambda handle: handle.name)
+        out.append('\n// Handle types tracked by the live-object census\n')
+        out.append('enum class CensusType : uint32_t {\n')
+        for handle in handles:
+            if handle.protect:
+                out.append(f'#ifdef {handle.protect}\n')
+            out.append(f'    {handle.name[2:]},\n')
+            if handle.protect:
+                out.append('#endif\n')
+        out.append('    Count,\n')
+        out.append('};\n')
+        out.append('static const char* const census_type_names[] = {\n')
+        for handle in handles:
+            if handle.protect:
+                out.append(f'#ifdef {handle.protect}\n')
+            out.append(f'    "{handle.name}",\n')
+            if handle.protect:
+                out.append('#endif\n')
+        out.append('};\n')
+
+        self.generate_format_tables(out)
+
         current_protect = None
         for name, cmd in self.vk.commands.items():
             prepend_newline = '\n'
@@ -1328,6 +1795,63 @@ class MockICDOutputGenerator(BaseGenerator):
                 out.append('#endif\n')
         out.append('};\n')
 
+    # Texel block and plane layout of every format, from the registry's format data
+    def generate_format_tables(self, out):
+        out.append('''
+// Texel block of a single-plane format: its size in bytes and its extent in texels (1x1x1 for uncompressed formats).
+// Multi-planar and unknown formats report a size of 0.
+struct TexelBlock {
+    uint32_t size;
+    uint32_t width;
+    uint32_t height;
+    uint32_t depth;
+};
+
+static TexelBlock GetTexelBlock(VkFormat format) {
+    switch (format) {
+''')
+        blocks = {}
+        for format in [x for x in self.vk.formats.values() if not x.planes]:
+            extent = tuple(int(x) for x in format.blockExtent) if format.blockExtent else (1, 1, 1)
+            blocks.setdefault((format.blockSize,) + extent, []).append(format.name)
+        for block, names in sorted(blocks.items()):
+            for name in sorted(names):
+                out.append(f'        case {name}:\n')
+            out.append(f'            return {{{", ".join(str(x) for x in block)}}};\n')
+        out.append('''        default:
+            return {0, 1, 1, 1};
+    }
+}
+
+// Planes of a multi-planar format: 2 or 3, with components of 1 byte (8-bit) or 2 bytes (10 to 16-bit), and the chroma planes
+// subsampled by the given divisors. Single-plane formats report one plane.
+struct PlaneLayout {
+    uint32_t plane_count;
+    uint32_t component_size;
+    uint32_t chroma_width_divisor;
+    uint32_t chroma_height_divisor;
+};
+
+static PlaneLayout GetPlaneLayout(VkFormat format) {
+    switch (format) {
+''')
+        layouts = {}
+        for format in [x for x in self.vk.formats.values() if x.planes]:
+            # Plane 0 holds one luma component; the chroma planes all share the same subsampling
+            component_size = self.vk.formats[format.planes[0].compatible].blockSize
+            chroma = format.planes[1]
+            layout = (len(format.planes), component_size, chroma.widthDivisor, chroma.heightDivisor)
+            layouts.setdefault(layout, []).append(format.name)
+        for layout, names in sorted(layouts.items(), reverse=True):
+            for name in sorted(names):
+                out.append(f'        case {name}:\n')
+            out.append(f'            return {{{", ".join(str(x) for x in layout)}}};\n')
+        out.append('''        default:
+            return {1, 0, 1, 1};
+    }
+}
+''')
+
     def generate_function_definitions(self, out):
         out.append('#include "mock_icd.h"\n')
         out.append('#include "function_declarations.h"\n')
@@ -1417,29 +1941,47 @@ class MockICDOutputGenerator(BaseGenerator):
                     out.append(f'    for (uint32_t i = 0; i < {lp_len}; ++i) {{\n')
                     out.append(f'        {lp_txt}[i] = ({lp_type}){allocator_txt};\n')
                     out.append('    }\n')
+                    if lp_type in self.vk.handles:
+                        out.append(f'    CensusAdd(CensusType::{lp_type[2:]}, {lp_len});\n')
                 else:
                     #print("Single %s last param is '%s' w/ type '%s'" % (handle_type, lp_txt, lp_type))
                     if 'AllocateMemory' in name:
                         # Store allocation size in case it's mapped
                         out.append('    allocated_memory_size_map[(VkDeviceMemory)global_unique_handle] = pAllocateInfo->allocationSize;\n')
+                        # Mappings of this memory are charged to its allocation callbacks
+                        out.append('    try {\n')
+                        out.append('        mapped_memory_map[(VkDeviceMemory)global_unique_handle] =\n')
+                        out.append('            host_vector<void*>(HostAllocator<void*>(pAllocator, VK_SYSTEM_ALLOCATION_SCOPE_OBJECT));\n')
+                        out.append('    } catch (const std::bad_alloc&) {\n')
+                        out.append('        allocated_memory_size_map.erase((VkDeviceMemory)global_unique_handle);\n')
+                        out.append('        return VK_ERROR_OUT_OF_HOST_MEMORY;\n')
+                        out.append('    }\n')
                     out.append(f'    *{lp_txt} = ({lp_type}){allocator_txt};\n')
+                    if lp_type in self.vk.handles:
+                        out.append(f'    CensusAdd(CensusType::{lp_type[2:]});\n')
             elif True in [ftxt in name for ftxt in ['Destroy', 'Free']]:
                 out.append('//Destroy object\n')
+                # The destroyed handle is the last handle parameter, either a single handle or an array of them
+                handle_param = next((p for p in reversed(cmd.params) if p.type in self.vk.handles), None)
+                if handle_param is not None and handle_param.length is not None:
+                    out.append(f'    for (uint32_t i = 0; i < {handle_param.length}; ++i) {{\n')
+                    out.append(f'        if ({handle_param.name}[i]) CensusRemove(CensusType::{handle_param.type[2:]});\n')
+                    out.append('    }\n')
+                elif handle_param is not None:
+                    out.append(f'    if ({handle_param.name}) CensusRemove(CensusType::{handle_param.type[2:]});\n')
                 if 'FreeMemory' in name:
                     # If the memory is mapped, unmap it
                     out.append('    UnmapMemory(device, memory);\n')
                     # Remove from allocation map
                     out.append('    unique_lock_t lock(global_lock);\n')
                     out.append('    allocated_memory_size_map.erase(memory);\n')
+                    out.append('    mapped_memory_map.erase(memory);\n')
             else:
                 out.append('//Not a CREATE or DESTROY function\n')
 
             # Return result variable, if any.
             if cmd.returnType != 'void':
-                if name == 'vkGetEventStatus':
-                    out.append('    return VK_EVENT_SET;\n')
-                else:
-                    out.append('    return VK_SUCCESS;\n')
+                out.append('    return VK_SUCCESS;\n')
             out.append('}\n')
         if current_protect is not None:
             out.append('#endif\n')
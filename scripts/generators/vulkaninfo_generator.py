@@ -54,9 +54,14 @@ LICENSE_HEADER = '''
 CUSTOM_FORMATTERS = r'''
 template <typename T>
 std::string to_hex_str(const T i) {
-    std::stringstream stream;
-    stream << "0x" << std::setfill('0') << std::setw(sizeof(T)) << std::hex << i;
-    return stream.str();
+    // lowercase hex digits, zero padded to at least sizeof(T) digits
+    char digits[2 * sizeof(T)];
+    auto result = std::to_chars(std::begin(digits), std::end(digits), static_cast<std::make_unsigned_t<T>>(i), 16);
+    size_t length = static_cast<size_t>(result.ptr - digits);
+    std::string str = "0x";
+    if (length < sizeof(T)) str.append(sizeof(T) - length, '0');
+    str.append(digits, length);
+    return str;
 }
 
 template <typename T>
@@ -96,6 +101,13 @@ STRUCT_BLACKLIST = ['VkVideoProfileListInfoKHR', 'VkDrmFormatModifierPropertiesL
 # These structures are only used in version 1.1, otherwise they are included in the promoted structs
 STRUCT_1_1_LIST = ['VkPhysicalDeviceProtectedMemoryFeatures', 'VkPhysicalDeviceShaderDrawParametersFeatures', 'VkPhysicalDeviceSubgroupProperties', 'VkPhysicalDeviceProtectedMemoryProperties']
 
+# Specific versions of drivers have an incorrect definition of the size of these structs.
+# We need to artificially pad the structure it just so the driver doesn't write out of bounds and
+# into other structures that are adjacent. This bug comes from the in-development version of
+# the extension having a larger size than the final version, so older drivers try to write to
+# members which don't exist.
+PADDED_STRUCTS = ['VkPhysicalDeviceShaderIntegerDotProductFeatures', 'VkPhysicalDeviceHostImageCopyFeaturesEXT']
+
 # generate these structures such that they only print when not in json mode (as json wants them separate)
 PORTABILITY_STRUCTS = ['VkPhysicalDevicePortabilitySubsetFeaturesKHR', 'VkPhysicalDevicePortabilitySubsetPropertiesKHR']
 
@@ -110,44 +122,51 @@ EXTENSION_TYPE_DEVICE = 'device'
 EXTENSION_TYPE_BOTH = 'both'
 
 # Types that need pNext Chains built. 'extends' is the xml tag used in the structextends member. 'type' can be device, instance, or both
+# 'arena' chains only allocate the structs that are actually put into the chain, the others embed every struct by value
 EXTENSION_CATEGORIES = OrderedDict((
     ('phys_device_props2',
         {'extends': 'VkPhysicalDeviceProperties2',
          'type': EXTENSION_TYPE_BOTH,
          'print_iterator': True,
          'can_show_promoted_structs': True,
-         'ignore_vendor_exclusion': False}),
+         'ignore_vendor_exclusion': False,
+         'arena': True}),
     ('phys_device_mem_props2',
         {'extends': 'VkPhysicalDeviceMemoryProperties2',
          'type': EXTENSION_TYPE_DEVICE,
          'print_iterator': False,
          'can_show_promoted_structs': False,
-         'ignore_vendor_exclusion': False}),
+         'ignore_vendor_exclusion': False,
+         'arena': True}),
     ('phys_device_features2',
         {'extends': 'VkPhysicalDeviceFeatures2',
          'type': EXTENSION_TYPE_DEVICE,
          'print_iterator': True,
          'can_show_promoted_structs': True,
-         'ignore_vendor_exclusion': False}),
+         'ignore_vendor_exclusion': False,
+         'arena': True}),
     ('surface_capabilities2',
         {'extends': 'VkSurfaceCapabilities2KHR',
          'type': EXTENSION_TYPE_BOTH,
          'print_iterator': True,
          'can_show_promoted_structs': False,
          'ignore_vendor_exclusion': False,
+         'arena': True,
          'exclude': ['VkSurfacePresentScalingCapabilitiesKHR', 'VkSurfacePresentModeCompatibilityKHR']}),
     ('format_properties2',
         {'extends': 'VkFormatProperties2',
          'type': EXTENSION_TYPE_DEVICE,
          'print_iterator': True,
          'can_show_promoted_structs': False,
-         'ignore_vendor_exclusion': False}),
+         'ignore_vendor_exclusion': False,
+         'arena': True}),
     ('queue_properties2',
         {'extends': 'VkQueueFamilyProperties2',
          'type': EXTENSION_TYPE_DEVICE,
          'print_iterator': True,
          'can_show_promoted_structs': False,
-         'ignore_vendor_exclusion': False}),
+         'ignore_vendor_exclusion': False,
+         'arena': True}),
     ('video_profile_info',
         {'extends': 'VkVideoProfileInfoKHR',
          'type': EXTENSION_TYPE_DEVICE,
@@ -173,6 +192,10 @@ class VulkanInfoGenerator(BaseGenerator):
         self.format_ranges = []
 
     def generate(self):
+        if self.filename == 'vulkaninfo_extensions.hpp':
+            self.write(''.join(self.genExtensionEnum()))
+            return
+
         self.findFormatRanges()
 
         # gather the types that are needed to generate
@@ -213,14 +236,38 @@ class VulkanInfoGenerator(BaseGenerator):
         # print the types gathered
         out = []
         out.append(LICENSE_HEADER + '\n')
-        out.append('#include "vulkaninfo.h"\n')
+        out.append('#pragma once\n\n')
+
+        # vulkaninfo_chains.hpp is everything the queries need and nothing that prints, so that libvulkaninfo can build
+        # from it without the Printer. vulkaninfo.hpp adds the Dump functions on top of it.
+        if self.filename == 'vulkaninfo_chains.hpp':
+            out.append('#include "vulkaninfo.h"\n\n')
+
+            out.extend(self.genVideoEnumStrings())
+            for enum in (e for e in types_to_gen if e in self.vk.enums):
+                out.extend(self.PrintEnumToString(self.vk.enums[enum]))
+
+            for key, value in EXTENSION_CATEGORIES.items():
+                out.extend(self.PrintChainStruct(key, extension_types[key], value))
+
+            out.append('auto format_ranges = std::array{\n')
+            for f in self.format_ranges:
+                out.append(f'    FormatRange{{{f.minimum_instance_version}, {self.vk.extensions[f.extensions[0]].nameString if len(f.extensions) > 0 else "nullptr"}, ')
+                out.append(f'static_cast<VkFormat>({f.first_format}), static_cast<VkFormat>({f.last_format})}},\n')
+            out.append('};\n')
+
+            out.extend(self.genVideoProfileUtils())
+
+            self.write(''.join(out))
+            return
+
+        out.append('#include "vulkaninfo_chains.hpp"\n')
         out.append('#include "outputprinter.h"\n')
         out.append(CUSTOM_FORMATTERS)
 
-        out.extend(self.genVideoEnums())
+        out.extend(self.genVideoEnumDumps())
 
         for enum in (e for e in types_to_gen if e in self.vk.enums):
-            out.extend(self.PrintEnumToString(self.vk.enums[enum]))
             out.extend(self.PrintEnum(self.vk.enums[enum]))
 
         # Need to go through all flags to find if they or their associated bitmask needs printing
@@ -239,7 +286,9 @@ class VulkanInfoGenerator(BaseGenerator):
             out.extend(self.PrintStructure(self.vk.structs[s], False))
 
         for key, value in EXTENSION_CATEGORIES.items():
-            out.extend(self.PrintChainStruct(key, extension_types[key], value))
+            if value.get('print_iterator'):
+                out.extend(self.PrintChainIterator(key, extension_types[key], value))
+        out.append('\n')
 
         for s in (x for x in comparison_types_to_gen if x in self.vk.structs):
             out.extend(self.PrintStructComparisonForwardDecl(self.vk.structs[s]))
@@ -248,18 +297,47 @@ class VulkanInfoGenerator(BaseGenerator):
         for s in (x for x in types_to_gen if x in self.vk.structs and x in STRUCT_SHORT_VERSIONS_TO_GEN):
             out.extend(self.PrintStructShort(self.vk.structs[s]))
 
-        out.append('auto format_ranges = std::array{\n')
-        for f in self.format_ranges:
-            out.append(f'    FormatRange{{{f.minimum_instance_version}, {self.vk.extensions[f.extensions[0]].nameString if len(f.extensions) > 0 else "nullptr"}, ')
-            out.append(f'static_cast<VkFormat>({f.first_format}), static_cast<VkFormat>({f.last_format})}},\n')
-        out.append('};\n')
+        self.write(''.join(out))
 
-        out.extend(self.genVideoProfileUtils())
 
-        self.write(''.join(out))
+    # Extension names are interned into AppExtension when they are enumerated, so that checking
+    # whether an extension is enabled is a bit test instead of a search through the names
+    def genExtensionEnum(self):
+        names = sorted(self.vk.extensions.keys())
+        out = []
+        out.append(LICENSE_HEADER + '\n')
+        out.append('#pragma once\n\n')
+        out.append('#include <algorithm>\n')
+        out.append('#include <bitset>\n')
+        out.append('#include <cstdint>\n')
+        out.append('#include <iterator>\n')
+        out.append('#include <string_view>\n\n')
+        out.append('// Every extension in the registry, sorted by name so the value of an extension is its index in app_extension_names\n')
+        out.append('enum class AppExtension : uint32_t {\n')
+        for name in names:
+            out.append(f'    {name[3:]},\n')
+        out.append('};\n\n')
+        out.append(f'constexpr size_t app_extension_count = {len(names)};\n\n')
+        out.append('using AppExtensionSet = std::bitset<app_extension_count>;\n\n')
+        out.append('constexpr std::string_view app_extension_names[app_extension_count] = {\n')
+        for name in names:
+            out.append(f'    "{name}",\n')
+        out.append('};\n\n')
+        out.append('''// Returns false if the extension is newer than the registry vulkaninfo was generated from
+inline bool FindAppExtension(std::string_view name, AppExtension &extension) {
+    auto it = std::lower_bound(std::begin(app_extension_names), std::end(app_extension_names), name);
+    if (it == std::end(app_extension_names) || *it != name) return false;
+    extension = static_cast<AppExtension>(it - std::begin(app_extension_names));
+    return true;
+}
+''')
+        return out
 
+    # The AppExtension enumerator of an extension, see genExtensionEnum
+    def ExtensionEnum(self, ext):
+        return f'AppExtension::{ext.name[3:]}'
 
-    def genVideoEnums(self):
+    def genVideoEnumStrings(self):
         out = []
         for enum in self.vk.videoStd.enums.values():
             out.append(f'std::string {enum.name}String({enum.name} value) {{\n')
@@ -270,7 +348,12 @@ class VulkanInfoGenerator(BaseGenerator):
                     out.append(f'        case {field.name}: return "{field.name}";\n')
             out.append(f'        default: return std::string("UNKNOWN_{enum.name}_value") + std::to_string(value);\n')
             out.append('    }\n}\n')
-            out.append(f'void Dump{enum.name}(Printer &p, std::string name, {enum.name} value) {{\n')
+        return out
+
+    def genVideoEnumDumps(self):
+        out = []
+        for enum in self.vk.videoStd.enums.values():
+            out.append(f'void Dump{enum.name}(Printer &p, std::string_view name, {enum.name} value) {{\n')
             out.append(f'    p.PrintKeyString(name, {enum.name}String(value));\n}}\n')
         return out
 
@@ -305,7 +388,7 @@ class VulkanInfoGenerator(BaseGenerator):
                         if has_version:
                             out.append('(')
                     if self.vk.extensions[ext].device:
-                        out.append(f'gpu.CheckPhysicalDeviceExtensionIncluded({self.vk.extensions[ext].nameString})')
+                        out.append(f'gpu.CheckPhysicalDeviceExtensionIncluded({self.ExtensionEnum(self.vk.extensions[ext])})')
                     else:
                         assert False, 'Should never get here'
             if has_version:
@@ -443,6 +526,36 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
             return result;
         };
 
+    // Codecs that no queue family can run are not probed, unless no queue family reported its video properties
+    VkVideoCodecOperationFlagsKHR queue_codec_operations = 0;
+    bool found_queue_video_properties = false;
+    for (const auto &queue_family : gpu.GetQueueFamilies()) {
+        for (auto p = reinterpret_cast<const VkBaseInStructure*>(queue_family.pNext); p != nullptr; p = p->pNext) {
+            if (p->sType == VK_STRUCTURE_TYPE_QUEUE_FAMILY_VIDEO_PROPERTIES_KHR) {
+                queue_codec_operations |= reinterpret_cast<const VkQueueFamilyVideoPropertiesKHR*>(p)->videoCodecOperations;
+                found_queue_video_properties = true;
+            }
+        }
+    }
+    if (!found_queue_video_properties) {
+        queue_codec_operations = ~VkVideoCodecOperationFlagsKHR{0};
+    }
+
+    // The profiles are listed first and probed afterwards. The first profile of each codec is its base profile, the other
+    // profiles of a codec are only probed if the base profile did not fail with VK_ERROR_VIDEO_PROFILE_CODEC_NOT_SUPPORTED_KHR.
+    struct ProfileProbe {
+        std::string name;
+        VkVideoProfileInfoKHR profile_info;
+        AppVideoProfile::CreateProfileInfoChainCb create_profile_info_chain;
+        AppVideoProfile::CreateCapabilitiesChainCb create_capabilities_chain;
+        AppVideoProfile::CreateFormatPropertiesChainCbList create_format_properties_chain_list;
+        AppVideoProfile::InitProfileCb init_profile;
+        size_t base_probe;
+    };
+    std::vector<ProfileProbe> probes;
+    std::vector<size_t> base_probes;
+    std::map<VkVideoCodecOperationFlagsKHR, size_t> base_probe_of_codec;
+
     auto add_profile = [&](
         const std::string &name,
         const VkVideoProfileInfoKHR &profile_info,
@@ -450,15 +563,19 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
         AppVideoProfile::CreateCapabilitiesChainCb create_capabilities_chain,
         const AppVideoProfile::CreateFormatPropertiesChainCbList &create_format_properties_chain_list,
         AppVideoProfile::InitProfileCb init_profile) {
-            auto profile = std::make_unique<AppVideoProfile>(gpu, gpu.phys_device,
-                                                             name, profile_info,
-                                                             create_profile_info_chain,
-                                                             create_capabilities_chain,
-                                                             create_format_properties_chain_list,
-                                                             init_profile);
-            if (profile->supported) {
-                result.push_back(std::move(profile));
+            if ((queue_codec_operations & profile_info.videoCodecOperation) == 0) {
+                return;
+            }
+            auto base_probe = base_probe_of_codec.emplace(profile_info.videoCodecOperation, probes.size());
+            if (base_probe.second) {
+                base_probes.push_back(probes.size());
             }
+            probes.push_back(ProfileProbe{name, profile_info,
+                                          create_profile_info_chain,
+                                          create_capabilities_chain,
+                                          create_format_properties_chain_list,
+                                          init_profile,
+                                          base_probe.first->second});
         };
 ''')
 
@@ -615,6 +732,32 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
             out.append(f'{" " * 8}}}\n')
             out.append(f'{" " * 4}}}\n')
 
+        out.append('''
+    std::vector<std::unique_ptr<AppVideoProfile>> probed(probes.size());
+    auto probe = [&](size_t i) {
+        const ProfileProbe &info = probes[i];
+        probed[i] = std::make_unique<AppVideoProfile>(gpu, gpu.phys_device, info.name, info.profile_info,
+                                                      info.create_profile_info_chain, info.create_capabilities_chain,
+                                                      info.create_format_properties_chain_list, info.init_profile);
+    };
+    RunParallelTasks(base_probes.size(), gpu.video_profile_jobs, [&](size_t i) { probe(base_probes[i]); });
+
+    std::vector<size_t> remaining_probes;
+    for (size_t i = 0; i < probes.size(); i++) {
+        if (probed[i] == nullptr &&
+            probed[probes[i].base_probe]->capabilities_result != VK_ERROR_VIDEO_PROFILE_CODEC_NOT_SUPPORTED_KHR) {
+            remaining_probes.push_back(i);
+        }
+    }
+    RunParallelTasks(remaining_probes.size(), gpu.video_profile_jobs, [&](size_t i) { probe(remaining_probes[i]); });
+
+    // Every probe wrote only to its own slot, so the profiles keep the order they were listed in
+    for (auto &profile : probed) {
+        if (profile != nullptr && profile->supported) {
+            result.push_back(std::move(profile));
+        }
+    }
+''')
         out.append('    return result;\n')
         out.append('}\n\n')
 
@@ -695,7 +838,7 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
     def PrintEnum(self,enum):
         out = []
         out.append(self.AddGuardHeader(enum))
-        out.append(f'''void Dump{enum.name}(Printer &p, std::string name, {enum.name} value) {{
+        out.append(f'''void Dump{enum.name}(Printer &p, std::string_view name, {enum.name} value) {{
     if (p.Type() == OutputType::json)
         p.PrintKeyString(name, std::string("VK_") + {enum.name}String(value));
     else
@@ -726,7 +869,7 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
 
     def PrintFlags(self, bitmask, name):
         out = []
-        out.append(f'void Dump{name}(Printer &p, std::string name, {name} value) {{\n')
+        out.append(f'void Dump{name}(Printer &p, std::string_view name, {name} value) {{\n')
         out.append(f'''    if (static_cast<{bitmask.name}>(value) == 0) {{
         ArrayWrapper arr(p, name, 0);
         if (p.Type() != OutputType::json && p.Type() != OutputType::vkconfig_output)
@@ -747,7 +890,7 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
 
 
     def PrintFlagBits(self, bitmask):
-        return [f'''void Dump{bitmask.name}(Printer &p, std::string name, {bitmask.name} value) {{
+        return [f'''void Dump{bitmask.name}(Printer &p, std::string_view name, {bitmask.name} value) {{
     auto strings = {bitmask.name}GetStrings(value);
     if (strings.size() > 0) {{
         if (p.Type() == OutputType::json)
@@ -796,7 +939,7 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
         for v in struct.members:
             if (v.type in PREDEFINED_TYPES or v.type in STRUCT_BLACKLIST) and (v.length is None or v.type in ['char'] or v.fixedSizeArray[0] in ['VK_UUID_SIZE', 'VK_LUID_SIZE']):
                 max_key_len = max(max_key_len, len(v.name))
-        out.append(f'void Dump{struct.name}(Printer &p, std::string name, const {struct.name} &obj)')
+        out.append(f'void Dump{struct.name}(Printer &p, std::string_view name, const {struct.name} &obj)')
         if declare_only:
             out.append(';\n')
             out.append(self.AddGuardFooter(struct))
@@ -920,20 +1063,21 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
     {listName}_chain& operator=({listName}_chain &&) = delete;
 ''')
 
+        use_arena = chain_details.get('arena')
         out.append('    void* start_of_chain = nullptr;\n')
+        if use_arena:
+            out.append('    ChainArena arena;\n')
         for s in structs_to_print:
             if s in STRUCT_BLACKLIST:
                 continue
             struct = self.vk.structs[s]
             out.append(self.AddGuardHeader(struct))
             if struct.sType is not None:
-                out.append(f'    {struct.name} {struct.name[2:]}{{}};\n')
-                # Specific versions of drivers have an incorrect definition of the size of these structs.
-                # We need to artificially pad the structure it just so the driver doesn't write out of bounds and
-                # into other structures that are adjacent. This bug comes from the in-development version of
-                # the extension having a larger size than the final version, so older drivers try to write to
-                # members which don't exist.
-                if struct.name in ['VkPhysicalDeviceShaderIntegerDotProductFeatures', 'VkPhysicalDeviceHostImageCopyFeaturesEXT']:
+                if use_arena:
+                    out.append(f'    {struct.name}* {struct.name[2:]}{{}};\n')
+                else:
+                    out.append(f'    {struct.name} {struct.name[2:]}{{}};\n')
+                if struct.name in PADDED_STRUCTS and not use_arena:
                     out.append(f'    char {struct.name}_padding[64];\n')
                 for member in struct.members:
                     if member.length is not None and len(member.fixedSizeArray) == 0:
@@ -948,16 +1092,17 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
         if chain_details.get('can_show_promoted_structs'):
             args.append('bool show_promoted_structs')
         out.append(f'{", ".join(args)}) noexcept {{\n')
-        for s in structs_to_print:
-            if s in STRUCT_BLACKLIST:
-                continue
-            struct = self.vk.structs[s]
+        if not use_arena:
+            for s in structs_to_print:
+                if s in STRUCT_BLACKLIST:
+                    continue
+                struct = self.vk.structs[s]
 
-            out.append(self.AddGuardHeader(struct))
-            out.append(f'        {struct.name[2:]}.sType = {struct.sType};\n')
-            out.append(self.AddGuardFooter(struct))
+                out.append(self.AddGuardHeader(struct))
+                out.append(f'        {struct.name[2:]}.sType = {struct.sType};\n')
+                out.append(self.AddGuardFooter(struct))
 
-        out.append('        std::vector<VkBaseOutStructure*> chain_members{};\n')
+            out.append('        std::vector<VkBaseOutStructure*> chain_members{};\n')
         for s in structs_to_print:
             if s in STRUCT_BLACKLIST:
                 continue
@@ -978,9 +1123,9 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
                             if has_version:
                                 out.append('(')
                         if self.vk.extensions[ext].device:
-                            out.append(f'gpu.CheckPhysicalDeviceExtensionIncluded({self.vk.extensions[ext].nameString})')
+                            out.append(f'gpu.CheckPhysicalDeviceExtensionIncluded({self.ExtensionEnum(self.vk.extensions[ext])})')
                         elif self.vk.extensions[ext].instance:
-                            out.append(f'inst.CheckExtensionEnabled({self.vk.extensions[ext].nameString})')
+                            out.append(f'inst.CheckExtensionEnabled({self.ExtensionEnum(self.vk.extensions[ext])})')
                         else:
                             assert False, 'Should never get here'
                 if has_version:
@@ -994,7 +1139,11 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
                 out.append(')\n            ')
             else:
                 out.append('        ')
-            out.append(f'chain_members.push_back(reinterpret_cast<VkBaseOutStructure*>(&{struct.name[2:]}));\n')
+            if use_arena:
+                padding = ', 64' if struct.name in PADDED_STRUCTS else ''
+                out.append(f'arena.Add({struct.name[2:]}, {struct.sType}{padding});\n')
+            else:
+                out.append(f'chain_members.push_back(reinterpret_cast<VkBaseOutStructure*>(&{struct.name[2:]}));\n')
             out.append(self.AddGuardFooter(struct))
         chain_param_list = []
         chain_arg_list = []
@@ -1008,56 +1157,29 @@ std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles
             chain_param_list.append('bool show_promoted_structs')
             chain_arg_list.append('show_promoted_structs')
 
-        out.append(f'''
-        if (!chain_members.empty()) {{
-            for(size_t i = 0; i < chain_members.size() - 1; i++){{
+        if use_arena:
+            out.append('''
+        start_of_chain = arena.Allocate();
+    }
+};
+''')
+        else:
+            out.append('''
+        if (!chain_members.empty()) {
+            for(size_t i = 0; i < chain_members.size() - 1; i++){
                 chain_members[i]->pNext = chain_members[i + 1];
-            }}
+            }
             start_of_chain = chain_members[0];
-        }}
-    }}
-}};
-void setup_{listName}_chain({chain_details['extends']}& start, std::unique_ptr<{listName}_chain>& chain, {','.join(chain_param_list)}){{
+        }
+    }
+};
+''')
+        out.append(f'''void setup_{listName}_chain({chain_details['extends']}& start, std::unique_ptr<{listName}_chain>& chain, {','.join(chain_param_list)}){{
     chain = std::unique_ptr<{listName}_chain>(new {listName}_chain());
     chain->initialize_chain({','.join(chain_arg_list)});
     start.pNext = chain->start_of_chain;
 }};
 ''')
-        if chain_details.get('print_iterator'):
-            out.append('\n')
-            out.append(f'void chain_iterator_{listName}(')
-            args = ['Printer &p']
-            if chain_details.get('type') in [EXTENSION_TYPE_INSTANCE, EXTENSION_TYPE_BOTH]:
-                args.append('AppInstance &inst')
-            if chain_details.get('type') in [EXTENSION_TYPE_DEVICE, EXTENSION_TYPE_BOTH]:
-                args.append('AppGpu &gpu')
-            if chain_details.get('can_show_promoted_structs'):
-                args.append('bool show_promoted_structs')
-            args.append('const void * place')
-            out.append(f'{", ".join(args)}) {{\n')
-            out.append('    while (place) {\n')
-            out.append('        const VkBaseOutStructure *structure = (const VkBaseOutStructure *)place;\n')
-            out.append('        p.SetSubHeader();\n')
-
-            for s in structs_to_print:
-                if s in STRUCT_BLACKLIST:
-                    continue
-                struct = self.vk.structs[s]
-
-                out.append(self.AddGuardHeader(struct))
-                out.append(f'        if (structure->sType == {struct.sType}')
-                if struct.name in PORTABILITY_STRUCTS:
-                    out.append(' && p.Type() != OutputType::json')
-                out.append(') {\n')
-                out.append(f'            const {struct.name}* props = (const {struct.name}*)structure;\n')
-                out.extend(self.PrintStructNameDecisionLogic(struct, version_desc, chain_details.get('can_show_promoted_structs')))
-                out.append('            p.AddNewline();\n')
-                out.append('        }\n')
-                out.append(self.AddGuardFooter(struct))
-            out.append('        place = structure->pNext;\n')
-            out.append('    }\n')
-            out.append('}\n')
-
         out.append('\n')
         out.append(f'bool prepare_{listName}_twocall_chain_vectors(std::unique_ptr<{listName}_chain>& chain) {{\n')
         out.append('    (void)chain;\n')
@@ -1073,10 +1195,16 @@ void setup_{listName}_chain({chain_details['extends']}& start, std::unique_ptr<{
             if not has_length:
                 continue
             out.append(self.AddGuardHeader(struct))
+            if use_arena:
+                out.append(f'    if (chain->{struct.name[2:]}) {{\n')
+            access = f'{struct.name[2:]}->' if use_arena else f'{struct.name[2:]}.'
+            indent = ' ' * (8 if use_arena else 4)
             for member in struct.members:
                 if member.length is not None and len(member.fixedSizeArray) == 0:
-                    out.append(f'    chain->{struct.name}_{member.name}.resize(chain->{struct.name[2:]}.{member.length});\n')
-                    out.append(f'    chain->{struct.name[2:]}.{member.name} = chain->{struct.name}_{member.name}.data();\n')
+                    out.append(f'{indent}chain->{struct.name}_{member.name}.resize(chain->{access}{member.length});\n')
+                    out.append(f'{indent}chain->{access}{member.name} = chain->{struct.name}_{member.name}.data();\n')
+            if use_arena:
+                out.append('    }\n')
             out.append(self.AddGuardFooter(struct))
             is_twocall = True
         out.append(f'    return {"true" if is_twocall else "false"};\n')
@@ -1084,24 +1212,73 @@ void setup_{listName}_chain({chain_details['extends']}& start, std::unique_ptr<{
 
         return out
 
+    def PrintChainIterator(self, listName, structs_to_print, chain_details):
+        version_desc = ''
+        if chain_details.get('type') in [EXTENSION_TYPE_DEVICE, EXTENSION_TYPE_BOTH]:
+            version_desc = 'gpu.api_version'
+        else:
+            version_desc = 'inst.instance_version'
+
+        out = []
+        out.append('\n')
+        out.append(f'void chain_iterator_{listName}(')
+        args = ['Printer &p']
+        if chain_details.get('type') in [EXTENSION_TYPE_INSTANCE, EXTENSION_TYPE_BOTH]:
+            args.append('AppInstance &inst')
+        if chain_details.get('type') in [EXTENSION_TYPE_DEVICE, EXTENSION_TYPE_BOTH]:
+            args.append('AppGpu &gpu')
+        if chain_details.get('can_show_promoted_structs'):
+            args.append('bool show_promoted_structs')
+        args.append('const void * place')
+        out.append(f'{", ".join(args)}) {{\n')
+        out.append('    while (place) {\n')
+        out.append('        const VkBaseOutStructure *structure = (const VkBaseOutStructure *)place;\n')
+        out.append('        p.SetSubHeader();\n')
+        # One switch per chain member, so the cost is independent of how many structs the chain can hold
+        out.append('        switch (structure->sType) {\n')
+
+        for s in structs_to_print:
+            if s in STRUCT_BLACKLIST:
+                continue
+            struct = self.vk.structs[s]
+
+            out.append(self.AddGuardHeader(struct))
+            out.append(f'            case {struct.sType}: {{\n')
+            if struct.name in PORTABILITY_STRUCTS:
+                out.append('                if (p.Type() == OutputType::json) break;\n')
+            out.append(f'                const {struct.name}* props = (const {struct.name}*)structure;\n')
+            out.extend(self.PrintStructNameDecisionLogic(struct, version_desc, chain_details.get('can_show_promoted_structs'), 16))
+            out.append('                p.AddNewline();\n')
+            out.append('                break;\n')
+            out.append('            }\n')
+            out.append(self.AddGuardFooter(struct))
+        out.append('            default:\n')
+        out.append('                break;\n')
+        out.append('        }\n')
+        out.append('        place = structure->pNext;\n')
+        out.append('    }\n')
+        out.append('}\n')
+
+        return out
+
     def GetStructCheckStringForMatchingExtension(self, struct, structName):
         for ext_name in struct.extensions:
             ext = self.vk.extensions[ext_name]
             vendor = ext.name.split('_')[1]
             if structName.endswith(vendor):
                 if ext.device:
-                    return f'gpu.CheckPhysicalDeviceExtensionIncluded({ext.nameString})'
+                    return f'gpu.CheckPhysicalDeviceExtensionIncluded({self.ExtensionEnum(ext)})'
                 elif ext.instance:
-                    return f'inst.CheckExtensionEnabled({ext.nameString})'
+                    return f'inst.CheckExtensionEnabled({self.ExtensionEnum(ext)})'
         return None
 
     # Function is complex because it has to do the following:
     # Always print the struct with the most appropriate name given the gpu api version & enabled instance/device extensions
     # Print struct aliases when --show-promoted-structs is set
     # Not let alias printing duplicate the most appropriate name
-    def PrintStructNameDecisionLogic(self, struct, version_desc, can_show_promoted_structs):
+    def PrintStructNameDecisionLogic(self, struct, version_desc, can_show_promoted_structs, indent):
         out = []
-        out.append(f'{" " * 12}const char* name = ')
+        out.append(f'{" " * indent}const char* name = ')
         # Get a list of all the conditions to check and the type name to use
         check_list = []
         if struct.version is not None:
@@ -1122,17 +1299,17 @@ void setup_{listName}_chain({chain_details['extends']}& start, std::unique_ptr<{
                 out.append( f'{check[0]} ? "{check[1]}" : (')
                 end_parens += ')'
         out.append(f'{end_parens};\n')
-        out.append(f'{" " * 12}Dump{struct.name}(p, name, *props);\n')
+        out.append(f'{" " * indent}Dump{struct.name}(p, name, *props);\n')
         if not can_show_promoted_structs:
             return out
         for alias in struct.aliases:
             ext_str = self.GetStructCheckStringForMatchingExtension(struct, alias)
             if ext_str is not None:
-                out.append(f'{" " * 12}if (show_promoted_structs && strcmp(name, "{alias}") != 0 && {ext_str}) {{\n')
-                out.append(f'{" " * 16}p.AddNewline();\n')
-                out.append(f'{" " * 16}p.SetSubHeader();\n')
-                out.append(f'{" " * 16}Dump{struct.name}(p, "{alias}", *props);\n')
-                out.append(f'{" " * 12}}}\n')
+                out.append(f'{" " * indent}if (show_promoted_structs && strcmp(name, "{alias}") != 0 && {ext_str}) {{\n')
+                out.append(f'{" " * (indent + 4)}p.AddNewline();\n')
+                out.append(f'{" " * (indent + 4)}p.SetSubHeader();\n')
+                out.append(f'{" " * (indent + 4)}Dump{struct.name}(p, "{alias}", *props);\n')
+                out.append(f'{" " * indent}}}\n')
         return out
 
     def PrintStructComparisonForwardDecl(self,structure):
@@ -19,6 +19,9 @@
 
 #include "test_common.h"
 
+#include "mock_icd_census.h"
+#include "mock_icd_sparse.h"
+
 void setup_mock_icd_env_vars() {
     // Necessary to point the loader at the mock driver
     set_environment_var("VK_DRIVER_FILES", MOCK_ICD_JSON_MANIFEST_PATH);
@@ -480,17 +483,40 @@ TEST_F(MockICD, vkGetPhysicalDeviceSparseImageFormatProperties) {
     uint32_t count = 0;
     VkSparseImageFormatProperties sparse_image_format_properties{};
     vkGetPhysicalDeviceSparseImageFormatProperties(physical_device, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TYPE_2D,
-                                                   VK_SAMPLE_COUNT_64_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+                                                   VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
                                                    VK_IMAGE_TILING_OPTIMAL, &count, nullptr);
     ASSERT_EQ(count, 1);
     vkGetPhysicalDeviceSparseImageFormatProperties(physical_device, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TYPE_2D,
-                                                   VK_SAMPLE_COUNT_64_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+                                                   VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
                                                    VK_IMAGE_TILING_OPTIMAL, &count, &sparse_image_format_properties);
     ASSERT_EQ(sparse_image_format_properties.aspectMask, VK_IMAGE_ASPECT_COLOR_BIT);
-    ASSERT_EQ(sparse_image_format_properties.imageGranularity.width, 4);
-    ASSERT_EQ(sparse_image_format_properties.imageGranularity.height, 4);
-    ASSERT_EQ(sparse_image_format_properties.imageGranularity.depth, 4);
+    // Standard 2D block shape of a 32-bit format
+    ASSERT_EQ(sparse_image_format_properties.imageGranularity.width, 128);
+    ASSERT_EQ(sparse_image_format_properties.imageGranularity.height, 128);
+    ASSERT_EQ(sparse_image_format_properties.imageGranularity.depth, 1);
     ASSERT_EQ(sparse_image_format_properties.flags, VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT);
+
+    vkGetPhysicalDeviceSparseImageFormatProperties(physical_device, VK_FORMAT_D32_SFLOAT, VK_IMAGE_TYPE_2D, VK_SAMPLE_COUNT_4_BIT,
+                                                   VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_IMAGE_TILING_OPTIMAL, &count,
+                                                   &sparse_image_format_properties);
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(sparse_image_format_properties.aspectMask, VK_IMAGE_ASPECT_DEPTH_BIT);
+    ASSERT_EQ(sparse_image_format_properties.imageGranularity.width, 64);
+    ASSERT_EQ(sparse_image_format_properties.imageGranularity.height, 64);
+
+    vkGetPhysicalDeviceSparseImageFormatProperties(physical_device, VK_FORMAT_BC1_RGB_UNORM_BLOCK, VK_IMAGE_TYPE_3D,
+                                                   VK_SAMPLE_COUNT_1_BIT, VK_IMAGE_USAGE_SAMPLED_BIT, VK_IMAGE_TILING_OPTIMAL,
+                                                   &count, &sparse_image_format_properties);
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(sparse_image_format_properties.imageGranularity.width, 128);
+    ASSERT_EQ(sparse_image_format_properties.imageGranularity.height, 64);
+    ASSERT_EQ(sparse_image_format_properties.imageGranularity.depth, 16);
+
+    // No standard block shape exists for 64 samples
+    vkGetPhysicalDeviceSparseImageFormatProperties(physical_device, VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TYPE_2D,
+                                                   VK_SAMPLE_COUNT_64_BIT, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+                                                   VK_IMAGE_TILING_OPTIMAL, &count, nullptr);
+    ASSERT_EQ(count, 0);
 }
 
 TEST_F(MockICD, vkGetPhysicalDeviceSparseImageFormatProperties2) {
@@ -499,7 +525,7 @@ TEST_F(MockICD, vkGetPhysicalDeviceSparseImageFormatProperties2) {
     VkPhysicalDeviceSparseImageFormatInfo2 sparse_image_format_info2{};
     sparse_image_format_info2.format = VK_FORMAT_R8G8B8A8_SRGB;
     sparse_image_format_info2.type = VK_IMAGE_TYPE_2D;
-    sparse_image_format_info2.samples = VK_SAMPLE_COUNT_64_BIT;
+    sparse_image_format_info2.samples = VK_SAMPLE_COUNT_1_BIT;
     sparse_image_format_info2.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
     sparse_image_format_info2.tiling = VK_IMAGE_TILING_OPTIMAL;
     vkGetPhysicalDeviceSparseImageFormatProperties2(physical_device, &sparse_image_format_info2, &count, nullptr);
@@ -507,9 +533,9 @@ TEST_F(MockICD, vkGetPhysicalDeviceSparseImageFormatProperties2) {
     vkGetPhysicalDeviceSparseImageFormatProperties2(physical_device, &sparse_image_format_info2, &count,
                                                     &sparse_image_format_properties2);
     ASSERT_EQ(sparse_image_format_properties2.properties.aspectMask, VK_IMAGE_ASPECT_COLOR_BIT);
-    ASSERT_EQ(sparse_image_format_properties2.properties.imageGranularity.width, 4);
-    ASSERT_EQ(sparse_image_format_properties2.properties.imageGranularity.height, 4);
-    ASSERT_EQ(sparse_image_format_properties2.properties.imageGranularity.depth, 4);
+    ASSERT_EQ(sparse_image_format_properties2.properties.imageGranularity.width, 128);
+    ASSERT_EQ(sparse_image_format_properties2.properties.imageGranularity.height, 128);
+    ASSERT_EQ(sparse_image_format_properties2.properties.imageGranularity.depth, 1);
     ASSERT_EQ(sparse_image_format_properties2.properties.flags, VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT);
 }
 
@@ -796,12 +822,14 @@ TEST_F(MockICD, ImageOperations) {
 
     VkImageSubresource image_subresource{};
     VkSubresourceLayout subresource_layout{};
+    image_subresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
     vkGetImageSubresourceLayout(device, image, &image_subresource, &subresource_layout);
-    ASSERT_EQ(subresource_layout.arrayPitch, 0);
-    ASSERT_EQ(subresource_layout.depthPitch, 0);
+    // 8 texels of 4 bytes padded to the default 256 byte row pitch alignment
+    ASSERT_EQ(subresource_layout.arrayPitch, 256 * 8 * 8);
+    ASSERT_EQ(subresource_layout.depthPitch, 256 * 8);
     ASSERT_EQ(subresource_layout.offset, 0);
-    ASSERT_EQ(subresource_layout.rowPitch, 0);
-    ASSERT_EQ(subresource_layout.size, 0);
+    ASSERT_EQ(subresource_layout.rowPitch, 256);
+    ASSERT_EQ(subresource_layout.size, 256 * 8 * 8);
 
     VkMemoryRequirements memory_requirements{};
     vkGetImageMemoryRequirements(device, image, &memory_requirements);
@@ -830,14 +858,14 @@ TEST_F(MockICD, ImageOperations) {
     vkGetImageSparseMemoryRequirements(device, image, &count, &sparse_image_memory_requirements);
     ASSERT_EQ(count, 1);
     ASSERT_EQ(sparse_image_memory_requirements.imageMipTailFirstLod, 0);
-    ASSERT_EQ(sparse_image_memory_requirements.imageMipTailSize, 8);
+    ASSERT_EQ(sparse_image_memory_requirements.imageMipTailSize, 65536);
     ASSERT_EQ(sparse_image_memory_requirements.imageMipTailOffset, 0);
-    ASSERT_EQ(sparse_image_memory_requirements.imageMipTailStride, 4);
-    ASSERT_EQ(sparse_image_memory_requirements.formatProperties.imageGranularity.width, 4);
-    ASSERT_EQ(sparse_image_memory_requirements.formatProperties.imageGranularity.height, 4);
-    ASSERT_EQ(sparse_image_memory_requirements.formatProperties.imageGranularity.depth, 4);
+    ASSERT_EQ(sparse_image_memory_requirements.imageMipTailStride, 0);
+    ASSERT_EQ(sparse_image_memory_requirements.formatProperties.imageGranularity.width, 128);
+    ASSERT_EQ(sparse_image_memory_requirements.formatProperties.imageGranularity.height, 128);
+    ASSERT_EQ(sparse_image_memory_requirements.formatProperties.imageGranularity.depth, 1);
     ASSERT_EQ(sparse_image_memory_requirements.formatProperties.flags, VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT);
-    ASSERT_EQ(sparse_image_memory_requirements.formatProperties.aspectMask, 1 | 2 | 4 | 8);
+    ASSERT_EQ(sparse_image_memory_requirements.formatProperties.aspectMask, VK_IMAGE_ASPECT_COLOR_BIT);
 
     count = 0;
     VkImageSparseMemoryRequirementsInfo2 sparse_memory_requirement_info2{};
@@ -847,14 +875,14 @@ TEST_F(MockICD, ImageOperations) {
     VkSparseImageMemoryRequirements2 sparse_image_memory_reqs2{};
     vkGetImageSparseMemoryRequirements2(device, &sparse_memory_requirement_info2, &count, &sparse_image_memory_reqs2);
     ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.imageMipTailFirstLod, 0);
-    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.imageMipTailSize, 8);
+    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.imageMipTailSize, 65536);
     ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.imageMipTailOffset, 0);
-    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.imageMipTailStride, 4);
-    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.formatProperties.imageGranularity.width, 4);
-    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.formatProperties.imageGranularity.height, 4);
-    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.formatProperties.imageGranularity.depth, 4);
+    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.imageMipTailStride, 0);
+    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.formatProperties.imageGranularity.width, 128);
+    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.formatProperties.imageGranularity.height, 128);
+    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.formatProperties.imageGranularity.depth, 1);
     ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.formatProperties.flags, VK_SPARSE_IMAGE_FORMAT_SINGLE_MIPTAIL_BIT);
-    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.formatProperties.aspectMask, 1 | 2 | 4 | 8);
+    ASSERT_EQ(sparse_image_memory_reqs2.memoryRequirements.formatProperties.aspectMask, VK_IMAGE_ASPECT_COLOR_BIT);
 
     VkMemoryAllocateInfo allocate_info{};
     allocate_info.allocationSize = memory_requirements.size;
@@ -1197,3 +1225,594 @@ TEST_F(MockICD, vkGetRenderAreaGranularity) {
     ASSERT_EQ(granularity.width, 1);
     ASSERT_EQ(granularity.height, 1);
 }
+
+// Allocation callbacks that record every live allocation and the scope it was made with
+struct AllocationTracker {
+    std::mutex lock;
+    std::unordered_map<void*, size_t> live_allocations;
+    std::array<uint32_t, VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE + 1> scope_counts{};
+    // Makes every allocation return NULL, like a capped arena that is used up
+    std::atomic<bool> fail_allocations{false};
+
+    static VKAPI_ATTR void* VKAPI_CALL Allocate(void* pUserData, size_t size, size_t alignment, VkSystemAllocationScope scope) {
+        auto tracker = static_cast<AllocationTracker*>(pUserData);
+        if (tracker->fail_allocations) return nullptr;
+        // Over-allocate so the returned pointer can be aligned and still find the original block when freed
+        auto base = static_cast<char*>(malloc(size + alignment + sizeof(void*)));
+        if (!base) return nullptr;
+        auto address = reinterpret_cast<uintptr_t>(base + sizeof(void*));
+        address = (address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        void* memory = reinterpret_cast<void*>(address);
+        reinterpret_cast<void**>(memory)[-1] = base;
+        std::lock_guard<std::mutex> guard(tracker->lock);
+        tracker->live_allocations[memory] = size;
+        tracker->scope_counts[scope]++;
+        return memory;
+    }
+    static VKAPI_ATTR void* VKAPI_CALL Reallocate(void* pUserData, void* pOriginal, size_t size, size_t alignment,
+                                                  VkSystemAllocationScope scope) {
+        auto tracker = static_cast<AllocationTracker*>(pUserData);
+        void* memory = Allocate(pUserData, size, alignment, scope);
+        if (memory && pOriginal) {
+            size_t original_size = 0;
+            {
+                std::lock_guard<std::mutex> guard(tracker->lock);
+                original_size = tracker->live_allocations.at(pOriginal);
+            }
+            memcpy(memory, pOriginal, (std::min)(size, original_size));
+            Free(pUserData, pOriginal);
+        }
+        return memory;
+    }
+    static VKAPI_ATTR void VKAPI_CALL Free(void* pUserData, void* pMemory) {
+        if (!pMemory) return;
+        auto tracker = static_cast<AllocationTracker*>(pUserData);
+        {
+            std::lock_guard<std::mutex> guard(tracker->lock);
+            tracker->live_allocations.erase(pMemory);
+        }
+        free(reinterpret_cast<void**>(pMemory)[-1]);
+    }
+
+    VkAllocationCallbacks callbacks() { return {this, Allocate, Reallocate, Free, nullptr, nullptr}; }
+    bool is_live(void* memory) {
+        std::lock_guard<std::mutex> guard(lock);
+        return live_allocations.count(memory) != 0;
+    }
+};
+
+/*
+ * Checks that host allocations made on behalf of objects go through the VkAllocationCallbacks they were created with
+ */
+TEST_F(MockICD, AllocationCallbacks) {
+    AllocationTracker tracker;
+    const VkAllocationCallbacks allocator = tracker.callbacks();
+    VkResult res = VK_SUCCESS;
+
+    VkInstanceCreateInfo instance_create_info{};
+    VkInstance tracked_instance{};
+    res = vkCreateInstance(&instance_create_info, &allocator, &tracked_instance);
+    ASSERT_EQ(res, VK_SUCCESS);
+    ASSERT_GT(tracker.scope_counts[VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE], 0);
+
+    uint32_t count = 1;
+    VkPhysicalDevice tracked_physical_device{};
+    res = vkEnumeratePhysicalDevices(tracked_instance, &count, &tracked_physical_device);
+    ASSERT_EQ(res, VK_SUCCESS);
+
+    VkDeviceCreateInfo device_create_info{};
+    VkDevice tracked_device{};
+    res = vkCreateDevice(tracked_physical_device, &device_create_info, &allocator, &tracked_device);
+    ASSERT_EQ(res, VK_SUCCESS);
+    ASSERT_GT(tracker.scope_counts[VK_SYSTEM_ALLOCATION_SCOPE_DEVICE], 0);
+
+    VkQueue tracked_queue{};
+    vkGetDeviceQueue(tracked_device, 0, 0, &tracked_queue);
+    ASSERT_NE(tracked_queue, nullptr);
+
+    // Mapped pointers come straight from the memory object's allocation callbacks
+    VkMemoryAllocateInfo allocate_info{};
+    allocate_info.allocationSize = 4096;
+    VkDeviceMemory memory{};
+    res = vkAllocateMemory(tracked_device, &allocate_info, &allocator, &memory);
+    ASSERT_EQ(res, VK_SUCCESS);
+    void* data = nullptr;
+    res = vkMapMemory(tracked_device, memory, 0, VK_WHOLE_SIZE, 0, &data);
+    ASSERT_EQ(res, VK_SUCCESS);
+    ASSERT_TRUE(tracker.is_live(data));
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(data) % 64, 0);
+    vkUnmapMemory(tracked_device, memory);
+    ASSERT_FALSE(tracker.is_live(data));
+    vkFreeMemory(tracked_device, memory, &allocator);
+
+    VkCommandPoolCreateInfo command_pool_create_info{};
+    VkCommandPool command_pool{};
+    res = vkCreateCommandPool(tracked_device, &command_pool_create_info, &allocator, &command_pool);
+    ASSERT_EQ(res, VK_SUCCESS);
+    const uint32_t object_scope_count = tracker.scope_counts[VK_SYSTEM_ALLOCATION_SCOPE_OBJECT];
+    VkCommandBufferAllocateInfo command_buffer_allocate_info{};
+    command_buffer_allocate_info.commandPool = command_pool;
+    command_buffer_allocate_info.commandBufferCount = 2;
+    std::array<VkCommandBuffer, 2> command_buffers;
+    res = vkAllocateCommandBuffers(tracked_device, &command_buffer_allocate_info, command_buffers.data());
+    ASSERT_EQ(res, VK_SUCCESS);
+    ASSERT_GE(tracker.scope_counts[VK_SYSTEM_ALLOCATION_SCOPE_OBJECT], object_scope_count + 2);
+    vkDestroyCommandPool(tracked_device, command_pool, &allocator);
+
+    vkDestroyDevice(tracked_device, &allocator);
+    vkDestroyInstance(tracked_instance, &allocator);
+    ASSERT_TRUE(tracker.live_allocations.empty());
+}
+
+/*
+ * Checks that allocation callbacks returning NULL are reported as VK_ERROR_OUT_OF_HOST_MEMORY, including for the bookkeeping
+ * charged to a device or a command pool, and leave the objects usable once memory is available again
+ */
+TEST_F(MockICD, AllocationCallbacksOutOfHostMemory) {
+    AllocationTracker tracker;
+    const VkAllocationCallbacks allocator = tracker.callbacks();
+    VkResult res = VK_SUCCESS;
+
+    VkInstanceCreateInfo instance_create_info{};
+    VkInstance tracked_instance{};
+    res = vkCreateInstance(&instance_create_info, &allocator, &tracked_instance);
+    ASSERT_EQ(res, VK_SUCCESS);
+
+    uint32_t count = 1;
+    VkPhysicalDevice tracked_physical_device{};
+    res = vkEnumeratePhysicalDevices(tracked_instance, &count, &tracked_physical_device);
+    ASSERT_EQ(res, VK_SUCCESS);
+
+    VkDeviceCreateInfo device_create_info{};
+    VkDevice tracked_device{};
+    res = vkCreateDevice(tracked_physical_device, &device_create_info, &allocator, &tracked_device);
+    ASSERT_EQ(res, VK_SUCCESS);
+
+    VkCommandPoolCreateInfo command_pool_create_info{};
+    VkCommandPool command_pool{};
+    res = vkCreateCommandPool(tracked_device, &command_pool_create_info, &allocator, &command_pool);
+    ASSERT_EQ(res, VK_SUCCESS);
+    VkCommandBufferAllocateInfo command_buffer_allocate_info{};
+    command_buffer_allocate_info.commandPool = command_pool;
+    command_buffer_allocate_info.commandBufferCount = 1;
+    VkCommandBuffer command_buffer{};
+    res = vkAllocateCommandBuffers(tracked_device, &command_buffer_allocate_info, &command_buffer);
+    ASSERT_EQ(res, VK_SUCCESS);
+
+    VkEventCreateInfo event_create_info{};
+    VkEvent event{};
+    res = vkCreateEvent(tracked_device, &event_create_info, nullptr, &event);
+    ASSERT_EQ(res, VK_SUCCESS);
+
+    VkMemoryAllocateInfo allocate_info{};
+    allocate_info.allocationSize = 4096;
+    VkDeviceMemory memory{};
+    res = vkAllocateMemory(tracked_device, &allocate_info, &allocator, &memory);
+    ASSERT_EQ(res, VK_SUCCESS);
+
+    VkCommandBufferBeginInfo begin_info{};
+    res = vkBeginCommandBuffer(command_buffer, &begin_info);
+    ASSERT_EQ(res, VK_SUCCESS);
+
+    tracker.fail_allocations = true;
+
+    // Objects created without callbacks still have their bookkeeping charged to the device
+    VkBufferCreateInfo buffer_create_info{};
+    buffer_create_info.size = 256;
+    buffer_create_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    VkBuffer buffer{};
+    ASSERT_EQ(vkCreateBuffer(tracked_device, &buffer_create_info, nullptr, &buffer), VK_ERROR_OUT_OF_HOST_MEMORY);
+
+    VkImageCreateInfo image_create_info{};
+    image_create_info.imageType = VK_IMAGE_TYPE_2D;
+    image_create_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_create_info.extent = {16, 16, 1};
+    image_create_info.mipLevels = 1;
+    image_create_info.arrayLayers = 1;
+    image_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_create_info.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    VkImage image{};
+    ASSERT_EQ(vkCreateImage(tracked_device, &image_create_info, nullptr, &image), VK_ERROR_OUT_OF_HOST_MEMORY);
+
+    VkCommandPool failed_command_pool{};
+    ASSERT_EQ(vkCreateCommandPool(tracked_device, &command_pool_create_info, nullptr, &failed_command_pool),
+              VK_ERROR_OUT_OF_HOST_MEMORY);
+
+    VkCommandBuffer failed_command_buffer{};
+    ASSERT_EQ(vkAllocateCommandBuffers(tracked_device, &command_buffer_allocate_info, &failed_command_buffer),
+              VK_ERROR_OUT_OF_HOST_MEMORY);
+    ASSERT_EQ(failed_command_buffer, nullptr);
+
+    // A queue the device wasn't created with can't be made
+    VkQueue failed_queue{};
+    vkGetDeviceQueue(tracked_device, 0, 1, &failed_queue);
+    ASSERT_EQ(failed_queue, nullptr);
+
+    void* data = nullptr;
+    ASSERT_EQ(vkMapMemory(tracked_device, memory, 0, VK_WHOLE_SIZE, 0, &data), VK_ERROR_MEMORY_MAP_FAILED);
+
+    // Recording commands can't fail, so the error is reported when recording ends
+    vkCmdSetEvent(command_buffer, event, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    ASSERT_EQ(vkEndCommandBuffer(command_buffer), VK_ERROR_OUT_OF_HOST_MEMORY);
+
+    tracker.fail_allocations = false;
+
+    res = vkBeginCommandBuffer(command_buffer, &begin_info);
+    ASSERT_EQ(res, VK_SUCCESS);
+    vkCmdSetEvent(command_buffer, event, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    ASSERT_EQ(vkEndCommandBuffer(command_buffer), VK_SUCCESS);
+    ASSERT_EQ(vkCreateBuffer(tracked_device, &buffer_create_info, nullptr, &buffer), VK_SUCCESS);
+    vkDestroyBuffer(tracked_device, buffer, nullptr);
+
+    vkFreeMemory(tracked_device, memory, &allocator);
+    vkDestroyEvent(tracked_device, event, nullptr);
+    vkDestroyCommandPool(tracked_device, command_pool, &allocator);
+    vkDestroyDevice(tracked_device, &allocator);
+    vkDestroyInstance(tracked_instance, &allocator);
+    ASSERT_TRUE(tracker.live_allocations.empty());
+}
+
+/*
+ * Checks the live-object census exported by the mock ICD follows object creation and destruction
+ */
+TEST_F(MockICD, ObjectCensus) {
+    auto get_object_census = get_library_function<PFN_vkmockGetObjectCensus>(MOCK_ICD_LIBRARY_PATH, "vkmockGetObjectCensus");
+    auto reset_object_census_peaks =
+        get_library_function<PFN_vkmockResetObjectCensusPeaks>(MOCK_ICD_LIBRARY_PATH, "vkmockResetObjectCensusPeaks");
+    ASSERT_NE(get_object_census, nullptr);
+    ASSERT_NE(reset_object_census_peaks, nullptr);
+
+    auto get_entry = [&](const char* type_name) {
+        uint32_t count = 0;
+        EXPECT_EQ(get_object_census(&count, nullptr), VK_SUCCESS);
+        std::vector<VkMockObjectCensusEntry> entries(count);
+        EXPECT_EQ(get_object_census(&count, entries.data()), VK_SUCCESS);
+        for (const auto& entry : entries) {
+            if (strcmp(entry.typeName, type_name) == 0) return entry;
+        }
+        ADD_FAILURE() << type_name << " missing from the census";
+        return VkMockObjectCensusEntry{};
+    };
+
+    uint32_t incomplete_count = 1;
+    VkMockObjectCensusEntry first_entry{};
+    ASSERT_EQ(get_object_census(&incomplete_count, &first_entry), VK_INCOMPLETE);
+    ASSERT_EQ(incomplete_count, 1);
+    ASSERT_NE(first_entry.typeName, nullptr);
+
+    ASSERT_GE(get_entry("VkDevice").liveCount, 1);
+    ASSERT_GE(get_entry("VkQueue").liveCount, 1);
+
+    reset_object_census_peaks();
+    const VkMockObjectCensusEntry fences_before = get_entry("VkFence");
+    ASSERT_EQ(fences_before.highWaterMark, fences_before.liveCount);
+
+    VkFenceCreateInfo fence_create_info{};
+    std::array<VkFence, 3> fences{};
+    for (auto& fence : fences) {
+        ASSERT_EQ(vkCreateFence(device, &fence_create_info, nullptr, &fence), VK_SUCCESS);
+    }
+    const VkMockObjectCensusEntry fences_created = get_entry("VkFence");
+    ASSERT_EQ(fences_created.liveCount, fences_before.liveCount + fences.size());
+    ASSERT_EQ(fences_created.highWaterMark, fences_created.liveCount);
+    ASSERT_EQ(fences_created.totalCreated, fences_before.totalCreated + fences.size());
+
+    for (auto& fence : fences) {
+        vkDestroyFence(device, fence, nullptr);
+    }
+    vkDestroyFence(device, VK_NULL_HANDLE, nullptr);
+    const VkMockObjectCensusEntry fences_destroyed = get_entry("VkFence");
+    ASSERT_EQ(fences_destroyed.liveCount, fences_before.liveCount);
+    ASSERT_EQ(fences_destroyed.highWaterMark, fences_created.highWaterMark);
+
+    // Descriptor sets are retired when their pool is reset
+    VkDescriptorPoolCreateInfo descriptor_pool_create_info{};
+    VkDescriptorPool descriptor_pool{};
+    ASSERT_EQ(vkCreateDescriptorPool(device, &descriptor_pool_create_info, nullptr, &descriptor_pool), VK_SUCCESS);
+    const uint64_t sets_before = get_entry("VkDescriptorSet").liveCount;
+    VkDescriptorSetAllocateInfo descriptor_set_allocate_info{};
+    descriptor_set_allocate_info.descriptorPool = descriptor_pool;
+    descriptor_set_allocate_info.descriptorSetCount = 2;
+    std::array<VkDescriptorSet, 2> descriptor_sets{};
+    ASSERT_EQ(vkAllocateDescriptorSets(device, &descriptor_set_allocate_info, descriptor_sets.data()), VK_SUCCESS);
+    ASSERT_EQ(get_entry("VkDescriptorSet").liveCount, sets_before + 2);
+    ASSERT_EQ(vkResetDescriptorPool(device, descriptor_pool, 0), VK_SUCCESS);
+    ASSERT_EQ(get_entry("VkDescriptorSet").liveCount, sets_before);
+    vkDestroyDescriptorPool(device, descriptor_pool, nullptr);
+}
+
+/*
+ * Checks event and semaphore state set from the host and from submitted command buffers
+ */
+TEST_F(MockICD, EventAndSemaphoreState) {
+    VkEventCreateInfo event_create_info{};
+    VkEvent event{};
+    ASSERT_EQ(vkCreateEvent(device, &event_create_info, nullptr, &event), VK_SUCCESS);
+    ASSERT_EQ(vkGetEventStatus(device, event), VK_EVENT_RESET);
+    ASSERT_EQ(vkSetEvent(device, event), VK_SUCCESS);
+    ASSERT_EQ(vkGetEventStatus(device, event), VK_EVENT_SET);
+    ASSERT_EQ(vkResetEvent(device, event), VK_SUCCESS);
+    ASSERT_EQ(vkGetEventStatus(device, event), VK_EVENT_RESET);
+
+    VkCommandPoolCreateInfo command_pool_create_info{};
+    VkCommandPool command_pool{};
+    ASSERT_EQ(vkCreateCommandPool(device, &command_pool_create_info, nullptr, &command_pool), VK_SUCCESS);
+    VkCommandBufferAllocateInfo command_buffer_allocate_info{};
+    command_buffer_allocate_info.commandPool = command_pool;
+    command_buffer_allocate_info.commandBufferCount = 2;
+    std::array<VkCommandBuffer, 2> command_buffers{};
+    ASSERT_EQ(vkAllocateCommandBuffers(device, &command_buffer_allocate_info, command_buffers.data()), VK_SUCCESS);
+    VkCommandBuffer primary = command_buffers[0];
+    VkCommandBuffer secondary = command_buffers[1];
+    VkCommandBufferBeginInfo begin_info{};
+
+    // Device-side sets only land once the command buffer is submitted
+    ASSERT_EQ(vkBeginCommandBuffer(primary, &begin_info), VK_SUCCESS);
+    vkCmdSetEvent(primary, event, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    ASSERT_EQ(vkEndCommandBuffer(primary), VK_SUCCESS);
+    ASSERT_EQ(vkGetEventStatus(device, event), VK_EVENT_RESET);
+    VkSubmitInfo submit_info{};
+    submit_info.commandBufferCount = 1;
+    submit_info.pCommandBuffers = &primary;
+    ASSERT_EQ(vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE), VK_SUCCESS);
+    ASSERT_EQ(vkGetEventStatus(device, event), VK_EVENT_SET);
+
+    // Re-recording replaces the earlier commands, and secondaries run where they are executed
+    ASSERT_EQ(vkBeginCommandBuffer(secondary, &begin_info), VK_SUCCESS);
+    vkCmdSetEvent(secondary, event, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    ASSERT_EQ(vkEndCommandBuffer(secondary), VK_SUCCESS);
+    ASSERT_EQ(vkBeginCommandBuffer(primary, &begin_info), VK_SUCCESS);
+    vkCmdExecuteCommands(primary, 1, &secondary);
+    vkCmdResetEvent(primary, event, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+    ASSERT_EQ(vkEndCommandBuffer(primary), VK_SUCCESS);
+    ASSERT_EQ(vkQueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE), VK_SUCCESS);
+    ASSERT_EQ(vkGetEventStatus(device, event), VK_EVENT_RESET);
+
+    VkSemaphoreTypeCreateInfo semaphore_type_create_info{};
+    semaphore_type_create_info.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    semaphore_type_create_info.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    semaphore_type_create_info.initialValue = 2;
+    VkSemaphoreCreateInfo semaphore_create_info{};
+    semaphore_create_info.pNext = &semaphore_type_create_info;
+    VkSemaphore timeline{};
+    ASSERT_EQ(vkCreateSemaphore(device, &semaphore_create_info, nullptr, &timeline), VK_SUCCESS);
+    uint64_t value = 0;
+    ASSERT_EQ(vkGetSemaphoreCounterValue(device, timeline, &value), VK_SUCCESS);
+    ASSERT_EQ(value, 2);
+
+    uint64_t wait_value = 5;
+    VkSemaphoreWaitInfo wait_info{};
+    wait_info.semaphoreCount = 1;
+    wait_info.pSemaphores = &timeline;
+    wait_info.pValues = &wait_value;
+    ASSERT_EQ(vkWaitSemaphores(device, &wait_info, 0), VK_TIMEOUT);
+
+    // A host wait blocks until another thread signals far enough
+    std::thread signaler([&]() {
+        VkSemaphoreSignalInfo signal_info{};
+        signal_info.semaphore = timeline;
+        signal_info.value = 3;
+        vkSignalSemaphore(device, &signal_info);
+        signal_info.value = 5;
+        vkSignalSemaphore(device, &signal_info);
+    });
+    ASSERT_EQ(vkWaitSemaphores(device, &wait_info, UINT64_MAX), VK_SUCCESS);
+    signaler.join();
+
+    const uint64_t signal_value = 7;
+    VkTimelineSemaphoreSubmitInfo timeline_submit_info{};
+    timeline_submit_info.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+    timeline_submit_info.signalSemaphoreValueCount = 1;
+    timeline_submit_info.pSignalSemaphoreValues = &signal_value;
+    VkSubmitInfo signal_submit_info{};
+    signal_submit_info.pNext = &timeline_submit_info;
+    signal_submit_info.signalSemaphoreCount = 1;
+    signal_submit_info.pSignalSemaphores = &timeline;
+    ASSERT_EQ(vkQueueSubmit(queue, 1, &signal_submit_info, VK_NULL_HANDLE), VK_SUCCESS);
+    ASSERT_EQ(vkGetSemaphoreCounterValue(device, timeline, &value), VK_SUCCESS);
+    ASSERT_EQ(value, 7);
+
+    vkDestroySemaphore(device, timeline, nullptr);
+    vkDestroyCommandPool(device, command_pool, nullptr);
+    vkDestroyEvent(device, event, nullptr);
+}
+
+/*
+ * Exercises the following commands:
+ * vkGetBufferMemoryRequirements
+ * vkGetImageSparseMemoryRequirements
+ * vkQueueBindSparse
+ */
+TEST_F(MockICD, SparseBinding) {
+    auto get_sparse_bind_statistics =
+        get_library_function<PFN_vkmockGetSparseBindStatistics>(MOCK_ICD_LIBRARY_PATH, "vkmockGetSparseBindStatistics");
+    auto resolve_sparse_address =
+        get_library_function<PFN_vkmockResolveSparseAddress>(MOCK_ICD_LIBRARY_PATH, "vkmockResolveSparseAddress");
+    auto get_sparse_resident_page_count =
+        get_library_function<PFN_vkmockGetSparseResidentPageCount>(MOCK_ICD_LIBRARY_PATH, "vkmockGetSparseResidentPageCount");
+    ASSERT_NE(get_sparse_bind_statistics, nullptr);
+    ASSERT_NE(resolve_sparse_address, nullptr);
+    ASSERT_NE(get_sparse_resident_page_count, nullptr);
+    VkMockSparseBindStatistics stats_before{};
+    get_sparse_bind_statistics(&stats_before);
+
+    const VkDeviceSize page_size = 65536;
+    VkBufferCreateInfo buffer_create_info{};
+    buffer_create_info.flags = VK_BUFFER_CREATE_SPARSE_BINDING_BIT | VK_BUFFER_CREATE_SPARSE_RESIDENCY_BIT;
+    buffer_create_info.size = 16 * page_size + 1;
+    VkBuffer buffer{};
+    ASSERT_EQ(vkCreateBuffer(device, &buffer_create_info, nullptr, &buffer), VK_SUCCESS);
+    VkMemoryRequirements buffer_requirements{};
+    vkGetBufferMemoryRequirements(device, buffer, &buffer_requirements);
+    ASSERT_EQ(buffer_requirements.alignment, page_size);
+    ASSERT_EQ(buffer_requirements.size, 17 * page_size);
+
+    VkImageCreateInfo image_create_info{};
+    image_create_info.flags = VK_IMAGE_CREATE_SPARSE_BINDING_BIT | VK_IMAGE_CREATE_SPARSE_RESIDENCY_BIT;
+    image_create_info.imageType = VK_IMAGE_TYPE_2D;
+    image_create_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_create_info.extent = {512, 512, 1};
+    image_create_info.mipLevels = 4;
+    image_create_info.arrayLayers = 2;
+    image_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_create_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+    image_create_info.usage = VK_IMAGE_USAGE_SAMPLED_BIT;
+    VkImage image{};
+    ASSERT_EQ(vkCreateImage(device, &image_create_info, nullptr, &image), VK_SUCCESS);
+
+    // 128x128 tiles: 16 + 4 + 1 per layer, then the 64x64 level 3 of both layers in one tail page
+    uint32_t count = 1;
+    VkSparseImageMemoryRequirements image_requirements{};
+    vkGetImageSparseMemoryRequirements(device, image, &count, &image_requirements);
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(image_requirements.imageMipTailFirstLod, 3);
+    ASSERT_EQ(image_requirements.imageMipTailOffset, 2 * 21 * page_size);
+    ASSERT_EQ(image_requirements.imageMipTailSize, page_size);
+    VkMemoryRequirements image_memory_requirements{};
+    vkGetImageMemoryRequirements(device, image, &image_memory_requirements);
+    ASSERT_EQ(image_memory_requirements.alignment, page_size);
+    ASSERT_GE(image_memory_requirements.size, image_requirements.imageMipTailOffset + image_requirements.imageMipTailSize);
+
+    VkMemoryAllocateInfo allocate_info{};
+    allocate_info.allocationSize = 8 * page_size;
+    VkDeviceMemory memory{};
+    ASSERT_EQ(vkAllocateMemory(device, &allocate_info, nullptr, &memory), VK_SUCCESS);
+
+    VkSparseMemoryBind buffer_bind{};
+    buffer_bind.resourceOffset = 2 * page_size;
+    buffer_bind.size = 2 * page_size;
+    buffer_bind.memory = memory;
+    buffer_bind.memoryOffset = page_size;
+    VkSparseBufferMemoryBindInfo buffer_bind_info{buffer, 1, &buffer_bind};
+    VkSparseImageMemoryBind image_bind{};
+    image_bind.subresource = {VK_IMAGE_ASPECT_COLOR_BIT, 1, 1};
+    image_bind.offset = {128, 0, 0};
+    image_bind.extent = {128, 128, 1};
+    image_bind.memory = memory;
+    image_bind.memoryOffset = 4 * page_size;
+    VkSparseImageMemoryBindInfo image_bind_info{image, 1, &image_bind};
+    VkSparseMemoryBind mip_tail_bind{};
+    mip_tail_bind.resourceOffset = image_requirements.imageMipTailOffset;
+    mip_tail_bind.size = image_requirements.imageMipTailSize;
+    mip_tail_bind.memory = memory;
+    mip_tail_bind.memoryOffset = 5 * page_size;
+    VkSparseImageOpaqueMemoryBindInfo mip_tail_bind_info{image, 1, &mip_tail_bind};
+    VkBindSparseInfo bind_sparse_info{};
+    bind_sparse_info.bufferBindCount = 1;
+    bind_sparse_info.pBufferBinds = &buffer_bind_info;
+    bind_sparse_info.imageOpaqueBindCount = 1;
+    bind_sparse_info.pImageOpaqueBinds = &mip_tail_bind_info;
+    bind_sparse_info.imageBindCount = 1;
+    bind_sparse_info.pImageBinds = &image_bind_info;
+    ASSERT_EQ(vkQueueBindSparse(queue, 1, &bind_sparse_info, VK_NULL_HANDLE), VK_SUCCESS);
+
+    VkDeviceMemory bound_memory{};
+    VkDeviceSize bound_offset = 0;
+    ASSERT_EQ(resolve_sparse_address((uint64_t)buffer, 3 * page_size + 100, &bound_memory, &bound_offset), VK_TRUE);
+    ASSERT_EQ(bound_memory, memory);
+    ASSERT_EQ(bound_offset, 2 * page_size + 100);
+    ASSERT_EQ(resolve_sparse_address((uint64_t)buffer, page_size, &bound_memory, &bound_offset), VK_FALSE);
+    ASSERT_EQ(get_sparse_resident_page_count((uint64_t)buffer), 2);
+
+    // Layer 1, level 1, tile (1, 0) sits after layer 0's 21 tiles and level 0's 16
+    ASSERT_EQ(resolve_sparse_address((uint64_t)image, (21 + 16 + 1) * page_size, &bound_memory, &bound_offset), VK_TRUE);
+    ASSERT_EQ(bound_offset, 4 * page_size);
+    ASSERT_EQ(resolve_sparse_address((uint64_t)image, image_requirements.imageMipTailOffset, &bound_memory, &bound_offset),
+              VK_TRUE);
+    ASSERT_EQ(bound_offset, 5 * page_size);
+    ASSERT_EQ(get_sparse_resident_page_count((uint64_t)image), 2);
+
+    // Binding VK_NULL_HANDLE makes the page non-resident again
+    buffer_bind.size = page_size;
+    buffer_bind.memory = VK_NULL_HANDLE;
+    bind_sparse_info.imageOpaqueBindCount = 0;
+    bind_sparse_info.imageBindCount = 0;
+    ASSERT_EQ(vkQueueBindSparse(queue, 1, &bind_sparse_info, VK_NULL_HANDLE), VK_SUCCESS);
+    ASSERT_EQ(resolve_sparse_address((uint64_t)buffer, 2 * page_size, &bound_memory, &bound_offset), VK_FALSE);
+    ASSERT_EQ(get_sparse_resident_page_count((uint64_t)buffer), 1);
+
+    VkMockSparseBindStatistics stats{};
+    get_sparse_bind_statistics(&stats);
+    ASSERT_EQ(stats.bindSparseCalls - stats_before.bindSparseCalls, 2);
+    ASSERT_EQ(stats.bindInfos - stats_before.bindInfos, 2);
+    ASSERT_EQ(stats.bindRanges - stats_before.bindRanges, 4);
+    ASSERT_EQ(stats.pagesBound - stats_before.pagesBound, 4);
+    ASSERT_EQ(stats.pagesUnbound - stats_before.pagesUnbound, 1);
+
+    // Destroying a resource drops its page table
+    vkDestroyBuffer(device, buffer, nullptr);
+    vkDestroyImage(device, image, nullptr);
+    ASSERT_EQ(get_sparse_resident_page_count((uint64_t)buffer), 0);
+    ASSERT_EQ(get_sparse_resident_page_count((uint64_t)image), 0);
+    vkFreeMemory(device, memory, nullptr);
+}
+
+/*
+ * Exercises the following commands:
+ * vkGetImageSubresourceLayout
+ * vkGetImageSubresourceLayout2
+ * vkGetDeviceImageSubresourceLayout
+ */
+TEST_F(MockICD, LinearSubresourceLayout) {
+    auto vkGetImageSubresourceLayout2 =
+        reinterpret_cast<PFN_vkGetImageSubresourceLayout2>(vkGetDeviceProcAddr(device, "vkGetImageSubresourceLayout2"));
+    auto vkGetDeviceImageSubresourceLayout =
+        reinterpret_cast<PFN_vkGetDeviceImageSubresourceLayout>(vkGetDeviceProcAddr(device, "vkGetDeviceImageSubresourceLayout"));
+    ASSERT_NE(vkGetImageSubresourceLayout2, nullptr);
+    ASSERT_NE(vkGetDeviceImageSubresourceLayout, nullptr);
+
+    VkImageCreateInfo image_create_info{};
+    image_create_info.imageType = VK_IMAGE_TYPE_2D;
+    image_create_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+    image_create_info.extent = {100, 10, 1};
+    image_create_info.mipLevels = 2;
+    image_create_info.arrayLayers = 2;
+    image_create_info.samples = VK_SAMPLE_COUNT_1_BIT;
+    image_create_info.tiling = VK_IMAGE_TILING_LINEAR;
+    image_create_info.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    VkImage image{};
+    ASSERT_EQ(vkCreateImage(device, &image_create_info, nullptr, &image), VK_SUCCESS);
+
+    // Level 0 rows are 400 bytes padded to 512, level 1 rows 200 padded to 256, and each layer holds both levels
+    VkImageSubresource subresource{VK_IMAGE_ASPECT_COLOR_BIT, 1, 1};
+    VkSubresourceLayout layout{};
+    vkGetImageSubresourceLayout(device, image, &subresource, &layout);
+    ASSERT_EQ(layout.rowPitch, 256);
+    ASSERT_EQ(layout.size, 256 * 5);
+    ASSERT_EQ(layout.arrayPitch, 512 * 10 + 256 * 5);
+    ASSERT_EQ(layout.offset, layout.arrayPitch + 512 * 10);
+
+    VkMemoryRequirements memory_requirements{};
+    vkGetImageMemoryRequirements(device, image, &memory_requirements);
+    ASSERT_GE(memory_requirements.size, layout.arrayPitch * 2);
+
+    VkSubresourceHostMemcpySize host_memcpy_size{};
+    host_memcpy_size.sType = VK_STRUCTURE_TYPE_SUBRESOURCE_HOST_MEMCPY_SIZE;
+    VkSubresourceLayout2 layout2{};
+    layout2.sType = VK_STRUCTURE_TYPE_SUBRESOURCE_LAYOUT_2;
+    layout2.pNext = &host_memcpy_size;
+    VkImageSubresource2 subresource2{};
+    subresource2.sType = VK_STRUCTURE_TYPE_IMAGE_SUBRESOURCE_2;
+    subresource2.imageSubresource = subresource;
+    vkGetImageSubresourceLayout2(device, image, &subresource2, &layout2);
+    ASSERT_EQ(layout2.subresourceLayout.offset, layout.offset);
+    ASSERT_EQ(host_memcpy_size.size, layout.size);
+    vkDestroyImage(device, image, nullptr);
+
+    // The chroma planes of a 4:2:0 image are half size in both dimensions and follow the luma plane
+    image_create_info.format = VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM;
+    image_create_info.extent = {64, 32, 1};
+    image_create_info.mipLevels = 1;
+    image_create_info.arrayLayers = 1;
+    VkDeviceImageSubresourceInfo device_subresource_info{};
+    device_subresource_info.sType = VK_STRUCTURE_TYPE_DEVICE_IMAGE_SUBRESOURCE_INFO;
+    device_subresource_info.pCreateInfo = &image_create_info;
+    device_subresource_info.pSubresource = &subresource2;
+    subresource2.imageSubresource = {VK_IMAGE_ASPECT_PLANE_2_BIT, 0, 0};
+    layout2.pNext = nullptr;
+    vkGetDeviceImageSubresourceLayout(device, &device_subresource_info, &layout2);
+    ASSERT_EQ(layout2.subresourceLayout.rowPitch, 256);
+    ASSERT_EQ(layout2.subresourceLayout.size, 256 * 16);
+    ASSERT_EQ(layout2.subresourceLayout.offset, 256 * 32 + 256 * 16);
+}
@@ -19,8 +19,14 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <cstring>
 #include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -30,5 +36,21 @@
 #include <windows.h>
 inline int set_environment_var(const char* name, const char* value) { return SetEnvironmentVariable(name, value); }
 #else
+#include <dlfcn.h>
 inline int set_environment_var(const char* name, const char* value) { return setenv(name, value, 1); }
 #endif
+
+// Points the loader at the mock ICD and keeps layers from being loaded
+void setup_mock_icd_env_vars();
+
+// Look up an entry point exported directly from a shared library, bypassing the loader
+template <typename T>
+T get_library_function(const char* library_path, const char* name) {
+#if defined(WIN32)
+    HMODULE library = LoadLibraryA(library_path);
+    return library ? reinterpret_cast<T>(GetProcAddress(library, name)) : nullptr;
+#else
+    void* library = dlopen(library_path, RTLD_NOW | RTLD_LOCAL);
+    return library ? reinterpret_cast<T>(dlsym(library, name)) : nullptr;
+#endif
+}
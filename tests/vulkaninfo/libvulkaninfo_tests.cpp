@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "test_common.h"
+
+#include "libvulkaninfo.h"
+
+// Checks what libvulkaninfo::Capture returns against querying the mock ICD through the loader directly
+class Libvulkaninfo : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        setup_mock_icd_env_vars();
+
+        VkApplicationInfo app_info{};
+        app_info.apiVersion = VK_HEADER_VERSION_COMPLETE;
+        VkInstanceCreateInfo instance_create_info{};
+        instance_create_info.pApplicationInfo = &app_info;
+        ASSERT_EQ(vkCreateInstance(&instance_create_info, nullptr, &instance), VK_SUCCESS);
+
+        uint32_t count = 1;
+        ASSERT_EQ(vkEnumeratePhysicalDevices(instance, &count, &physical_device), VK_SUCCESS);
+        ASSERT_EQ(count, 1);
+    }
+
+    void TearDown() override { vkDestroyInstance(instance, nullptr); }
+
+    VkInstance instance{};
+    VkPhysicalDevice physical_device{};
+};
+
+TEST_F(Libvulkaninfo, CaptureMatchesMockICD) {
+    libvulkaninfo::CaptureOptions options;
+    options.formats = true;
+    options.memory_budget = true;
+    const libvulkaninfo::InstanceInfo info = libvulkaninfo::Capture(options);
+
+    uint32_t count = 0;
+    ASSERT_EQ(vkEnumerateInstanceExtensionProperties(nullptr, &count, nullptr), VK_SUCCESS);
+    ASSERT_EQ(info.extensions.size(), count);
+    ASSERT_EQ(vkEnumerateInstanceLayerProperties(&count, nullptr), VK_SUCCESS);
+    ASSERT_EQ(info.layers.size(), count);
+    ASSERT_EQ(info.physical_devices.size(), 1U);
+    const libvulkaninfo::PhysicalDeviceInfo &gpu = info.physical_devices[0];
+
+    VkPhysicalDeviceProperties properties{};
+    vkGetPhysicalDeviceProperties(physical_device, &properties);
+    ASSERT_STREQ(gpu.properties.deviceName, properties.deviceName);
+    ASSERT_EQ(gpu.properties.vendorID, properties.vendorID);
+    ASSERT_EQ(gpu.properties.deviceID, properties.deviceID);
+    ASSERT_EQ(gpu.properties.apiVersion, properties.apiVersion);
+
+    ASSERT_EQ(vkEnumerateDeviceExtensionProperties(physical_device, nullptr, &count, nullptr), VK_SUCCESS);
+    ASSERT_EQ(gpu.extensions.size(), count);
+
+    vkGetPhysicalDeviceQueueFamilyProperties(physical_device, &count, nullptr);
+    ASSERT_EQ(gpu.queue_families.size(), count);
+
+    VkPhysicalDeviceMemoryProperties memory_properties{};
+    vkGetPhysicalDeviceMemoryProperties(physical_device, &memory_properties);
+    ASSERT_EQ(gpu.memory_properties.memoryTypeCount, memory_properties.memoryTypeCount);
+    ASSERT_EQ(gpu.memory_properties.memoryHeapCount, memory_properties.memoryHeapCount);
+
+    // The chains hold the structs the driver filled in, which stay valid for as long as info does
+    if (info.api_version >= VK_API_VERSION_1_2 && gpu.properties.apiVersion >= VK_API_VERSION_1_2) {
+        VkPhysicalDeviceVulkan12Features vulkan12_features{};
+        vulkan12_features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        VkPhysicalDeviceFeatures2 features2{};
+        features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        features2.pNext = &vulkan12_features;
+        vkGetPhysicalDeviceFeatures2(physical_device, &features2);
+
+        auto captured = gpu.features_chain.Find<VkPhysicalDeviceVulkan12Features>(
+            VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES);
+        ASSERT_NE(captured, nullptr);
+        ASSERT_EQ(captured->timelineSemaphore, vulkan12_features.timelineSemaphore);
+        ASSERT_EQ(captured->bufferDeviceAddress, vulkan12_features.bufferDeviceAddress);
+    }
+
+    // Formats are sorted by format and report the same features as the driver
+    ASSERT_FALSE(gpu.formats.empty());
+    ASSERT_TRUE(std::is_sorted(gpu.formats.begin(), gpu.formats.end(),
+                               [](const auto& a, const auto& b) { return a.format < b.format; }));
+    auto r8g8b8a8 = std::find_if(gpu.formats.begin(), gpu.formats.end(),
+                                 [](const auto& format) { return format.format == VK_FORMAT_R8G8B8A8_UNORM; });
+    ASSERT_NE(r8g8b8a8, gpu.formats.end());
+    VkFormatProperties format_properties{};
+    vkGetPhysicalDeviceFormatProperties(physical_device, VK_FORMAT_R8G8B8A8_UNORM, &format_properties);
+    ASSERT_EQ(r8g8b8a8->properties.linearTilingFeatures, format_properties.linearTilingFeatures);
+    ASSERT_EQ(r8g8b8a8->properties.optimalTilingFeatures, format_properties.optimalTilingFeatures);
+    ASSERT_EQ(r8g8b8a8->properties.bufferFeatures, format_properties.bufferFeatures);
+}
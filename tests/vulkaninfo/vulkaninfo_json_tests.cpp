@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "test_common.h"
+
+#include <sstream>
+#include <stdexcept>
+
+#include "vulkaninfo_diff.h"
+
+// Reads every token of a json document
+std::vector<JsonToken> ReadJsonTokens(const std::string& json) {
+    std::istringstream in(json);
+    JsonReader reader(in);
+    std::vector<JsonToken> tokens;
+    JsonToken token;
+    while (reader.Next(token)) tokens.push_back(token);
+    return tokens;
+}
+
+// The string a document made of a single json string reads as
+std::string ReadJsonString(const std::string& json) {
+    auto tokens = ReadJsonTokens(json);
+    EXPECT_EQ(tokens.size(), 1U);
+    EXPECT_EQ(tokens.at(0).type, JsonType::string);
+    return tokens.at(0).text;
+}
+
+std::vector<JsonFlatValue> FlattenJson(const std::string& json) {
+    std::istringstream in(json);
+    std::vector<JsonFlatValue> values;
+    FlattenVulkaninfoJson(in, values);
+    return values;
+}
+
+const JsonFlatValue* FindFlatValue(const std::vector<JsonFlatValue>& values, std::string_view path) {
+    auto found = std::find_if(values.begin(), values.end(), [path](const JsonFlatValue& value) { return value.path == path; });
+    return found == values.end() ? nullptr : &*found;
+}
+
+JsonDiff DiffJson(const std::string& from, const std::string& to, uint32_t gpu = 0) {
+    std::istringstream from_in(from);
+    std::istringstream to_in(to);
+    JsonDiff diff;
+    DiffVulkaninfoJson(from_in, to_in, diff, gpu);
+    return diff;
+}
+
+std::string DiffText(const JsonDiff& diff) {
+    std::ostringstream out;
+    PrintDiffText(out, diff);
+    return out.str();
+}
+
+TEST(VulkaninfoJson, ReaderTokens) {
+    auto tokens = ReadJsonTokens(R"({"a": [1, -2.5e3, true, false, null], "b": {}, "c": "d"})");
+    ASSERT_EQ(tokens.size(), 12U);
+    ASSERT_EQ(tokens[0].type, JsonType::begin_object);
+    ASSERT_EQ(tokens[1].type, JsonType::begin_array);
+    ASSERT_EQ(tokens[1].key, "a");
+    ASSERT_EQ(tokens[2].type, JsonType::number);
+    ASSERT_EQ(tokens[2].text, "1");
+    ASSERT_TRUE(tokens[2].key.empty());
+    ASSERT_EQ(tokens[3].text, "-2.5e3");
+    ASSERT_EQ(tokens[4].type, JsonType::boolean);
+    ASSERT_EQ(tokens[4].text, "true");
+    ASSERT_EQ(tokens[5].text, "false");
+    ASSERT_EQ(tokens[6].type, JsonType::null);
+    ASSERT_EQ(tokens[7].type, JsonType::end_array);
+    ASSERT_EQ(tokens[8].type, JsonType::begin_object);
+    ASSERT_EQ(tokens[8].key, "b");
+    ASSERT_EQ(tokens[9].type, JsonType::end_object);
+    ASSERT_EQ(tokens[10].type, JsonType::string);
+    ASSERT_EQ(tokens[10].key, "c");
+    ASSERT_EQ(tokens[10].text, "d");
+    ASSERT_EQ(tokens[11].type, JsonType::end_object);
+}
+
+TEST(VulkaninfoJson, ReaderSkip) {
+    std::istringstream in(R"({"skipped": {"a": [1, {"b": 2}]}, "kept": 3})");
+    JsonReader reader(in);
+    JsonToken token;
+    ASSERT_TRUE(reader.Next(token));
+    ASSERT_TRUE(reader.Next(token));
+    ASSERT_EQ(token.key, "skipped");
+    reader.Skip();
+    ASSERT_EQ(reader.Depth(), 1U);
+    ASSERT_TRUE(reader.Next(token));
+    ASSERT_EQ(token.key, "kept");
+    ASSERT_EQ(token.text, "3");
+}
+
+TEST(VulkaninfoJson, ReaderEscapes) {
+    ASSERT_EQ(ReadJsonString(R"("\"\\\/\b\f\n\r\t")"), "\"\\/\b\f\n\r\t");
+    ASSERT_EQ(ReadJsonString(R"("\u0041\u00e9\u20AC")"), "A\xC3\xA9\xE2\x82\xAC");
+    // U+1F600 is written as a surrogate pair and read as a single 4 byte UTF-8 sequence
+    ASSERT_EQ(ReadJsonString(R"("\ud83d\ude00")"), "\xF0\x9F\x98\x80");
+    ASSERT_EQ(ReadJsonString(R"("a\uD83D\uDE00b")"), "a\xF0\x9F\x98\x80" "b");
+    // UTF-8 that isn't escaped is passed through
+    ASSERT_EQ(ReadJsonString("\"\xC3\xA9\""), "\xC3\xA9");
+
+    ASSERT_THROW(ReadJsonTokens(R"("\ud83d")"), std::runtime_error);        // high surrogate alone
+    ASSERT_THROW(ReadJsonTokens(R"("\ud83d\u0041")"), std::runtime_error);  // high surrogate followed by no low one
+    ASSERT_THROW(ReadJsonTokens(R"("\ud83dx")"), std::runtime_error);
+    ASSERT_THROW(ReadJsonTokens(R"("\u12g4")"), std::runtime_error);
+    ASSERT_THROW(ReadJsonTokens(R"("\x")"), std::runtime_error);
+}
+
+// A string longer than the buffer of the reader, with an escape split by the end of the buffer
+TEST(VulkaninfoJson, ReaderLongString) {
+    std::string text(65535, 'x');
+    auto read = ReadJsonString("\"" + text + "\\u00e9\"");
+    ASSERT_EQ(read, text + "\xC3\xA9");
+}
+
+TEST(VulkaninfoJson, ReaderMalformed) {
+    const char* malformed[] = {
+        "",                  // no document
+        "{",                 // truncated
+        R"({"a": [1, 2)",    // truncated inside of an array
+        R"({"a": "b)",       // unterminated string
+        R"({"a" 1})",        // missing colon
+        R"({"a": 1 "b": 2})",  // missing comma
+        R"([1, 2,])",        // trailing comma
+        R"({a: 1})",         // key that isn't a string
+        R"({"a": tru})",     // invalid literal
+        R"({"a": +1})",      // not a value
+        R"({"a": 1}})",      // characters after the document
+        R"({"a": 1} {})",    // second document
+    };
+    for (const char* json : malformed) {
+        ASSERT_THROW(ReadJsonTokens(json), std::runtime_error) << json;
+    }
+
+    // Errors name how far into the document they were found, here just past the '"' that should have been a ','
+    try {
+        ReadJsonTokens(R"({"a": 1 "b": 2})");
+        FAIL();
+    } catch (const std::runtime_error& error) {
+        ASSERT_STREQ(error.what(), "expected ',' at byte 9");
+    }
+}
+
+TEST(VulkaninfoJson, FlattenProfile) {
+    auto values = FlattenJson(R"({
+        "$schema": "https://schema.khronos.org/vulkan/profiles-0.8.2-276.json#",
+        "capabilities": {
+            "device": {
+                "extensions": {"VK_KHR_swapchain": 70},
+                "features": {"VkPhysicalDeviceFeatures": {"geometryShader": true}},
+                "properties": {"VkPhysicalDeviceProperties": {
+                    "deviceName": "Mock",
+                    "maxComputeWorkGroupCount": [65535, 65535, 65535]
+                }},
+                "queueFamiliesProperties": [{"VkQueueFamilyProperties": {"queueCount": 1}}]
+            }
+        },
+        "profiles": {"VP_VULKANINFO_Mock": {"version": 1, "capabilities": ["device"]}}
+    })");
+
+    ASSERT_EQ(values.size(), 7U);
+    ASSERT_EQ(values[0].path, "device/extensions/VK_KHR_swapchain");
+    ASSERT_EQ(values[0].type, JsonType::number);
+    ASSERT_EQ(values[0].text, "70");
+    ASSERT_EQ(values[1].path, "device/features/VkPhysicalDeviceFeatures/geometryShader");
+    ASSERT_EQ(values[1].type, JsonType::boolean);
+    ASSERT_EQ(values[2].path, "device/properties/VkPhysicalDeviceProperties/deviceName");
+    ASSERT_EQ(values[2].type, JsonType::string);
+    ASSERT_EQ(values[2].text, "Mock");
+    ASSERT_EQ(values[3].path, "device/properties/VkPhysicalDeviceProperties/maxComputeWorkGroupCount[0]");
+    ASSERT_EQ(values[5].path, "device/properties/VkPhysicalDeviceProperties/maxComputeWorkGroupCount[2]");
+    ASSERT_EQ(values[6].path, "device/queueFamiliesProperties[0]/VkQueueFamilyProperties/queueCount");
+    // An array of objects is only its elements, and neither the schema nor the profiles are capabilities
+    ASSERT_EQ(FindFlatValue(values, "device/queueFamiliesProperties"), nullptr);
+    ASSERT_EQ(FindFlatValue(values, "$schema"), nullptr);
+}
+
+// vulkaninfo writes flags as arrays of strings. An empty array is an empty set of flags, a missing array is no value at all.
+TEST(VulkaninfoJson, FlattenFlags) {
+    auto values = FlattenJson(R"({"capabilities": {"device": {"formats": {"VK_FORMAT_R8_UNORM": {
+        "linearTilingFeatures": ["VK_FORMAT_FEATURE_TRANSFER_DST_BIT", "VK_FORMAT_FEATURE_BLIT_SRC_BIT"],
+        "bufferFeatures": []
+    }}}}})");
+
+    auto linear = FindFlatValue(values, "device/formats/VK_FORMAT_R8_UNORM/linearTilingFeatures");
+    ASSERT_NE(linear, nullptr);
+    ASSERT_EQ(linear->type, JsonType::begin_array);
+    ASSERT_EQ(linear->text, "VK_FORMAT_FEATURE_BLIT_SRC_BIT|VK_FORMAT_FEATURE_TRANSFER_DST_BIT");  // sorted
+
+    auto buffer = FindFlatValue(values, "device/formats/VK_FORMAT_R8_UNORM/bufferFeatures");
+    ASSERT_NE(buffer, nullptr);
+    ASSERT_EQ(buffer->type, JsonType::begin_array);
+    ASSERT_TRUE(buffer->text.empty());
+
+    ASSERT_EQ(FindFlatValue(values, "device/formats/VK_FORMAT_R8_UNORM/optimalTilingFeatures"), nullptr);
+    ASSERT_EQ(values.size(), 2U);
+}
+
+// Documents that aren't profiles have every value flattened, named from the top of the document
+TEST(VulkaninfoJson, FlattenOtherDocument) {
+    auto values = FlattenJson(R"({"Vulkan Instance Version": "1.4.304", "Layers": {"count": 0}})");
+    ASSERT_EQ(values.size(), 2U);
+    ASSERT_EQ(values[0].path, "Vulkan Instance Version");
+    ASSERT_EQ(values[1].path, "Layers/count");
+}
+
+TEST(VulkaninfoJson, FlattenStreams) {
+    std::istringstream in(R"({"capabilities": {"device": {"a": 1, "b": 2}}})");
+    std::vector<std::string> paths;
+    FlattenVulkaninfoJson(in, [&paths](JsonFlatValue&& value) { paths.push_back(value.path); });
+    ASSERT_EQ(paths, (std::vector<std::string>{"device/a", "device/b"}));
+}
+
+TEST(VulkaninfoJson, FlattenMalformed) {
+    ASSERT_THROW(FlattenJson("[]"), std::runtime_error);
+    ASSERT_THROW(FlattenJson(R"("capabilities")"), std::runtime_error);
+    ASSERT_THROW(FlattenJson(""), std::runtime_error);
+    ASSERT_THROW(FlattenJson(R"({"capabilities": {"device": {"a": 1})"), std::runtime_error);
+    ASSERT_THROW(FlattenJson(R"({"capabilities": {"device": {"a": 1}}} trailing)"), std::runtime_error);
+}
+
+TEST(VulkaninfoJson, SplitProfileBlockPath) {
+    ProfileBlockPath split = SplitProfileBlockPath("device_gpu1/extensions/VK_KHR_swapchain");
+    ASSERT_EQ(split.block, "device");
+    ASSERT_EQ(split.gpu, "1");
+    ASSERT_EQ(split.rest, "extensions/VK_KHR_swapchain");
+
+    split = SplitProfileBlockPath("device/extensions/VK_KHR_swapchain");
+    ASSERT_EQ(split.block, "device");
+    ASSERT_TRUE(split.gpu.empty());
+    ASSERT_EQ(split.rest, "extensions/VK_KHR_swapchain");
+
+    split = SplitProfileBlockPath("device_gpu12");
+    ASSERT_EQ(split.block, "device");
+    ASSERT_EQ(split.gpu, "12");
+    ASSERT_TRUE(split.rest.empty());
+
+    // Only a "_gpu" followed by nothing but digits at the end of the block name is a GPU number
+    split = SplitProfileBlockPath("my_gpu3_block/a");
+    ASSERT_EQ(split.block, "my_gpu3_block");
+    ASSERT_TRUE(split.gpu.empty());
+    split = SplitProfileBlockPath("device_gpu/a");
+    ASSERT_EQ(split.block, "device_gpu");
+    ASSERT_TRUE(split.gpu.empty());
+    split = SplitProfileBlockPath("device_gpu1x/a");
+    ASSERT_EQ(split.block, "device_gpu1x");
+    ASSERT_TRUE(split.gpu.empty());
+    split = SplitProfileBlockPath("a_gpu_gpu2/b/c_gpu3");
+    ASSERT_EQ(split.block, "a_gpu");
+    ASSERT_EQ(split.gpu, "2");
+    ASSERT_EQ(split.rest, "b/c_gpu3");
+}
+
+TEST(VulkaninfoJson, DiffProfiles) {
+    JsonDiff diff = DiffJson(R"({"capabilities": {"device": {
+        "name": "A", "count": 1, "removed": true, "flags": ["X", "Y"], "same": 7
+    }}})",
+                             R"({"capabilities": {"device": {
+        "same": 7, "flags": ["Z", "X"], "count": 2, "name": "A", "added": "new"
+    }}})");
+
+    // Changed and added values in the order of the second document, then the removed ones
+    ASSERT_EQ(diff.changes.size(), 4U);
+    ASSERT_EQ(diff.changes[0].to->path, "device/flags");
+    ASSERT_EQ(diff.changes[1].to->path, "device/count");
+    ASSERT_EQ(diff.changes[1].from->text, "1");
+    ASSERT_EQ(diff.changes[1].to->text, "2");
+    ASSERT_EQ(diff.changes[2].from, nullptr);
+    ASSERT_EQ(diff.changes[2].to->path, "device/added");
+    ASSERT_EQ(diff.changes[3].from->path, "device/removed");
+    ASSERT_EQ(diff.changes[3].to, nullptr);
+
+    ASSERT_EQ(DiffText(diff),
+              "~ device/flags: +Z -Y\n"
+              "~ device/count: 1 -> 2\n"
+              "+ device/added: \"new\"\n"
+              "- device/removed: true\n"
+              "2 changed, 1 added, 1 removed\n");
+}
+
+// Emptying a set of flags is a change, removing it is not the same change
+TEST(VulkaninfoJson, DiffEmptyAndMissingFlags) {
+    JsonDiff emptied = DiffJson(R"({"capabilities": {"device": {"flags": ["X"]}}})",
+                                R"({"capabilities": {"device": {"flags": []}}})");
+    ASSERT_EQ(emptied.changes.size(), 1U);
+    ASSERT_NE(emptied.changes[0].from, nullptr);
+    ASSERT_NE(emptied.changes[0].to, nullptr);
+    ASSERT_EQ(DiffText(emptied), "~ device/flags: -X\n1 changed, 0 added, 0 removed\n");
+
+    JsonDiff removed = DiffJson(R"({"capabilities": {"device": {"flags": []}}})", R"({"capabilities": {"device": {}}})");
+    ASSERT_EQ(removed.changes.size(), 1U);
+    ASSERT_EQ(removed.changes[0].to, nullptr);
+    ASSERT_EQ(DiffText(removed), "- device/flags: []\n0 changed, 0 added, 1 removed\n");
+
+    ASSERT_TRUE(DiffJson(R"({"capabilities": {"device": {"flags": []}}})", R"({"capabilities": {"device": {"flags": []}}})")
+                    .changes.empty());
+}
+
+const char* const all_gpus_json = R"({"capabilities": {
+    "device_gpu0": {"properties": {"deviceName": "B", "maxImageDimension2D": 8192}},
+    "device_gpu1": {"properties": {"deviceName": "C", "maxImageDimension2D": 4096}}
+}})";
+
+// --json=all compared with the profile of one GPU only compares the blocks of the GPU that was picked
+TEST(VulkaninfoJson, DiffAllGpusWithSingleProfile) {
+    const char* single = R"({"capabilities": {"device": {"properties": {"deviceName": "C", "maxImageDimension2D": 4096}}}})";
+
+    ASSERT_TRUE(DiffJson(all_gpus_json, single, 1).changes.empty());
+    ASSERT_TRUE(DiffJson(single, all_gpus_json, 1).changes.empty());
+
+    JsonDiff diff = DiffJson(all_gpus_json, single, 0);
+    ASSERT_EQ(diff.changes.size(), 2U);
+    ASSERT_EQ(diff.changes[0].from->path, "device/properties/deviceName");
+    ASSERT_EQ(diff.changes[0].from->text, "B");
+    ASSERT_EQ(diff.changes[0].to->text, "C");
+    ASSERT_EQ(diff.changes[1].from->text, "8192");
+
+    ASSERT_THROW(DiffJson(all_gpus_json, single, 2), std::runtime_error);
+}
+
+// Two --json=all documents are compared GPU by GPU
+TEST(VulkaninfoJson, DiffAllGpus) {
+    const char* other = R"({"capabilities": {
+        "device_gpu0": {"properties": {"deviceName": "B", "maxImageDimension2D": 8192}},
+        "device_gpu1": {"properties": {"deviceName": "D", "maxImageDimension2D": 4096}}
+    }})";
+    JsonDiff diff = DiffJson(all_gpus_json, other);
+    ASSERT_EQ(diff.changes.size(), 1U);
+    ASSERT_EQ(diff.changes[0].to->path, "device_gpu1/properties/deviceName");
+    ASSERT_EQ(diff.changes[0].to->text, "D");
+}
+
+TEST(VulkaninfoJson, DiffMalformed) {
+    const char* profile = R"({"capabilities": {"device": {"a": 1}}})";
+    ASSERT_THROW(DiffJson(profile, R"({"capabilities": {"device": {"a": 1}})"), std::runtime_error);
+    ASSERT_THROW(DiffJson("[1]", profile), std::runtime_error);
+    ASSERT_THROW(DiffJson(profile, ""), std::runtime_error);
+}
+
+TEST(VulkaninfoJson, DiffJsonOutput) {
+    JsonDiff diff = DiffJson(R"({"capabilities": {"device": {"name": "a\"b", "flags": ["X"]}}})",
+                             R"({"capabilities": {"device": {"name": "a\nb", "flags": ["X", "Y"]}}})");
+    std::ostringstream out;
+    PrintDiffJson(out, diff);
+
+    // The output is json itself, with the strings escaped again
+    auto values = FlattenJson(out.str());
+    ASSERT_EQ(values.size(), 8U);
+    ASSERT_EQ(values[0].path, "changed[0]/path");
+    ASSERT_EQ(values[0].text, "device/name");
+    ASSERT_EQ(values[1].path, "changed[0]/from");
+    ASSERT_EQ(values[1].text, "a\"b");
+    ASSERT_EQ(values[2].text, "a\nb");
+    ASSERT_EQ(values[4].path, "changed[1]/from");
+    ASSERT_EQ(values[4].text, "X");
+    ASSERT_EQ(values[5].path, "changed[1]/to");
+    ASSERT_EQ(values[5].text, "X|Y");
+    ASSERT_EQ(values[6].path, "added");
+    ASSERT_EQ(values[6].type, JsonType::begin_array);
+    ASSERT_TRUE(values[6].text.empty());
+    ASSERT_EQ(values[7].path, "removed");
+}
@@ -0,0 +1,4957 @@
+
+/*
+ * Copyright (c) 2019-2026 The Khronos Group Inc.
+ * Copyright (c) 2019-2026 Valve Corporation
+ * Copyright (c) 2019-2026 LunarG, Inc.
+ * Copyright (c) 2023-2024 RasterGrid Kft.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author: Charles Giessen <charles@lunarg.com>
+ *
+ */
+
+/*
+ * This file is generated from the Khronos Vulkan XML API Registry.
+ */
+
+#pragma once
+
+#include "vulkaninfo.h"
+
+std::string StdVideoH264ChromaFormatIdcString(StdVideoH264ChromaFormatIdc value) {
+    switch (value) {
+        case STD_VIDEO_H264_CHROMA_FORMAT_IDC_MONOCHROME:
+            return "STD_VIDEO_H264_CHROMA_FORMAT_IDC_MONOCHROME";
+        case STD_VIDEO_H264_CHROMA_FORMAT_IDC_420:
+            return "STD_VIDEO_H264_CHROMA_FORMAT_IDC_420";
+        case STD_VIDEO_H264_CHROMA_FORMAT_IDC_422:
+            return "STD_VIDEO_H264_CHROMA_FORMAT_IDC_422";
+        case STD_VIDEO_H264_CHROMA_FORMAT_IDC_444:
+            return "STD_VIDEO_H264_CHROMA_FORMAT_IDC_444";
+        case STD_VIDEO_H264_CHROMA_FORMAT_IDC_INVALID:
+            return "STD_VIDEO_H264_CHROMA_FORMAT_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264ChromaFormatIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264ProfileIdcString(StdVideoH264ProfileIdc value) {
+    switch (value) {
+        case STD_VIDEO_H264_PROFILE_IDC_BASELINE:
+            return "STD_VIDEO_H264_PROFILE_IDC_BASELINE";
+        case STD_VIDEO_H264_PROFILE_IDC_MAIN:
+            return "STD_VIDEO_H264_PROFILE_IDC_MAIN";
+        case STD_VIDEO_H264_PROFILE_IDC_HIGH:
+            return "STD_VIDEO_H264_PROFILE_IDC_HIGH";
+        case STD_VIDEO_H264_PROFILE_IDC_HIGH_10:
+            return "STD_VIDEO_H264_PROFILE_IDC_HIGH_10";
+        case STD_VIDEO_H264_PROFILE_IDC_HIGH_422:
+            return "STD_VIDEO_H264_PROFILE_IDC_HIGH_422";
+        case STD_VIDEO_H264_PROFILE_IDC_HIGH_444_PREDICTIVE:
+            return "STD_VIDEO_H264_PROFILE_IDC_HIGH_444_PREDICTIVE";
+        case STD_VIDEO_H264_PROFILE_IDC_INVALID:
+            return "STD_VIDEO_H264_PROFILE_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264ProfileIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264LevelIdcString(StdVideoH264LevelIdc value) {
+    switch (value) {
+        case STD_VIDEO_H264_LEVEL_IDC_1_0:
+            return "STD_VIDEO_H264_LEVEL_IDC_1_0";
+        case STD_VIDEO_H264_LEVEL_IDC_1_1:
+            return "STD_VIDEO_H264_LEVEL_IDC_1_1";
+        case STD_VIDEO_H264_LEVEL_IDC_1_2:
+            return "STD_VIDEO_H264_LEVEL_IDC_1_2";
+        case STD_VIDEO_H264_LEVEL_IDC_1_3:
+            return "STD_VIDEO_H264_LEVEL_IDC_1_3";
+        case STD_VIDEO_H264_LEVEL_IDC_2_0:
+            return "STD_VIDEO_H264_LEVEL_IDC_2_0";
+        case STD_VIDEO_H264_LEVEL_IDC_2_1:
+            return "STD_VIDEO_H264_LEVEL_IDC_2_1";
+        case STD_VIDEO_H264_LEVEL_IDC_2_2:
+            return "STD_VIDEO_H264_LEVEL_IDC_2_2";
+        case STD_VIDEO_H264_LEVEL_IDC_3_0:
+            return "STD_VIDEO_H264_LEVEL_IDC_3_0";
+        case STD_VIDEO_H264_LEVEL_IDC_3_1:
+            return "STD_VIDEO_H264_LEVEL_IDC_3_1";
+        case STD_VIDEO_H264_LEVEL_IDC_3_2:
+            return "STD_VIDEO_H264_LEVEL_IDC_3_2";
+        case STD_VIDEO_H264_LEVEL_IDC_4_0:
+            return "STD_VIDEO_H264_LEVEL_IDC_4_0";
+        case STD_VIDEO_H264_LEVEL_IDC_4_1:
+            return "STD_VIDEO_H264_LEVEL_IDC_4_1";
+        case STD_VIDEO_H264_LEVEL_IDC_4_2:
+            return "STD_VIDEO_H264_LEVEL_IDC_4_2";
+        case STD_VIDEO_H264_LEVEL_IDC_5_0:
+            return "STD_VIDEO_H264_LEVEL_IDC_5_0";
+        case STD_VIDEO_H264_LEVEL_IDC_5_1:
+            return "STD_VIDEO_H264_LEVEL_IDC_5_1";
+        case STD_VIDEO_H264_LEVEL_IDC_5_2:
+            return "STD_VIDEO_H264_LEVEL_IDC_5_2";
+        case STD_VIDEO_H264_LEVEL_IDC_6_0:
+            return "STD_VIDEO_H264_LEVEL_IDC_6_0";
+        case STD_VIDEO_H264_LEVEL_IDC_6_1:
+            return "STD_VIDEO_H264_LEVEL_IDC_6_1";
+        case STD_VIDEO_H264_LEVEL_IDC_6_2:
+            return "STD_VIDEO_H264_LEVEL_IDC_6_2";
+        case STD_VIDEO_H264_LEVEL_IDC_INVALID:
+            return "STD_VIDEO_H264_LEVEL_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264LevelIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264PocTypeString(StdVideoH264PocType value) {
+    switch (value) {
+        case STD_VIDEO_H264_POC_TYPE_0:
+            return "STD_VIDEO_H264_POC_TYPE_0";
+        case STD_VIDEO_H264_POC_TYPE_1:
+            return "STD_VIDEO_H264_POC_TYPE_1";
+        case STD_VIDEO_H264_POC_TYPE_2:
+            return "STD_VIDEO_H264_POC_TYPE_2";
+        case STD_VIDEO_H264_POC_TYPE_INVALID:
+            return "STD_VIDEO_H264_POC_TYPE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264PocType_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264AspectRatioIdcString(StdVideoH264AspectRatioIdc value) {
+    switch (value) {
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_UNSPECIFIED:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_UNSPECIFIED";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_SQUARE:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_SQUARE";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_12_11:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_12_11";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_10_11:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_10_11";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_16_11:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_16_11";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_40_33:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_40_33";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_24_11:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_24_11";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_20_11:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_20_11";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_32_11:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_32_11";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_80_33:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_80_33";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_18_11:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_18_11";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_15_11:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_15_11";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_64_33:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_64_33";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_160_99:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_160_99";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_4_3:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_4_3";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_3_2:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_3_2";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_2_1:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_2_1";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_EXTENDED_SAR:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_EXTENDED_SAR";
+        case STD_VIDEO_H264_ASPECT_RATIO_IDC_INVALID:
+            return "STD_VIDEO_H264_ASPECT_RATIO_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264AspectRatioIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264WeightedBipredIdcString(StdVideoH264WeightedBipredIdc value) {
+    switch (value) {
+        case STD_VIDEO_H264_WEIGHTED_BIPRED_IDC_DEFAULT:
+            return "STD_VIDEO_H264_WEIGHTED_BIPRED_IDC_DEFAULT";
+        case STD_VIDEO_H264_WEIGHTED_BIPRED_IDC_EXPLICIT:
+            return "STD_VIDEO_H264_WEIGHTED_BIPRED_IDC_EXPLICIT";
+        case STD_VIDEO_H264_WEIGHTED_BIPRED_IDC_IMPLICIT:
+            return "STD_VIDEO_H264_WEIGHTED_BIPRED_IDC_IMPLICIT";
+        case STD_VIDEO_H264_WEIGHTED_BIPRED_IDC_INVALID:
+            return "STD_VIDEO_H264_WEIGHTED_BIPRED_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264WeightedBipredIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264ModificationOfPicNumsIdcString(StdVideoH264ModificationOfPicNumsIdc value) {
+    switch (value) {
+        case STD_VIDEO_H264_MODIFICATION_OF_PIC_NUMS_IDC_SHORT_TERM_SUBTRACT:
+            return "STD_VIDEO_H264_MODIFICATION_OF_PIC_NUMS_IDC_SHORT_TERM_SUBTRACT";
+        case STD_VIDEO_H264_MODIFICATION_OF_PIC_NUMS_IDC_SHORT_TERM_ADD:
+            return "STD_VIDEO_H264_MODIFICATION_OF_PIC_NUMS_IDC_SHORT_TERM_ADD";
+        case STD_VIDEO_H264_MODIFICATION_OF_PIC_NUMS_IDC_LONG_TERM:
+            return "STD_VIDEO_H264_MODIFICATION_OF_PIC_NUMS_IDC_LONG_TERM";
+        case STD_VIDEO_H264_MODIFICATION_OF_PIC_NUMS_IDC_END:
+            return "STD_VIDEO_H264_MODIFICATION_OF_PIC_NUMS_IDC_END";
+        case STD_VIDEO_H264_MODIFICATION_OF_PIC_NUMS_IDC_INVALID:
+            return "STD_VIDEO_H264_MODIFICATION_OF_PIC_NUMS_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264ModificationOfPicNumsIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264MemMgmtControlOpString(StdVideoH264MemMgmtControlOp value) {
+    switch (value) {
+        case STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_END:
+            return "STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_END";
+        case STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_UNMARK_SHORT_TERM:
+            return "STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_UNMARK_SHORT_TERM";
+        case STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_UNMARK_LONG_TERM:
+            return "STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_UNMARK_LONG_TERM";
+        case STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_MARK_LONG_TERM:
+            return "STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_MARK_LONG_TERM";
+        case STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_SET_MAX_LONG_TERM_INDEX:
+            return "STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_SET_MAX_LONG_TERM_INDEX";
+        case STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_UNMARK_ALL:
+            return "STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_UNMARK_ALL";
+        case STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_MARK_CURRENT_AS_LONG_TERM:
+            return "STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_MARK_CURRENT_AS_LONG_TERM";
+        case STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_INVALID:
+            return "STD_VIDEO_H264_MEM_MGMT_CONTROL_OP_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264MemMgmtControlOp_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264CabacInitIdcString(StdVideoH264CabacInitIdc value) {
+    switch (value) {
+        case STD_VIDEO_H264_CABAC_INIT_IDC_0:
+            return "STD_VIDEO_H264_CABAC_INIT_IDC_0";
+        case STD_VIDEO_H264_CABAC_INIT_IDC_1:
+            return "STD_VIDEO_H264_CABAC_INIT_IDC_1";
+        case STD_VIDEO_H264_CABAC_INIT_IDC_2:
+            return "STD_VIDEO_H264_CABAC_INIT_IDC_2";
+        case STD_VIDEO_H264_CABAC_INIT_IDC_INVALID:
+            return "STD_VIDEO_H264_CABAC_INIT_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264CabacInitIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264DisableDeblockingFilterIdcString(StdVideoH264DisableDeblockingFilterIdc value) {
+    switch (value) {
+        case STD_VIDEO_H264_DISABLE_DEBLOCKING_FILTER_IDC_DISABLED:
+            return "STD_VIDEO_H264_DISABLE_DEBLOCKING_FILTER_IDC_DISABLED";
+        case STD_VIDEO_H264_DISABLE_DEBLOCKING_FILTER_IDC_ENABLED:
+            return "STD_VIDEO_H264_DISABLE_DEBLOCKING_FILTER_IDC_ENABLED";
+        case STD_VIDEO_H264_DISABLE_DEBLOCKING_FILTER_IDC_PARTIAL:
+            return "STD_VIDEO_H264_DISABLE_DEBLOCKING_FILTER_IDC_PARTIAL";
+        case STD_VIDEO_H264_DISABLE_DEBLOCKING_FILTER_IDC_INVALID:
+            return "STD_VIDEO_H264_DISABLE_DEBLOCKING_FILTER_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264DisableDeblockingFilterIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264SliceTypeString(StdVideoH264SliceType value) {
+    switch (value) {
+        case STD_VIDEO_H264_SLICE_TYPE_P:
+            return "STD_VIDEO_H264_SLICE_TYPE_P";
+        case STD_VIDEO_H264_SLICE_TYPE_B:
+            return "STD_VIDEO_H264_SLICE_TYPE_B";
+        case STD_VIDEO_H264_SLICE_TYPE_I:
+            return "STD_VIDEO_H264_SLICE_TYPE_I";
+        case STD_VIDEO_H264_SLICE_TYPE_INVALID:
+            return "STD_VIDEO_H264_SLICE_TYPE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264SliceType_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264PictureTypeString(StdVideoH264PictureType value) {
+    switch (value) {
+        case STD_VIDEO_H264_PICTURE_TYPE_P:
+            return "STD_VIDEO_H264_PICTURE_TYPE_P";
+        case STD_VIDEO_H264_PICTURE_TYPE_B:
+            return "STD_VIDEO_H264_PICTURE_TYPE_B";
+        case STD_VIDEO_H264_PICTURE_TYPE_I:
+            return "STD_VIDEO_H264_PICTURE_TYPE_I";
+        case STD_VIDEO_H264_PICTURE_TYPE_IDR:
+            return "STD_VIDEO_H264_PICTURE_TYPE_IDR";
+        case STD_VIDEO_H264_PICTURE_TYPE_INVALID:
+            return "STD_VIDEO_H264_PICTURE_TYPE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264PictureType_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH264NonVclNaluTypeString(StdVideoH264NonVclNaluType value) {
+    switch (value) {
+        case STD_VIDEO_H264_NON_VCL_NALU_TYPE_SPS:
+            return "STD_VIDEO_H264_NON_VCL_NALU_TYPE_SPS";
+        case STD_VIDEO_H264_NON_VCL_NALU_TYPE_PPS:
+            return "STD_VIDEO_H264_NON_VCL_NALU_TYPE_PPS";
+        case STD_VIDEO_H264_NON_VCL_NALU_TYPE_AUD:
+            return "STD_VIDEO_H264_NON_VCL_NALU_TYPE_AUD";
+        case STD_VIDEO_H264_NON_VCL_NALU_TYPE_PREFIX:
+            return "STD_VIDEO_H264_NON_VCL_NALU_TYPE_PREFIX";
+        case STD_VIDEO_H264_NON_VCL_NALU_TYPE_END_OF_SEQUENCE:
+            return "STD_VIDEO_H264_NON_VCL_NALU_TYPE_END_OF_SEQUENCE";
+        case STD_VIDEO_H264_NON_VCL_NALU_TYPE_END_OF_STREAM:
+            return "STD_VIDEO_H264_NON_VCL_NALU_TYPE_END_OF_STREAM";
+        case STD_VIDEO_H264_NON_VCL_NALU_TYPE_PRECODED:
+            return "STD_VIDEO_H264_NON_VCL_NALU_TYPE_PRECODED";
+        case STD_VIDEO_H264_NON_VCL_NALU_TYPE_INVALID:
+            return "STD_VIDEO_H264_NON_VCL_NALU_TYPE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH264NonVclNaluType_value") + std::to_string(value);
+    }
+}
+std::string StdVideoDecodeH264FieldOrderCountString(StdVideoDecodeH264FieldOrderCount value) {
+    switch (value) {
+        case STD_VIDEO_DECODE_H264_FIELD_ORDER_COUNT_TOP:
+            return "STD_VIDEO_DECODE_H264_FIELD_ORDER_COUNT_TOP";
+        case STD_VIDEO_DECODE_H264_FIELD_ORDER_COUNT_BOTTOM:
+            return "STD_VIDEO_DECODE_H264_FIELD_ORDER_COUNT_BOTTOM";
+        case STD_VIDEO_DECODE_H264_FIELD_ORDER_COUNT_INVALID:
+            return "STD_VIDEO_DECODE_H264_FIELD_ORDER_COUNT_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoDecodeH264FieldOrderCount_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH265ChromaFormatIdcString(StdVideoH265ChromaFormatIdc value) {
+    switch (value) {
+        case STD_VIDEO_H265_CHROMA_FORMAT_IDC_MONOCHROME:
+            return "STD_VIDEO_H265_CHROMA_FORMAT_IDC_MONOCHROME";
+        case STD_VIDEO_H265_CHROMA_FORMAT_IDC_420:
+            return "STD_VIDEO_H265_CHROMA_FORMAT_IDC_420";
+        case STD_VIDEO_H265_CHROMA_FORMAT_IDC_422:
+            return "STD_VIDEO_H265_CHROMA_FORMAT_IDC_422";
+        case STD_VIDEO_H265_CHROMA_FORMAT_IDC_444:
+            return "STD_VIDEO_H265_CHROMA_FORMAT_IDC_444";
+        case STD_VIDEO_H265_CHROMA_FORMAT_IDC_INVALID:
+            return "STD_VIDEO_H265_CHROMA_FORMAT_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH265ChromaFormatIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH265ProfileIdcString(StdVideoH265ProfileIdc value) {
+    switch (value) {
+        case STD_VIDEO_H265_PROFILE_IDC_MAIN:
+            return "STD_VIDEO_H265_PROFILE_IDC_MAIN";
+        case STD_VIDEO_H265_PROFILE_IDC_MAIN_10:
+            return "STD_VIDEO_H265_PROFILE_IDC_MAIN_10";
+        case STD_VIDEO_H265_PROFILE_IDC_MAIN_STILL_PICTURE:
+            return "STD_VIDEO_H265_PROFILE_IDC_MAIN_STILL_PICTURE";
+        case STD_VIDEO_H265_PROFILE_IDC_FORMAT_RANGE_EXTENSIONS:
+            return "STD_VIDEO_H265_PROFILE_IDC_FORMAT_RANGE_EXTENSIONS";
+        case STD_VIDEO_H265_PROFILE_IDC_SCC_EXTENSIONS:
+            return "STD_VIDEO_H265_PROFILE_IDC_SCC_EXTENSIONS";
+        case STD_VIDEO_H265_PROFILE_IDC_INVALID:
+            return "STD_VIDEO_H265_PROFILE_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH265ProfileIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH265LevelIdcString(StdVideoH265LevelIdc value) {
+    switch (value) {
+        case STD_VIDEO_H265_LEVEL_IDC_1_0:
+            return "STD_VIDEO_H265_LEVEL_IDC_1_0";
+        case STD_VIDEO_H265_LEVEL_IDC_2_0:
+            return "STD_VIDEO_H265_LEVEL_IDC_2_0";
+        case STD_VIDEO_H265_LEVEL_IDC_2_1:
+            return "STD_VIDEO_H265_LEVEL_IDC_2_1";
+        case STD_VIDEO_H265_LEVEL_IDC_3_0:
+            return "STD_VIDEO_H265_LEVEL_IDC_3_0";
+        case STD_VIDEO_H265_LEVEL_IDC_3_1:
+            return "STD_VIDEO_H265_LEVEL_IDC_3_1";
+        case STD_VIDEO_H265_LEVEL_IDC_4_0:
+            return "STD_VIDEO_H265_LEVEL_IDC_4_0";
+        case STD_VIDEO_H265_LEVEL_IDC_4_1:
+            return "STD_VIDEO_H265_LEVEL_IDC_4_1";
+        case STD_VIDEO_H265_LEVEL_IDC_5_0:
+            return "STD_VIDEO_H265_LEVEL_IDC_5_0";
+        case STD_VIDEO_H265_LEVEL_IDC_5_1:
+            return "STD_VIDEO_H265_LEVEL_IDC_5_1";
+        case STD_VIDEO_H265_LEVEL_IDC_5_2:
+            return "STD_VIDEO_H265_LEVEL_IDC_5_2";
+        case STD_VIDEO_H265_LEVEL_IDC_6_0:
+            return "STD_VIDEO_H265_LEVEL_IDC_6_0";
+        case STD_VIDEO_H265_LEVEL_IDC_6_1:
+            return "STD_VIDEO_H265_LEVEL_IDC_6_1";
+        case STD_VIDEO_H265_LEVEL_IDC_6_2:
+            return "STD_VIDEO_H265_LEVEL_IDC_6_2";
+        case STD_VIDEO_H265_LEVEL_IDC_INVALID:
+            return "STD_VIDEO_H265_LEVEL_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH265LevelIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH265SliceTypeString(StdVideoH265SliceType value) {
+    switch (value) {
+        case STD_VIDEO_H265_SLICE_TYPE_B:
+            return "STD_VIDEO_H265_SLICE_TYPE_B";
+        case STD_VIDEO_H265_SLICE_TYPE_P:
+            return "STD_VIDEO_H265_SLICE_TYPE_P";
+        case STD_VIDEO_H265_SLICE_TYPE_I:
+            return "STD_VIDEO_H265_SLICE_TYPE_I";
+        case STD_VIDEO_H265_SLICE_TYPE_INVALID:
+            return "STD_VIDEO_H265_SLICE_TYPE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH265SliceType_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH265PictureTypeString(StdVideoH265PictureType value) {
+    switch (value) {
+        case STD_VIDEO_H265_PICTURE_TYPE_P:
+            return "STD_VIDEO_H265_PICTURE_TYPE_P";
+        case STD_VIDEO_H265_PICTURE_TYPE_B:
+            return "STD_VIDEO_H265_PICTURE_TYPE_B";
+        case STD_VIDEO_H265_PICTURE_TYPE_I:
+            return "STD_VIDEO_H265_PICTURE_TYPE_I";
+        case STD_VIDEO_H265_PICTURE_TYPE_IDR:
+            return "STD_VIDEO_H265_PICTURE_TYPE_IDR";
+        case STD_VIDEO_H265_PICTURE_TYPE_INVALID:
+            return "STD_VIDEO_H265_PICTURE_TYPE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH265PictureType_value") + std::to_string(value);
+    }
+}
+std::string StdVideoH265AspectRatioIdcString(StdVideoH265AspectRatioIdc value) {
+    switch (value) {
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_UNSPECIFIED:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_UNSPECIFIED";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_SQUARE:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_SQUARE";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_12_11:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_12_11";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_10_11:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_10_11";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_16_11:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_16_11";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_40_33:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_40_33";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_24_11:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_24_11";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_20_11:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_20_11";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_32_11:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_32_11";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_80_33:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_80_33";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_18_11:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_18_11";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_15_11:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_15_11";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_64_33:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_64_33";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_160_99:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_160_99";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_4_3:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_4_3";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_3_2:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_3_2";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_2_1:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_2_1";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_EXTENDED_SAR:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_EXTENDED_SAR";
+        case STD_VIDEO_H265_ASPECT_RATIO_IDC_INVALID:
+            return "STD_VIDEO_H265_ASPECT_RATIO_IDC_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoH265AspectRatioIdc_value") + std::to_string(value);
+    }
+}
+std::string StdVideoAV1ProfileString(StdVideoAV1Profile value) {
+    switch (value) {
+        case STD_VIDEO_AV1_PROFILE_MAIN:
+            return "STD_VIDEO_AV1_PROFILE_MAIN";
+        case STD_VIDEO_AV1_PROFILE_HIGH:
+            return "STD_VIDEO_AV1_PROFILE_HIGH";
+        case STD_VIDEO_AV1_PROFILE_PROFESSIONAL:
+            return "STD_VIDEO_AV1_PROFILE_PROFESSIONAL";
+        case STD_VIDEO_AV1_PROFILE_INVALID:
+            return "STD_VIDEO_AV1_PROFILE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoAV1Profile_value") + std::to_string(value);
+    }
+}
+std::string StdVideoAV1LevelString(StdVideoAV1Level value) {
+    switch (value) {
+        case STD_VIDEO_AV1_LEVEL_2_0:
+            return "STD_VIDEO_AV1_LEVEL_2_0";
+        case STD_VIDEO_AV1_LEVEL_2_1:
+            return "STD_VIDEO_AV1_LEVEL_2_1";
+        case STD_VIDEO_AV1_LEVEL_2_2:
+            return "STD_VIDEO_AV1_LEVEL_2_2";
+        case STD_VIDEO_AV1_LEVEL_2_3:
+            return "STD_VIDEO_AV1_LEVEL_2_3";
+        case STD_VIDEO_AV1_LEVEL_3_0:
+            return "STD_VIDEO_AV1_LEVEL_3_0";
+        case STD_VIDEO_AV1_LEVEL_3_1:
+            return "STD_VIDEO_AV1_LEVEL_3_1";
+        case STD_VIDEO_AV1_LEVEL_3_2:
+            return "STD_VIDEO_AV1_LEVEL_3_2";
+        case STD_VIDEO_AV1_LEVEL_3_3:
+            return "STD_VIDEO_AV1_LEVEL_3_3";
+        case STD_VIDEO_AV1_LEVEL_4_0:
+            return "STD_VIDEO_AV1_LEVEL_4_0";
+        case STD_VIDEO_AV1_LEVEL_4_1:
+            return "STD_VIDEO_AV1_LEVEL_4_1";
+        case STD_VIDEO_AV1_LEVEL_4_2:
+            return "STD_VIDEO_AV1_LEVEL_4_2";
+        case STD_VIDEO_AV1_LEVEL_4_3:
+            return "STD_VIDEO_AV1_LEVEL_4_3";
+        case STD_VIDEO_AV1_LEVEL_5_0:
+            return "STD_VIDEO_AV1_LEVEL_5_0";
+        case STD_VIDEO_AV1_LEVEL_5_1:
+            return "STD_VIDEO_AV1_LEVEL_5_1";
+        case STD_VIDEO_AV1_LEVEL_5_2:
+            return "STD_VIDEO_AV1_LEVEL_5_2";
+        case STD_VIDEO_AV1_LEVEL_5_3:
+            return "STD_VIDEO_AV1_LEVEL_5_3";
+        case STD_VIDEO_AV1_LEVEL_6_0:
+            return "STD_VIDEO_AV1_LEVEL_6_0";
+        case STD_VIDEO_AV1_LEVEL_6_1:
+            return "STD_VIDEO_AV1_LEVEL_6_1";
+        case STD_VIDEO_AV1_LEVEL_6_2:
+            return "STD_VIDEO_AV1_LEVEL_6_2";
+        case STD_VIDEO_AV1_LEVEL_6_3:
+            return "STD_VIDEO_AV1_LEVEL_6_3";
+        case STD_VIDEO_AV1_LEVEL_7_0:
+            return "STD_VIDEO_AV1_LEVEL_7_0";
+        case STD_VIDEO_AV1_LEVEL_7_1:
+            return "STD_VIDEO_AV1_LEVEL_7_1";
+        case STD_VIDEO_AV1_LEVEL_7_2:
+            return "STD_VIDEO_AV1_LEVEL_7_2";
+        case STD_VIDEO_AV1_LEVEL_7_3:
+            return "STD_VIDEO_AV1_LEVEL_7_3";
+        case STD_VIDEO_AV1_LEVEL_INVALID:
+            return "STD_VIDEO_AV1_LEVEL_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoAV1Level_value") + std::to_string(value);
+    }
+}
+std::string StdVideoAV1FrameTypeString(StdVideoAV1FrameType value) {
+    switch (value) {
+        case STD_VIDEO_AV1_FRAME_TYPE_KEY:
+            return "STD_VIDEO_AV1_FRAME_TYPE_KEY";
+        case STD_VIDEO_AV1_FRAME_TYPE_INTER:
+            return "STD_VIDEO_AV1_FRAME_TYPE_INTER";
+        case STD_VIDEO_AV1_FRAME_TYPE_INTRA_ONLY:
+            return "STD_VIDEO_AV1_FRAME_TYPE_INTRA_ONLY";
+        case STD_VIDEO_AV1_FRAME_TYPE_SWITCH:
+            return "STD_VIDEO_AV1_FRAME_TYPE_SWITCH";
+        case STD_VIDEO_AV1_FRAME_TYPE_INVALID:
+            return "STD_VIDEO_AV1_FRAME_TYPE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoAV1FrameType_value") + std::to_string(value);
+    }
+}
+std::string StdVideoAV1ReferenceNameString(StdVideoAV1ReferenceName value) {
+    switch (value) {
+        case STD_VIDEO_AV1_REFERENCE_NAME_INTRA_FRAME:
+            return "STD_VIDEO_AV1_REFERENCE_NAME_INTRA_FRAME";
+        case STD_VIDEO_AV1_REFERENCE_NAME_LAST_FRAME:
+            return "STD_VIDEO_AV1_REFERENCE_NAME_LAST_FRAME";
+        case STD_VIDEO_AV1_REFERENCE_NAME_LAST2_FRAME:
+            return "STD_VIDEO_AV1_REFERENCE_NAME_LAST2_FRAME";
+        case STD_VIDEO_AV1_REFERENCE_NAME_LAST3_FRAME:
+            return "STD_VIDEO_AV1_REFERENCE_NAME_LAST3_FRAME";
+        case STD_VIDEO_AV1_REFERENCE_NAME_GOLDEN_FRAME:
+            return "STD_VIDEO_AV1_REFERENCE_NAME_GOLDEN_FRAME";
+        case STD_VIDEO_AV1_REFERENCE_NAME_BWDREF_FRAME:
+            return "STD_VIDEO_AV1_REFERENCE_NAME_BWDREF_FRAME";
+        case STD_VIDEO_AV1_REFERENCE_NAME_ALTREF2_FRAME:
+            return "STD_VIDEO_AV1_REFERENCE_NAME_ALTREF2_FRAME";
+        case STD_VIDEO_AV1_REFERENCE_NAME_ALTREF_FRAME:
+            return "STD_VIDEO_AV1_REFERENCE_NAME_ALTREF_FRAME";
+        case STD_VIDEO_AV1_REFERENCE_NAME_INVALID:
+            return "STD_VIDEO_AV1_REFERENCE_NAME_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoAV1ReferenceName_value") + std::to_string(value);
+    }
+}
+std::string StdVideoAV1InterpolationFilterString(StdVideoAV1InterpolationFilter value) {
+    switch (value) {
+        case STD_VIDEO_AV1_INTERPOLATION_FILTER_EIGHTTAP:
+            return "STD_VIDEO_AV1_INTERPOLATION_FILTER_EIGHTTAP";
+        case STD_VIDEO_AV1_INTERPOLATION_FILTER_EIGHTTAP_SMOOTH:
+            return "STD_VIDEO_AV1_INTERPOLATION_FILTER_EIGHTTAP_SMOOTH";
+        case STD_VIDEO_AV1_INTERPOLATION_FILTER_EIGHTTAP_SHARP:
+            return "STD_VIDEO_AV1_INTERPOLATION_FILTER_EIGHTTAP_SHARP";
+        case STD_VIDEO_AV1_INTERPOLATION_FILTER_BILINEAR:
+            return "STD_VIDEO_AV1_INTERPOLATION_FILTER_BILINEAR";
+        case STD_VIDEO_AV1_INTERPOLATION_FILTER_SWITCHABLE:
+            return "STD_VIDEO_AV1_INTERPOLATION_FILTER_SWITCHABLE";
+        case STD_VIDEO_AV1_INTERPOLATION_FILTER_INVALID:
+            return "STD_VIDEO_AV1_INTERPOLATION_FILTER_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoAV1InterpolationFilter_value") + std::to_string(value);
+    }
+}
+std::string StdVideoAV1TxModeString(StdVideoAV1TxMode value) {
+    switch (value) {
+        case STD_VIDEO_AV1_TX_MODE_ONLY_4X4:
+            return "STD_VIDEO_AV1_TX_MODE_ONLY_4X4";
+        case STD_VIDEO_AV1_TX_MODE_LARGEST:
+            return "STD_VIDEO_AV1_TX_MODE_LARGEST";
+        case STD_VIDEO_AV1_TX_MODE_SELECT:
+            return "STD_VIDEO_AV1_TX_MODE_SELECT";
+        case STD_VIDEO_AV1_TX_MODE_INVALID:
+            return "STD_VIDEO_AV1_TX_MODE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoAV1TxMode_value") + std::to_string(value);
+    }
+}
+std::string StdVideoAV1FrameRestorationTypeString(StdVideoAV1FrameRestorationType value) {
+    switch (value) {
+        case STD_VIDEO_AV1_FRAME_RESTORATION_TYPE_NONE:
+            return "STD_VIDEO_AV1_FRAME_RESTORATION_TYPE_NONE";
+        case STD_VIDEO_AV1_FRAME_RESTORATION_TYPE_WIENER:
+            return "STD_VIDEO_AV1_FRAME_RESTORATION_TYPE_WIENER";
+        case STD_VIDEO_AV1_FRAME_RESTORATION_TYPE_SGRPROJ:
+            return "STD_VIDEO_AV1_FRAME_RESTORATION_TYPE_SGRPROJ";
+        case STD_VIDEO_AV1_FRAME_RESTORATION_TYPE_SWITCHABLE:
+            return "STD_VIDEO_AV1_FRAME_RESTORATION_TYPE_SWITCHABLE";
+        case STD_VIDEO_AV1_FRAME_RESTORATION_TYPE_INVALID:
+            return "STD_VIDEO_AV1_FRAME_RESTORATION_TYPE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoAV1FrameRestorationType_value") + std::to_string(value);
+    }
+}
+std::string StdVideoAV1ColorPrimariesString(StdVideoAV1ColorPrimaries value) {
+    switch (value) {
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_BT_709:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_BT_709";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_UNSPECIFIED:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_UNSPECIFIED";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_BT_470_M:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_BT_470_M";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_BT_470_B_G:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_BT_470_B_G";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_BT_601:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_BT_601";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_SMPTE_240:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_SMPTE_240";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_GENERIC_FILM:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_GENERIC_FILM";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_BT_2020:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_BT_2020";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_XYZ:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_XYZ";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_SMPTE_431:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_SMPTE_431";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_SMPTE_432:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_SMPTE_432";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_EBU_3213:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_EBU_3213";
+        case STD_VIDEO_AV1_COLOR_PRIMARIES_INVALID:
+            return "STD_VIDEO_AV1_COLOR_PRIMARIES_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoAV1ColorPrimaries_value") + std::to_string(value);
+    }
+}
+std::string StdVideoAV1TransferCharacteristicsString(StdVideoAV1TransferCharacteristics value) {
+    switch (value) {
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_RESERVED_0:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_RESERVED_0";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_709:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_709";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_UNSPECIFIED:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_UNSPECIFIED";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_RESERVED_3:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_RESERVED_3";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_470_M:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_470_M";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_470_B_G:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_470_B_G";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_601:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_601";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_SMPTE_240:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_SMPTE_240";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_LINEAR:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_LINEAR";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_LOG_100:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_LOG_100";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_LOG_100_SQRT10:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_LOG_100_SQRT10";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_IEC_61966:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_IEC_61966";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_1361:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_1361";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_SRGB:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_SRGB";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_2020_10_BIT:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_2020_10_BIT";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_2020_12_BIT:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_BT_2020_12_BIT";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_SMPTE_2084:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_SMPTE_2084";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_SMPTE_428:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_SMPTE_428";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_HLG:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_HLG";
+        case STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_INVALID:
+            return "STD_VIDEO_AV1_TRANSFER_CHARACTERISTICS_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoAV1TransferCharacteristics_value") + std::to_string(value);
+    }
+}
+std::string StdVideoAV1MatrixCoefficientsString(StdVideoAV1MatrixCoefficients value) {
+    switch (value) {
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_IDENTITY:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_IDENTITY";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_BT_709:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_BT_709";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_UNSPECIFIED:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_UNSPECIFIED";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_RESERVED_3:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_RESERVED_3";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_FCC:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_FCC";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_BT_470_B_G:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_BT_470_B_G";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_BT_601:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_BT_601";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_SMPTE_240:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_SMPTE_240";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_SMPTE_YCGCO:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_SMPTE_YCGCO";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_BT_2020_NCL:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_BT_2020_NCL";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_BT_2020_CL:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_BT_2020_CL";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_SMPTE_2085:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_SMPTE_2085";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_CHROMAT_NCL:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_CHROMAT_NCL";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_CHROMAT_CL:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_CHROMAT_CL";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_ICTCP:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_ICTCP";
+        case STD_VIDEO_AV1_MATRIX_COEFFICIENTS_INVALID:
+            return "STD_VIDEO_AV1_MATRIX_COEFFICIENTS_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoAV1MatrixCoefficients_value") + std::to_string(value);
+    }
+}
+std::string StdVideoAV1ChromaSamplePositionString(StdVideoAV1ChromaSamplePosition value) {
+    switch (value) {
+        case STD_VIDEO_AV1_CHROMA_SAMPLE_POSITION_UNKNOWN:
+            return "STD_VIDEO_AV1_CHROMA_SAMPLE_POSITION_UNKNOWN";
+        case STD_VIDEO_AV1_CHROMA_SAMPLE_POSITION_VERTICAL:
+            return "STD_VIDEO_AV1_CHROMA_SAMPLE_POSITION_VERTICAL";
+        case STD_VIDEO_AV1_CHROMA_SAMPLE_POSITION_COLOCATED:
+            return "STD_VIDEO_AV1_CHROMA_SAMPLE_POSITION_COLOCATED";
+        case STD_VIDEO_AV1_CHROMA_SAMPLE_POSITION_RESERVED:
+            return "STD_VIDEO_AV1_CHROMA_SAMPLE_POSITION_RESERVED";
+        case STD_VIDEO_AV1_CHROMA_SAMPLE_POSITION_INVALID:
+            return "STD_VIDEO_AV1_CHROMA_SAMPLE_POSITION_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoAV1ChromaSamplePosition_value") + std::to_string(value);
+    }
+}
+std::string StdVideoVP9ProfileString(StdVideoVP9Profile value) {
+    switch (value) {
+        case STD_VIDEO_VP9_PROFILE_0:
+            return "STD_VIDEO_VP9_PROFILE_0";
+        case STD_VIDEO_VP9_PROFILE_1:
+            return "STD_VIDEO_VP9_PROFILE_1";
+        case STD_VIDEO_VP9_PROFILE_2:
+            return "STD_VIDEO_VP9_PROFILE_2";
+        case STD_VIDEO_VP9_PROFILE_3:
+            return "STD_VIDEO_VP9_PROFILE_3";
+        case STD_VIDEO_VP9_PROFILE_INVALID:
+            return "STD_VIDEO_VP9_PROFILE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoVP9Profile_value") + std::to_string(value);
+    }
+}
+std::string StdVideoVP9LevelString(StdVideoVP9Level value) {
+    switch (value) {
+        case STD_VIDEO_VP9_LEVEL_1_0:
+            return "STD_VIDEO_VP9_LEVEL_1_0";
+        case STD_VIDEO_VP9_LEVEL_1_1:
+            return "STD_VIDEO_VP9_LEVEL_1_1";
+        case STD_VIDEO_VP9_LEVEL_2_0:
+            return "STD_VIDEO_VP9_LEVEL_2_0";
+        case STD_VIDEO_VP9_LEVEL_2_1:
+            return "STD_VIDEO_VP9_LEVEL_2_1";
+        case STD_VIDEO_VP9_LEVEL_3_0:
+            return "STD_VIDEO_VP9_LEVEL_3_0";
+        case STD_VIDEO_VP9_LEVEL_3_1:
+            return "STD_VIDEO_VP9_LEVEL_3_1";
+        case STD_VIDEO_VP9_LEVEL_4_0:
+            return "STD_VIDEO_VP9_LEVEL_4_0";
+        case STD_VIDEO_VP9_LEVEL_4_1:
+            return "STD_VIDEO_VP9_LEVEL_4_1";
+        case STD_VIDEO_VP9_LEVEL_5_0:
+            return "STD_VIDEO_VP9_LEVEL_5_0";
+        case STD_VIDEO_VP9_LEVEL_5_1:
+            return "STD_VIDEO_VP9_LEVEL_5_1";
+        case STD_VIDEO_VP9_LEVEL_5_2:
+            return "STD_VIDEO_VP9_LEVEL_5_2";
+        case STD_VIDEO_VP9_LEVEL_6_0:
+            return "STD_VIDEO_VP9_LEVEL_6_0";
+        case STD_VIDEO_VP9_LEVEL_6_1:
+            return "STD_VIDEO_VP9_LEVEL_6_1";
+        case STD_VIDEO_VP9_LEVEL_6_2:
+            return "STD_VIDEO_VP9_LEVEL_6_2";
+        case STD_VIDEO_VP9_LEVEL_INVALID:
+            return "STD_VIDEO_VP9_LEVEL_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoVP9Level_value") + std::to_string(value);
+    }
+}
+std::string StdVideoVP9FrameTypeString(StdVideoVP9FrameType value) {
+    switch (value) {
+        case STD_VIDEO_VP9_FRAME_TYPE_KEY:
+            return "STD_VIDEO_VP9_FRAME_TYPE_KEY";
+        case STD_VIDEO_VP9_FRAME_TYPE_NON_KEY:
+            return "STD_VIDEO_VP9_FRAME_TYPE_NON_KEY";
+        case STD_VIDEO_VP9_FRAME_TYPE_INVALID:
+            return "STD_VIDEO_VP9_FRAME_TYPE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoVP9FrameType_value") + std::to_string(value);
+    }
+}
+std::string StdVideoVP9ReferenceNameString(StdVideoVP9ReferenceName value) {
+    switch (value) {
+        case STD_VIDEO_VP9_REFERENCE_NAME_INTRA_FRAME:
+            return "STD_VIDEO_VP9_REFERENCE_NAME_INTRA_FRAME";
+        case STD_VIDEO_VP9_REFERENCE_NAME_LAST_FRAME:
+            return "STD_VIDEO_VP9_REFERENCE_NAME_LAST_FRAME";
+        case STD_VIDEO_VP9_REFERENCE_NAME_GOLDEN_FRAME:
+            return "STD_VIDEO_VP9_REFERENCE_NAME_GOLDEN_FRAME";
+        case STD_VIDEO_VP9_REFERENCE_NAME_ALTREF_FRAME:
+            return "STD_VIDEO_VP9_REFERENCE_NAME_ALTREF_FRAME";
+        case STD_VIDEO_VP9_REFERENCE_NAME_INVALID:
+            return "STD_VIDEO_VP9_REFERENCE_NAME_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoVP9ReferenceName_value") + std::to_string(value);
+    }
+}
+std::string StdVideoVP9InterpolationFilterString(StdVideoVP9InterpolationFilter value) {
+    switch (value) {
+        case STD_VIDEO_VP9_INTERPOLATION_FILTER_EIGHTTAP:
+            return "STD_VIDEO_VP9_INTERPOLATION_FILTER_EIGHTTAP";
+        case STD_VIDEO_VP9_INTERPOLATION_FILTER_EIGHTTAP_SMOOTH:
+            return "STD_VIDEO_VP9_INTERPOLATION_FILTER_EIGHTTAP_SMOOTH";
+        case STD_VIDEO_VP9_INTERPOLATION_FILTER_EIGHTTAP_SHARP:
+            return "STD_VIDEO_VP9_INTERPOLATION_FILTER_EIGHTTAP_SHARP";
+        case STD_VIDEO_VP9_INTERPOLATION_FILTER_BILINEAR:
+            return "STD_VIDEO_VP9_INTERPOLATION_FILTER_BILINEAR";
+        case STD_VIDEO_VP9_INTERPOLATION_FILTER_SWITCHABLE:
+            return "STD_VIDEO_VP9_INTERPOLATION_FILTER_SWITCHABLE";
+        case STD_VIDEO_VP9_INTERPOLATION_FILTER_INVALID:
+            return "STD_VIDEO_VP9_INTERPOLATION_FILTER_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoVP9InterpolationFilter_value") + std::to_string(value);
+    }
+}
+std::string StdVideoVP9ColorSpaceString(StdVideoVP9ColorSpace value) {
+    switch (value) {
+        case STD_VIDEO_VP9_COLOR_SPACE_UNKNOWN:
+            return "STD_VIDEO_VP9_COLOR_SPACE_UNKNOWN";
+        case STD_VIDEO_VP9_COLOR_SPACE_BT_601:
+            return "STD_VIDEO_VP9_COLOR_SPACE_BT_601";
+        case STD_VIDEO_VP9_COLOR_SPACE_BT_709:
+            return "STD_VIDEO_VP9_COLOR_SPACE_BT_709";
+        case STD_VIDEO_VP9_COLOR_SPACE_SMPTE_170:
+            return "STD_VIDEO_VP9_COLOR_SPACE_SMPTE_170";
+        case STD_VIDEO_VP9_COLOR_SPACE_SMPTE_240:
+            return "STD_VIDEO_VP9_COLOR_SPACE_SMPTE_240";
+        case STD_VIDEO_VP9_COLOR_SPACE_BT_2020:
+            return "STD_VIDEO_VP9_COLOR_SPACE_BT_2020";
+        case STD_VIDEO_VP9_COLOR_SPACE_RESERVED:
+            return "STD_VIDEO_VP9_COLOR_SPACE_RESERVED";
+        case STD_VIDEO_VP9_COLOR_SPACE_RGB:
+            return "STD_VIDEO_VP9_COLOR_SPACE_RGB";
+        case STD_VIDEO_VP9_COLOR_SPACE_INVALID:
+            return "STD_VIDEO_VP9_COLOR_SPACE_INVALID";
+        default:
+            return std::string("UNKNOWN_StdVideoVP9ColorSpace_value") + std::to_string(value);
+    }
+}
+std::string VkColorSpaceKHRString(VkColorSpaceKHR value) {
+    switch (value) {
+        case (VK_COLOR_SPACE_SRGB_NONLINEAR_KHR):
+            return "COLOR_SPACE_SRGB_NONLINEAR_KHR";
+        case (VK_COLOR_SPACE_DISPLAY_P3_NONLINEAR_EXT):
+            return "COLOR_SPACE_DISPLAY_P3_NONLINEAR_EXT";
+        case (VK_COLOR_SPACE_EXTENDED_SRGB_LINEAR_EXT):
+            return "COLOR_SPACE_EXTENDED_SRGB_LINEAR_EXT";
+        case (VK_COLOR_SPACE_DISPLAY_P3_LINEAR_EXT):
+            return "COLOR_SPACE_DISPLAY_P3_LINEAR_EXT";
+        case (VK_COLOR_SPACE_DCI_P3_NONLINEAR_EXT):
+            return "COLOR_SPACE_DCI_P3_NONLINEAR_EXT";
+        case (VK_COLOR_SPACE_BT709_LINEAR_EXT):
+            return "COLOR_SPACE_BT709_LINEAR_EXT";
+        case (VK_COLOR_SPACE_BT709_NONLINEAR_EXT):
+            return "COLOR_SPACE_BT709_NONLINEAR_EXT";
+        case (VK_COLOR_SPACE_BT2020_LINEAR_EXT):
+            return "COLOR_SPACE_BT2020_LINEAR_EXT";
+        case (VK_COLOR_SPACE_HDR10_ST2084_EXT):
+            return "COLOR_SPACE_HDR10_ST2084_EXT";
+        case (VK_COLOR_SPACE_DOLBYVISION_EXT):
+            return "COLOR_SPACE_DOLBYVISION_EXT";
+        case (VK_COLOR_SPACE_HDR10_HLG_EXT):
+            return "COLOR_SPACE_HDR10_HLG_EXT";
+        case (VK_COLOR_SPACE_ADOBERGB_LINEAR_EXT):
+            return "COLOR_SPACE_ADOBERGB_LINEAR_EXT";
+        case (VK_COLOR_SPACE_ADOBERGB_NONLINEAR_EXT):
+            return "COLOR_SPACE_ADOBERGB_NONLINEAR_EXT";
+        case (VK_COLOR_SPACE_PASS_THROUGH_EXT):
+            return "COLOR_SPACE_PASS_THROUGH_EXT";
+        case (VK_COLOR_SPACE_EXTENDED_SRGB_NONLINEAR_EXT):
+            return "COLOR_SPACE_EXTENDED_SRGB_NONLINEAR_EXT";
+        case (VK_COLOR_SPACE_DISPLAY_NATIVE_AMD):
+            return "COLOR_SPACE_DISPLAY_NATIVE_AMD";
+        default:
+            return std::string("UNKNOWN_VkColorSpaceKHR_value") + std::to_string(value);
+    }
+}
+std::string VkComponentSwizzleString(VkComponentSwizzle value) {
+    switch (value) {
+        case (VK_COMPONENT_SWIZZLE_IDENTITY):
+            return "COMPONENT_SWIZZLE_IDENTITY";
+        case (VK_COMPONENT_SWIZZLE_ZERO):
+            return "COMPONENT_SWIZZLE_ZERO";
+        case (VK_COMPONENT_SWIZZLE_ONE):
+            return "COMPONENT_SWIZZLE_ONE";
+        case (VK_COMPONENT_SWIZZLE_R):
+            return "COMPONENT_SWIZZLE_R";
+        case (VK_COMPONENT_SWIZZLE_G):
+            return "COMPONENT_SWIZZLE_G";
+        case (VK_COMPONENT_SWIZZLE_B):
+            return "COMPONENT_SWIZZLE_B";
+        case (VK_COMPONENT_SWIZZLE_A):
+            return "COMPONENT_SWIZZLE_A";
+        default:
+            return std::string("UNKNOWN_VkComponentSwizzle_value") + std::to_string(value);
+    }
+}
+std::string VkComponentTypeKHRString(VkComponentTypeKHR value) {
+    switch (value) {
+        case (VK_COMPONENT_TYPE_FLOAT16_KHR):
+            return "COMPONENT_TYPE_FLOAT16_KHR";
+        case (VK_COMPONENT_TYPE_FLOAT32_KHR):
+            return "COMPONENT_TYPE_FLOAT32_KHR";
+        case (VK_COMPONENT_TYPE_FLOAT64_KHR):
+            return "COMPONENT_TYPE_FLOAT64_KHR";
+        case (VK_COMPONENT_TYPE_SINT8_KHR):
+            return "COMPONENT_TYPE_SINT8_KHR";
+        case (VK_COMPONENT_TYPE_SINT16_KHR):
+            return "COMPONENT_TYPE_SINT16_KHR";
+        case (VK_COMPONENT_TYPE_SINT32_KHR):
+            return "COMPONENT_TYPE_SINT32_KHR";
+        case (VK_COMPONENT_TYPE_SINT64_KHR):
+            return "COMPONENT_TYPE_SINT64_KHR";
+        case (VK_COMPONENT_TYPE_UINT8_KHR):
+            return "COMPONENT_TYPE_UINT8_KHR";
+        case (VK_COMPONENT_TYPE_UINT16_KHR):
+            return "COMPONENT_TYPE_UINT16_KHR";
+        case (VK_COMPONENT_TYPE_UINT32_KHR):
+            return "COMPONENT_TYPE_UINT32_KHR";
+        case (VK_COMPONENT_TYPE_UINT64_KHR):
+            return "COMPONENT_TYPE_UINT64_KHR";
+        case (VK_COMPONENT_TYPE_BFLOAT16_KHR):
+            return "COMPONENT_TYPE_BFLOAT16_KHR";
+        case (VK_COMPONENT_TYPE_SINT8_PACKED_NV):
+            return "COMPONENT_TYPE_SINT8_PACKED_NV";
+        case (VK_COMPONENT_TYPE_UINT8_PACKED_NV):
+            return "COMPONENT_TYPE_UINT8_PACKED_NV";
+        case (VK_COMPONENT_TYPE_FLOAT8_E4M3_EXT):
+            return "COMPONENT_TYPE_FLOAT8_E4M3_EXT";
+        case (VK_COMPONENT_TYPE_FLOAT8_E5M2_EXT):
+            return "COMPONENT_TYPE_FLOAT8_E5M2_EXT";
+        case (VK_COMPONENT_TYPE_FLOAT6_E2M3_EXT):
+            return "COMPONENT_TYPE_FLOAT6_E2M3_EXT";
+        case (VK_COMPONENT_TYPE_FLOAT6_E3M2_EXT):
+            return "COMPONENT_TYPE_FLOAT6_E3M2_EXT";
+        case (VK_COMPONENT_TYPE_FLOAT4_E2M1_EXT):
+            return "COMPONENT_TYPE_FLOAT4_E2M1_EXT";
+        case (VK_COMPONENT_TYPE_FLOAT8_UNSIGNED_E8M0_EXT):
+            return "COMPONENT_TYPE_FLOAT8_UNSIGNED_E8M0_EXT";
+        case (VK_COMPONENT_TYPE_MXINT8_EXT):
+            return "COMPONENT_TYPE_MXINT8_EXT";
+        default:
+            return std::string("UNKNOWN_VkComponentTypeKHR_value") + std::to_string(value);
+    }
+}
+std::string VkDefaultVertexAttributeValueKHRString(VkDefaultVertexAttributeValueKHR value) {
+    switch (value) {
+        case (VK_DEFAULT_VERTEX_ATTRIBUTE_VALUE_ZERO_ZERO_ZERO_ZERO_KHR):
+            return "DEFAULT_VERTEX_ATTRIBUTE_VALUE_ZERO_ZERO_ZERO_ZERO_KHR";
+        case (VK_DEFAULT_VERTEX_ATTRIBUTE_VALUE_ZERO_ZERO_ZERO_ONE_KHR):
+            return "DEFAULT_VERTEX_ATTRIBUTE_VALUE_ZERO_ZERO_ZERO_ONE_KHR";
+        default:
+            return std::string("UNKNOWN_VkDefaultVertexAttributeValueKHR_value") + std::to_string(value);
+    }
+}
+std::string VkDriverIdString(VkDriverId value) {
+    switch (value) {
+        case (VK_DRIVER_ID_AMD_PROPRIETARY):
+            return "DRIVER_ID_AMD_PROPRIETARY";
+        case (VK_DRIVER_ID_AMD_OPEN_SOURCE):
+            return "DRIVER_ID_AMD_OPEN_SOURCE";
+        case (VK_DRIVER_ID_MESA_RADV):
+            return "DRIVER_ID_MESA_RADV";
+        case (VK_DRIVER_ID_NVIDIA_PROPRIETARY):
+            return "DRIVER_ID_NVIDIA_PROPRIETARY";
+        case (VK_DRIVER_ID_INTEL_PROPRIETARY_WINDOWS):
+            return "DRIVER_ID_INTEL_PROPRIETARY_WINDOWS";
+        case (VK_DRIVER_ID_INTEL_OPEN_SOURCE_MESA):
+            return "DRIVER_ID_INTEL_OPEN_SOURCE_MESA";
+        case (VK_DRIVER_ID_IMAGINATION_PROPRIETARY):
+            return "DRIVER_ID_IMAGINATION_PROPRIETARY";
+        case (VK_DRIVER_ID_QUALCOMM_PROPRIETARY):
+            return "DRIVER_ID_QUALCOMM_PROPRIETARY";
+        case (VK_DRIVER_ID_ARM_PROPRIETARY):
+            return "DRIVER_ID_ARM_PROPRIETARY";
+        case (VK_DRIVER_ID_GOOGLE_SWIFTSHADER):
+            return "DRIVER_ID_GOOGLE_SWIFTSHADER";
+        case (VK_DRIVER_ID_GGP_PROPRIETARY):
+            return "DRIVER_ID_GGP_PROPRIETARY";
+        case (VK_DRIVER_ID_BROADCOM_PROPRIETARY):
+            return "DRIVER_ID_BROADCOM_PROPRIETARY";
+        case (VK_DRIVER_ID_MESA_LLVMPIPE):
+            return "DRIVER_ID_MESA_LLVMPIPE";
+        case (VK_DRIVER_ID_MOLTENVK):
+            return "DRIVER_ID_MOLTENVK";
+        case (VK_DRIVER_ID_COREAVI_PROPRIETARY):
+            return "DRIVER_ID_COREAVI_PROPRIETARY";
+        case (VK_DRIVER_ID_JUICE_PROPRIETARY):
+            return "DRIVER_ID_JUICE_PROPRIETARY";
+        case (VK_DRIVER_ID_VERISILICON_PROPRIETARY):
+            return "DRIVER_ID_VERISILICON_PROPRIETARY";
+        case (VK_DRIVER_ID_MESA_TURNIP):
+            return "DRIVER_ID_MESA_TURNIP";
+        case (VK_DRIVER_ID_MESA_V3DV):
+            return "DRIVER_ID_MESA_V3DV";
+        case (VK_DRIVER_ID_MESA_PANVK):
+            return "DRIVER_ID_MESA_PANVK";
+        case (VK_DRIVER_ID_SAMSUNG_PROPRIETARY):
+            return "DRIVER_ID_SAMSUNG_PROPRIETARY";
+        case (VK_DRIVER_ID_MESA_VENUS):
+            return "DRIVER_ID_MESA_VENUS";
+        case (VK_DRIVER_ID_MESA_DOZEN):
+            return "DRIVER_ID_MESA_DOZEN";
+        case (VK_DRIVER_ID_MESA_NVK):
+            return "DRIVER_ID_MESA_NVK";
+        case (VK_DRIVER_ID_IMAGINATION_OPEN_SOURCE_MESA):
+            return "DRIVER_ID_IMAGINATION_OPEN_SOURCE_MESA";
+        case (VK_DRIVER_ID_MESA_HONEYKRISP):
+            return "DRIVER_ID_MESA_HONEYKRISP";
+        case (VK_DRIVER_ID_VULKAN_SC_EMULATION_ON_VULKAN):
+            return "DRIVER_ID_VULKAN_SC_EMULATION_ON_VULKAN";
+        case (VK_DRIVER_ID_MESA_KOSMICKRISP):
+            return "DRIVER_ID_MESA_KOSMICKRISP";
+        case (VK_DRIVER_ID_MESA_GFXSTREAM):
+            return "DRIVER_ID_MESA_GFXSTREAM";
+        case (VK_DRIVER_ID_APE_SOFT):
+            return "DRIVER_ID_APE_SOFT";
+        case (VK_DRIVER_ID_RESERVED_31):
+            return "DRIVER_ID_RESERVED_31";
+        default:
+            return std::string("UNKNOWN_VkDriverId_value") + std::to_string(value);
+    }
+}
+std::string VkFormatString(VkFormat value) {
+    switch (value) {
+        case (VK_FORMAT_UNDEFINED):
+            return "FORMAT_UNDEFINED";
+        case (VK_FORMAT_R4G4_UNORM_PACK8):
+            return "FORMAT_R4G4_UNORM_PACK8";
+        case (VK_FORMAT_R4G4B4A4_UNORM_PACK16):
+            return "FORMAT_R4G4B4A4_UNORM_PACK16";
+        case (VK_FORMAT_B4G4R4A4_UNORM_PACK16):
+            return "FORMAT_B4G4R4A4_UNORM_PACK16";
+        case (VK_FORMAT_R5G6B5_UNORM_PACK16):
+            return "FORMAT_R5G6B5_UNORM_PACK16";
+        case (VK_FORMAT_B5G6R5_UNORM_PACK16):
+            return "FORMAT_B5G6R5_UNORM_PACK16";
+        case (VK_FORMAT_R5G5B5A1_UNORM_PACK16):
+            return "FORMAT_R5G5B5A1_UNORM_PACK16";
+        case (VK_FORMAT_B5G5R5A1_UNORM_PACK16):
+            return "FORMAT_B5G5R5A1_UNORM_PACK16";
+        case (VK_FORMAT_A1R5G5B5_UNORM_PACK16):
+            return "FORMAT_A1R5G5B5_UNORM_PACK16";
+        case (VK_FORMAT_R8_UNORM):
+            return "FORMAT_R8_UNORM";
+        case (VK_FORMAT_R8_SNORM):
+            return "FORMAT_R8_SNORM";
+        case (VK_FORMAT_R8_USCALED):
+            return "FORMAT_R8_USCALED";
+        case (VK_FORMAT_R8_SSCALED):
+            return "FORMAT_R8_SSCALED";
+        case (VK_FORMAT_R8_UINT):
+            return "FORMAT_R8_UINT";
+        case (VK_FORMAT_R8_SINT):
+            return "FORMAT_R8_SINT";
+        case (VK_FORMAT_R8_SRGB):
+            return "FORMAT_R8_SRGB";
+        case (VK_FORMAT_R8G8_UNORM):
+            return "FORMAT_R8G8_UNORM";
+        case (VK_FORMAT_R8G8_SNORM):
+            return "FORMAT_R8G8_SNORM";
+        case (VK_FORMAT_R8G8_USCALED):
+            return "FORMAT_R8G8_USCALED";
+        case (VK_FORMAT_R8G8_SSCALED):
+            return "FORMAT_R8G8_SSCALED";
+        case (VK_FORMAT_R8G8_UINT):
+            return "FORMAT_R8G8_UINT";
+        case (VK_FORMAT_R8G8_SINT):
+            return "FORMAT_R8G8_SINT";
+        case (VK_FORMAT_R8G8_SRGB):
+            return "FORMAT_R8G8_SRGB";
+        case (VK_FORMAT_R8G8B8_UNORM):
+            return "FORMAT_R8G8B8_UNORM";
+        case (VK_FORMAT_R8G8B8_SNORM):
+            return "FORMAT_R8G8B8_SNORM";
+        case (VK_FORMAT_R8G8B8_USCALED):
+            return "FORMAT_R8G8B8_USCALED";
+        case (VK_FORMAT_R8G8B8_SSCALED):
+            return "FORMAT_R8G8B8_SSCALED";
+        case (VK_FORMAT_R8G8B8_UINT):
+            return "FORMAT_R8G8B8_UINT";
+        case (VK_FORMAT_R8G8B8_SINT):
+            return "FORMAT_R8G8B8_SINT";
+        case (VK_FORMAT_R8G8B8_SRGB):
+            return "FORMAT_R8G8B8_SRGB";
+        case (VK_FORMAT_B8G8R8_UNORM):
+            return "FORMAT_B8G8R8_UNORM";
+        case (VK_FORMAT_B8G8R8_SNORM):
+            return "FORMAT_B8G8R8_SNORM";
+        case (VK_FORMAT_B8G8R8_USCALED):
+            return "FORMAT_B8G8R8_USCALED";
+        case (VK_FORMAT_B8G8R8_SSCALED):
+            return "FORMAT_B8G8R8_SSCALED";
+        case (VK_FORMAT_B8G8R8_UINT):
+            return "FORMAT_B8G8R8_UINT";
+        case (VK_FORMAT_B8G8R8_SINT):
+            return "FORMAT_B8G8R8_SINT";
+        case (VK_FORMAT_B8G8R8_SRGB):
+            return "FORMAT_B8G8R8_SRGB";
+        case (VK_FORMAT_R8G8B8A8_UNORM):
+            return "FORMAT_R8G8B8A8_UNORM";
+        case (VK_FORMAT_R8G8B8A8_SNORM):
+            return "FORMAT_R8G8B8A8_SNORM";
+        case (VK_FORMAT_R8G8B8A8_USCALED):
+            return "FORMAT_R8G8B8A8_USCALED";
+        case (VK_FORMAT_R8G8B8A8_SSCALED):
+            return "FORMAT_R8G8B8A8_SSCALED";
+        case (VK_FORMAT_R8G8B8A8_UINT):
+            return "FORMAT_R8G8B8A8_UINT";
+        case (VK_FORMAT_R8G8B8A8_SINT):
+            return "FORMAT_R8G8B8A8_SINT";
+        case (VK_FORMAT_R8G8B8A8_SRGB):
+            return "FORMAT_R8G8B8A8_SRGB";
+        case (VK_FORMAT_B8G8R8A8_UNORM):
+            return "FORMAT_B8G8R8A8_UNORM";
+        case (VK_FORMAT_B8G8R8A8_SNORM):
+            return "FORMAT_B8G8R8A8_SNORM";
+        case (VK_FORMAT_B8G8R8A8_USCALED):
+            return "FORMAT_B8G8R8A8_USCALED";
+        case (VK_FORMAT_B8G8R8A8_SSCALED):
+            return "FORMAT_B8G8R8A8_SSCALED";
+        case (VK_FORMAT_B8G8R8A8_UINT):
+            return "FORMAT_B8G8R8A8_UINT";
+        case (VK_FORMAT_B8G8R8A8_SINT):
+            return "FORMAT_B8G8R8A8_SINT";
+        case (VK_FORMAT_B8G8R8A8_SRGB):
+            return "FORMAT_B8G8R8A8_SRGB";
+        case (VK_FORMAT_A8B8G8R8_UNORM_PACK32):
+            return "FORMAT_A8B8G8R8_UNORM_PACK32";
+        case (VK_FORMAT_A8B8G8R8_SNORM_PACK32):
+            return "FORMAT_A8B8G8R8_SNORM_PACK32";
+        case (VK_FORMAT_A8B8G8R8_USCALED_PACK32):
+            return "FORMAT_A8B8G8R8_USCALED_PACK32";
+        case (VK_FORMAT_A8B8G8R8_SSCALED_PACK32):
+            return "FORMAT_A8B8G8R8_SSCALED_PACK32";
+        case (VK_FORMAT_A8B8G8R8_UINT_PACK32):
+            return "FORMAT_A8B8G8R8_UINT_PACK32";
+        case (VK_FORMAT_A8B8G8R8_SINT_PACK32):
+            return "FORMAT_A8B8G8R8_SINT_PACK32";
+        case (VK_FORMAT_A8B8G8R8_SRGB_PACK32):
+            return "FORMAT_A8B8G8R8_SRGB_PACK32";
+        case (VK_FORMAT_A2R10G10B10_UNORM_PACK32):
+            return "FORMAT_A2R10G10B10_UNORM_PACK32";
+        case (VK_FORMAT_A2R10G10B10_SNORM_PACK32):
+            return "FORMAT_A2R10G10B10_SNORM_PACK32";
+        case (VK_FORMAT_A2R10G10B10_USCALED_PACK32):
+            return "FORMAT_A2R10G10B10_USCALED_PACK32";
+        case (VK_FORMAT_A2R10G10B10_SSCALED_PACK32):
+            return "FORMAT_A2R10G10B10_SSCALED_PACK32";
+        case (VK_FORMAT_A2R10G10B10_UINT_PACK32):
+            return "FORMAT_A2R10G10B10_UINT_PACK32";
+        case (VK_FORMAT_A2R10G10B10_SINT_PACK32):
+            return "FORMAT_A2R10G10B10_SINT_PACK32";
+        case (VK_FORMAT_A2B10G10R10_UNORM_PACK32):
+            return "FORMAT_A2B10G10R10_UNORM_PACK32";
+        case (VK_FORMAT_A2B10G10R10_SNORM_PACK32):
+            return "FORMAT_A2B10G10R10_SNORM_PACK32";
+        case (VK_FORMAT_A2B10G10R10_USCALED_PACK32):
+            return "FORMAT_A2B10G10R10_USCALED_PACK32";
+        case (VK_FORMAT_A2B10G10R10_SSCALED_PACK32):
+            return "FORMAT_A2B10G10R10_SSCALED_PACK32";
+        case (VK_FORMAT_A2B10G10R10_UINT_PACK32):
+            return "FORMAT_A2B10G10R10_UINT_PACK32";
+        case (VK_FORMAT_A2B10G10R10_SINT_PACK32):
+            return "FORMAT_A2B10G10R10_SINT_PACK32";
+        case (VK_FORMAT_R16_UNORM):
+            return "FORMAT_R16_UNORM";
+        case (VK_FORMAT_R16_SNORM):
+            return "FORMAT_R16_SNORM";
+        case (VK_FORMAT_R16_USCALED):
+            return "FORMAT_R16_USCALED";
+        case (VK_FORMAT_R16_SSCALED):
+            return "FORMAT_R16_SSCALED";
+        case (VK_FORMAT_R16_UINT):
+            return "FORMAT_R16_UINT";
+        case (VK_FORMAT_R16_SINT):
+            return "FORMAT_R16_SINT";
+        case (VK_FORMAT_R16_SFLOAT):
+            return "FORMAT_R16_SFLOAT";
+        case (VK_FORMAT_R16G16_UNORM):
+            return "FORMAT_R16G16_UNORM";
+        case (VK_FORMAT_R16G16_SNORM):
+            return "FORMAT_R16G16_SNORM";
+        case (VK_FORMAT_R16G16_USCALED):
+            return "FORMAT_R16G16_USCALED";
+        case (VK_FORMAT_R16G16_SSCALED):
+            return "FORMAT_R16G16_SSCALED";
+        case (VK_FORMAT_R16G16_UINT):
+            return "FORMAT_R16G16_UINT";
+        case (VK_FORMAT_R16G16_SINT):
+            return "FORMAT_R16G16_SINT";
+        case (VK_FORMAT_R16G16_SFLOAT):
+            return "FORMAT_R16G16_SFLOAT";
+        case (VK_FORMAT_R16G16B16_UNORM):
+            return "FORMAT_R16G16B16_UNORM";
+        case (VK_FORMAT_R16G16B16_SNORM):
+            return "FORMAT_R16G16B16_SNORM";
+        case (VK_FORMAT_R16G16B16_USCALED):
+            return "FORMAT_R16G16B16_USCALED";
+        case (VK_FORMAT_R16G16B16_SSCALED):
+            return "FORMAT_R16G16B16_SSCALED";
+        case (VK_FORMAT_R16G16B16_UINT):
+            return "FORMAT_R16G16B16_UINT";
+        case (VK_FORMAT_R16G16B16_SINT):
+            return "FORMAT_R16G16B16_SINT";
+        case (VK_FORMAT_R16G16B16_SFLOAT):
+            return "FORMAT_R16G16B16_SFLOAT";
+        case (VK_FORMAT_R16G16B16A16_UNORM):
+            return "FORMAT_R16G16B16A16_UNORM";
+        case (VK_FORMAT_R16G16B16A16_SNORM):
+            return "FORMAT_R16G16B16A16_SNORM";
+        case (VK_FORMAT_R16G16B16A16_USCALED):
+            return "FORMAT_R16G16B16A16_USCALED";
+        case (VK_FORMAT_R16G16B16A16_SSCALED):
+            return "FORMAT_R16G16B16A16_SSCALED";
+        case (VK_FORMAT_R16G16B16A16_UINT):
+            return "FORMAT_R16G16B16A16_UINT";
+        case (VK_FORMAT_R16G16B16A16_SINT):
+            return "FORMAT_R16G16B16A16_SINT";
+        case (VK_FORMAT_R16G16B16A16_SFLOAT):
+            return "FORMAT_R16G16B16A16_SFLOAT";
+        case (VK_FORMAT_R32_UINT):
+            return "FORMAT_R32_UINT";
+        case (VK_FORMAT_R32_SINT):
+            return "FORMAT_R32_SINT";
+        case (VK_FORMAT_R32_SFLOAT):
+            return "FORMAT_R32_SFLOAT";
+        case (VK_FORMAT_R32G32_UINT):
+            return "FORMAT_R32G32_UINT";
+        case (VK_FORMAT_R32G32_SINT):
+            return "FORMAT_R32G32_SINT";
+        case (VK_FORMAT_R32G32_SFLOAT):
+            return "FORMAT_R32G32_SFLOAT";
+        case (VK_FORMAT_R32G32B32_UINT):
+            return "FORMAT_R32G32B32_UINT";
+        case (VK_FORMAT_R32G32B32_SINT):
+            return "FORMAT_R32G32B32_SINT";
+        case (VK_FORMAT_R32G32B32_SFLOAT):
+            return "FORMAT_R32G32B32_SFLOAT";
+        case (VK_FORMAT_R32G32B32A32_UINT):
+            return "FORMAT_R32G32B32A32_UINT";
+        case (VK_FORMAT_R32G32B32A32_SINT):
+            return "FORMAT_R32G32B32A32_SINT";
+        case (VK_FORMAT_R32G32B32A32_SFLOAT):
+            return "FORMAT_R32G32B32A32_SFLOAT";
+        case (VK_FORMAT_R64_UINT):
+            return "FORMAT_R64_UINT";
+        case (VK_FORMAT_R64_SINT):
+            return "FORMAT_R64_SINT";
+        case (VK_FORMAT_R64_SFLOAT):
+            return "FORMAT_R64_SFLOAT";
+        case (VK_FORMAT_R64G64_UINT):
+            return "FORMAT_R64G64_UINT";
+        case (VK_FORMAT_R64G64_SINT):
+            return "FORMAT_R64G64_SINT";
+        case (VK_FORMAT_R64G64_SFLOAT):
+            return "FORMAT_R64G64_SFLOAT";
+        case (VK_FORMAT_R64G64B64_UINT):
+            return "FORMAT_R64G64B64_UINT";
+        case (VK_FORMAT_R64G64B64_SINT):
+            return "FORMAT_R64G64B64_SINT";
+        case (VK_FORMAT_R64G64B64_SFLOAT):
+            return "FORMAT_R64G64B64_SFLOAT";
+        case (VK_FORMAT_R64G64B64A64_UINT):
+            return "FORMAT_R64G64B64A64_UINT";
+        case (VK_FORMAT_R64G64B64A64_SINT):
+            return "FORMAT_R64G64B64A64_SINT";
+        case (VK_FORMAT_R64G64B64A64_SFLOAT):
+            return "FORMAT_R64G64B64A64_SFLOAT";
+        case (VK_FORMAT_B10G11R11_UFLOAT_PACK32):
+            return "FORMAT_B10G11R11_UFLOAT_PACK32";
+        case (VK_FORMAT_E5B9G9R9_UFLOAT_PACK32):
+            return "FORMAT_E5B9G9R9_UFLOAT_PACK32";
+        case (VK_FORMAT_D16_UNORM):
+            return "FORMAT_D16_UNORM";
+        case (VK_FORMAT_X8_D24_UNORM_PACK32):
+            return "FORMAT_X8_D24_UNORM_PACK32";
+        case (VK_FORMAT_D32_SFLOAT):
+            return "FORMAT_D32_SFLOAT";
+        case (VK_FORMAT_S8_UINT):
+            return "FORMAT_S8_UINT";
+        case (VK_FORMAT_D16_UNORM_S8_UINT):
+            return "FORMAT_D16_UNORM_S8_UINT";
+        case (VK_FORMAT_D24_UNORM_S8_UINT):
+            return "FORMAT_D24_UNORM_S8_UINT";
+        case (VK_FORMAT_D32_SFLOAT_S8_UINT):
+            return "FORMAT_D32_SFLOAT_S8_UINT";
+        case (VK_FORMAT_BC1_RGB_UNORM_BLOCK):
+            return "FORMAT_BC1_RGB_UNORM_BLOCK";
+        case (VK_FORMAT_BC1_RGB_SRGB_BLOCK):
+            return "FORMAT_BC1_RGB_SRGB_BLOCK";
+        case (VK_FORMAT_BC1_RGBA_UNORM_BLOCK):
+            return "FORMAT_BC1_RGBA_UNORM_BLOCK";
+        case (VK_FORMAT_BC1_RGBA_SRGB_BLOCK):
+            return "FORMAT_BC1_RGBA_SRGB_BLOCK";
+        case (VK_FORMAT_BC2_UNORM_BLOCK):
+            return "FORMAT_BC2_UNORM_BLOCK";
+        case (VK_FORMAT_BC2_SRGB_BLOCK):
+            return "FORMAT_BC2_SRGB_BLOCK";
+        case (VK_FORMAT_BC3_UNORM_BLOCK):
+            return "FORMAT_BC3_UNORM_BLOCK";
+        case (VK_FORMAT_BC3_SRGB_BLOCK):
+            return "FORMAT_BC3_SRGB_BLOCK";
+        case (VK_FORMAT_BC4_UNORM_BLOCK):
+            return "FORMAT_BC4_UNORM_BLOCK";
+        case (VK_FORMAT_BC4_SNORM_BLOCK):
+            return "FORMAT_BC4_SNORM_BLOCK";
+        case (VK_FORMAT_BC5_UNORM_BLOCK):
+            return "FORMAT_BC5_UNORM_BLOCK";
+        case (VK_FORMAT_BC5_SNORM_BLOCK):
+            return "FORMAT_BC5_SNORM_BLOCK";
+        case (VK_FORMAT_BC6H_UFLOAT_BLOCK):
+            return "FORMAT_BC6H_UFLOAT_BLOCK";
+        case (VK_FORMAT_BC6H_SFLOAT_BLOCK):
+            return "FORMAT_BC6H_SFLOAT_BLOCK";
+        case (VK_FORMAT_BC7_UNORM_BLOCK):
+            return "FORMAT_BC7_UNORM_BLOCK";
+        case (VK_FORMAT_BC7_SRGB_BLOCK):
+            return "FORMAT_BC7_SRGB_BLOCK";
+        case (VK_FORMAT_ETC2_R8G8B8_UNORM_BLOCK):
+            return "FORMAT_ETC2_R8G8B8_UNORM_BLOCK";
+        case (VK_FORMAT_ETC2_R8G8B8_SRGB_BLOCK):
+            return "FORMAT_ETC2_R8G8B8_SRGB_BLOCK";
+        case (VK_FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK):
+            return "FORMAT_ETC2_R8G8B8A1_UNORM_BLOCK";
+        case (VK_FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK):
+            return "FORMAT_ETC2_R8G8B8A1_SRGB_BLOCK";
+        case (VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK):
+            return "FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK";
+        case (VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK):
+            return "FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK";
+        case (VK_FORMAT_EAC_R11_UNORM_BLOCK):
+            return "FORMAT_EAC_R11_UNORM_BLOCK";
+        case (VK_FORMAT_EAC_R11_SNORM_BLOCK):
+            return "FORMAT_EAC_R11_SNORM_BLOCK";
+        case (VK_FORMAT_EAC_R11G11_UNORM_BLOCK):
+            return "FORMAT_EAC_R11G11_UNORM_BLOCK";
+        case (VK_FORMAT_EAC_R11G11_SNORM_BLOCK):
+            return "FORMAT_EAC_R11G11_SNORM_BLOCK";
+        case (VK_FORMAT_ASTC_4x4_UNORM_BLOCK):
+            return "FORMAT_ASTC_4x4_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_4x4_SRGB_BLOCK):
+            return "FORMAT_ASTC_4x4_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_5x4_UNORM_BLOCK):
+            return "FORMAT_ASTC_5x4_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_5x4_SRGB_BLOCK):
+            return "FORMAT_ASTC_5x4_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_5x5_UNORM_BLOCK):
+            return "FORMAT_ASTC_5x5_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_5x5_SRGB_BLOCK):
+            return "FORMAT_ASTC_5x5_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_6x5_UNORM_BLOCK):
+            return "FORMAT_ASTC_6x5_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_6x5_SRGB_BLOCK):
+            return "FORMAT_ASTC_6x5_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_6x6_UNORM_BLOCK):
+            return "FORMAT_ASTC_6x6_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_6x6_SRGB_BLOCK):
+            return "FORMAT_ASTC_6x6_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_8x5_UNORM_BLOCK):
+            return "FORMAT_ASTC_8x5_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_8x5_SRGB_BLOCK):
+            return "FORMAT_ASTC_8x5_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_8x6_UNORM_BLOCK):
+            return "FORMAT_ASTC_8x6_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_8x6_SRGB_BLOCK):
+            return "FORMAT_ASTC_8x6_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_8x8_UNORM_BLOCK):
+            return "FORMAT_ASTC_8x8_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_8x8_SRGB_BLOCK):
+            return "FORMAT_ASTC_8x8_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_10x5_UNORM_BLOCK):
+            return "FORMAT_ASTC_10x5_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_10x5_SRGB_BLOCK):
+            return "FORMAT_ASTC_10x5_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_10x6_UNORM_BLOCK):
+            return "FORMAT_ASTC_10x6_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_10x6_SRGB_BLOCK):
+            return "FORMAT_ASTC_10x6_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_10x8_UNORM_BLOCK):
+            return "FORMAT_ASTC_10x8_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_10x8_SRGB_BLOCK):
+            return "FORMAT_ASTC_10x8_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_10x10_UNORM_BLOCK):
+            return "FORMAT_ASTC_10x10_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_10x10_SRGB_BLOCK):
+            return "FORMAT_ASTC_10x10_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_12x10_UNORM_BLOCK):
+            return "FORMAT_ASTC_12x10_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_12x10_SRGB_BLOCK):
+            return "FORMAT_ASTC_12x10_SRGB_BLOCK";
+        case (VK_FORMAT_ASTC_12x12_UNORM_BLOCK):
+            return "FORMAT_ASTC_12x12_UNORM_BLOCK";
+        case (VK_FORMAT_ASTC_12x12_SRGB_BLOCK):
+            return "FORMAT_ASTC_12x12_SRGB_BLOCK";
+        case (VK_FORMAT_G8B8G8R8_422_UNORM):
+            return "FORMAT_G8B8G8R8_422_UNORM";
+        case (VK_FORMAT_B8G8R8G8_422_UNORM):
+            return "FORMAT_B8G8R8G8_422_UNORM";
+        case (VK_FORMAT_G8_B8_R8_3PLANE_420_UNORM):
+            return "FORMAT_G8_B8_R8_3PLANE_420_UNORM";
+        case (VK_FORMAT_G8_B8R8_2PLANE_420_UNORM):
+            return "FORMAT_G8_B8R8_2PLANE_420_UNORM";
+        case (VK_FORMAT_G8_B8_R8_3PLANE_422_UNORM):
+            return "FORMAT_G8_B8_R8_3PLANE_422_UNORM";
+        case (VK_FORMAT_G8_B8R8_2PLANE_422_UNORM):
+            return "FORMAT_G8_B8R8_2PLANE_422_UNORM";
+        case (VK_FORMAT_G8_B8_R8_3PLANE_444_UNORM):
+            return "FORMAT_G8_B8_R8_3PLANE_444_UNORM";
+        case (VK_FORMAT_R10X6_UNORM_PACK16):
+            return "FORMAT_R10X6_UNORM_PACK16";
+        case (VK_FORMAT_R10X6G10X6_UNORM_2PACK16):
+            return "FORMAT_R10X6G10X6_UNORM_2PACK16";
+        case (VK_FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16):
+            return "FORMAT_R10X6G10X6B10X6A10X6_UNORM_4PACK16";
+        case (VK_FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16):
+            return "FORMAT_G10X6B10X6G10X6R10X6_422_UNORM_4PACK16";
+        case (VK_FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16):
+            return "FORMAT_B10X6G10X6R10X6G10X6_422_UNORM_4PACK16";
+        case (VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16):
+            return "FORMAT_G10X6_B10X6_R10X6_3PLANE_420_UNORM_3PACK16";
+        case (VK_FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16):
+            return "FORMAT_G10X6_B10X6R10X6_2PLANE_420_UNORM_3PACK16";
+        case (VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16):
+            return "FORMAT_G10X6_B10X6_R10X6_3PLANE_422_UNORM_3PACK16";
+        case (VK_FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16):
+            return "FORMAT_G10X6_B10X6R10X6_2PLANE_422_UNORM_3PACK16";
+        case (VK_FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16):
+            return "FORMAT_G10X6_B10X6_R10X6_3PLANE_444_UNORM_3PACK16";
+        case (VK_FORMAT_R12X4_UNORM_PACK16):
+            return "FORMAT_R12X4_UNORM_PACK16";
+        case (VK_FORMAT_R12X4G12X4_UNORM_2PACK16):
+            return "FORMAT_R12X4G12X4_UNORM_2PACK16";
+        case (VK_FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16):
+            return "FORMAT_R12X4G12X4B12X4A12X4_UNORM_4PACK16";
+        case (VK_FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16):
+            return "FORMAT_G12X4B12X4G12X4R12X4_422_UNORM_4PACK16";
+        case (VK_FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16):
+            return "FORMAT_B12X4G12X4R12X4G12X4_422_UNORM_4PACK16";
+        case (VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16):
+            return "FORMAT_G12X4_B12X4_R12X4_3PLANE_420_UNORM_3PACK16";
+        case (VK_FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16):
+            return "FORMAT_G12X4_B12X4R12X4_2PLANE_420_UNORM_3PACK16";
+        case (VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16):
+            return "FORMAT_G12X4_B12X4_R12X4_3PLANE_422_UNORM_3PACK16";
+        case (VK_FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16):
+            return "FORMAT_G12X4_B12X4R12X4_2PLANE_422_UNORM_3PACK16";
+        case (VK_FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16):
+            return "FORMAT_G12X4_B12X4_R12X4_3PLANE_444_UNORM_3PACK16";
+        case (VK_FORMAT_G16B16G16R16_422_UNORM):
+            return "FORMAT_G16B16G16R16_422_UNORM";
+        case (VK_FORMAT_B16G16R16G16_422_UNORM):
+            return "FORMAT_B16G16R16G16_422_UNORM";
+        case (VK_FORMAT_G16_B16_R16_3PLANE_420_UNORM):
+            return "FORMAT_G16_B16_R16_3PLANE_420_UNORM";
+        case (VK_FORMAT_G16_B16R16_2PLANE_420_UNORM):
+            return "FORMAT_G16_B16R16_2PLANE_420_UNORM";
+        case (VK_FORMAT_G16_B16_R16_3PLANE_422_UNORM):
+            return "FORMAT_G16_B16_R16_3PLANE_422_UNORM";
+        case (VK_FORMAT_G16_B16R16_2PLANE_422_UNORM):
+            return "FORMAT_G16_B16R16_2PLANE_422_UNORM";
+        case (VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM):
+            return "FORMAT_G16_B16_R16_3PLANE_444_UNORM";
+        case (VK_FORMAT_G8_B8R8_2PLANE_444_UNORM):
+            return "FORMAT_G8_B8R8_2PLANE_444_UNORM";
+        case (VK_FORMAT_G10X6_B10X6R10X6_2PLANE_444_UNORM_3PACK16):
+            return "FORMAT_G10X6_B10X6R10X6_2PLANE_444_UNORM_3PACK16";
+        case (VK_FORMAT_G12X4_B12X4R12X4_2PLANE_444_UNORM_3PACK16):
+            return "FORMAT_G12X4_B12X4R12X4_2PLANE_444_UNORM_3PACK16";
+        case (VK_FORMAT_G16_B16R16_2PLANE_444_UNORM):
+            return "FORMAT_G16_B16R16_2PLANE_444_UNORM";
+        case (VK_FORMAT_A4R4G4B4_UNORM_PACK16):
+            return "FORMAT_A4R4G4B4_UNORM_PACK16";
+        case (VK_FORMAT_A4B4G4R4_UNORM_PACK16):
+            return "FORMAT_A4B4G4R4_UNORM_PACK16";
+        case (VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_4x4_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_5x4_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_5x4_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_5x5_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_5x5_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_6x5_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_6x5_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_6x6_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_6x6_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_8x5_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_8x5_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_8x6_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_8x6_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_8x8_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_8x8_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_10x5_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_10x5_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_10x6_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_10x6_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_10x8_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_10x8_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_10x10_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_10x10_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_12x10_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_12x10_SFLOAT_BLOCK";
+        case (VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK):
+            return "FORMAT_ASTC_12x12_SFLOAT_BLOCK";
+        case (VK_FORMAT_A1B5G5R5_UNORM_PACK16):
+            return "FORMAT_A1B5G5R5_UNORM_PACK16";
+        case (VK_FORMAT_A8_UNORM):
+            return "FORMAT_A8_UNORM";
+        case (VK_FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG):
+            return "FORMAT_PVRTC1_2BPP_UNORM_BLOCK_IMG";
+        case (VK_FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG):
+            return "FORMAT_PVRTC1_4BPP_UNORM_BLOCK_IMG";
+        case (VK_FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG):
+            return "FORMAT_PVRTC2_2BPP_UNORM_BLOCK_IMG";
+        case (VK_FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG):
+            return "FORMAT_PVRTC2_4BPP_UNORM_BLOCK_IMG";
+        case (VK_FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG):
+            return "FORMAT_PVRTC1_2BPP_SRGB_BLOCK_IMG";
+        case (VK_FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG):
+            return "FORMAT_PVRTC1_4BPP_SRGB_BLOCK_IMG";
+        case (VK_FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG):
+            return "FORMAT_PVRTC2_2BPP_SRGB_BLOCK_IMG";
+        case (VK_FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG):
+            return "FORMAT_PVRTC2_4BPP_SRGB_BLOCK_IMG";
+        case (VK_FORMAT_ASTC_3x3x3_UNORM_BLOCK_EXT):
+            return "FORMAT_ASTC_3x3x3_UNORM_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_3x3x3_SRGB_BLOCK_EXT):
+            return "FORMAT_ASTC_3x3x3_SRGB_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_3x3x3_SFLOAT_BLOCK_EXT):
+            return "FORMAT_ASTC_3x3x3_SFLOAT_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_4x3x3_UNORM_BLOCK_EXT):
+            return "FORMAT_ASTC_4x3x3_UNORM_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_4x3x3_SRGB_BLOCK_EXT):
+            return "FORMAT_ASTC_4x3x3_SRGB_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_4x3x3_SFLOAT_BLOCK_EXT):
+            return "FORMAT_ASTC_4x3x3_SFLOAT_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_4x4x3_UNORM_BLOCK_EXT):
+            return "FORMAT_ASTC_4x4x3_UNORM_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_4x4x3_SRGB_BLOCK_EXT):
+            return "FORMAT_ASTC_4x4x3_SRGB_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_4x4x3_SFLOAT_BLOCK_EXT):
+            return "FORMAT_ASTC_4x4x3_SFLOAT_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_4x4x4_UNORM_BLOCK_EXT):
+            return "FORMAT_ASTC_4x4x4_UNORM_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_4x4x4_SRGB_BLOCK_EXT):
+            return "FORMAT_ASTC_4x4x4_SRGB_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_4x4x4_SFLOAT_BLOCK_EXT):
+            return "FORMAT_ASTC_4x4x4_SFLOAT_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_5x4x4_UNORM_BLOCK_EXT):
+            return "FORMAT_ASTC_5x4x4_UNORM_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_5x4x4_SRGB_BLOCK_EXT):
+            return "FORMAT_ASTC_5x4x4_SRGB_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_5x4x4_SFLOAT_BLOCK_EXT):
+            return "FORMAT_ASTC_5x4x4_SFLOAT_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_5x5x4_UNORM_BLOCK_EXT):
+            return "FORMAT_ASTC_5x5x4_UNORM_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_5x5x4_SRGB_BLOCK_EXT):
+            return "FORMAT_ASTC_5x5x4_SRGB_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_5x5x4_SFLOAT_BLOCK_EXT):
+            return "FORMAT_ASTC_5x5x4_SFLOAT_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_5x5x5_UNORM_BLOCK_EXT):
+            return "FORMAT_ASTC_5x5x5_UNORM_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_5x5x5_SRGB_BLOCK_EXT):
+            return "FORMAT_ASTC_5x5x5_SRGB_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_5x5x5_SFLOAT_BLOCK_EXT):
+            return "FORMAT_ASTC_5x5x5_SFLOAT_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_6x5x5_UNORM_BLOCK_EXT):
+            return "FORMAT_ASTC_6x5x5_UNORM_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_6x5x5_SRGB_BLOCK_EXT):
+            return "FORMAT_ASTC_6x5x5_SRGB_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_6x5x5_SFLOAT_BLOCK_EXT):
+            return "FORMAT_ASTC_6x5x5_SFLOAT_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_6x6x5_UNORM_BLOCK_EXT):
+            return "FORMAT_ASTC_6x6x5_UNORM_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_6x6x5_SRGB_BLOCK_EXT):
+            return "FORMAT_ASTC_6x6x5_SRGB_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_6x6x5_SFLOAT_BLOCK_EXT):
+            return "FORMAT_ASTC_6x6x5_SFLOAT_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_6x6x6_UNORM_BLOCK_EXT):
+            return "FORMAT_ASTC_6x6x6_UNORM_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_6x6x6_SRGB_BLOCK_EXT):
+            return "FORMAT_ASTC_6x6x6_SRGB_BLOCK_EXT";
+        case (VK_FORMAT_ASTC_6x6x6_SFLOAT_BLOCK_EXT):
+            return "FORMAT_ASTC_6x6x6_SFLOAT_BLOCK_EXT";
+        case (VK_FORMAT_R8_BOOL_ARM):
+            return "FORMAT_R8_BOOL_ARM";
+        case (VK_FORMAT_R16_SFLOAT_FPENCODING_BFLOAT16_ARM):
+            return "FORMAT_R16_SFLOAT_FPENCODING_BFLOAT16_ARM";
+        case (VK_FORMAT_R8_SFLOAT_FPENCODING_FLOAT8E4M3_ARM):
+            return "FORMAT_R8_SFLOAT_FPENCODING_FLOAT8E4M3_ARM";
+        case (VK_FORMAT_R8_SFLOAT_FPENCODING_FLOAT8E5M2_ARM):
+            return "FORMAT_R8_SFLOAT_FPENCODING_FLOAT8E5M2_ARM";
+        case (VK_FORMAT_R16G16_SFIXED5_NV):
+            return "FORMAT_R16G16_SFIXED5_NV";
+        case (VK_FORMAT_R10X6_UINT_PACK16_ARM):
+            return "FORMAT_R10X6_UINT_PACK16_ARM";
+        case (VK_FORMAT_R10X6G10X6_UINT_2PACK16_ARM):
+            return "FORMAT_R10X6G10X6_UINT_2PACK16_ARM";
+        case (VK_FORMAT_R10X6G10X6B10X6A10X6_UINT_4PACK16_ARM):
+            return "FORMAT_R10X6G10X6B10X6A10X6_UINT_4PACK16_ARM";
+        case (VK_FORMAT_R12X4_UINT_PACK16_ARM):
+            return "FORMAT_R12X4_UINT_PACK16_ARM";
+        case (VK_FORMAT_R12X4G12X4_UINT_2PACK16_ARM):
+            return "FORMAT_R12X4G12X4_UINT_2PACK16_ARM";
+        case (VK_FORMAT_R12X4G12X4B12X4A12X4_UINT_4PACK16_ARM):
+            return "FORMAT_R12X4G12X4B12X4A12X4_UINT_4PACK16_ARM";
+        case (VK_FORMAT_R14X2_UINT_PACK16_ARM):
+            return "FORMAT_R14X2_UINT_PACK16_ARM";
+        case (VK_FORMAT_R14X2G14X2_UINT_2PACK16_ARM):
+            return "FORMAT_R14X2G14X2_UINT_2PACK16_ARM";
+        case (VK_FORMAT_R14X2G14X2B14X2A14X2_UINT_4PACK16_ARM):
+            return "FORMAT_R14X2G14X2B14X2A14X2_UINT_4PACK16_ARM";
+        case (VK_FORMAT_R14X2_UNORM_PACK16_ARM):
+            return "FORMAT_R14X2_UNORM_PACK16_ARM";
+        case (VK_FORMAT_R14X2G14X2_UNORM_2PACK16_ARM):
+            return "FORMAT_R14X2G14X2_UNORM_2PACK16_ARM";
+        case (VK_FORMAT_R14X2G14X2B14X2A14X2_UNORM_4PACK16_ARM):
+            return "FORMAT_R14X2G14X2B14X2A14X2_UNORM_4PACK16_ARM";
+        case (VK_FORMAT_G14X2_B14X2R14X2_2PLANE_420_UNORM_3PACK16_ARM):
+            return "FORMAT_G14X2_B14X2R14X2_2PLANE_420_UNORM_3PACK16_ARM";
+        case (VK_FORMAT_G14X2_B14X2R14X2_2PLANE_422_UNORM_3PACK16_ARM):
+            return "FORMAT_G14X2_B14X2R14X2_2PLANE_422_UNORM_3PACK16_ARM";
+        default:
+            return std::string("UNKNOWN_VkFormat_value") + std::to_string(value);
+    }
+}
+std::string VkImageLayoutString(VkImageLayout value) {
+    switch (value) {
+        case (VK_IMAGE_LAYOUT_UNDEFINED):
+            return "IMAGE_LAYOUT_UNDEFINED";
+        case (VK_IMAGE_LAYOUT_GENERAL):
+            return "IMAGE_LAYOUT_GENERAL";
+        case (VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL):
+            return "IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL):
+            return "IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL):
+            return "IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL):
+            return "IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL):
+            return "IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL):
+            return "IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_PREINITIALIZED):
+            return "IMAGE_LAYOUT_PREINITIALIZED";
+        case (VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_STENCIL_ATTACHMENT_OPTIMAL):
+            return "IMAGE_LAYOUT_DEPTH_READ_ONLY_STENCIL_ATTACHMENT_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_STENCIL_READ_ONLY_OPTIMAL):
+            return "IMAGE_LAYOUT_DEPTH_ATTACHMENT_STENCIL_READ_ONLY_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL):
+            return "IMAGE_LAYOUT_DEPTH_ATTACHMENT_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_DEPTH_READ_ONLY_OPTIMAL):
+            return "IMAGE_LAYOUT_DEPTH_READ_ONLY_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_STENCIL_ATTACHMENT_OPTIMAL):
+            return "IMAGE_LAYOUT_STENCIL_ATTACHMENT_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_STENCIL_READ_ONLY_OPTIMAL):
+            return "IMAGE_LAYOUT_STENCIL_READ_ONLY_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_READ_ONLY_OPTIMAL):
+            return "IMAGE_LAYOUT_READ_ONLY_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_ATTACHMENT_OPTIMAL):
+            return "IMAGE_LAYOUT_ATTACHMENT_OPTIMAL";
+        case (VK_IMAGE_LAYOUT_RENDERING_LOCAL_READ):
+            return "IMAGE_LAYOUT_RENDERING_LOCAL_READ";
+        case (VK_IMAGE_LAYOUT_PRESENT_SRC_KHR):
+            return "IMAGE_LAYOUT_PRESENT_SRC_KHR";
+        case (VK_IMAGE_LAYOUT_VIDEO_DECODE_DST_KHR):
+            return "IMAGE_LAYOUT_VIDEO_DECODE_DST_KHR";
+        case (VK_IMAGE_LAYOUT_VIDEO_DECODE_SRC_KHR):
+            return "IMAGE_LAYOUT_VIDEO_DECODE_SRC_KHR";
+        case (VK_IMAGE_LAYOUT_VIDEO_DECODE_DPB_KHR):
+            return "IMAGE_LAYOUT_VIDEO_DECODE_DPB_KHR";
+        case (VK_IMAGE_LAYOUT_SHARED_PRESENT_KHR):
+            return "IMAGE_LAYOUT_SHARED_PRESENT_KHR";
+        case (VK_IMAGE_LAYOUT_FRAGMENT_DENSITY_MAP_OPTIMAL_EXT):
+            return "IMAGE_LAYOUT_FRAGMENT_DENSITY_MAP_OPTIMAL_EXT";
+        case (VK_IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL_KHR):
+            return "IMAGE_LAYOUT_FRAGMENT_SHADING_RATE_ATTACHMENT_OPTIMAL_KHR";
+        case (VK_IMAGE_LAYOUT_VIDEO_ENCODE_DST_KHR):
+            return "IMAGE_LAYOUT_VIDEO_ENCODE_DST_KHR";
+        case (VK_IMAGE_LAYOUT_VIDEO_ENCODE_SRC_KHR):
+            return "IMAGE_LAYOUT_VIDEO_ENCODE_SRC_KHR";
+        case (VK_IMAGE_LAYOUT_VIDEO_ENCODE_DPB_KHR):
+            return "IMAGE_LAYOUT_VIDEO_ENCODE_DPB_KHR";
+        case (VK_IMAGE_LAYOUT_ATTACHMENT_FEEDBACK_LOOP_OPTIMAL_EXT):
+            return "IMAGE_LAYOUT_ATTACHMENT_FEEDBACK_LOOP_OPTIMAL_EXT";
+        case (VK_IMAGE_LAYOUT_TENSOR_ALIASING_ARM):
+            return "IMAGE_LAYOUT_TENSOR_ALIASING_ARM";
+        case (VK_IMAGE_LAYOUT_VIDEO_ENCODE_QUANTIZATION_MAP_KHR):
+            return "IMAGE_LAYOUT_VIDEO_ENCODE_QUANTIZATION_MAP_KHR";
+        case (VK_IMAGE_LAYOUT_ZERO_INITIALIZED_EXT):
+            return "IMAGE_LAYOUT_ZERO_INITIALIZED_EXT";
+        default:
+            return std::string("UNKNOWN_VkImageLayout_value") + std::to_string(value);
+    }
+}
+std::string VkImageTilingString(VkImageTiling value) {
+    switch (value) {
+        case (VK_IMAGE_TILING_OPTIMAL):
+            return "IMAGE_TILING_OPTIMAL";
+        case (VK_IMAGE_TILING_LINEAR):
+            return "IMAGE_TILING_LINEAR";
+        case (VK_IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT):
+            return "IMAGE_TILING_DRM_FORMAT_MODIFIER_EXT";
+        default:
+            return std::string("UNKNOWN_VkImageTiling_value") + std::to_string(value);
+    }
+}
+std::string VkImageTypeString(VkImageType value) {
+    switch (value) {
+        case (VK_IMAGE_TYPE_1D):
+            return "IMAGE_TYPE_1D";
+        case (VK_IMAGE_TYPE_2D):
+            return "IMAGE_TYPE_2D";
+        case (VK_IMAGE_TYPE_3D):
+            return "IMAGE_TYPE_3D";
+        default:
+            return std::string("UNKNOWN_VkImageType_value") + std::to_string(value);
+    }
+}
+std::string VkPhysicalDeviceLayeredApiKHRString(VkPhysicalDeviceLayeredApiKHR value) {
+    switch (value) {
+        case (VK_PHYSICAL_DEVICE_LAYERED_API_VULKAN_KHR):
+            return "PHYSICAL_DEVICE_LAYERED_API_VULKAN_KHR";
+        case (VK_PHYSICAL_DEVICE_LAYERED_API_D3D12_KHR):
+            return "PHYSICAL_DEVICE_LAYERED_API_D3D12_KHR";
+        case (VK_PHYSICAL_DEVICE_LAYERED_API_METAL_KHR):
+            return "PHYSICAL_DEVICE_LAYERED_API_METAL_KHR";
+        case (VK_PHYSICAL_DEVICE_LAYERED_API_OPENGL_KHR):
+            return "PHYSICAL_DEVICE_LAYERED_API_OPENGL_KHR";
+        case (VK_PHYSICAL_DEVICE_LAYERED_API_OPENGLES_KHR):
+            return "PHYSICAL_DEVICE_LAYERED_API_OPENGLES_KHR";
+        default:
+            return std::string("UNKNOWN_VkPhysicalDeviceLayeredApiKHR_value") + std::to_string(value);
+    }
+}
+std::string VkPhysicalDeviceTypeString(VkPhysicalDeviceType value) {
+    switch (value) {
+        case (VK_PHYSICAL_DEVICE_TYPE_OTHER):
+            return "PHYSICAL_DEVICE_TYPE_OTHER";
+        case (VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU):
+            return "PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU";
+        case (VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU):
+            return "PHYSICAL_DEVICE_TYPE_DISCRETE_GPU";
+        case (VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU):
+            return "PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU";
+        case (VK_PHYSICAL_DEVICE_TYPE_CPU):
+            return "PHYSICAL_DEVICE_TYPE_CPU";
+        default:
+            return std::string("UNKNOWN_VkPhysicalDeviceType_value") + std::to_string(value);
+    }
+}
+std::string VkPipelineRobustnessBufferBehaviorString(VkPipelineRobustnessBufferBehavior value) {
+    switch (value) {
+        case (VK_PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_DEVICE_DEFAULT):
+            return "PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_DEVICE_DEFAULT";
+        case (VK_PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_DISABLED):
+            return "PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_DISABLED";
+        case (VK_PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_ROBUST_BUFFER_ACCESS):
+            return "PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_ROBUST_BUFFER_ACCESS";
+        case (VK_PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_ROBUST_BUFFER_ACCESS_2):
+            return "PIPELINE_ROBUSTNESS_BUFFER_BEHAVIOR_ROBUST_BUFFER_ACCESS_2";
+        default:
+            return std::string("UNKNOWN_VkPipelineRobustnessBufferBehavior_value") + std::to_string(value);
+    }
+}
+std::string VkPipelineRobustnessImageBehaviorString(VkPipelineRobustnessImageBehavior value) {
+    switch (value) {
+        case (VK_PIPELINE_ROBUSTNESS_IMAGE_BEHAVIOR_DEVICE_DEFAULT):
+            return "PIPELINE_ROBUSTNESS_IMAGE_BEHAVIOR_DEVICE_DEFAULT";
+        case (VK_PIPELINE_ROBUSTNESS_IMAGE_BEHAVIOR_DISABLED):
+            return "PIPELINE_ROBUSTNESS_IMAGE_BEHAVIOR_DISABLED";
+        case (VK_PIPELINE_ROBUSTNESS_IMAGE_BEHAVIOR_ROBUST_IMAGE_ACCESS):
+            return "PIPELINE_ROBUSTNESS_IMAGE_BEHAVIOR_ROBUST_IMAGE_ACCESS";
+        case (VK_PIPELINE_ROBUSTNESS_IMAGE_BEHAVIOR_ROBUST_IMAGE_ACCESS_2):
+            return "PIPELINE_ROBUSTNESS_IMAGE_BEHAVIOR_ROBUST_IMAGE_ACCESS_2";
+        default:
+            return std::string("UNKNOWN_VkPipelineRobustnessImageBehavior_value") + std::to_string(value);
+    }
+}
+std::string VkPointClippingBehaviorString(VkPointClippingBehavior value) {
+    switch (value) {
+        case (VK_POINT_CLIPPING_BEHAVIOR_ALL_CLIP_PLANES):
+            return "POINT_CLIPPING_BEHAVIOR_ALL_CLIP_PLANES";
+        case (VK_POINT_CLIPPING_BEHAVIOR_USER_CLIP_PLANES_ONLY):
+            return "POINT_CLIPPING_BEHAVIOR_USER_CLIP_PLANES_ONLY";
+        default:
+            return std::string("UNKNOWN_VkPointClippingBehavior_value") + std::to_string(value);
+    }
+}
+std::string VkPresentModeKHRString(VkPresentModeKHR value) {
+    switch (value) {
+        case (VK_PRESENT_MODE_IMMEDIATE_KHR):
+            return "PRESENT_MODE_IMMEDIATE_KHR";
+        case (VK_PRESENT_MODE_MAILBOX_KHR):
+            return "PRESENT_MODE_MAILBOX_KHR";
+        case (VK_PRESENT_MODE_FIFO_KHR):
+            return "PRESENT_MODE_FIFO_KHR";
+        case (VK_PRESENT_MODE_FIFO_RELAXED_KHR):
+            return "PRESENT_MODE_FIFO_RELAXED_KHR";
+        case (VK_PRESENT_MODE_SHARED_DEMAND_REFRESH_KHR):
+            return "PRESENT_MODE_SHARED_DEMAND_REFRESH_KHR";
+        case (VK_PRESENT_MODE_SHARED_CONTINUOUS_REFRESH_KHR):
+            return "PRESENT_MODE_SHARED_CONTINUOUS_REFRESH_KHR";
+        case (VK_PRESENT_MODE_FIFO_LATEST_READY_KHR):
+            return "PRESENT_MODE_FIFO_LATEST_READY_KHR";
+        default:
+            return std::string("UNKNOWN_VkPresentModeKHR_value") + std::to_string(value);
+    }
+}
+std::string VkQueueGlobalPriorityString(VkQueueGlobalPriority value) {
+    switch (value) {
+        case (VK_QUEUE_GLOBAL_PRIORITY_LOW):
+            return "QUEUE_GLOBAL_PRIORITY_LOW";
+        case (VK_QUEUE_GLOBAL_PRIORITY_MEDIUM):
+            return "QUEUE_GLOBAL_PRIORITY_MEDIUM";
+        case (VK_QUEUE_GLOBAL_PRIORITY_HIGH):
+            return "QUEUE_GLOBAL_PRIORITY_HIGH";
+        case (VK_QUEUE_GLOBAL_PRIORITY_REALTIME):
+            return "QUEUE_GLOBAL_PRIORITY_REALTIME";
+        default:
+            return std::string("UNKNOWN_VkQueueGlobalPriority_value") + std::to_string(value);
+    }
+}
+std::string VkRayTracingInvocationReorderModeEXTString(VkRayTracingInvocationReorderModeEXT value) {
+    switch (value) {
+        case (VK_RAY_TRACING_INVOCATION_REORDER_MODE_NONE_EXT):
+            return "RAY_TRACING_INVOCATION_REORDER_MODE_NONE_EXT";
+        case (VK_RAY_TRACING_INVOCATION_REORDER_MODE_REORDER_EXT):
+            return "RAY_TRACING_INVOCATION_REORDER_MODE_REORDER_EXT";
+        default:
+            return std::string("UNKNOWN_VkRayTracingInvocationReorderModeEXT_value") + std::to_string(value);
+    }
+}
+std::string VkResultString(VkResult value) {
+    switch (value) {
+        case (VK_SUCCESS):
+            return "SUCCESS";
+        case (VK_NOT_READY):
+            return "NOT_READY";
+        case (VK_TIMEOUT):
+            return "TIMEOUT";
+        case (VK_EVENT_SET):
+            return "EVENT_SET";
+        case (VK_EVENT_RESET):
+            return "EVENT_RESET";
+        case (VK_INCOMPLETE):
+            return "INCOMPLETE";
+        case (VK_ERROR_OUT_OF_HOST_MEMORY):
+            return "ERROR_OUT_OF_HOST_MEMORY";
+        case (VK_ERROR_OUT_OF_DEVICE_MEMORY):
+            return "ERROR_OUT_OF_DEVICE_MEMORY";
+        case (VK_ERROR_INITIALIZATION_FAILED):
+            return "ERROR_INITIALIZATION_FAILED";
+        case (VK_ERROR_DEVICE_LOST):
+            return "ERROR_DEVICE_LOST";
+        case (VK_ERROR_MEMORY_MAP_FAILED):
+            return "ERROR_MEMORY_MAP_FAILED";
+        case (VK_ERROR_LAYER_NOT_PRESENT):
+            return "ERROR_LAYER_NOT_PRESENT";
+        case (VK_ERROR_EXTENSION_NOT_PRESENT):
+            return "ERROR_EXTENSION_NOT_PRESENT";
+        case (VK_ERROR_FEATURE_NOT_PRESENT):
+            return "ERROR_FEATURE_NOT_PRESENT";
+        case (VK_ERROR_INCOMPATIBLE_DRIVER):
+            return "ERROR_INCOMPATIBLE_DRIVER";
+        case (VK_ERROR_TOO_MANY_OBJECTS):
+            return "ERROR_TOO_MANY_OBJECTS";
+        case (VK_ERROR_FORMAT_NOT_SUPPORTED):
+            return "ERROR_FORMAT_NOT_SUPPORTED";
+        case (VK_ERROR_FRAGMENTED_POOL):
+            return "ERROR_FRAGMENTED_POOL";
+        case (VK_ERROR_UNKNOWN):
+            return "ERROR_UNKNOWN";
+        case (VK_ERROR_VALIDATION_FAILED):
+            return "ERROR_VALIDATION_FAILED";
+        case (VK_ERROR_OUT_OF_POOL_MEMORY):
+            return "ERROR_OUT_OF_POOL_MEMORY";
+        case (VK_ERROR_INVALID_EXTERNAL_HANDLE):
+            return "ERROR_INVALID_EXTERNAL_HANDLE";
+        case (VK_ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS):
+            return "ERROR_INVALID_OPAQUE_CAPTURE_ADDRESS";
+        case (VK_ERROR_FRAGMENTATION):
+            return "ERROR_FRAGMENTATION";
+        case (VK_PIPELINE_COMPILE_REQUIRED):
+            return "PIPELINE_COMPILE_REQUIRED";
+        case (VK_ERROR_NOT_PERMITTED):
+            return "ERROR_NOT_PERMITTED";
+        case (VK_ERROR_SURFACE_LOST_KHR):
+            return "ERROR_SURFACE_LOST_KHR";
+        case (VK_ERROR_NATIVE_WINDOW_IN_USE_KHR):
+            return "ERROR_NATIVE_WINDOW_IN_USE_KHR";
+        case (VK_SUBOPTIMAL_KHR):
+            return "SUBOPTIMAL_KHR";
+        case (VK_ERROR_OUT_OF_DATE_KHR):
+            return "ERROR_OUT_OF_DATE_KHR";
+        case (VK_ERROR_INCOMPATIBLE_DISPLAY_KHR):
+            return "ERROR_INCOMPATIBLE_DISPLAY_KHR";
+        case (VK_ERROR_INVALID_SHADER_NV):
+            return "ERROR_INVALID_SHADER_NV";
+        case (VK_ERROR_IMAGE_USAGE_NOT_SUPPORTED_KHR):
+            return "ERROR_IMAGE_USAGE_NOT_SUPPORTED_KHR";
+        case (VK_ERROR_VIDEO_PICTURE_LAYOUT_NOT_SUPPORTED_KHR):
+            return "ERROR_VIDEO_PICTURE_LAYOUT_NOT_SUPPORTED_KHR";
+        case (VK_ERROR_VIDEO_PROFILE_OPERATION_NOT_SUPPORTED_KHR):
+            return "ERROR_VIDEO_PROFILE_OPERATION_NOT_SUPPORTED_KHR";
+        case (VK_ERROR_VIDEO_PROFILE_FORMAT_NOT_SUPPORTED_KHR):
+            return "ERROR_VIDEO_PROFILE_FORMAT_NOT_SUPPORTED_KHR";
+        case (VK_ERROR_VIDEO_PROFILE_CODEC_NOT_SUPPORTED_KHR):
+            return "ERROR_VIDEO_PROFILE_CODEC_NOT_SUPPORTED_KHR";
+        case (VK_ERROR_VIDEO_STD_VERSION_NOT_SUPPORTED_KHR):
+            return "ERROR_VIDEO_STD_VERSION_NOT_SUPPORTED_KHR";
+        case (VK_ERROR_INVALID_DRM_FORMAT_MODIFIER_PLANE_LAYOUT_EXT):
+            return "ERROR_INVALID_DRM_FORMAT_MODIFIER_PLANE_LAYOUT_EXT";
+        case (VK_ERROR_PRESENT_TIMING_QUEUE_FULL_EXT):
+            return "ERROR_PRESENT_TIMING_QUEUE_FULL_EXT";
+        case (VK_ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT):
+            return "ERROR_FULL_SCREEN_EXCLUSIVE_MODE_LOST_EXT";
+        case (VK_THREAD_IDLE_KHR):
+            return "THREAD_IDLE_KHR";
+        case (VK_THREAD_DONE_KHR):
+            return "THREAD_DONE_KHR";
+        case (VK_OPERATION_DEFERRED_KHR):
+            return "OPERATION_DEFERRED_KHR";
+        case (VK_OPERATION_NOT_DEFERRED_KHR):
+            return "OPERATION_NOT_DEFERRED_KHR";
+        case (VK_ERROR_INVALID_VIDEO_STD_PARAMETERS_KHR):
+            return "ERROR_INVALID_VIDEO_STD_PARAMETERS_KHR";
+        case (VK_ERROR_COMPRESSION_EXHAUSTED_EXT):
+            return "ERROR_COMPRESSION_EXHAUSTED_EXT";
+        case (VK_INCOMPATIBLE_SHADER_BINARY_EXT):
+            return "INCOMPATIBLE_SHADER_BINARY_EXT";
+        case (VK_PIPELINE_BINARY_MISSING_KHR):
+            return "PIPELINE_BINARY_MISSING_KHR";
+        case (VK_ERROR_NOT_ENOUGH_SPACE_KHR):
+            return "ERROR_NOT_ENOUGH_SPACE_KHR";
+        default:
+            return std::string("UNKNOWN_VkResult_value") + std::to_string(value);
+    }
+}
+std::string VkScopeKHRString(VkScopeKHR value) {
+    switch (value) {
+        case (VK_SCOPE_DEVICE_KHR):
+            return "SCOPE_DEVICE_KHR";
+        case (VK_SCOPE_WORKGROUP_KHR):
+            return "SCOPE_WORKGROUP_KHR";
+        case (VK_SCOPE_SUBGROUP_KHR):
+            return "SCOPE_SUBGROUP_KHR";
+        case (VK_SCOPE_QUEUE_FAMILY_KHR):
+            return "SCOPE_QUEUE_FAMILY_KHR";
+        default:
+            return std::string("UNKNOWN_VkScopeKHR_value") + std::to_string(value);
+    }
+}
+std::string VkShaderFloatControlsIndependenceString(VkShaderFloatControlsIndependence value) {
+    switch (value) {
+        case (VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY):
+            return "SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY";
+        case (VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL):
+            return "SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL";
+        case (VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE):
+            return "SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE";
+        default:
+            return std::string("UNKNOWN_VkShaderFloatControlsIndependence_value") + std::to_string(value);
+    }
+}
+std::string VkTimeDomainKHRString(VkTimeDomainKHR value) {
+    switch (value) {
+        case (VK_TIME_DOMAIN_DEVICE_KHR):
+            return "TIME_DOMAIN_DEVICE_KHR";
+        case (VK_TIME_DOMAIN_CLOCK_MONOTONIC_KHR):
+            return "TIME_DOMAIN_CLOCK_MONOTONIC_KHR";
+        case (VK_TIME_DOMAIN_CLOCK_MONOTONIC_RAW_KHR):
+            return "TIME_DOMAIN_CLOCK_MONOTONIC_RAW_KHR";
+        case (VK_TIME_DOMAIN_QUERY_PERFORMANCE_COUNTER_KHR):
+            return "TIME_DOMAIN_QUERY_PERFORMANCE_COUNTER_KHR";
+        case (VK_TIME_DOMAIN_PRESENT_STAGE_LOCAL_EXT):
+            return "TIME_DOMAIN_PRESENT_STAGE_LOCAL_EXT";
+        case (VK_TIME_DOMAIN_SWAPCHAIN_LOCAL_EXT):
+            return "TIME_DOMAIN_SWAPCHAIN_LOCAL_EXT";
+        default:
+            return std::string("UNKNOWN_VkTimeDomainKHR_value") + std::to_string(value);
+    }
+}
+std::string VkVideoEncodeTuningModeKHRString(VkVideoEncodeTuningModeKHR value) {
+    switch (value) {
+        case (VK_VIDEO_ENCODE_TUNING_MODE_DEFAULT_KHR):
+            return "VIDEO_ENCODE_TUNING_MODE_DEFAULT_KHR";
+        case (VK_VIDEO_ENCODE_TUNING_MODE_HIGH_QUALITY_KHR):
+            return "VIDEO_ENCODE_TUNING_MODE_HIGH_QUALITY_KHR";
+        case (VK_VIDEO_ENCODE_TUNING_MODE_LOW_LATENCY_KHR):
+            return "VIDEO_ENCODE_TUNING_MODE_LOW_LATENCY_KHR";
+        case (VK_VIDEO_ENCODE_TUNING_MODE_ULTRA_LOW_LATENCY_KHR):
+            return "VIDEO_ENCODE_TUNING_MODE_ULTRA_LOW_LATENCY_KHR";
+        case (VK_VIDEO_ENCODE_TUNING_MODE_LOSSLESS_KHR):
+            return "VIDEO_ENCODE_TUNING_MODE_LOSSLESS_KHR";
+        default:
+            return std::string("UNKNOWN_VkVideoEncodeTuningModeKHR_value") + std::to_string(value);
+    }
+}
+struct phys_device_props2_chain {
+    phys_device_props2_chain() = default;
+    phys_device_props2_chain(const phys_device_props2_chain &) = delete;
+    phys_device_props2_chain &operator=(const phys_device_props2_chain &) = delete;
+    phys_device_props2_chain(phys_device_props2_chain &&) = delete;
+    phys_device_props2_chain &operator=(phys_device_props2_chain &&) = delete;
+    void *start_of_chain = nullptr;
+    ChainArena arena;
+    VkPhysicalDeviceAccelerationStructurePropertiesKHR *PhysicalDeviceAccelerationStructurePropertiesKHR{};
+    VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT *PhysicalDeviceBlendOperationAdvancedPropertiesEXT{};
+    VkPhysicalDeviceComputeShaderDerivativesPropertiesKHR *PhysicalDeviceComputeShaderDerivativesPropertiesKHR{};
+    VkPhysicalDeviceConservativeRasterizationPropertiesEXT *PhysicalDeviceConservativeRasterizationPropertiesEXT{};
+    VkPhysicalDeviceCooperativeMatrixPropertiesKHR *PhysicalDeviceCooperativeMatrixPropertiesKHR{};
+    VkPhysicalDeviceCopyMemoryIndirectPropertiesKHR *PhysicalDeviceCopyMemoryIndirectPropertiesKHR{};
+    VkPhysicalDeviceCustomBorderColorPropertiesEXT *PhysicalDeviceCustomBorderColorPropertiesEXT{};
+    VkPhysicalDeviceDepthStencilResolveProperties *PhysicalDeviceDepthStencilResolveProperties{};
+    VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT *PhysicalDeviceDescriptorBufferDensityMapPropertiesEXT{};
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT *PhysicalDeviceDescriptorBufferPropertiesEXT{};
+    VkPhysicalDeviceDescriptorHeapPropertiesEXT *PhysicalDeviceDescriptorHeapPropertiesEXT{};
+    VkPhysicalDeviceDescriptorHeapTensorPropertiesARM *PhysicalDeviceDescriptorHeapTensorPropertiesARM{};
+    VkPhysicalDeviceDescriptorIndexingProperties *PhysicalDeviceDescriptorIndexingProperties{};
+    VkPhysicalDeviceDeviceGeneratedCommandsPropertiesEXT *PhysicalDeviceDeviceGeneratedCommandsPropertiesEXT{};
+    VkPhysicalDeviceDiscardRectanglePropertiesEXT *PhysicalDeviceDiscardRectanglePropertiesEXT{};
+    VkPhysicalDeviceDriverProperties *PhysicalDeviceDriverProperties{};
+    VkPhysicalDeviceDrmPropertiesEXT *PhysicalDeviceDrmPropertiesEXT{};
+    VkPhysicalDeviceExtendedDynamicState3PropertiesEXT *PhysicalDeviceExtendedDynamicState3PropertiesEXT{};
+    VkPhysicalDeviceExternalMemoryHostPropertiesEXT *PhysicalDeviceExternalMemoryHostPropertiesEXT{};
+    VkPhysicalDeviceFaultPropertiesKHR *PhysicalDeviceFaultPropertiesKHR{};
+    VkPhysicalDeviceFloatControlsProperties *PhysicalDeviceFloatControlsProperties{};
+    VkPhysicalDeviceFragmentDensityMap2PropertiesEXT *PhysicalDeviceFragmentDensityMap2PropertiesEXT{};
+    VkPhysicalDeviceFragmentDensityMapOffsetPropertiesEXT *PhysicalDeviceFragmentDensityMapOffsetPropertiesEXT{};
+    VkPhysicalDeviceFragmentDensityMapPropertiesEXT *PhysicalDeviceFragmentDensityMapPropertiesEXT{};
+    VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR *PhysicalDeviceFragmentShaderBarycentricPropertiesKHR{};
+    VkPhysicalDeviceFragmentShadingRatePropertiesKHR *PhysicalDeviceFragmentShadingRatePropertiesKHR{};
+    VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT *PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT{};
+    VkPhysicalDeviceHostImageCopyProperties *PhysicalDeviceHostImageCopyProperties{};
+    std::vector<VkImageLayout> VkPhysicalDeviceHostImageCopyProperties_pCopySrcLayouts;
+    std::vector<VkImageLayout> VkPhysicalDeviceHostImageCopyProperties_pCopyDstLayouts;
+    VkPhysicalDeviceIDProperties *PhysicalDeviceIDProperties{};
+    VkPhysicalDeviceInlineUniformBlockProperties *PhysicalDeviceInlineUniformBlockProperties{};
+    VkPhysicalDeviceLayeredApiPropertiesListKHR *PhysicalDeviceLayeredApiPropertiesListKHR{};
+    std::vector<VkPhysicalDeviceLayeredApiPropertiesKHR> VkPhysicalDeviceLayeredApiPropertiesListKHR_pLayeredApis;
+    VkPhysicalDeviceLegacyVertexAttributesPropertiesEXT *PhysicalDeviceLegacyVertexAttributesPropertiesEXT{};
+    VkPhysicalDeviceLineRasterizationProperties *PhysicalDeviceLineRasterizationProperties{};
+    VkPhysicalDeviceMaintenance10PropertiesKHR *PhysicalDeviceMaintenance10PropertiesKHR{};
+    VkPhysicalDeviceMaintenance3Properties *PhysicalDeviceMaintenance3Properties{};
+    VkPhysicalDeviceMaintenance4Properties *PhysicalDeviceMaintenance4Properties{};
+    VkPhysicalDeviceMaintenance5Properties *PhysicalDeviceMaintenance5Properties{};
+    VkPhysicalDeviceMaintenance6Properties *PhysicalDeviceMaintenance6Properties{};
+    VkPhysicalDeviceMaintenance7PropertiesKHR *PhysicalDeviceMaintenance7PropertiesKHR{};
+    VkPhysicalDeviceMaintenance9PropertiesKHR *PhysicalDeviceMaintenance9PropertiesKHR{};
+    VkPhysicalDeviceMapMemoryPlacedPropertiesEXT *PhysicalDeviceMapMemoryPlacedPropertiesEXT{};
+    VkPhysicalDeviceMemoryDecompressionPropertiesEXT *PhysicalDeviceMemoryDecompressionPropertiesEXT{};
+    VkPhysicalDeviceMeshShaderPropertiesEXT *PhysicalDeviceMeshShaderPropertiesEXT{};
+    VkPhysicalDeviceMultiDrawPropertiesEXT *PhysicalDeviceMultiDrawPropertiesEXT{};
+    VkPhysicalDeviceMultiviewProperties *PhysicalDeviceMultiviewProperties{};
+    VkPhysicalDeviceNestedCommandBufferPropertiesEXT *PhysicalDeviceNestedCommandBufferPropertiesEXT{};
+    VkPhysicalDeviceOpacityMicromapPropertiesEXT *PhysicalDeviceOpacityMicromapPropertiesEXT{};
+    VkPhysicalDeviceOpacityMicromapPropertiesKHR *PhysicalDeviceOpacityMicromapPropertiesKHR{};
+    VkPhysicalDevicePCIBusInfoPropertiesEXT *PhysicalDevicePCIBusInfoPropertiesEXT{};
+    VkPhysicalDevicePerformanceQueryPropertiesKHR *PhysicalDevicePerformanceQueryPropertiesKHR{};
+    VkPhysicalDevicePipelineBinaryPropertiesKHR *PhysicalDevicePipelineBinaryPropertiesKHR{};
+    VkPhysicalDevicePipelineRobustnessProperties *PhysicalDevicePipelineRobustnessProperties{};
+    VkPhysicalDevicePointClippingProperties *PhysicalDevicePointClippingProperties{};
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    VkPhysicalDevicePortabilitySubsetPropertiesKHR *PhysicalDevicePortabilitySubsetPropertiesKHR{};
+#endif  // VK_ENABLE_BETA_EXTENSIONS
+    VkPhysicalDeviceProtectedMemoryProperties *PhysicalDeviceProtectedMemoryProperties{};
+    VkPhysicalDeviceProvokingVertexPropertiesEXT *PhysicalDeviceProvokingVertexPropertiesEXT{};
+    VkPhysicalDevicePushDescriptorProperties *PhysicalDevicePushDescriptorProperties{};
+    VkPhysicalDeviceRayTracingInvocationReorderPropertiesEXT *PhysicalDeviceRayTracingInvocationReorderPropertiesEXT{};
+    VkPhysicalDeviceRayTracingPipelinePropertiesKHR *PhysicalDeviceRayTracingPipelinePropertiesKHR{};
+    VkPhysicalDeviceRobustness2PropertiesKHR *PhysicalDeviceRobustness2PropertiesKHR{};
+    VkPhysicalDeviceSampleLocationsPropertiesEXT *PhysicalDeviceSampleLocationsPropertiesEXT{};
+    VkPhysicalDeviceSamplerFilterMinmaxProperties *PhysicalDeviceSamplerFilterMinmaxProperties{};
+    VkPhysicalDeviceShaderAbortPropertiesKHR *PhysicalDeviceShaderAbortPropertiesKHR{};
+    VkPhysicalDeviceShaderIntegerDotProductProperties *PhysicalDeviceShaderIntegerDotProductProperties{};
+    VkPhysicalDeviceShaderLongVectorPropertiesEXT *PhysicalDeviceShaderLongVectorPropertiesEXT{};
+    VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT *PhysicalDeviceShaderModuleIdentifierPropertiesEXT{};
+    VkPhysicalDeviceShaderObjectPropertiesEXT *PhysicalDeviceShaderObjectPropertiesEXT{};
+    VkPhysicalDeviceShaderSplitBarrierPropertiesEXT *PhysicalDeviceShaderSplitBarrierPropertiesEXT{};
+    VkPhysicalDeviceShaderTileImagePropertiesEXT *PhysicalDeviceShaderTileImagePropertiesEXT{};
+    VkPhysicalDeviceSubgroupProperties *PhysicalDeviceSubgroupProperties{};
+    VkPhysicalDeviceSubgroupSizeControlProperties *PhysicalDeviceSubgroupSizeControlProperties{};
+    VkPhysicalDeviceTexelBufferAlignmentProperties *PhysicalDeviceTexelBufferAlignmentProperties{};
+    VkPhysicalDeviceTimelineSemaphoreProperties *PhysicalDeviceTimelineSemaphoreProperties{};
+    VkPhysicalDeviceTransformFeedbackPropertiesEXT *PhysicalDeviceTransformFeedbackPropertiesEXT{};
+    VkPhysicalDeviceVertexAttributeDivisorProperties *PhysicalDeviceVertexAttributeDivisorProperties{};
+    VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT *PhysicalDeviceVertexAttributeDivisorPropertiesEXT{};
+    VkPhysicalDeviceVulkan11Properties *PhysicalDeviceVulkan11Properties{};
+    VkPhysicalDeviceVulkan12Properties *PhysicalDeviceVulkan12Properties{};
+    VkPhysicalDeviceVulkan13Properties *PhysicalDeviceVulkan13Properties{};
+    VkPhysicalDeviceVulkan14Properties *PhysicalDeviceVulkan14Properties{};
+    std::vector<VkImageLayout> VkPhysicalDeviceVulkan14Properties_pCopySrcLayouts;
+    std::vector<VkImageLayout> VkPhysicalDeviceVulkan14Properties_pCopyDstLayouts;
+    void initialize_chain(AppInstance &inst, AppGpu &gpu, bool show_promoted_structs) noexcept {
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_acceleration_structure))
+            arena.Add(PhysicalDeviceAccelerationStructurePropertiesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_blend_operation_advanced))
+            arena.Add(PhysicalDeviceBlendOperationAdvancedPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_compute_shader_derivatives))
+            arena.Add(PhysicalDeviceComputeShaderDerivativesPropertiesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_conservative_rasterization))
+            arena.Add(PhysicalDeviceConservativeRasterizationPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_cooperative_matrix))
+            arena.Add(PhysicalDeviceCooperativeMatrixPropertiesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_copy_memory_indirect) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::NV_copy_memory_indirect))
+            arena.Add(PhysicalDeviceCopyMemoryIndirectPropertiesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COPY_MEMORY_INDIRECT_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_custom_border_color))
+            arena.Add(PhysicalDeviceCustomBorderColorPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_depth_stencil_resolve)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceDepthStencilResolveProperties,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_descriptor_buffer))
+            arena.Add(PhysicalDeviceDescriptorBufferDensityMapPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_DENSITY_MAP_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_descriptor_buffer))
+            arena.Add(PhysicalDeviceDescriptorBufferPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_descriptor_heap))
+            arena.Add(PhysicalDeviceDescriptorHeapPropertiesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_HEAP_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_descriptor_heap))
+            arena.Add(PhysicalDeviceDescriptorHeapTensorPropertiesARM,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_HEAP_TENSOR_PROPERTIES_ARM);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_descriptor_indexing)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceDescriptorIndexingProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_device_generated_commands))
+            arena.Add(PhysicalDeviceDeviceGeneratedCommandsPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_discard_rectangles))
+            arena.Add(PhysicalDeviceDiscardRectanglePropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_driver_properties)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceDriverProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_physical_device_drm))
+            arena.Add(PhysicalDeviceDrmPropertiesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_extended_dynamic_state3))
+            arena.Add(PhysicalDeviceExtendedDynamicState3PropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_external_memory_host))
+            arena.Add(PhysicalDeviceExternalMemoryHostPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_device_fault))
+            arena.Add(PhysicalDeviceFaultPropertiesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_PROPERTIES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_float_controls)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceFloatControlsProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_fragment_density_map2))
+            arena.Add(PhysicalDeviceFragmentDensityMap2PropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::QCOM_fragment_density_map_offset) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_fragment_density_map_offset))
+            arena.Add(PhysicalDeviceFragmentDensityMapOffsetPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_fragment_density_map))
+            arena.Add(PhysicalDeviceFragmentDensityMapPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_fragment_shader_barycentric))
+            arena.Add(PhysicalDeviceFragmentShaderBarycentricPropertiesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_fragment_shading_rate))
+            arena.Add(PhysicalDeviceFragmentShadingRatePropertiesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_graphics_pipeline_library))
+            arena.Add(PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_host_image_copy)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceHostImageCopyProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES);
+        if ((inst.CheckExtensionEnabled(AppExtension::KHR_external_memory_capabilities) ||
+             inst.CheckExtensionEnabled(AppExtension::KHR_external_semaphore_capabilities) ||
+             inst.CheckExtensionEnabled(AppExtension::KHR_external_fence_capabilities)) &&
+            (gpu.api_version < VK_API_VERSION_1_1 || show_promoted_structs))
+            arena.Add(PhysicalDeviceIDProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_inline_uniform_block)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceInlineUniformBlockProperties,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance7))
+            arena.Add(PhysicalDeviceLayeredApiPropertiesListKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LAYERED_API_PROPERTIES_LIST_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_legacy_vertex_attributes))
+            arena.Add(PhysicalDeviceLegacyVertexAttributesPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LEGACY_VERTEX_ATTRIBUTES_PROPERTIES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_line_rasterization) ||
+             gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_line_rasterization)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceLineRasterizationProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance10))
+            arena.Add(PhysicalDeviceMaintenance10PropertiesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_10_PROPERTIES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance3)) &&
+            (gpu.api_version < VK_API_VERSION_1_1 || show_promoted_structs))
+            arena.Add(PhysicalDeviceMaintenance3Properties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance4)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceMaintenance4Properties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance5)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceMaintenance5Properties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_5_PROPERTIES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance6)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceMaintenance6Properties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_6_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance7))
+            arena.Add(PhysicalDeviceMaintenance7PropertiesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_7_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance9))
+            arena.Add(PhysicalDeviceMaintenance9PropertiesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_9_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_map_memory_placed))
+            arena.Add(PhysicalDeviceMapMemoryPlacedPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAP_MEMORY_PLACED_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::NV_memory_decompression) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_memory_decompression))
+            arena.Add(PhysicalDeviceMemoryDecompressionPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_mesh_shader))
+            arena.Add(PhysicalDeviceMeshShaderPropertiesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_multi_draw))
+            arena.Add(PhysicalDeviceMultiDrawPropertiesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_multiview)) &&
+            (gpu.api_version < VK_API_VERSION_1_1 || show_promoted_structs))
+            arena.Add(PhysicalDeviceMultiviewProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_nested_command_buffer))
+            arena.Add(PhysicalDeviceNestedCommandBufferPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_NESTED_COMMAND_BUFFER_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_opacity_micromap))
+            arena.Add(PhysicalDeviceOpacityMicromapPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_opacity_micromap))
+            arena.Add(PhysicalDeviceOpacityMicromapPropertiesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_pci_bus_info))
+            arena.Add(PhysicalDevicePCIBusInfoPropertiesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_performance_query))
+            arena.Add(PhysicalDevicePerformanceQueryPropertiesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_pipeline_binary))
+            arena.Add(PhysicalDevicePipelineBinaryPropertiesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_BINARY_PROPERTIES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_pipeline_robustness)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDevicePipelineRobustnessProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_PROPERTIES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance2)) &&
+            (gpu.api_version < VK_API_VERSION_1_1 || show_promoted_structs))
+            arena.Add(PhysicalDevicePointClippingProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_portability_subset))
+            arena.Add(PhysicalDevicePortabilitySubsetPropertiesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR);
+#endif  // VK_ENABLE_BETA_EXTENSIONS
+        if (gpu.api_version == VK_API_VERSION_1_1 || show_promoted_structs)
+            arena.Add(PhysicalDeviceProtectedMemoryProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_provoking_vertex))
+            arena.Add(PhysicalDeviceProvokingVertexPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_push_descriptor)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDevicePushDescriptorProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_ray_tracing_invocation_reorder))
+            arena.Add(PhysicalDeviceRayTracingInvocationReorderPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_ray_tracing_pipeline))
+            arena.Add(PhysicalDeviceRayTracingPipelinePropertiesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_robustness2) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_robustness2))
+            arena.Add(PhysicalDeviceRobustness2PropertiesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_sample_locations))
+            arena.Add(PhysicalDeviceSampleLocationsPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_sampler_filter_minmax)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceSamplerFilterMinmaxProperties,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_abort))
+            arena.Add(PhysicalDeviceShaderAbortPropertiesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ABORT_PROPERTIES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_integer_dot_product)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceShaderIntegerDotProductProperties,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_long_vector))
+            arena.Add(PhysicalDeviceShaderLongVectorPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_LONG_VECTOR_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_module_identifier))
+            arena.Add(PhysicalDeviceShaderModuleIdentifierPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_object))
+            arena.Add(PhysicalDeviceShaderObjectPropertiesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_split_barrier))
+            arena.Add(PhysicalDeviceShaderSplitBarrierPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SPLIT_BARRIER_PROPERTIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_tile_image))
+            arena.Add(PhysicalDeviceShaderTileImagePropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TILE_IMAGE_PROPERTIES_EXT);
+        if (gpu.api_version == VK_API_VERSION_1_1 || show_promoted_structs)
+            arena.Add(PhysicalDeviceSubgroupProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_subgroup_size_control)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceSubgroupSizeControlProperties,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_texel_buffer_alignment)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceTexelBufferAlignmentProperties,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_timeline_semaphore)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceTimelineSemaphoreProperties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_transform_feedback))
+            arena.Add(PhysicalDeviceTransformFeedbackPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_vertex_attribute_divisor)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceVertexAttributeDivisorProperties,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_vertex_attribute_divisor))
+            arena.Add(PhysicalDeviceVertexAttributeDivisorPropertiesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT);
+        if ((gpu.api_version >= VK_API_VERSION_1_2))
+            arena.Add(PhysicalDeviceVulkan11Properties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES);
+        if ((gpu.api_version >= VK_API_VERSION_1_2))
+            arena.Add(PhysicalDeviceVulkan12Properties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES);
+        if ((gpu.api_version >= VK_API_VERSION_1_3))
+            arena.Add(PhysicalDeviceVulkan13Properties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES);
+        if ((gpu.api_version >= VK_API_VERSION_1_4))
+            arena.Add(PhysicalDeviceVulkan14Properties, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_4_PROPERTIES);
+
+        start_of_chain = arena.Allocate();
+    }
+};
+void setup_phys_device_props2_chain(VkPhysicalDeviceProperties2 &start, std::unique_ptr<phys_device_props2_chain> &chain,
+                                    AppInstance &inst, AppGpu &gpu, bool show_promoted_structs) {
+    chain = std::unique_ptr<phys_device_props2_chain>(new phys_device_props2_chain());
+    chain->initialize_chain(inst, gpu, show_promoted_structs);
+    start.pNext = chain->start_of_chain;
+};
+
+bool prepare_phys_device_props2_twocall_chain_vectors(std::unique_ptr<phys_device_props2_chain> &chain) {
+    (void)chain;
+    if (chain->PhysicalDeviceHostImageCopyProperties) {
+        chain->VkPhysicalDeviceHostImageCopyProperties_pCopySrcLayouts.resize(
+            chain->PhysicalDeviceHostImageCopyProperties->copySrcLayoutCount);
+        chain->PhysicalDeviceHostImageCopyProperties->pCopySrcLayouts =
+            chain->VkPhysicalDeviceHostImageCopyProperties_pCopySrcLayouts.data();
+        chain->VkPhysicalDeviceHostImageCopyProperties_pCopyDstLayouts.resize(
+            chain->PhysicalDeviceHostImageCopyProperties->copyDstLayoutCount);
+        chain->PhysicalDeviceHostImageCopyProperties->pCopyDstLayouts =
+            chain->VkPhysicalDeviceHostImageCopyProperties_pCopyDstLayouts.data();
+    }
+    if (chain->PhysicalDeviceLayeredApiPropertiesListKHR) {
+        chain->VkPhysicalDeviceLayeredApiPropertiesListKHR_pLayeredApis.resize(
+            chain->PhysicalDeviceLayeredApiPropertiesListKHR->layeredApiCount);
+        chain->PhysicalDeviceLayeredApiPropertiesListKHR->pLayeredApis =
+            chain->VkPhysicalDeviceLayeredApiPropertiesListKHR_pLayeredApis.data();
+    }
+    if (chain->PhysicalDeviceVulkan14Properties) {
+        chain->VkPhysicalDeviceVulkan14Properties_pCopySrcLayouts.resize(
+            chain->PhysicalDeviceVulkan14Properties->copySrcLayoutCount);
+        chain->PhysicalDeviceVulkan14Properties->pCopySrcLayouts = chain->VkPhysicalDeviceVulkan14Properties_pCopySrcLayouts.data();
+        chain->VkPhysicalDeviceVulkan14Properties_pCopyDstLayouts.resize(
+            chain->PhysicalDeviceVulkan14Properties->copyDstLayoutCount);
+        chain->PhysicalDeviceVulkan14Properties->pCopyDstLayouts = chain->VkPhysicalDeviceVulkan14Properties_pCopyDstLayouts.data();
+    }
+    return true;
+}
+struct phys_device_mem_props2_chain {
+    phys_device_mem_props2_chain() = default;
+    phys_device_mem_props2_chain(const phys_device_mem_props2_chain &) = delete;
+    phys_device_mem_props2_chain &operator=(const phys_device_mem_props2_chain &) = delete;
+    phys_device_mem_props2_chain(phys_device_mem_props2_chain &&) = delete;
+    phys_device_mem_props2_chain &operator=(phys_device_mem_props2_chain &&) = delete;
+    void *start_of_chain = nullptr;
+    ChainArena arena;
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT *PhysicalDeviceMemoryBudgetPropertiesEXT{};
+    void initialize_chain(AppGpu &gpu) noexcept {
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_memory_budget))
+            arena.Add(PhysicalDeviceMemoryBudgetPropertiesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT);
+
+        start_of_chain = arena.Allocate();
+    }
+};
+void setup_phys_device_mem_props2_chain(VkPhysicalDeviceMemoryProperties2 &start,
+                                        std::unique_ptr<phys_device_mem_props2_chain> &chain, AppGpu &gpu) {
+    chain = std::unique_ptr<phys_device_mem_props2_chain>(new phys_device_mem_props2_chain());
+    chain->initialize_chain(gpu);
+    start.pNext = chain->start_of_chain;
+};
+
+bool prepare_phys_device_mem_props2_twocall_chain_vectors(std::unique_ptr<phys_device_mem_props2_chain> &chain) {
+    (void)chain;
+    return false;
+}
+struct phys_device_features2_chain {
+    phys_device_features2_chain() = default;
+    phys_device_features2_chain(const phys_device_features2_chain &) = delete;
+    phys_device_features2_chain &operator=(const phys_device_features2_chain &) = delete;
+    phys_device_features2_chain(phys_device_features2_chain &&) = delete;
+    phys_device_features2_chain &operator=(phys_device_features2_chain &&) = delete;
+    void *start_of_chain = nullptr;
+    ChainArena arena;
+    VkPhysicalDevice16BitStorageFeatures *PhysicalDevice16BitStorageFeatures{};
+    VkPhysicalDevice4444FormatsFeaturesEXT *PhysicalDevice4444FormatsFeaturesEXT{};
+    VkPhysicalDevice8BitStorageFeatures *PhysicalDevice8BitStorageFeatures{};
+    VkPhysicalDeviceASTCDecodeFeaturesEXT *PhysicalDeviceASTCDecodeFeaturesEXT{};
+    VkPhysicalDeviceAccelerationStructureFeaturesKHR *PhysicalDeviceAccelerationStructureFeaturesKHR{};
+    VkPhysicalDeviceAddressBindingReportFeaturesEXT *PhysicalDeviceAddressBindingReportFeaturesEXT{};
+    VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT *PhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT{};
+    VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT *PhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT{};
+    VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT *PhysicalDeviceBlendOperationAdvancedFeaturesEXT{};
+    VkPhysicalDeviceBorderColorSwizzleFeaturesEXT *PhysicalDeviceBorderColorSwizzleFeaturesEXT{};
+    VkPhysicalDeviceBufferDeviceAddressFeatures *PhysicalDeviceBufferDeviceAddressFeatures{};
+    VkPhysicalDeviceBufferDeviceAddressFeaturesEXT *PhysicalDeviceBufferDeviceAddressFeaturesEXT{};
+    VkPhysicalDeviceColorWriteEnableFeaturesEXT *PhysicalDeviceColorWriteEnableFeaturesEXT{};
+    VkPhysicalDeviceComputeShaderDerivativesFeaturesKHR *PhysicalDeviceComputeShaderDerivativesFeaturesKHR{};
+    VkPhysicalDeviceConditionalRenderingFeaturesEXT *PhysicalDeviceConditionalRenderingFeaturesEXT{};
+    VkPhysicalDeviceCooperativeMatrixFeaturesKHR *PhysicalDeviceCooperativeMatrixFeaturesKHR{};
+    VkPhysicalDeviceCooperativeMatrixMaintenance1FeaturesEXT *PhysicalDeviceCooperativeMatrixMaintenance1FeaturesEXT{};
+    VkPhysicalDeviceCopyMemoryIndirectFeaturesKHR *PhysicalDeviceCopyMemoryIndirectFeaturesKHR{};
+    VkPhysicalDeviceCustomBorderColorFeaturesEXT *PhysicalDeviceCustomBorderColorFeaturesEXT{};
+    VkPhysicalDeviceCustomResolveFeaturesEXT *PhysicalDeviceCustomResolveFeaturesEXT{};
+    VkPhysicalDeviceDepthBiasControlFeaturesEXT *PhysicalDeviceDepthBiasControlFeaturesEXT{};
+    VkPhysicalDeviceDepthClampControlFeaturesEXT *PhysicalDeviceDepthClampControlFeaturesEXT{};
+    VkPhysicalDeviceDepthClampZeroOneFeaturesKHR *PhysicalDeviceDepthClampZeroOneFeaturesKHR{};
+    VkPhysicalDeviceDepthClipControlFeaturesEXT *PhysicalDeviceDepthClipControlFeaturesEXT{};
+    VkPhysicalDeviceDepthClipEnableFeaturesEXT *PhysicalDeviceDepthClipEnableFeaturesEXT{};
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT *PhysicalDeviceDescriptorBufferFeaturesEXT{};
+    VkPhysicalDeviceDescriptorHeapFeaturesEXT *PhysicalDeviceDescriptorHeapFeaturesEXT{};
+    VkPhysicalDeviceDescriptorIndexingFeatures *PhysicalDeviceDescriptorIndexingFeatures{};
+    VkPhysicalDeviceDeviceAddressCommandsFeaturesKHR *PhysicalDeviceDeviceAddressCommandsFeaturesKHR{};
+    VkPhysicalDeviceDeviceGeneratedCommandsFeaturesEXT *PhysicalDeviceDeviceGeneratedCommandsFeaturesEXT{};
+    VkPhysicalDeviceDeviceMemoryReportFeaturesEXT *PhysicalDeviceDeviceMemoryReportFeaturesEXT{};
+    VkPhysicalDeviceDynamicRenderingFeatures *PhysicalDeviceDynamicRenderingFeatures{};
+    VkPhysicalDeviceDynamicRenderingLocalReadFeatures *PhysicalDeviceDynamicRenderingLocalReadFeatures{};
+    VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT *PhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT{};
+    VkPhysicalDeviceExtendedDynamicState2FeaturesEXT *PhysicalDeviceExtendedDynamicState2FeaturesEXT{};
+    VkPhysicalDeviceExtendedDynamicState3FeaturesEXT *PhysicalDeviceExtendedDynamicState3FeaturesEXT{};
+    VkPhysicalDeviceExtendedDynamicStateFeaturesEXT *PhysicalDeviceExtendedDynamicStateFeaturesEXT{};
+    VkPhysicalDeviceExtendedFlagsFeaturesKHR *PhysicalDeviceExtendedFlagsFeaturesKHR{};
+    VkPhysicalDeviceFaultFeaturesEXT *PhysicalDeviceFaultFeaturesEXT{};
+    VkPhysicalDeviceFaultFeaturesKHR *PhysicalDeviceFaultFeaturesKHR{};
+    VkPhysicalDeviceFragmentDensityMap2FeaturesEXT *PhysicalDeviceFragmentDensityMap2FeaturesEXT{};
+    VkPhysicalDeviceFragmentDensityMapFeaturesEXT *PhysicalDeviceFragmentDensityMapFeaturesEXT{};
+    VkPhysicalDeviceFragmentDensityMapOffsetFeaturesEXT *PhysicalDeviceFragmentDensityMapOffsetFeaturesEXT{};
+    VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR *PhysicalDeviceFragmentShaderBarycentricFeaturesKHR{};
+    VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT *PhysicalDeviceFragmentShaderInterlockFeaturesEXT{};
+    VkPhysicalDeviceFragmentShadingRateFeaturesKHR *PhysicalDeviceFragmentShadingRateFeaturesKHR{};
+    VkPhysicalDeviceFrameBoundaryFeaturesEXT *PhysicalDeviceFrameBoundaryFeaturesEXT{};
+    VkPhysicalDeviceGlobalPriorityQueryFeatures *PhysicalDeviceGlobalPriorityQueryFeatures{};
+    VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT *PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT{};
+    VkPhysicalDeviceHostImageCopyFeatures *PhysicalDeviceHostImageCopyFeatures{};
+    VkPhysicalDeviceHostQueryResetFeatures *PhysicalDeviceHostQueryResetFeatures{};
+    VkPhysicalDeviceImage2DViewOf3DFeaturesEXT *PhysicalDeviceImage2DViewOf3DFeaturesEXT{};
+    VkPhysicalDeviceImageCompressionControlFeaturesEXT *PhysicalDeviceImageCompressionControlFeaturesEXT{};
+    VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT *PhysicalDeviceImageCompressionControlSwapchainFeaturesEXT{};
+    VkPhysicalDeviceImageRobustnessFeatures *PhysicalDeviceImageRobustnessFeatures{};
+    VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT *PhysicalDeviceImageSlicedViewOf3DFeaturesEXT{};
+    VkPhysicalDeviceImageTilingControlFeaturesEXT *PhysicalDeviceImageTilingControlFeaturesEXT{};
+    VkPhysicalDeviceImageViewMinLodFeaturesEXT *PhysicalDeviceImageViewMinLodFeaturesEXT{};
+    VkPhysicalDeviceImagelessFramebufferFeatures *PhysicalDeviceImagelessFramebufferFeatures{};
+    VkPhysicalDeviceIndexTypeUint8Features *PhysicalDeviceIndexTypeUint8Features{};
+    VkPhysicalDeviceInlineUniformBlockFeatures *PhysicalDeviceInlineUniformBlockFeatures{};
+    VkPhysicalDeviceInternallySynchronizedQueuesFeaturesKHR *PhysicalDeviceInternallySynchronizedQueuesFeaturesKHR{};
+    VkPhysicalDeviceLegacyDitheringFeaturesEXT *PhysicalDeviceLegacyDitheringFeaturesEXT{};
+    VkPhysicalDeviceLegacyVertexAttributesFeaturesEXT *PhysicalDeviceLegacyVertexAttributesFeaturesEXT{};
+    VkPhysicalDeviceLineRasterizationFeatures *PhysicalDeviceLineRasterizationFeatures{};
+    VkPhysicalDeviceMaintenance10FeaturesKHR *PhysicalDeviceMaintenance10FeaturesKHR{};
+    VkPhysicalDeviceMaintenance11FeaturesKHR *PhysicalDeviceMaintenance11FeaturesKHR{};
+    VkPhysicalDeviceMaintenance4Features *PhysicalDeviceMaintenance4Features{};
+    VkPhysicalDeviceMaintenance5Features *PhysicalDeviceMaintenance5Features{};
+    VkPhysicalDeviceMaintenance6Features *PhysicalDeviceMaintenance6Features{};
+    VkPhysicalDeviceMaintenance7FeaturesKHR *PhysicalDeviceMaintenance7FeaturesKHR{};
+    VkPhysicalDeviceMaintenance8FeaturesKHR *PhysicalDeviceMaintenance8FeaturesKHR{};
+    VkPhysicalDeviceMaintenance9FeaturesKHR *PhysicalDeviceMaintenance9FeaturesKHR{};
+    VkPhysicalDeviceMapMemoryPlacedFeaturesEXT *PhysicalDeviceMapMemoryPlacedFeaturesEXT{};
+    VkPhysicalDeviceMemoryDecompressionFeaturesEXT *PhysicalDeviceMemoryDecompressionFeaturesEXT{};
+    VkPhysicalDeviceMemoryPriorityFeaturesEXT *PhysicalDeviceMemoryPriorityFeaturesEXT{};
+    VkPhysicalDeviceMeshShaderFeaturesEXT *PhysicalDeviceMeshShaderFeaturesEXT{};
+    VkPhysicalDeviceMultiDrawFeaturesEXT *PhysicalDeviceMultiDrawFeaturesEXT{};
+    VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT *PhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT{};
+    VkPhysicalDeviceMultisampledRenderToSwapchainFeaturesEXT *PhysicalDeviceMultisampledRenderToSwapchainFeaturesEXT{};
+    VkPhysicalDeviceMultiviewFeatures *PhysicalDeviceMultiviewFeatures{};
+    VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT *PhysicalDeviceMutableDescriptorTypeFeaturesEXT{};
+    VkPhysicalDeviceNestedCommandBufferFeaturesEXT *PhysicalDeviceNestedCommandBufferFeaturesEXT{};
+    VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT *PhysicalDeviceNonSeamlessCubeMapFeaturesEXT{};
+    VkPhysicalDeviceOpacityMicromapFeaturesEXT *PhysicalDeviceOpacityMicromapFeaturesEXT{};
+    VkPhysicalDeviceOpacityMicromapFeaturesKHR *PhysicalDeviceOpacityMicromapFeaturesKHR{};
+    VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT *PhysicalDevicePageableDeviceLocalMemoryFeaturesEXT{};
+    VkPhysicalDevicePerformanceQueryFeaturesKHR *PhysicalDevicePerformanceQueryFeaturesKHR{};
+    VkPhysicalDevicePipelineBinaryFeaturesKHR *PhysicalDevicePipelineBinaryFeaturesKHR{};
+    VkPhysicalDevicePipelineCreationCacheControlFeatures *PhysicalDevicePipelineCreationCacheControlFeatures{};
+    VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR *PhysicalDevicePipelineExecutablePropertiesFeaturesKHR{};
+    VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT *PhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT{};
+    VkPhysicalDevicePipelinePropertiesFeaturesEXT *PhysicalDevicePipelinePropertiesFeaturesEXT{};
+    VkPhysicalDevicePipelineProtectedAccessFeatures *PhysicalDevicePipelineProtectedAccessFeatures{};
+    VkPhysicalDevicePipelineRobustnessFeatures *PhysicalDevicePipelineRobustnessFeatures{};
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    VkPhysicalDevicePortabilitySubsetFeaturesKHR *PhysicalDevicePortabilitySubsetFeaturesKHR{};
+#endif  // VK_ENABLE_BETA_EXTENSIONS
+    VkPhysicalDevicePresentId2FeaturesKHR *PhysicalDevicePresentId2FeaturesKHR{};
+    VkPhysicalDevicePresentIdFeaturesKHR *PhysicalDevicePresentIdFeaturesKHR{};
+    VkPhysicalDevicePresentModeFifoLatestReadyFeaturesKHR *PhysicalDevicePresentModeFifoLatestReadyFeaturesKHR{};
+    VkPhysicalDevicePresentTimingFeaturesEXT *PhysicalDevicePresentTimingFeaturesEXT{};
+    VkPhysicalDevicePresentWait2FeaturesKHR *PhysicalDevicePresentWait2FeaturesKHR{};
+    VkPhysicalDevicePresentWaitFeaturesKHR *PhysicalDevicePresentWaitFeaturesKHR{};
+    VkPhysicalDevicePrimitiveRestartIndexFeaturesEXT *PhysicalDevicePrimitiveRestartIndexFeaturesEXT{};
+    VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT *PhysicalDevicePrimitiveTopologyListRestartFeaturesEXT{};
+    VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT *PhysicalDevicePrimitivesGeneratedQueryFeaturesEXT{};
+    VkPhysicalDevicePrivateDataFeatures *PhysicalDevicePrivateDataFeatures{};
+    VkPhysicalDeviceProtectedMemoryFeatures *PhysicalDeviceProtectedMemoryFeatures{};
+    VkPhysicalDeviceProvokingVertexFeaturesEXT *PhysicalDeviceProvokingVertexFeaturesEXT{};
+    VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT *PhysicalDeviceRGBA10X6FormatsFeaturesEXT{};
+    VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT *PhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT{};
+    VkPhysicalDeviceRayQueryFeaturesKHR *PhysicalDeviceRayQueryFeaturesKHR{};
+    VkPhysicalDeviceRayTracingInvocationReorderFeaturesEXT *PhysicalDeviceRayTracingInvocationReorderFeaturesEXT{};
+    VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR *PhysicalDeviceRayTracingMaintenance1FeaturesKHR{};
+    VkPhysicalDeviceRayTracingPipelineFeaturesKHR *PhysicalDeviceRayTracingPipelineFeaturesKHR{};
+    VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR *PhysicalDeviceRayTracingPositionFetchFeaturesKHR{};
+    VkPhysicalDeviceRobustness2FeaturesKHR *PhysicalDeviceRobustness2FeaturesKHR{};
+    VkPhysicalDeviceSamplerYcbcrConversionFeatures *PhysicalDeviceSamplerYcbcrConversionFeatures{};
+    VkPhysicalDeviceScalarBlockLayoutFeatures *PhysicalDeviceScalarBlockLayoutFeatures{};
+    VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures *PhysicalDeviceSeparateDepthStencilLayoutsFeatures{};
+    VkPhysicalDeviceShader64BitIndexingFeaturesEXT *PhysicalDeviceShader64BitIndexingFeaturesEXT{};
+    VkPhysicalDeviceShaderAbortFeaturesKHR *PhysicalDeviceShaderAbortFeaturesKHR{};
+    VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT *PhysicalDeviceShaderAtomicFloat2FeaturesEXT{};
+    VkPhysicalDeviceShaderAtomicFloatFeaturesEXT *PhysicalDeviceShaderAtomicFloatFeaturesEXT{};
+    VkPhysicalDeviceShaderAtomicInt64Features *PhysicalDeviceShaderAtomicInt64Features{};
+    VkPhysicalDeviceShaderBfloat16FeaturesKHR *PhysicalDeviceShaderBfloat16FeaturesKHR{};
+    VkPhysicalDeviceShaderClockFeaturesKHR *PhysicalDeviceShaderClockFeaturesKHR{};
+    VkPhysicalDeviceShaderConstantDataFeaturesKHR *PhysicalDeviceShaderConstantDataFeaturesKHR{};
+    VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures *PhysicalDeviceShaderDemoteToHelperInvocationFeatures{};
+    VkPhysicalDeviceShaderDrawParametersFeatures *PhysicalDeviceShaderDrawParametersFeatures{};
+    VkPhysicalDeviceShaderExpectAssumeFeatures *PhysicalDeviceShaderExpectAssumeFeatures{};
+    VkPhysicalDeviceShaderFloat16Int8Features *PhysicalDeviceShaderFloat16Int8Features{};
+    VkPhysicalDeviceShaderFloat8FeaturesEXT *PhysicalDeviceShaderFloat8FeaturesEXT{};
+    VkPhysicalDeviceShaderFloatControls2Features *PhysicalDeviceShaderFloatControls2Features{};
+    VkPhysicalDeviceShaderFmaFeaturesKHR *PhysicalDeviceShaderFmaFeaturesKHR{};
+    VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT *PhysicalDeviceShaderImageAtomicInt64FeaturesEXT{};
+    VkPhysicalDeviceShaderIntegerDotProductFeatures *PhysicalDeviceShaderIntegerDotProductFeatures{};
+    VkPhysicalDeviceShaderLongVectorFeaturesEXT *PhysicalDeviceShaderLongVectorFeaturesEXT{};
+    VkPhysicalDeviceShaderMaximalReconvergenceFeaturesKHR *PhysicalDeviceShaderMaximalReconvergenceFeaturesKHR{};
+    VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT *PhysicalDeviceShaderModuleIdentifierFeaturesEXT{};
+    VkPhysicalDeviceShaderOCPMicroscalingTypesFeaturesEXT *PhysicalDeviceShaderOCPMicroscalingTypesFeaturesEXT{};
+    VkPhysicalDeviceShaderObjectFeaturesEXT *PhysicalDeviceShaderObjectFeaturesEXT{};
+    VkPhysicalDeviceShaderQuadControlFeaturesKHR *PhysicalDeviceShaderQuadControlFeaturesKHR{};
+    VkPhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR *PhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR{};
+    VkPhysicalDeviceShaderReplicatedCompositesFeaturesEXT *PhysicalDeviceShaderReplicatedCompositesFeaturesEXT{};
+    VkPhysicalDeviceShaderSplitBarrierFeaturesEXT *PhysicalDeviceShaderSplitBarrierFeaturesEXT{};
+    VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures *PhysicalDeviceShaderSubgroupExtendedTypesFeatures{};
+    VkPhysicalDeviceShaderSubgroupPartitionedFeaturesEXT *PhysicalDeviceShaderSubgroupPartitionedFeaturesEXT{};
+    VkPhysicalDeviceShaderSubgroupRotateFeatures *PhysicalDeviceShaderSubgroupRotateFeatures{};
+    VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR *PhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR{};
+    VkPhysicalDeviceShaderTerminateInvocationFeatures *PhysicalDeviceShaderTerminateInvocationFeatures{};
+    VkPhysicalDeviceShaderTileImageFeaturesEXT *PhysicalDeviceShaderTileImageFeaturesEXT{};
+    VkPhysicalDeviceShaderUniformBufferUnsizedArrayFeaturesEXT *PhysicalDeviceShaderUniformBufferUnsizedArrayFeaturesEXT{};
+    VkPhysicalDeviceShaderUntypedPointersFeaturesKHR *PhysicalDeviceShaderUntypedPointersFeaturesKHR{};
+    VkPhysicalDeviceSubgroupSizeControlFeatures *PhysicalDeviceSubgroupSizeControlFeatures{};
+    VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT *PhysicalDeviceSubpassMergeFeedbackFeaturesEXT{};
+    VkPhysicalDeviceSwapchainMaintenance1FeaturesKHR *PhysicalDeviceSwapchainMaintenance1FeaturesKHR{};
+    VkPhysicalDeviceSynchronization2Features *PhysicalDeviceSynchronization2Features{};
+    VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT *PhysicalDeviceTexelBufferAlignmentFeaturesEXT{};
+    VkPhysicalDeviceTextureCompressionASTC3DFeaturesEXT *PhysicalDeviceTextureCompressionASTC3DFeaturesEXT{};
+    VkPhysicalDeviceTextureCompressionASTCHDRFeatures *PhysicalDeviceTextureCompressionASTCHDRFeatures{};
+    VkPhysicalDeviceTimelineSemaphoreFeatures *PhysicalDeviceTimelineSemaphoreFeatures{};
+    VkPhysicalDeviceTransformFeedbackFeaturesEXT *PhysicalDeviceTransformFeedbackFeaturesEXT{};
+    VkPhysicalDeviceUnifiedImageLayoutsFeaturesKHR *PhysicalDeviceUnifiedImageLayoutsFeaturesKHR{};
+    VkPhysicalDeviceUniformBufferStandardLayoutFeatures *PhysicalDeviceUniformBufferStandardLayoutFeatures{};
+    VkPhysicalDeviceVariablePointersFeatures *PhysicalDeviceVariablePointersFeatures{};
+    VkPhysicalDeviceVertexAttributeDivisorFeatures *PhysicalDeviceVertexAttributeDivisorFeatures{};
+    VkPhysicalDeviceVertexAttributeRobustnessFeaturesEXT *PhysicalDeviceVertexAttributeRobustnessFeaturesEXT{};
+    VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT *PhysicalDeviceVertexInputDynamicStateFeaturesEXT{};
+    VkPhysicalDeviceVideoDecodeVP9FeaturesKHR *PhysicalDeviceVideoDecodeVP9FeaturesKHR{};
+    VkPhysicalDeviceVideoEncodeAV1FeaturesKHR *PhysicalDeviceVideoEncodeAV1FeaturesKHR{};
+    VkPhysicalDeviceVideoEncodeFeedback2FeaturesKHR *PhysicalDeviceVideoEncodeFeedback2FeaturesKHR{};
+    VkPhysicalDeviceVideoEncodeIntraRefreshFeaturesKHR *PhysicalDeviceVideoEncodeIntraRefreshFeaturesKHR{};
+    VkPhysicalDeviceVideoEncodeQuantizationMapFeaturesKHR *PhysicalDeviceVideoEncodeQuantizationMapFeaturesKHR{};
+    VkPhysicalDeviceVideoMaintenance1FeaturesKHR *PhysicalDeviceVideoMaintenance1FeaturesKHR{};
+    VkPhysicalDeviceVideoMaintenance2FeaturesKHR *PhysicalDeviceVideoMaintenance2FeaturesKHR{};
+    VkPhysicalDeviceVulkan11Features *PhysicalDeviceVulkan11Features{};
+    VkPhysicalDeviceVulkan12Features *PhysicalDeviceVulkan12Features{};
+    VkPhysicalDeviceVulkan13Features *PhysicalDeviceVulkan13Features{};
+    VkPhysicalDeviceVulkan14Features *PhysicalDeviceVulkan14Features{};
+    VkPhysicalDeviceVulkanMemoryModelFeatures *PhysicalDeviceVulkanMemoryModelFeatures{};
+    VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR *PhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR{};
+    VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT *PhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT{};
+    VkPhysicalDeviceYcbcrImageArraysFeaturesEXT *PhysicalDeviceYcbcrImageArraysFeaturesEXT{};
+    VkPhysicalDeviceZeroInitializeDeviceMemoryFeaturesEXT *PhysicalDeviceZeroInitializeDeviceMemoryFeaturesEXT{};
+    VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures *PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures{};
+    void initialize_chain(AppGpu &gpu, bool show_promoted_structs) noexcept {
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_16bit_storage)) &&
+            (gpu.api_version < VK_API_VERSION_1_1 || show_promoted_structs))
+            arena.Add(PhysicalDevice16BitStorageFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_4444_formats))
+            arena.Add(PhysicalDevice4444FormatsFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_8bit_storage)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDevice8BitStorageFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_astc_decode_mode))
+            arena.Add(PhysicalDeviceASTCDecodeFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_acceleration_structure))
+            arena.Add(PhysicalDeviceAccelerationStructureFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_device_address_binding_report))
+            arena.Add(PhysicalDeviceAddressBindingReportFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ADDRESS_BINDING_REPORT_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_attachment_feedback_loop_dynamic_state))
+            arena.Add(PhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_DYNAMIC_STATE_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_attachment_feedback_loop_layout))
+            arena.Add(PhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_LAYOUT_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_blend_operation_advanced))
+            arena.Add(PhysicalDeviceBlendOperationAdvancedFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_border_color_swizzle))
+            arena.Add(PhysicalDeviceBorderColorSwizzleFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_buffer_device_address)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceBufferDeviceAddressFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_buffer_device_address))
+            arena.Add(PhysicalDeviceBufferDeviceAddressFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_color_write_enable))
+            arena.Add(PhysicalDeviceColorWriteEnableFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COLOR_WRITE_ENABLE_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_compute_shader_derivatives) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::NV_compute_shader_derivatives))
+            arena.Add(PhysicalDeviceComputeShaderDerivativesFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_conditional_rendering))
+            arena.Add(PhysicalDeviceConditionalRenderingFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_cooperative_matrix))
+            arena.Add(PhysicalDeviceCooperativeMatrixFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_cooperative_matrix_maintenance1))
+            arena.Add(PhysicalDeviceCooperativeMatrixMaintenance1FeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_MAINTENANCE_1_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_copy_memory_indirect))
+            arena.Add(PhysicalDeviceCopyMemoryIndirectFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COPY_MEMORY_INDIRECT_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_custom_border_color))
+            arena.Add(PhysicalDeviceCustomBorderColorFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_custom_resolve))
+            arena.Add(PhysicalDeviceCustomResolveFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_RESOLVE_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_depth_bias_control))
+            arena.Add(PhysicalDeviceDepthBiasControlFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_BIAS_CONTROL_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_depth_clamp_control))
+            arena.Add(PhysicalDeviceDepthClampControlFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLAMP_CONTROL_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_depth_clamp_zero_one) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_depth_clamp_zero_one))
+            arena.Add(PhysicalDeviceDepthClampZeroOneFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLAMP_ZERO_ONE_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_depth_clip_control))
+            arena.Add(PhysicalDeviceDepthClipControlFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONTROL_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_depth_clip_enable))
+            arena.Add(PhysicalDeviceDepthClipEnableFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_descriptor_buffer))
+            arena.Add(PhysicalDeviceDescriptorBufferFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_descriptor_heap))
+            arena.Add(PhysicalDeviceDescriptorHeapFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_HEAP_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_descriptor_indexing)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceDescriptorIndexingFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_device_address_commands))
+            arena.Add(PhysicalDeviceDeviceAddressCommandsFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_ADDRESS_COMMANDS_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_device_generated_commands))
+            arena.Add(PhysicalDeviceDeviceGeneratedCommandsFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_device_memory_report))
+            arena.Add(PhysicalDeviceDeviceMemoryReportFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_dynamic_rendering)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceDynamicRenderingFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_dynamic_rendering_local_read)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceDynamicRenderingLocalReadFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_LOCAL_READ_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_dynamic_rendering_unused_attachments))
+            arena.Add(PhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_UNUSED_ATTACHMENTS_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_extended_dynamic_state2))
+            arena.Add(PhysicalDeviceExtendedDynamicState2FeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_extended_dynamic_state3))
+            arena.Add(PhysicalDeviceExtendedDynamicState3FeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_extended_dynamic_state))
+            arena.Add(PhysicalDeviceExtendedDynamicStateFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_extended_flags))
+            arena.Add(PhysicalDeviceExtendedFlagsFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_FLAGS_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_device_fault))
+            arena.Add(PhysicalDeviceFaultFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_device_fault))
+            arena.Add(PhysicalDeviceFaultFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_fragment_density_map2))
+            arena.Add(PhysicalDeviceFragmentDensityMap2FeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_fragment_density_map))
+            arena.Add(PhysicalDeviceFragmentDensityMapFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::QCOM_fragment_density_map_offset) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_fragment_density_map_offset))
+            arena.Add(PhysicalDeviceFragmentDensityMapOffsetFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_fragment_shader_barycentric) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::NV_fragment_shader_barycentric))
+            arena.Add(PhysicalDeviceFragmentShaderBarycentricFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_fragment_shader_interlock))
+            arena.Add(PhysicalDeviceFragmentShaderInterlockFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_fragment_shading_rate))
+            arena.Add(PhysicalDeviceFragmentShadingRateFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_frame_boundary))
+            arena.Add(PhysicalDeviceFrameBoundaryFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAME_BOUNDARY_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_global_priority) ||
+             gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_global_priority_query)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceGlobalPriorityQueryFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_graphics_pipeline_library))
+            arena.Add(PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_host_image_copy)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceHostImageCopyFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_host_query_reset)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceHostQueryResetFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_image_2d_view_of_3d))
+            arena.Add(PhysicalDeviceImage2DViewOf3DFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_2D_VIEW_OF_3D_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_image_compression_control))
+            arena.Add(PhysicalDeviceImageCompressionControlFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_image_compression_control_swapchain))
+            arena.Add(PhysicalDeviceImageCompressionControlSwapchainFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_SWAPCHAIN_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_image_robustness)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceImageRobustnessFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_image_sliced_view_of_3d))
+            arena.Add(PhysicalDeviceImageSlicedViewOf3DFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_SLICED_VIEW_OF_3D_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_image_tiling_control))
+            arena.Add(PhysicalDeviceImageTilingControlFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_TILING_CONTROL_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_image_view_min_lod))
+            arena.Add(PhysicalDeviceImageViewMinLodFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_MIN_LOD_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_imageless_framebuffer)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceImagelessFramebufferFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_index_type_uint8) ||
+             gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_index_type_uint8)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceIndexTypeUint8Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_inline_uniform_block)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceInlineUniformBlockFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_internally_synchronized_queues))
+            arena.Add(PhysicalDeviceInternallySynchronizedQueuesFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INTERNALLY_SYNCHRONIZED_QUEUES_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_legacy_dithering))
+            arena.Add(PhysicalDeviceLegacyDitheringFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LEGACY_DITHERING_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_legacy_vertex_attributes))
+            arena.Add(PhysicalDeviceLegacyVertexAttributesFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LEGACY_VERTEX_ATTRIBUTES_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_line_rasterization) ||
+             gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_line_rasterization)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceLineRasterizationFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance10))
+            arena.Add(PhysicalDeviceMaintenance10FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_10_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance11))
+            arena.Add(PhysicalDeviceMaintenance11FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_11_FEATURES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance4)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceMaintenance4Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance5)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceMaintenance5Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_5_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance6)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceMaintenance6Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_6_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance7))
+            arena.Add(PhysicalDeviceMaintenance7FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_7_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance8))
+            arena.Add(PhysicalDeviceMaintenance8FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_8_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance9))
+            arena.Add(PhysicalDeviceMaintenance9FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_9_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_map_memory_placed))
+            arena.Add(PhysicalDeviceMapMemoryPlacedFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAP_MEMORY_PLACED_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::NV_memory_decompression) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_memory_decompression))
+            arena.Add(PhysicalDeviceMemoryDecompressionFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_memory_priority))
+            arena.Add(PhysicalDeviceMemoryPriorityFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_mesh_shader))
+            arena.Add(PhysicalDeviceMeshShaderFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_multi_draw))
+            arena.Add(PhysicalDeviceMultiDrawFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_multisampled_render_to_single_sampled))
+            arena.Add(PhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_multisampled_render_to_swapchain))
+            arena.Add(PhysicalDeviceMultisampledRenderToSwapchainFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTISAMPLED_RENDER_TO_SWAPCHAIN_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_multiview)) &&
+            (gpu.api_version < VK_API_VERSION_1_1 || show_promoted_structs))
+            arena.Add(PhysicalDeviceMultiviewFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::VALVE_mutable_descriptor_type) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_mutable_descriptor_type))
+            arena.Add(PhysicalDeviceMutableDescriptorTypeFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_nested_command_buffer))
+            arena.Add(PhysicalDeviceNestedCommandBufferFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_NESTED_COMMAND_BUFFER_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_non_seamless_cube_map))
+            arena.Add(PhysicalDeviceNonSeamlessCubeMapFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_NON_SEAMLESS_CUBE_MAP_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_opacity_micromap))
+            arena.Add(PhysicalDeviceOpacityMicromapFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_opacity_micromap))
+            arena.Add(PhysicalDeviceOpacityMicromapFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_pageable_device_local_memory))
+            arena.Add(PhysicalDevicePageableDeviceLocalMemoryFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_performance_query))
+            arena.Add(PhysicalDevicePerformanceQueryFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_pipeline_binary))
+            arena.Add(PhysicalDevicePipelineBinaryFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_BINARY_FEATURES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_pipeline_creation_cache_control)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDevicePipelineCreationCacheControlFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_pipeline_executable_properties))
+            arena.Add(PhysicalDevicePipelineExecutablePropertiesFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_pipeline_library_group_handles))
+            arena.Add(PhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_LIBRARY_GROUP_HANDLES_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_pipeline_properties))
+            arena.Add(PhysicalDevicePipelinePropertiesFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROPERTIES_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_pipeline_protected_access)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDevicePipelineProtectedAccessFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROTECTED_ACCESS_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_pipeline_robustness)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDevicePipelineRobustnessFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_FEATURES);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_portability_subset))
+            arena.Add(PhysicalDevicePortabilitySubsetFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR);
+#endif  // VK_ENABLE_BETA_EXTENSIONS
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_present_id2))
+            arena.Add(PhysicalDevicePresentId2FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_2_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_present_id))
+            arena.Add(PhysicalDevicePresentIdFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_present_mode_fifo_latest_ready) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_present_mode_fifo_latest_ready))
+            arena.Add(PhysicalDevicePresentModeFifoLatestReadyFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_MODE_FIFO_LATEST_READY_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_present_timing))
+            arena.Add(PhysicalDevicePresentTimingFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_TIMING_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_present_wait2))
+            arena.Add(PhysicalDevicePresentWait2FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_2_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_present_wait))
+            arena.Add(PhysicalDevicePresentWaitFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_primitive_restart_index))
+            arena.Add(PhysicalDevicePrimitiveRestartIndexFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_RESTART_INDEX_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_primitive_topology_list_restart))
+            arena.Add(PhysicalDevicePrimitiveTopologyListRestartFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_primitives_generated_query))
+            arena.Add(PhysicalDevicePrimitivesGeneratedQueryFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVES_GENERATED_QUERY_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_private_data)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDevicePrivateDataFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES);
+        if (gpu.api_version == VK_API_VERSION_1_1 || show_promoted_structs)
+            arena.Add(PhysicalDeviceProtectedMemoryFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_provoking_vertex))
+            arena.Add(PhysicalDeviceProvokingVertexFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_rgba10x6_formats))
+            arena.Add(PhysicalDeviceRGBA10X6FormatsFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::ARM_rasterization_order_attachment_access) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_rasterization_order_attachment_access))
+            arena.Add(PhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_ray_query))
+            arena.Add(PhysicalDeviceRayQueryFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_ray_tracing_invocation_reorder))
+            arena.Add(PhysicalDeviceRayTracingInvocationReorderFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_ray_tracing_maintenance1))
+            arena.Add(PhysicalDeviceRayTracingMaintenance1FeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MAINTENANCE_1_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_ray_tracing_pipeline))
+            arena.Add(PhysicalDeviceRayTracingPipelineFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_ray_tracing_position_fetch))
+            arena.Add(PhysicalDeviceRayTracingPositionFetchFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_POSITION_FETCH_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_robustness2) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_robustness2))
+            arena.Add(PhysicalDeviceRobustness2FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_sampler_ycbcr_conversion)) &&
+            (gpu.api_version < VK_API_VERSION_1_1 || show_promoted_structs))
+            arena.Add(PhysicalDeviceSamplerYcbcrConversionFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_scalar_block_layout)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceScalarBlockLayoutFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_separate_depth_stencil_layouts)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceSeparateDepthStencilLayoutsFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_64bit_indexing))
+            arena.Add(PhysicalDeviceShader64BitIndexingFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_64_BIT_INDEXING_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_abort))
+            arena.Add(PhysicalDeviceShaderAbortFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ABORT_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_atomic_float2))
+            arena.Add(PhysicalDeviceShaderAtomicFloat2FeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_atomic_float))
+            arena.Add(PhysicalDeviceShaderAtomicFloatFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_atomic_int64)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceShaderAtomicInt64Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_bfloat16))
+            arena.Add(PhysicalDeviceShaderBfloat16FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_BFLOAT16_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_clock))
+            arena.Add(PhysicalDeviceShaderClockFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_constant_data))
+            arena.Add(PhysicalDeviceShaderConstantDataFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CONSTANT_DATA_FEATURES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_demote_to_helper_invocation)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceShaderDemoteToHelperInvocationFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES);
+        if (gpu.api_version == VK_API_VERSION_1_1 || show_promoted_structs)
+            arena.Add(PhysicalDeviceShaderDrawParametersFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_expect_assume)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceShaderExpectAssumeFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_EXPECT_ASSUME_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_float16_int8)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceShaderFloat16Int8Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_float8))
+            arena.Add(PhysicalDeviceShaderFloat8FeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT8_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_float_controls2)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceShaderFloatControls2Features,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT_CONTROLS_2_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_fma))
+            arena.Add(PhysicalDeviceShaderFmaFeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FMA_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_image_atomic_int64))
+            arena.Add(PhysicalDeviceShaderImageAtomicInt64FeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_integer_dot_product)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceShaderIntegerDotProductFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES, 64);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_long_vector))
+            arena.Add(PhysicalDeviceShaderLongVectorFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_LONG_VECTOR_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_maximal_reconvergence))
+            arena.Add(PhysicalDeviceShaderMaximalReconvergenceFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MAXIMAL_RECONVERGENCE_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_module_identifier))
+            arena.Add(PhysicalDeviceShaderModuleIdentifierFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_ocp_microscaling_types))
+            arena.Add(PhysicalDeviceShaderOCPMicroscalingTypesFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OCP_MICROSCALING_TYPES_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_object))
+            arena.Add(PhysicalDeviceShaderObjectFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_quad_control))
+            arena.Add(PhysicalDeviceShaderQuadControlFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_QUAD_CONTROL_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_relaxed_extended_instruction))
+            arena.Add(PhysicalDeviceShaderRelaxedExtendedInstructionFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_RELAXED_EXTENDED_INSTRUCTION_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_replicated_composites))
+            arena.Add(PhysicalDeviceShaderReplicatedCompositesFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_REPLICATED_COMPOSITES_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_split_barrier))
+            arena.Add(PhysicalDeviceShaderSplitBarrierFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SPLIT_BARRIER_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_subgroup_extended_types)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceShaderSubgroupExtendedTypesFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_subgroup_partitioned))
+            arena.Add(PhysicalDeviceShaderSubgroupPartitionedFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_PARTITIONED_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_subgroup_rotate)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceShaderSubgroupRotateFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_ROTATE_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_subgroup_uniform_control_flow))
+            arena.Add(PhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_FEATURES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_terminate_invocation)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceShaderTerminateInvocationFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_tile_image))
+            arena.Add(PhysicalDeviceShaderTileImageFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TILE_IMAGE_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_shader_uniform_buffer_unsized_array))
+            arena.Add(PhysicalDeviceShaderUniformBufferUnsizedArrayFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_UNIFORM_BUFFER_UNSIZED_ARRAY_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shader_untyped_pointers))
+            arena.Add(PhysicalDeviceShaderUntypedPointersFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_UNTYPED_POINTERS_FEATURES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_subgroup_size_control)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceSubgroupSizeControlFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_subpass_merge_feedback))
+            arena.Add(PhysicalDeviceSubpassMergeFeedbackFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_MERGE_FEEDBACK_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_swapchain_maintenance1) ||
+            gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_swapchain_maintenance1))
+            arena.Add(PhysicalDeviceSwapchainMaintenance1FeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_synchronization2)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceSynchronization2Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_texel_buffer_alignment))
+            arena.Add(PhysicalDeviceTexelBufferAlignmentFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_texture_compression_astc_3d))
+            arena.Add(PhysicalDeviceTextureCompressionASTC3DFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_3D_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_texture_compression_astc_hdr)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceTextureCompressionASTCHDRFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_timeline_semaphore)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceTimelineSemaphoreFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_transform_feedback))
+            arena.Add(PhysicalDeviceTransformFeedbackFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_unified_image_layouts))
+            arena.Add(PhysicalDeviceUnifiedImageLayoutsFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFIED_IMAGE_LAYOUTS_FEATURES_KHR);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_uniform_buffer_standard_layout)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceUniformBufferStandardLayoutFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_variable_pointers)) &&
+            (gpu.api_version < VK_API_VERSION_1_1 || show_promoted_structs))
+            arena.Add(PhysicalDeviceVariablePointersFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_vertex_attribute_divisor) ||
+             gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_vertex_attribute_divisor)) &&
+            (gpu.api_version < VK_API_VERSION_1_4 || show_promoted_structs))
+            arena.Add(PhysicalDeviceVertexAttributeDivisorFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_vertex_attribute_robustness))
+            arena.Add(PhysicalDeviceVertexAttributeRobustnessFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_ROBUSTNESS_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_vertex_input_dynamic_state))
+            arena.Add(PhysicalDeviceVertexInputDynamicStateFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_vp9))
+            arena.Add(PhysicalDeviceVideoDecodeVP9FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_DECODE_VP9_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_av1))
+            arena.Add(PhysicalDeviceVideoEncodeAV1FeaturesKHR, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_AV1_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_feedback2))
+            arena.Add(PhysicalDeviceVideoEncodeFeedback2FeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_FEEDBACK_2_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_intra_refresh))
+            arena.Add(PhysicalDeviceVideoEncodeIntraRefreshFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_INTRA_REFRESH_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map))
+            arena.Add(PhysicalDeviceVideoEncodeQuantizationMapFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_QUANTIZATION_MAP_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_maintenance1))
+            arena.Add(PhysicalDeviceVideoMaintenance1FeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_MAINTENANCE_1_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_maintenance2))
+            arena.Add(PhysicalDeviceVideoMaintenance2FeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_MAINTENANCE_2_FEATURES_KHR);
+        if ((gpu.api_version >= VK_API_VERSION_1_2))
+            arena.Add(PhysicalDeviceVulkan11Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES);
+        if ((gpu.api_version >= VK_API_VERSION_1_2))
+            arena.Add(PhysicalDeviceVulkan12Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES);
+        if ((gpu.api_version >= VK_API_VERSION_1_3))
+            arena.Add(PhysicalDeviceVulkan13Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES);
+        if ((gpu.api_version >= VK_API_VERSION_1_4))
+            arena.Add(PhysicalDeviceVulkan14Features, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_4_FEATURES);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_vulkan_memory_model)) &&
+            (gpu.api_version < VK_API_VERSION_1_2 || show_promoted_structs))
+            arena.Add(PhysicalDeviceVulkanMemoryModelFeatures, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_workgroup_memory_explicit_layout))
+            arena.Add(PhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_ycbcr_2plane_444_formats))
+            arena.Add(PhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_ycbcr_image_arrays))
+            arena.Add(PhysicalDeviceYcbcrImageArraysFeaturesEXT, VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_zero_initialize_device_memory))
+            arena.Add(PhysicalDeviceZeroInitializeDeviceMemoryFeaturesEXT,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_DEVICE_MEMORY_FEATURES_EXT);
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_zero_initialize_workgroup_memory)) &&
+            (gpu.api_version < VK_API_VERSION_1_3 || show_promoted_structs))
+            arena.Add(PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures,
+                      VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES);
+
+        start_of_chain = arena.Allocate();
+    }
+};
+void setup_phys_device_features2_chain(VkPhysicalDeviceFeatures2 &start, std::unique_ptr<phys_device_features2_chain> &chain,
+                                       AppGpu &gpu, bool show_promoted_structs) {
+    chain = std::unique_ptr<phys_device_features2_chain>(new phys_device_features2_chain());
+    chain->initialize_chain(gpu, show_promoted_structs);
+    start.pNext = chain->start_of_chain;
+};
+
+bool prepare_phys_device_features2_twocall_chain_vectors(std::unique_ptr<phys_device_features2_chain> &chain) {
+    (void)chain;
+    return false;
+}
+struct surface_capabilities2_chain {
+    surface_capabilities2_chain() = default;
+    surface_capabilities2_chain(const surface_capabilities2_chain &) = delete;
+    surface_capabilities2_chain &operator=(const surface_capabilities2_chain &) = delete;
+    surface_capabilities2_chain(surface_capabilities2_chain &&) = delete;
+    surface_capabilities2_chain &operator=(surface_capabilities2_chain &&) = delete;
+    void *start_of_chain = nullptr;
+    ChainArena arena;
+    VkImageUsageFlags2CreateInfoKHR *ImageUsageFlags2CreateInfoKHR{};
+    VkPresentTimingSurfaceCapabilitiesEXT *PresentTimingSurfaceCapabilitiesEXT{};
+    VkSharedPresentSurfaceCapabilities2KHR *SharedPresentSurfaceCapabilities2KHR{};
+    VkSharedPresentSurfaceCapabilitiesKHR *SharedPresentSurfaceCapabilitiesKHR{};
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    VkSurfaceCapabilitiesFullScreenExclusiveEXT *SurfaceCapabilitiesFullScreenExclusiveEXT{};
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+    VkSurfaceCapabilitiesPresentId2KHR *SurfaceCapabilitiesPresentId2KHR{};
+    VkSurfaceCapabilitiesPresentWait2KHR *SurfaceCapabilitiesPresentWait2KHR{};
+    VkSurfaceProtectedCapabilitiesKHR *SurfaceProtectedCapabilitiesKHR{};
+    VkSwapchainFlagsSurfaceCapabilitiesEXT *SwapchainFlagsSurfaceCapabilitiesEXT{};
+    void initialize_chain(AppInstance &inst, AppGpu &gpu) noexcept {
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_extended_flags))
+            arena.Add(ImageUsageFlags2CreateInfoKHR, VK_STRUCTURE_TYPE_IMAGE_USAGE_FLAGS_2_CREATE_INFO_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_present_timing))
+            arena.Add(PresentTimingSurfaceCapabilitiesEXT, VK_STRUCTURE_TYPE_PRESENT_TIMING_SURFACE_CAPABILITIES_EXT);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_extended_flags))
+            arena.Add(SharedPresentSurfaceCapabilities2KHR, VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_2_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_shared_presentable_image))
+            arena.Add(SharedPresentSurfaceCapabilitiesKHR, VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_full_screen_exclusive))
+            arena.Add(SurfaceCapabilitiesFullScreenExclusiveEXT, VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT);
+#endif  // VK_USE_PLATFORM_WIN32_KHR
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_present_id2))
+            arena.Add(SurfaceCapabilitiesPresentId2KHR, VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_PRESENT_ID_2_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_present_wait2))
+            arena.Add(SurfaceCapabilitiesPresentWait2KHR, VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_PRESENT_WAIT_2_KHR);
+        if (inst.CheckExtensionEnabled(AppExtension::KHR_surface_protected_capabilities))
+            arena.Add(SurfaceProtectedCapabilitiesKHR, VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_multisampled_render_to_swapchain))
+            arena.Add(SwapchainFlagsSurfaceCapabilitiesEXT, VK_STRUCTURE_TYPE_SWAPCHAIN_FLAGS_SURFACE_CAPABILITIES_EXT);
+
+        start_of_chain = arena.Allocate();
+    }
+};
+void setup_surface_capabilities2_chain(VkSurfaceCapabilities2KHR &start, std::unique_ptr<surface_capabilities2_chain> &chain,
+                                       AppInstance &inst, AppGpu &gpu) {
+    chain = std::unique_ptr<surface_capabilities2_chain>(new surface_capabilities2_chain());
+    chain->initialize_chain(inst, gpu);
+    start.pNext = chain->start_of_chain;
+};
+
+bool prepare_surface_capabilities2_twocall_chain_vectors(std::unique_ptr<surface_capabilities2_chain> &chain) {
+    (void)chain;
+    return false;
+}
+struct format_properties2_chain {
+    format_properties2_chain() = default;
+    format_properties2_chain(const format_properties2_chain &) = delete;
+    format_properties2_chain &operator=(const format_properties2_chain &) = delete;
+    format_properties2_chain(format_properties2_chain &&) = delete;
+    format_properties2_chain &operator=(format_properties2_chain &&) = delete;
+    void *start_of_chain = nullptr;
+    ChainArena arena;
+    VkFormatProperties3 *FormatProperties3{};
+    VkFormatProperties4KHR *FormatProperties4KHR{};
+    VkSubpassResolvePerformanceQueryEXT *SubpassResolvePerformanceQueryEXT{};
+    void initialize_chain(AppGpu &gpu) noexcept {
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_format_feature_flags2)) &&
+            (gpu.api_version < VK_API_VERSION_1_3))
+            arena.Add(FormatProperties3, VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_extended_flags))
+            arena.Add(FormatProperties4KHR, VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_4_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_multisampled_render_to_single_sampled))
+            arena.Add(SubpassResolvePerformanceQueryEXT, VK_STRUCTURE_TYPE_SUBPASS_RESOLVE_PERFORMANCE_QUERY_EXT);
+
+        start_of_chain = arena.Allocate();
+    }
+};
+void setup_format_properties2_chain(VkFormatProperties2 &start, std::unique_ptr<format_properties2_chain> &chain, AppGpu &gpu) {
+    chain = std::unique_ptr<format_properties2_chain>(new format_properties2_chain());
+    chain->initialize_chain(gpu);
+    start.pNext = chain->start_of_chain;
+};
+
+bool prepare_format_properties2_twocall_chain_vectors(std::unique_ptr<format_properties2_chain> &chain) {
+    (void)chain;
+    return false;
+}
+struct queue_properties2_chain {
+    queue_properties2_chain() = default;
+    queue_properties2_chain(const queue_properties2_chain &) = delete;
+    queue_properties2_chain &operator=(const queue_properties2_chain &) = delete;
+    queue_properties2_chain(queue_properties2_chain &&) = delete;
+    queue_properties2_chain &operator=(queue_properties2_chain &&) = delete;
+    void *start_of_chain = nullptr;
+    ChainArena arena;
+    VkQueueFamilyGlobalPriorityProperties *QueueFamilyGlobalPriorityProperties{};
+    VkQueueFamilyOptimalImageTransferGranularityPropertiesKHR *QueueFamilyOptimalImageTransferGranularityPropertiesKHR{};
+    VkQueueFamilyOwnershipTransferPropertiesKHR *QueueFamilyOwnershipTransferPropertiesKHR{};
+    VkQueueFamilyQueryResultStatusPropertiesKHR *QueueFamilyQueryResultStatusPropertiesKHR{};
+    VkQueueFamilyVideoPropertiesKHR *QueueFamilyVideoPropertiesKHR{};
+    void initialize_chain(AppGpu &gpu) noexcept {
+        if ((gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_global_priority) ||
+             gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_global_priority_query)) &&
+            (gpu.api_version < VK_API_VERSION_1_4))
+            arena.Add(QueueFamilyGlobalPriorityProperties, VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance11))
+            arena.Add(QueueFamilyOptimalImageTransferGranularityPropertiesKHR,
+                      VK_STRUCTURE_TYPE_QUEUE_FAMILY_OPTIMAL_IMAGE_TRANSFER_GRANULARITY_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance9))
+            arena.Add(QueueFamilyOwnershipTransferPropertiesKHR, VK_STRUCTURE_TYPE_QUEUE_FAMILY_OWNERSHIP_TRANSFER_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_queue))
+            arena.Add(QueueFamilyQueryResultStatusPropertiesKHR, VK_STRUCTURE_TYPE_QUEUE_FAMILY_QUERY_RESULT_STATUS_PROPERTIES_KHR);
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_queue))
+            arena.Add(QueueFamilyVideoPropertiesKHR, VK_STRUCTURE_TYPE_QUEUE_FAMILY_VIDEO_PROPERTIES_KHR);
+
+        start_of_chain = arena.Allocate();
+    }
+};
+void setup_queue_properties2_chain(VkQueueFamilyProperties2 &start, std::unique_ptr<queue_properties2_chain> &chain, AppGpu &gpu) {
+    chain = std::unique_ptr<queue_properties2_chain>(new queue_properties2_chain());
+    chain->initialize_chain(gpu);
+    start.pNext = chain->start_of_chain;
+};
+
+bool prepare_queue_properties2_twocall_chain_vectors(std::unique_ptr<queue_properties2_chain> &chain) {
+    (void)chain;
+    return false;
+}
+struct video_profile_info_chain {
+    video_profile_info_chain() = default;
+    video_profile_info_chain(const video_profile_info_chain &) = delete;
+    video_profile_info_chain &operator=(const video_profile_info_chain &) = delete;
+    video_profile_info_chain(video_profile_info_chain &&) = delete;
+    video_profile_info_chain &operator=(video_profile_info_chain &&) = delete;
+    void *start_of_chain = nullptr;
+    VkVideoDecodeAV1ProfileInfoKHR VideoDecodeAV1ProfileInfoKHR{};
+    VkVideoDecodeH264ProfileInfoKHR VideoDecodeH264ProfileInfoKHR{};
+    VkVideoDecodeH265ProfileInfoKHR VideoDecodeH265ProfileInfoKHR{};
+    VkVideoDecodeUsageInfoKHR VideoDecodeUsageInfoKHR{};
+    VkVideoDecodeVP9ProfileInfoKHR VideoDecodeVP9ProfileInfoKHR{};
+    VkVideoEncodeAV1ProfileInfoKHR VideoEncodeAV1ProfileInfoKHR{};
+    VkVideoEncodeH264ProfileInfoKHR VideoEncodeH264ProfileInfoKHR{};
+    VkVideoEncodeH265ProfileInfoKHR VideoEncodeH265ProfileInfoKHR{};
+    VkVideoEncodeProfileRgbConversionInfoVALVE VideoEncodeProfileRgbConversionInfoVALVE{};
+    VkVideoEncodeUsageInfoKHR VideoEncodeUsageInfoKHR{};
+    void initialize_chain(AppGpu &gpu) noexcept {
+        VideoDecodeAV1ProfileInfoKHR.sType = VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_PROFILE_INFO_KHR;
+        VideoDecodeH264ProfileInfoKHR.sType = VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_INFO_KHR;
+        VideoDecodeH265ProfileInfoKHR.sType = VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_INFO_KHR;
+        VideoDecodeUsageInfoKHR.sType = VK_STRUCTURE_TYPE_VIDEO_DECODE_USAGE_INFO_KHR;
+        VideoDecodeVP9ProfileInfoKHR.sType = VK_STRUCTURE_TYPE_VIDEO_DECODE_VP9_PROFILE_INFO_KHR;
+        VideoEncodeAV1ProfileInfoKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_PROFILE_INFO_KHR;
+        VideoEncodeH264ProfileInfoKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_INFO_KHR;
+        VideoEncodeH265ProfileInfoKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_INFO_KHR;
+        VideoEncodeProfileRgbConversionInfoVALVE.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_PROFILE_RGB_CONVERSION_INFO_VALVE;
+        VideoEncodeUsageInfoKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_USAGE_INFO_KHR;
+        std::vector<VkBaseOutStructure *> chain_members{};
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_av1))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoDecodeAV1ProfileInfoKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_h264))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoDecodeH264ProfileInfoKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_h265))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoDecodeH265ProfileInfoKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_queue))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoDecodeUsageInfoKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_vp9))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoDecodeVP9ProfileInfoKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_av1))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeAV1ProfileInfoKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_h264))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeH264ProfileInfoKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_h265))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeH265ProfileInfoKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::VALVE_video_encode_rgb_conversion))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeProfileRgbConversionInfoVALVE));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_queue))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeUsageInfoKHR));
+
+        if (!chain_members.empty()) {
+            for (size_t i = 0; i < chain_members.size() - 1; i++) {
+                chain_members[i]->pNext = chain_members[i + 1];
+            }
+            start_of_chain = chain_members[0];
+        }
+    }
+};
+void setup_video_profile_info_chain(VkVideoProfileInfoKHR &start, std::unique_ptr<video_profile_info_chain> &chain, AppGpu &gpu) {
+    chain = std::unique_ptr<video_profile_info_chain>(new video_profile_info_chain());
+    chain->initialize_chain(gpu);
+    start.pNext = chain->start_of_chain;
+};
+
+bool prepare_video_profile_info_twocall_chain_vectors(std::unique_ptr<video_profile_info_chain> &chain) {
+    (void)chain;
+    return false;
+}
+struct video_capabilities_chain {
+    video_capabilities_chain() = default;
+    video_capabilities_chain(const video_capabilities_chain &) = delete;
+    video_capabilities_chain &operator=(const video_capabilities_chain &) = delete;
+    video_capabilities_chain(video_capabilities_chain &&) = delete;
+    video_capabilities_chain &operator=(video_capabilities_chain &&) = delete;
+    void *start_of_chain = nullptr;
+    VkVideoDecodeAV1CapabilitiesKHR VideoDecodeAV1CapabilitiesKHR{};
+    VkVideoDecodeCapabilitiesKHR VideoDecodeCapabilitiesKHR{};
+    VkVideoDecodeH264CapabilitiesKHR VideoDecodeH264CapabilitiesKHR{};
+    VkVideoDecodeH265CapabilitiesKHR VideoDecodeH265CapabilitiesKHR{};
+    VkVideoDecodeVP9CapabilitiesKHR VideoDecodeVP9CapabilitiesKHR{};
+    VkVideoEncodeAV1CapabilitiesKHR VideoEncodeAV1CapabilitiesKHR{};
+    VkVideoEncodeAV1QuantizationMapCapabilitiesKHR VideoEncodeAV1QuantizationMapCapabilitiesKHR{};
+    VkVideoEncodeCapabilitiesKHR VideoEncodeCapabilitiesKHR{};
+    VkVideoEncodeFeedback2CapabilitiesKHR VideoEncodeFeedback2CapabilitiesKHR{};
+    VkVideoEncodeH264CapabilitiesKHR VideoEncodeH264CapabilitiesKHR{};
+    VkVideoEncodeH264QuantizationMapCapabilitiesKHR VideoEncodeH264QuantizationMapCapabilitiesKHR{};
+    VkVideoEncodeH265CapabilitiesKHR VideoEncodeH265CapabilitiesKHR{};
+    VkVideoEncodeH265QuantizationMapCapabilitiesKHR VideoEncodeH265QuantizationMapCapabilitiesKHR{};
+    VkVideoEncodeIntraRefreshCapabilitiesKHR VideoEncodeIntraRefreshCapabilitiesKHR{};
+    VkVideoEncodeQuantizationMapCapabilitiesKHR VideoEncodeQuantizationMapCapabilitiesKHR{};
+    VkVideoEncodeRgbConversionCapabilitiesVALVE VideoEncodeRgbConversionCapabilitiesVALVE{};
+    void initialize_chain(AppGpu &gpu) noexcept {
+        VideoDecodeAV1CapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_CAPABILITIES_KHR;
+        VideoDecodeCapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR;
+        VideoDecodeH264CapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_KHR;
+        VideoDecodeH265CapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_KHR;
+        VideoDecodeVP9CapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_DECODE_VP9_CAPABILITIES_KHR;
+        VideoEncodeAV1CapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_CAPABILITIES_KHR;
+        VideoEncodeAV1QuantizationMapCapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_QUANTIZATION_MAP_CAPABILITIES_KHR;
+        VideoEncodeCapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR;
+        VideoEncodeFeedback2CapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_FEEDBACK_2_CAPABILITIES_KHR;
+        VideoEncodeH264CapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_KHR;
+        VideoEncodeH264QuantizationMapCapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_QUANTIZATION_MAP_CAPABILITIES_KHR;
+        VideoEncodeH265CapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_KHR;
+        VideoEncodeH265QuantizationMapCapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_QUANTIZATION_MAP_CAPABILITIES_KHR;
+        VideoEncodeIntraRefreshCapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_INTRA_REFRESH_CAPABILITIES_KHR;
+        VideoEncodeQuantizationMapCapabilitiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUANTIZATION_MAP_CAPABILITIES_KHR;
+        VideoEncodeRgbConversionCapabilitiesVALVE.sType = VK_STRUCTURE_TYPE_VIDEO_ENCODE_RGB_CONVERSION_CAPABILITIES_VALVE;
+        std::vector<VkBaseOutStructure *> chain_members{};
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_av1))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoDecodeAV1CapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_queue))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoDecodeCapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_h264))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoDecodeH264CapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_h265))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoDecodeH265CapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_vp9))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoDecodeVP9CapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_av1))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeAV1CapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeAV1QuantizationMapCapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_queue))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeCapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_feedback2))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeFeedback2CapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_h264))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeH264CapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeH264QuantizationMapCapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_h265))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeH265CapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeH265QuantizationMapCapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_intra_refresh))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeIntraRefreshCapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeQuantizationMapCapabilitiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::VALVE_video_encode_rgb_conversion))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoEncodeRgbConversionCapabilitiesVALVE));
+
+        if (!chain_members.empty()) {
+            for (size_t i = 0; i < chain_members.size() - 1; i++) {
+                chain_members[i]->pNext = chain_members[i + 1];
+            }
+            start_of_chain = chain_members[0];
+        }
+    }
+};
+void setup_video_capabilities_chain(VkVideoCapabilitiesKHR &start, std::unique_ptr<video_capabilities_chain> &chain, AppGpu &gpu) {
+    chain = std::unique_ptr<video_capabilities_chain>(new video_capabilities_chain());
+    chain->initialize_chain(gpu);
+    start.pNext = chain->start_of_chain;
+};
+
+bool prepare_video_capabilities_twocall_chain_vectors(std::unique_ptr<video_capabilities_chain> &chain) {
+    (void)chain;
+    return false;
+}
+struct video_format_properties_chain {
+    video_format_properties_chain() = default;
+    video_format_properties_chain(const video_format_properties_chain &) = delete;
+    video_format_properties_chain &operator=(const video_format_properties_chain &) = delete;
+    video_format_properties_chain(video_format_properties_chain &&) = delete;
+    video_format_properties_chain &operator=(video_format_properties_chain &&) = delete;
+    void *start_of_chain = nullptr;
+    VkImageCreateFlags2CreateInfoKHR ImageCreateFlags2CreateInfoKHR{};
+    VkImageUsageFlags2CreateInfoKHR ImageUsageFlags2CreateInfoKHR{};
+    VkVideoFormatAV1QuantizationMapPropertiesKHR VideoFormatAV1QuantizationMapPropertiesKHR{};
+    VkVideoFormatH265QuantizationMapPropertiesKHR VideoFormatH265QuantizationMapPropertiesKHR{};
+    VkVideoFormatQuantizationMapPropertiesKHR VideoFormatQuantizationMapPropertiesKHR{};
+    void initialize_chain(AppGpu &gpu) noexcept {
+        ImageCreateFlags2CreateInfoKHR.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_FLAGS_2_CREATE_INFO_KHR;
+        ImageUsageFlags2CreateInfoKHR.sType = VK_STRUCTURE_TYPE_IMAGE_USAGE_FLAGS_2_CREATE_INFO_KHR;
+        VideoFormatAV1QuantizationMapPropertiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_FORMAT_AV1_QUANTIZATION_MAP_PROPERTIES_KHR;
+        VideoFormatH265QuantizationMapPropertiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_FORMAT_H265_QUANTIZATION_MAP_PROPERTIES_KHR;
+        VideoFormatQuantizationMapPropertiesKHR.sType = VK_STRUCTURE_TYPE_VIDEO_FORMAT_QUANTIZATION_MAP_PROPERTIES_KHR;
+        std::vector<VkBaseOutStructure *> chain_members{};
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_extended_flags))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&ImageCreateFlags2CreateInfoKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_extended_flags))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&ImageUsageFlags2CreateInfoKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoFormatAV1QuantizationMapPropertiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoFormatH265QuantizationMapPropertiesKHR));
+        if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map))
+            chain_members.push_back(reinterpret_cast<VkBaseOutStructure *>(&VideoFormatQuantizationMapPropertiesKHR));
+
+        if (!chain_members.empty()) {
+            for (size_t i = 0; i < chain_members.size() - 1; i++) {
+                chain_members[i]->pNext = chain_members[i + 1];
+            }
+            start_of_chain = chain_members[0];
+        }
+    }
+};
+void setup_video_format_properties_chain(VkVideoFormatPropertiesKHR &start, std::unique_ptr<video_format_properties_chain> &chain,
+                                         AppGpu &gpu) {
+    chain = std::unique_ptr<video_format_properties_chain>(new video_format_properties_chain());
+    chain->initialize_chain(gpu);
+    start.pNext = chain->start_of_chain;
+};
+
+bool prepare_video_format_properties_twocall_chain_vectors(std::unique_ptr<video_format_properties_chain> &chain) {
+    (void)chain;
+    return false;
+}
+auto format_ranges = std::array{
+    FormatRange{0, nullptr, static_cast<VkFormat>(0), static_cast<VkFormat>(184)},
+    FormatRange{VK_API_VERSION_1_1, nullptr, static_cast<VkFormat>(1000156000), static_cast<VkFormat>(1000156033)},
+    FormatRange{0, VK_KHR_SAMPLER_YCBCR_CONVERSION_EXTENSION_NAME, static_cast<VkFormat>(1000156000),
+                static_cast<VkFormat>(1000156033)},
+    FormatRange{VK_API_VERSION_1_3, nullptr, static_cast<VkFormat>(1000330000), static_cast<VkFormat>(1000330003)},
+    FormatRange{0, VK_EXT_YCBCR_2PLANE_444_FORMATS_EXTENSION_NAME, static_cast<VkFormat>(1000330000),
+                static_cast<VkFormat>(1000330003)},
+    FormatRange{VK_API_VERSION_1_3, nullptr, static_cast<VkFormat>(1000340000), static_cast<VkFormat>(1000340001)},
+    FormatRange{0, VK_EXT_4444_FORMATS_EXTENSION_NAME, static_cast<VkFormat>(1000340000), static_cast<VkFormat>(1000340001)},
+    FormatRange{VK_API_VERSION_1_3, nullptr, static_cast<VkFormat>(1000066000), static_cast<VkFormat>(1000066013)},
+    FormatRange{0, VK_EXT_TEXTURE_COMPRESSION_ASTC_HDR_EXTENSION_NAME, static_cast<VkFormat>(1000066000),
+                static_cast<VkFormat>(1000066013)},
+    FormatRange{VK_API_VERSION_1_4, nullptr, static_cast<VkFormat>(1000470000), static_cast<VkFormat>(1000470001)},
+    FormatRange{0, VK_KHR_MAINTENANCE_5_EXTENSION_NAME, static_cast<VkFormat>(1000470000), static_cast<VkFormat>(1000470001)},
+    FormatRange{0, VK_IMG_FORMAT_PVRTC_EXTENSION_NAME, static_cast<VkFormat>(1000054000), static_cast<VkFormat>(1000054007)},
+    FormatRange{0, VK_EXT_TEXTURE_COMPRESSION_ASTC_3D_EXTENSION_NAME, static_cast<VkFormat>(1000288000),
+                static_cast<VkFormat>(1000288029)},
+    FormatRange{0, VK_ARM_TENSORS_EXTENSION_NAME, static_cast<VkFormat>(1000460000), static_cast<VkFormat>(1000460003)},
+    FormatRange{0, VK_NV_OPTICAL_FLOW_EXTENSION_NAME, static_cast<VkFormat>(1000464000), static_cast<VkFormat>(1000464000)},
+    FormatRange{0, VK_ARM_FORMAT_PACK_EXTENSION_NAME, static_cast<VkFormat>(1000609000), static_cast<VkFormat>(1000609013)},
+};
+
+bool is_video_format_same(const VkVideoFormatPropertiesKHR &format_a, const VkVideoFormatPropertiesKHR &format_b) {
+    auto a = reinterpret_cast<const VkBaseInStructure *>(&format_a);
+    auto b = reinterpret_cast<const VkBaseInStructure *>(&format_b);
+    bool same = true;
+    while (same && a != nullptr && b != nullptr) {
+        if (a->sType != b->sType) {
+            // Structure type mismatch (extension structures are expected to be chained in the same order)
+            same = false;
+        } else {
+            switch (a->sType) {
+                case VK_STRUCTURE_TYPE_VIDEO_FORMAT_PROPERTIES_KHR:
+                    same = same && memcmp(reinterpret_cast<const char *>(a) + sizeof(VkBaseInStructure),
+                                          reinterpret_cast<const char *>(b) + sizeof(VkBaseInStructure),
+                                          sizeof(VkVideoFormatPropertiesKHR) - sizeof(VkBaseInStructure)) == 0;
+                    break;
+                case VK_STRUCTURE_TYPE_IMAGE_CREATE_FLAGS_2_CREATE_INFO_KHR:
+                    same = same && memcmp(reinterpret_cast<const char *>(a) + sizeof(VkBaseInStructure),
+                                          reinterpret_cast<const char *>(b) + sizeof(VkBaseInStructure),
+                                          sizeof(VkImageCreateFlags2CreateInfoKHR) - sizeof(VkBaseInStructure)) == 0;
+                    break;
+                case VK_STRUCTURE_TYPE_IMAGE_USAGE_FLAGS_2_CREATE_INFO_KHR:
+                    same = same && memcmp(reinterpret_cast<const char *>(a) + sizeof(VkBaseInStructure),
+                                          reinterpret_cast<const char *>(b) + sizeof(VkBaseInStructure),
+                                          sizeof(VkImageUsageFlags2CreateInfoKHR) - sizeof(VkBaseInStructure)) == 0;
+                    break;
+                case VK_STRUCTURE_TYPE_VIDEO_FORMAT_AV1_QUANTIZATION_MAP_PROPERTIES_KHR:
+                    same = same && memcmp(reinterpret_cast<const char *>(a) + sizeof(VkBaseInStructure),
+                                          reinterpret_cast<const char *>(b) + sizeof(VkBaseInStructure),
+                                          sizeof(VkVideoFormatAV1QuantizationMapPropertiesKHR) - sizeof(VkBaseInStructure)) == 0;
+                    break;
+                case VK_STRUCTURE_TYPE_VIDEO_FORMAT_H265_QUANTIZATION_MAP_PROPERTIES_KHR:
+                    same = same && memcmp(reinterpret_cast<const char *>(a) + sizeof(VkBaseInStructure),
+                                          reinterpret_cast<const char *>(b) + sizeof(VkBaseInStructure),
+                                          sizeof(VkVideoFormatH265QuantizationMapPropertiesKHR) - sizeof(VkBaseInStructure)) == 0;
+                    break;
+                case VK_STRUCTURE_TYPE_VIDEO_FORMAT_QUANTIZATION_MAP_PROPERTIES_KHR:
+                    same = same && memcmp(reinterpret_cast<const char *>(a) + sizeof(VkBaseInStructure),
+                                          reinterpret_cast<const char *>(b) + sizeof(VkBaseInStructure),
+                                          sizeof(VkVideoFormatQuantizationMapPropertiesKHR) - sizeof(VkBaseInStructure)) == 0;
+                    break;
+                default:
+                    // Unexpected structure type
+                    same = false;
+                    break;
+            }
+        }
+        a = a->pNext;
+        b = b->pNext;
+    }
+    return same;
+}
+
+std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles(AppGpu &gpu) {
+    std::vector<std::unique_ptr<AppVideoProfile>> result{};
+
+    struct ChromaSubsamplingInfo {
+        VkVideoChromaSubsamplingFlagsKHR value;
+        const char *name;
+    };
+    const std::vector<ChromaSubsamplingInfo> chroma_subsampling_list = {
+        {VK_VIDEO_CHROMA_SUBSAMPLING_420_BIT_KHR, "4:2:0"},
+        {VK_VIDEO_CHROMA_SUBSAMPLING_422_BIT_KHR, "4:2:2"},
+        {VK_VIDEO_CHROMA_SUBSAMPLING_444_BIT_KHR, "4:4:4"},
+        {VK_VIDEO_CHROMA_SUBSAMPLING_MONOCHROME_BIT_KHR, "monochrome"}};
+
+    struct BitDepthInfo {
+        VkVideoComponentBitDepthFlagsKHR value;
+        const char *name;
+    };
+    const std::vector<BitDepthInfo> bit_depth_list = {{VK_VIDEO_COMPONENT_BIT_DEPTH_8_BIT_KHR, "8"},
+                                                      {VK_VIDEO_COMPONENT_BIT_DEPTH_10_BIT_KHR, "10"},
+                                                      {VK_VIDEO_COMPONENT_BIT_DEPTH_12_BIT_KHR, "12"}};
+
+    auto find_caps_struct = [](const VkVideoCapabilitiesKHR &capabilities, VkStructureType stype) -> const VkBaseInStructure * {
+        auto p = reinterpret_cast<const VkBaseInStructure *>(&capabilities);
+        while (p != nullptr) {
+            if (p->sType == stype) {
+                return p;
+            }
+            p = p->pNext;
+        }
+        return nullptr;
+    };
+
+    auto base_format = [](const ChromaSubsamplingInfo &chroma_subsampling, const BitDepthInfo &luma_bit_depth,
+                          const BitDepthInfo &chroma_bit_depth) {
+        std::string result{};
+        result += " (";
+        result += chroma_subsampling.name;
+        result += " ";
+        result += luma_bit_depth.name;
+        if (luma_bit_depth.value != chroma_bit_depth.value) {
+            result += ":";
+            result += chroma_bit_depth.name;
+        }
+        result += "-bit)";
+        return result;
+    };
+
+    // Codecs that no queue family can run are not probed, unless no queue family reported its video properties
+    VkVideoCodecOperationFlagsKHR queue_codec_operations = 0;
+    bool found_queue_video_properties = false;
+    for (const auto &queue_family : gpu.GetQueueFamilies()) {
+        for (auto p = reinterpret_cast<const VkBaseInStructure *>(queue_family.pNext); p != nullptr; p = p->pNext) {
+            if (p->sType == VK_STRUCTURE_TYPE_QUEUE_FAMILY_VIDEO_PROPERTIES_KHR) {
+                queue_codec_operations |= reinterpret_cast<const VkQueueFamilyVideoPropertiesKHR *>(p)->videoCodecOperations;
+                found_queue_video_properties = true;
+            }
+        }
+    }
+    if (!found_queue_video_properties) {
+        queue_codec_operations = ~VkVideoCodecOperationFlagsKHR{0};
+    }
+
+    // The profiles are listed first and probed afterwards. The first profile of each codec is its base profile, the other
+    // profiles of a codec are only probed if the base profile did not fail with VK_ERROR_VIDEO_PROFILE_CODEC_NOT_SUPPORTED_KHR.
+    struct ProfileProbe {
+        std::string name;
+        VkVideoProfileInfoKHR profile_info;
+        AppVideoProfile::CreateProfileInfoChainCb create_profile_info_chain;
+        AppVideoProfile::CreateCapabilitiesChainCb create_capabilities_chain;
+        AppVideoProfile::CreateFormatPropertiesChainCbList create_format_properties_chain_list;
+        AppVideoProfile::InitProfileCb init_profile;
+        size_t base_probe;
+    };
+    std::vector<ProfileProbe> probes;
+    std::vector<size_t> base_probes;
+    std::map<VkVideoCodecOperationFlagsKHR, size_t> base_probe_of_codec;
+
+    auto add_profile = [&](const std::string &name, const VkVideoProfileInfoKHR &profile_info,
+                           AppVideoProfile::CreateProfileInfoChainCb create_profile_info_chain,
+                           AppVideoProfile::CreateCapabilitiesChainCb create_capabilities_chain,
+                           const AppVideoProfile::CreateFormatPropertiesChainCbList &create_format_properties_chain_list,
+                           AppVideoProfile::InitProfileCb init_profile) {
+        if ((queue_codec_operations & profile_info.videoCodecOperation) == 0) {
+            return;
+        }
+        auto base_probe = base_probe_of_codec.emplace(profile_info.videoCodecOperation, probes.size());
+        if (base_probe.second) {
+            base_probes.push_back(probes.size());
+        }
+        probes.push_back(ProfileProbe{name, profile_info, create_profile_info_chain, create_capabilities_chain,
+                                      create_format_properties_chain_list, init_profile, base_probe.first->second});
+    };
+
+    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_h264)) {
+        const std::string codec_name = "H.264 Decode";
+
+        for (auto chroma_subsampling : chroma_subsampling_list) {
+            for (auto luma_bit_depth : bit_depth_list) {
+                for (auto chroma_bit_depth : bit_depth_list) {
+                    if (chroma_subsampling.value == VK_VIDEO_CHROMA_SUBSAMPLING_MONOCHROME_BIT_KHR &&
+                        luma_bit_depth.value != chroma_bit_depth.value) {
+                        // Ignore the chroma bit depth dimension for monochrome
+                        continue;
+                    }
+
+                    std::string profile_base_name = codec_name + base_format(chroma_subsampling, luma_bit_depth, chroma_bit_depth);
+                    VkVideoProfileInfoKHR profile_info{VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR,
+                                                       nullptr,
+                                                       VK_VIDEO_CODEC_OPERATION_DECODE_H264_BIT_KHR,
+                                                       chroma_subsampling.value,
+                                                       luma_bit_depth.value,
+                                                       chroma_bit_depth.value};
+
+                    auto create_profile_info_chain = [&](const void **ppnext) -> std::unique_ptr<video_profile_info_chain> {
+                        auto profile_info_chain = std::make_unique<video_profile_info_chain>();
+                        if (profile_info_chain != nullptr) {
+                            profile_info_chain->VideoDecodeH264ProfileInfoKHR.sType =
+                                VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_INFO_KHR;
+                            profile_info_chain->VideoDecodeH264ProfileInfoKHR.pNext = nullptr;
+                            *ppnext = &profile_info_chain->VideoDecodeH264ProfileInfoKHR;
+                            ppnext = &profile_info_chain->VideoDecodeH264ProfileInfoKHR.pNext;
+                        }
+                        return profile_info_chain;
+                    };
+
+                    auto create_capabilities_chain = [&](void **ppnext) -> std::unique_ptr<video_capabilities_chain> {
+                        auto capabilities_chain = std::make_unique<video_capabilities_chain>();
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_queue)) {
+                                capabilities_chain->VideoDecodeCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR;
+                                capabilities_chain->VideoDecodeCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoDecodeCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoDecodeCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_h264)) {
+                                capabilities_chain->VideoDecodeH264CapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_KHR;
+                                capabilities_chain->VideoDecodeH264CapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoDecodeH264CapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoDecodeH264CapabilitiesKHR.pNext;
+                            }
+                        }
+                        return capabilities_chain;
+                    };
+
+                    const AppVideoProfile::CreateFormatPropertiesChainCbList create_format_properties_chain_list = {
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Decode Output",
+                            VK_IMAGE_USAGE_VIDEO_DECODE_DST_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "DPB",
+                            VK_IMAGE_USAGE_VIDEO_DECODE_DPB_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                    };
+
+                    add_profile(profile_base_name + " Baseline progressive", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_BASELINE;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_PROGRESSIVE_KHR;
+                                });
+                    add_profile(profile_base_name + " Main progressive", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_MAIN;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_PROGRESSIVE_KHR;
+                                });
+                    add_profile(profile_base_name + " High progressive", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_PROGRESSIVE_KHR;
+                                });
+                    add_profile(profile_base_name + " High 10 progressive", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_10;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_PROGRESSIVE_KHR;
+                                });
+                    add_profile(profile_base_name + " High 4:2:2 progressive", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_422;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_PROGRESSIVE_KHR;
+                                });
+                    add_profile(profile_base_name + " High 4:4:4 Predictive progressive", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_444_PREDICTIVE;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_PROGRESSIVE_KHR;
+                                });
+                    add_profile(profile_base_name + " Baseline interlaced (interleaved lines)", profile_info,
+                                create_profile_info_chain, create_capabilities_chain, create_format_properties_chain_list,
+                                [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_BASELINE;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_INTERLEAVED_LINES_BIT_KHR;
+                                });
+                    add_profile(profile_base_name + " Main interlaced (interleaved lines)", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_MAIN;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_INTERLEAVED_LINES_BIT_KHR;
+                                });
+                    add_profile(profile_base_name + " High interlaced (interleaved lines)", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_INTERLEAVED_LINES_BIT_KHR;
+                                });
+                    add_profile(profile_base_name + " High 10 interlaced (interleaved lines)", profile_info,
+                                create_profile_info_chain, create_capabilities_chain, create_format_properties_chain_list,
+                                [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_10;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_INTERLEAVED_LINES_BIT_KHR;
+                                });
+                    add_profile(profile_base_name + " High 4:2:2 interlaced (interleaved lines)", profile_info,
+                                create_profile_info_chain, create_capabilities_chain, create_format_properties_chain_list,
+                                [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_422;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_INTERLEAVED_LINES_BIT_KHR;
+                                });
+                    add_profile(profile_base_name + " High 4:4:4 Predictive interlaced (interleaved lines)", profile_info,
+                                create_profile_info_chain, create_capabilities_chain, create_format_properties_chain_list,
+                                [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_444_PREDICTIVE;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_INTERLEAVED_LINES_BIT_KHR;
+                                });
+                    add_profile(profile_base_name + " Baseline interlaced (separate planes)", profile_info,
+                                create_profile_info_chain, create_capabilities_chain, create_format_properties_chain_list,
+                                [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_BASELINE;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_SEPARATE_PLANES_BIT_KHR;
+                                });
+                    add_profile(profile_base_name + " Main interlaced (separate planes)", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_MAIN;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_SEPARATE_PLANES_BIT_KHR;
+                                });
+                    add_profile(profile_base_name + " High interlaced (separate planes)", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_SEPARATE_PLANES_BIT_KHR;
+                                });
+                    add_profile(profile_base_name + " High 10 interlaced (separate planes)", profile_info,
+                                create_profile_info_chain, create_capabilities_chain, create_format_properties_chain_list,
+                                [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_10;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_SEPARATE_PLANES_BIT_KHR;
+                                });
+                    add_profile(profile_base_name + " High 4:2:2 interlaced (separate planes)", profile_info,
+                                create_profile_info_chain, create_capabilities_chain, create_format_properties_chain_list,
+                                [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_422;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_SEPARATE_PLANES_BIT_KHR;
+                                });
+                    add_profile(profile_base_name + " High 4:4:4 Predictive interlaced (separate planes)", profile_info,
+                                create_profile_info_chain, create_capabilities_chain, create_format_properties_chain_list,
+                                [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_444_PREDICTIVE;
+                                    profile.profile_info_chain->VideoDecodeH264ProfileInfoKHR.pictureLayout =
+                                        VK_VIDEO_DECODE_H264_PICTURE_LAYOUT_INTERLACED_SEPARATE_PLANES_BIT_KHR;
+                                });
+                }
+            }
+        }
+    }
+
+    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_h265)) {
+        const std::string codec_name = "H.265 Decode";
+
+        for (auto chroma_subsampling : chroma_subsampling_list) {
+            for (auto luma_bit_depth : bit_depth_list) {
+                for (auto chroma_bit_depth : bit_depth_list) {
+                    if (chroma_subsampling.value == VK_VIDEO_CHROMA_SUBSAMPLING_MONOCHROME_BIT_KHR &&
+                        luma_bit_depth.value != chroma_bit_depth.value) {
+                        // Ignore the chroma bit depth dimension for monochrome
+                        continue;
+                    }
+
+                    std::string profile_base_name = codec_name + base_format(chroma_subsampling, luma_bit_depth, chroma_bit_depth);
+                    VkVideoProfileInfoKHR profile_info{VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR,
+                                                       nullptr,
+                                                       VK_VIDEO_CODEC_OPERATION_DECODE_H265_BIT_KHR,
+                                                       chroma_subsampling.value,
+                                                       luma_bit_depth.value,
+                                                       chroma_bit_depth.value};
+
+                    auto create_profile_info_chain = [&](const void **ppnext) -> std::unique_ptr<video_profile_info_chain> {
+                        auto profile_info_chain = std::make_unique<video_profile_info_chain>();
+                        if (profile_info_chain != nullptr) {
+                            profile_info_chain->VideoDecodeH265ProfileInfoKHR.sType =
+                                VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_INFO_KHR;
+                            profile_info_chain->VideoDecodeH265ProfileInfoKHR.pNext = nullptr;
+                            *ppnext = &profile_info_chain->VideoDecodeH265ProfileInfoKHR;
+                            ppnext = &profile_info_chain->VideoDecodeH265ProfileInfoKHR.pNext;
+                        }
+                        return profile_info_chain;
+                    };
+
+                    auto create_capabilities_chain = [&](void **ppnext) -> std::unique_ptr<video_capabilities_chain> {
+                        auto capabilities_chain = std::make_unique<video_capabilities_chain>();
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_queue)) {
+                                capabilities_chain->VideoDecodeCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR;
+                                capabilities_chain->VideoDecodeCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoDecodeCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoDecodeCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_h265)) {
+                                capabilities_chain->VideoDecodeH265CapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_KHR;
+                                capabilities_chain->VideoDecodeH265CapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoDecodeH265CapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoDecodeH265CapabilitiesKHR.pNext;
+                            }
+                        }
+                        return capabilities_chain;
+                    };
+
+                    const AppVideoProfile::CreateFormatPropertiesChainCbList create_format_properties_chain_list = {
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Decode Output",
+                            VK_IMAGE_USAGE_VIDEO_DECODE_DST_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "DPB",
+                            VK_IMAGE_USAGE_VIDEO_DECODE_DPB_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                    };
+
+                    add_profile(profile_base_name + " Main", profile_info, create_profile_info_chain, create_capabilities_chain,
+                                create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH265ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H265_PROFILE_IDC_MAIN;
+                                });
+                    add_profile(profile_base_name + " Main 10", profile_info, create_profile_info_chain, create_capabilities_chain,
+                                create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH265ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H265_PROFILE_IDC_MAIN_10;
+                                });
+                    add_profile(profile_base_name + " Main Still Picture", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH265ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H265_PROFILE_IDC_MAIN_STILL_PICTURE;
+                                });
+                    add_profile(profile_base_name + " Format range extensions", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH265ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H265_PROFILE_IDC_FORMAT_RANGE_EXTENSIONS;
+                                });
+                    add_profile(profile_base_name + " Screen content coding extensions", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeH265ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H265_PROFILE_IDC_SCC_EXTENSIONS;
+                                });
+                }
+            }
+        }
+    }
+
+    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_vp9)) {
+        const std::string codec_name = "VP9 Decode";
+
+        for (auto chroma_subsampling : chroma_subsampling_list) {
+            for (auto luma_bit_depth : bit_depth_list) {
+                for (auto chroma_bit_depth : bit_depth_list) {
+                    if (chroma_subsampling.value == VK_VIDEO_CHROMA_SUBSAMPLING_MONOCHROME_BIT_KHR &&
+                        luma_bit_depth.value != chroma_bit_depth.value) {
+                        // Ignore the chroma bit depth dimension for monochrome
+                        continue;
+                    }
+
+                    std::string profile_base_name = codec_name + base_format(chroma_subsampling, luma_bit_depth, chroma_bit_depth);
+                    VkVideoProfileInfoKHR profile_info{VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR,
+                                                       nullptr,
+                                                       VK_VIDEO_CODEC_OPERATION_DECODE_VP9_BIT_KHR,
+                                                       chroma_subsampling.value,
+                                                       luma_bit_depth.value,
+                                                       chroma_bit_depth.value};
+
+                    auto create_profile_info_chain = [&](const void **ppnext) -> std::unique_ptr<video_profile_info_chain> {
+                        auto profile_info_chain = std::make_unique<video_profile_info_chain>();
+                        if (profile_info_chain != nullptr) {
+                            profile_info_chain->VideoDecodeVP9ProfileInfoKHR.sType =
+                                VK_STRUCTURE_TYPE_VIDEO_DECODE_VP9_PROFILE_INFO_KHR;
+                            profile_info_chain->VideoDecodeVP9ProfileInfoKHR.pNext = nullptr;
+                            *ppnext = &profile_info_chain->VideoDecodeVP9ProfileInfoKHR;
+                            ppnext = &profile_info_chain->VideoDecodeVP9ProfileInfoKHR.pNext;
+                        }
+                        return profile_info_chain;
+                    };
+
+                    auto create_capabilities_chain = [&](void **ppnext) -> std::unique_ptr<video_capabilities_chain> {
+                        auto capabilities_chain = std::make_unique<video_capabilities_chain>();
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_queue)) {
+                                capabilities_chain->VideoDecodeCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR;
+                                capabilities_chain->VideoDecodeCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoDecodeCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoDecodeCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_vp9)) {
+                                capabilities_chain->VideoDecodeVP9CapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_DECODE_VP9_CAPABILITIES_KHR;
+                                capabilities_chain->VideoDecodeVP9CapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoDecodeVP9CapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoDecodeVP9CapabilitiesKHR.pNext;
+                            }
+                        }
+                        return capabilities_chain;
+                    };
+
+                    const AppVideoProfile::CreateFormatPropertiesChainCbList create_format_properties_chain_list = {
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Decode Output",
+                            VK_IMAGE_USAGE_VIDEO_DECODE_DST_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "DPB",
+                            VK_IMAGE_USAGE_VIDEO_DECODE_DPB_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                    };
+
+                    add_profile(profile_base_name + " Profile 0", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeVP9ProfileInfoKHR.stdProfile = STD_VIDEO_VP9_PROFILE_0;
+                                });
+                    add_profile(profile_base_name + " Profile 1", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeVP9ProfileInfoKHR.stdProfile = STD_VIDEO_VP9_PROFILE_1;
+                                });
+                    add_profile(profile_base_name + " Profile 2", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeVP9ProfileInfoKHR.stdProfile = STD_VIDEO_VP9_PROFILE_2;
+                                });
+                    add_profile(profile_base_name + " Profile 3", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeVP9ProfileInfoKHR.stdProfile = STD_VIDEO_VP9_PROFILE_3;
+                                });
+                }
+            }
+        }
+    }
+
+    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_av1)) {
+        const std::string codec_name = "AV1 Decode";
+
+        for (auto chroma_subsampling : chroma_subsampling_list) {
+            for (auto luma_bit_depth : bit_depth_list) {
+                for (auto chroma_bit_depth : bit_depth_list) {
+                    if (chroma_subsampling.value == VK_VIDEO_CHROMA_SUBSAMPLING_MONOCHROME_BIT_KHR &&
+                        luma_bit_depth.value != chroma_bit_depth.value) {
+                        // Ignore the chroma bit depth dimension for monochrome
+                        continue;
+                    }
+
+                    std::string profile_base_name = codec_name + base_format(chroma_subsampling, luma_bit_depth, chroma_bit_depth);
+                    VkVideoProfileInfoKHR profile_info{VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR,
+                                                       nullptr,
+                                                       VK_VIDEO_CODEC_OPERATION_DECODE_AV1_BIT_KHR,
+                                                       chroma_subsampling.value,
+                                                       luma_bit_depth.value,
+                                                       chroma_bit_depth.value};
+
+                    auto create_profile_info_chain = [&](const void **ppnext) -> std::unique_ptr<video_profile_info_chain> {
+                        auto profile_info_chain = std::make_unique<video_profile_info_chain>();
+                        if (profile_info_chain != nullptr) {
+                            profile_info_chain->VideoDecodeAV1ProfileInfoKHR.sType =
+                                VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_PROFILE_INFO_KHR;
+                            profile_info_chain->VideoDecodeAV1ProfileInfoKHR.pNext = nullptr;
+                            *ppnext = &profile_info_chain->VideoDecodeAV1ProfileInfoKHR;
+                            ppnext = &profile_info_chain->VideoDecodeAV1ProfileInfoKHR.pNext;
+                        }
+                        return profile_info_chain;
+                    };
+
+                    auto create_capabilities_chain = [&](void **ppnext) -> std::unique_ptr<video_capabilities_chain> {
+                        auto capabilities_chain = std::make_unique<video_capabilities_chain>();
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_queue)) {
+                                capabilities_chain->VideoDecodeCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR;
+                                capabilities_chain->VideoDecodeCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoDecodeCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoDecodeCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_decode_av1)) {
+                                capabilities_chain->VideoDecodeAV1CapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_DECODE_AV1_CAPABILITIES_KHR;
+                                capabilities_chain->VideoDecodeAV1CapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoDecodeAV1CapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoDecodeAV1CapabilitiesKHR.pNext;
+                            }
+                        }
+                        return capabilities_chain;
+                    };
+
+                    const AppVideoProfile::CreateFormatPropertiesChainCbList create_format_properties_chain_list = {
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Decode Output",
+                            VK_IMAGE_USAGE_VIDEO_DECODE_DST_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "DPB",
+                            VK_IMAGE_USAGE_VIDEO_DECODE_DPB_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                    };
+
+                    add_profile(profile_base_name + " Main with film grain support", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.stdProfile =
+                                        STD_VIDEO_AV1_PROFILE_MAIN;
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.filmGrainSupport = VK_TRUE;
+                                });
+                    add_profile(profile_base_name + " High with film grain support", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.stdProfile =
+                                        STD_VIDEO_AV1_PROFILE_HIGH;
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.filmGrainSupport = VK_TRUE;
+                                });
+                    add_profile(profile_base_name + " Professional with film grain support", profile_info,
+                                create_profile_info_chain, create_capabilities_chain, create_format_properties_chain_list,
+                                [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.stdProfile =
+                                        STD_VIDEO_AV1_PROFILE_PROFESSIONAL;
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.filmGrainSupport = VK_TRUE;
+                                });
+                    add_profile(profile_base_name + " Main without film grain support", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.stdProfile =
+                                        STD_VIDEO_AV1_PROFILE_MAIN;
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.filmGrainSupport = VK_FALSE;
+                                });
+                    add_profile(profile_base_name + " High without film grain support", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.stdProfile =
+                                        STD_VIDEO_AV1_PROFILE_HIGH;
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.filmGrainSupport = VK_FALSE;
+                                });
+                    add_profile(profile_base_name + " Professional without film grain support", profile_info,
+                                create_profile_info_chain, create_capabilities_chain, create_format_properties_chain_list,
+                                [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.stdProfile =
+                                        STD_VIDEO_AV1_PROFILE_PROFESSIONAL;
+                                    profile.profile_info_chain->VideoDecodeAV1ProfileInfoKHR.filmGrainSupport = VK_FALSE;
+                                });
+                }
+            }
+        }
+    }
+
+    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_h264)) {
+        const std::string codec_name = "H.264 Encode";
+
+        for (auto chroma_subsampling : chroma_subsampling_list) {
+            for (auto luma_bit_depth : bit_depth_list) {
+                for (auto chroma_bit_depth : bit_depth_list) {
+                    if (chroma_subsampling.value == VK_VIDEO_CHROMA_SUBSAMPLING_MONOCHROME_BIT_KHR &&
+                        luma_bit_depth.value != chroma_bit_depth.value) {
+                        // Ignore the chroma bit depth dimension for monochrome
+                        continue;
+                    }
+
+                    std::string profile_base_name = codec_name + base_format(chroma_subsampling, luma_bit_depth, chroma_bit_depth);
+                    VkVideoProfileInfoKHR profile_info{VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR,
+                                                       nullptr,
+                                                       VK_VIDEO_CODEC_OPERATION_ENCODE_H264_BIT_KHR,
+                                                       chroma_subsampling.value,
+                                                       luma_bit_depth.value,
+                                                       chroma_bit_depth.value};
+
+                    auto create_profile_info_chain = [&](const void **ppnext) -> std::unique_ptr<video_profile_info_chain> {
+                        auto profile_info_chain = std::make_unique<video_profile_info_chain>();
+                        if (profile_info_chain != nullptr) {
+                            profile_info_chain->VideoEncodeH264ProfileInfoKHR.sType =
+                                VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_INFO_KHR;
+                            profile_info_chain->VideoEncodeH264ProfileInfoKHR.pNext = nullptr;
+                            *ppnext = &profile_info_chain->VideoEncodeH264ProfileInfoKHR;
+                            ppnext = &profile_info_chain->VideoEncodeH264ProfileInfoKHR.pNext;
+                        }
+                        return profile_info_chain;
+                    };
+
+                    auto create_capabilities_chain = [&](void **ppnext) -> std::unique_ptr<video_capabilities_chain> {
+                        auto capabilities_chain = std::make_unique<video_capabilities_chain>();
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_queue)) {
+                                capabilities_chain->VideoEncodeCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUANTIZATION_MAP_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_intra_refresh)) {
+                                capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_INTRA_REFRESH_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_feedback2)) {
+                                capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_FEEDBACK_2_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::VALVE_video_encode_rgb_conversion)) {
+                                capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_RGB_CONVERSION_CAPABILITIES_VALVE;
+                                capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE;
+                                ppnext = &capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_h264)) {
+                                capabilities_chain->VideoEncodeH264CapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeH264CapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeH264CapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeH264CapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                capabilities_chain->VideoEncodeH264QuantizationMapCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_QUANTIZATION_MAP_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeH264QuantizationMapCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeH264QuantizationMapCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeH264QuantizationMapCapabilitiesKHR.pNext;
+                            }
+                        }
+                        return capabilities_chain;
+                    };
+
+                    const AppVideoProfile::CreateFormatPropertiesChainCbList create_format_properties_chain_list = {
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Encode Input",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_SRC_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "DPB",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_DPB_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Quantization Delta Map",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_QUANTIZATION_DELTA_MAP_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_queue)) {
+                                    auto caps = reinterpret_cast<const VkVideoEncodeCapabilitiesKHR *>(
+                                        find_caps_struct(capabilities, VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR));
+                                    if (caps != nullptr) {
+                                        supported =
+                                            supported &&
+                                            ((caps->flags & VK_VIDEO_ENCODE_CAPABILITY_QUANTIZATION_DELTA_MAP_BIT_KHR) != 0);
+                                    } else {
+                                        supported = false;
+                                    }
+                                } else {
+                                    supported = false;
+                                }
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                if (format_properties_chain != nullptr) {
+                                    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.sType =
+                                            VK_STRUCTURE_TYPE_VIDEO_FORMAT_QUANTIZATION_MAP_PROPERTIES_KHR;
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext = nullptr;
+                                        *ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR;
+                                        ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext;
+                                    }
+                                }
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Emphasis Map",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_EMPHASIS_MAP_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_queue)) {
+                                    auto caps = reinterpret_cast<const VkVideoEncodeCapabilitiesKHR *>(
+                                        find_caps_struct(capabilities, VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR));
+                                    if (caps != nullptr) {
+                                        supported =
+                                            supported && ((caps->flags & VK_VIDEO_ENCODE_CAPABILITY_EMPHASIS_MAP_BIT_KHR) != 0);
+                                    } else {
+                                        supported = false;
+                                    }
+                                } else {
+                                    supported = false;
+                                }
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                if (format_properties_chain != nullptr) {
+                                    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.sType =
+                                            VK_STRUCTURE_TYPE_VIDEO_FORMAT_QUANTIZATION_MAP_PROPERTIES_KHR;
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext = nullptr;
+                                        *ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR;
+                                        ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext;
+                                    }
+                                }
+                                return format_properties_chain;
+                            },
+                        },
+                    };
+
+                    add_profile(profile_base_name + " Baseline", profile_info, create_profile_info_chain, create_capabilities_chain,
+                                create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_BASELINE;
+                                });
+                    add_profile(profile_base_name + " Main", profile_info, create_profile_info_chain, create_capabilities_chain,
+                                create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_MAIN;
+                                });
+                    add_profile(profile_base_name + " High", profile_info, create_profile_info_chain, create_capabilities_chain,
+                                create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH;
+                                });
+                    add_profile(profile_base_name + " High 10", profile_info, create_profile_info_chain, create_capabilities_chain,
+                                create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_10;
+                                });
+                    add_profile(profile_base_name + " High 4:2:2", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_422;
+                                });
+                    add_profile(profile_base_name + " High 4:4:4 Predictive", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeH264ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H264_PROFILE_IDC_HIGH_444_PREDICTIVE;
+                                });
+                }
+            }
+        }
+    }
+
+    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_h265)) {
+        const std::string codec_name = "H.265 Encode";
+
+        for (auto chroma_subsampling : chroma_subsampling_list) {
+            for (auto luma_bit_depth : bit_depth_list) {
+                for (auto chroma_bit_depth : bit_depth_list) {
+                    if (chroma_subsampling.value == VK_VIDEO_CHROMA_SUBSAMPLING_MONOCHROME_BIT_KHR &&
+                        luma_bit_depth.value != chroma_bit_depth.value) {
+                        // Ignore the chroma bit depth dimension for monochrome
+                        continue;
+                    }
+
+                    std::string profile_base_name = codec_name + base_format(chroma_subsampling, luma_bit_depth, chroma_bit_depth);
+                    VkVideoProfileInfoKHR profile_info{VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR,
+                                                       nullptr,
+                                                       VK_VIDEO_CODEC_OPERATION_ENCODE_H265_BIT_KHR,
+                                                       chroma_subsampling.value,
+                                                       luma_bit_depth.value,
+                                                       chroma_bit_depth.value};
+
+                    auto create_profile_info_chain = [&](const void **ppnext) -> std::unique_ptr<video_profile_info_chain> {
+                        auto profile_info_chain = std::make_unique<video_profile_info_chain>();
+                        if (profile_info_chain != nullptr) {
+                            profile_info_chain->VideoEncodeH265ProfileInfoKHR.sType =
+                                VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_INFO_KHR;
+                            profile_info_chain->VideoEncodeH265ProfileInfoKHR.pNext = nullptr;
+                            *ppnext = &profile_info_chain->VideoEncodeH265ProfileInfoKHR;
+                            ppnext = &profile_info_chain->VideoEncodeH265ProfileInfoKHR.pNext;
+                        }
+                        return profile_info_chain;
+                    };
+
+                    auto create_capabilities_chain = [&](void **ppnext) -> std::unique_ptr<video_capabilities_chain> {
+                        auto capabilities_chain = std::make_unique<video_capabilities_chain>();
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_queue)) {
+                                capabilities_chain->VideoEncodeCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUANTIZATION_MAP_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_intra_refresh)) {
+                                capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_INTRA_REFRESH_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_feedback2)) {
+                                capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_FEEDBACK_2_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::VALVE_video_encode_rgb_conversion)) {
+                                capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_RGB_CONVERSION_CAPABILITIES_VALVE;
+                                capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE;
+                                ppnext = &capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_h265)) {
+                                capabilities_chain->VideoEncodeH265CapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeH265CapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeH265CapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeH265CapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                capabilities_chain->VideoEncodeH265QuantizationMapCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_QUANTIZATION_MAP_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeH265QuantizationMapCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeH265QuantizationMapCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeH265QuantizationMapCapabilitiesKHR.pNext;
+                            }
+                        }
+                        return capabilities_chain;
+                    };
+
+                    const AppVideoProfile::CreateFormatPropertiesChainCbList create_format_properties_chain_list = {
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Encode Input",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_SRC_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "DPB",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_DPB_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Quantization Delta Map",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_QUANTIZATION_DELTA_MAP_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_queue)) {
+                                    auto caps = reinterpret_cast<const VkVideoEncodeCapabilitiesKHR *>(
+                                        find_caps_struct(capabilities, VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR));
+                                    if (caps != nullptr) {
+                                        supported =
+                                            supported &&
+                                            ((caps->flags & VK_VIDEO_ENCODE_CAPABILITY_QUANTIZATION_DELTA_MAP_BIT_KHR) != 0);
+                                    } else {
+                                        supported = false;
+                                    }
+                                } else {
+                                    supported = false;
+                                }
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                if (format_properties_chain != nullptr) {
+                                    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.sType =
+                                            VK_STRUCTURE_TYPE_VIDEO_FORMAT_QUANTIZATION_MAP_PROPERTIES_KHR;
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext = nullptr;
+                                        *ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR;
+                                        ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext;
+                                    }
+                                }
+                                if (format_properties_chain != nullptr) {
+                                    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                        format_properties_chain->VideoFormatH265QuantizationMapPropertiesKHR.sType =
+                                            VK_STRUCTURE_TYPE_VIDEO_FORMAT_H265_QUANTIZATION_MAP_PROPERTIES_KHR;
+                                        format_properties_chain->VideoFormatH265QuantizationMapPropertiesKHR.pNext = nullptr;
+                                        *ppnext = &format_properties_chain->VideoFormatH265QuantizationMapPropertiesKHR;
+                                        ppnext = &format_properties_chain->VideoFormatH265QuantizationMapPropertiesKHR.pNext;
+                                    }
+                                }
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Emphasis Map",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_EMPHASIS_MAP_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_queue)) {
+                                    auto caps = reinterpret_cast<const VkVideoEncodeCapabilitiesKHR *>(
+                                        find_caps_struct(capabilities, VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR));
+                                    if (caps != nullptr) {
+                                        supported =
+                                            supported && ((caps->flags & VK_VIDEO_ENCODE_CAPABILITY_EMPHASIS_MAP_BIT_KHR) != 0);
+                                    } else {
+                                        supported = false;
+                                    }
+                                } else {
+                                    supported = false;
+                                }
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                if (format_properties_chain != nullptr) {
+                                    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.sType =
+                                            VK_STRUCTURE_TYPE_VIDEO_FORMAT_QUANTIZATION_MAP_PROPERTIES_KHR;
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext = nullptr;
+                                        *ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR;
+                                        ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext;
+                                    }
+                                }
+                                if (format_properties_chain != nullptr) {
+                                    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                        format_properties_chain->VideoFormatH265QuantizationMapPropertiesKHR.sType =
+                                            VK_STRUCTURE_TYPE_VIDEO_FORMAT_H265_QUANTIZATION_MAP_PROPERTIES_KHR;
+                                        format_properties_chain->VideoFormatH265QuantizationMapPropertiesKHR.pNext = nullptr;
+                                        *ppnext = &format_properties_chain->VideoFormatH265QuantizationMapPropertiesKHR;
+                                        ppnext = &format_properties_chain->VideoFormatH265QuantizationMapPropertiesKHR.pNext;
+                                    }
+                                }
+                                return format_properties_chain;
+                            },
+                        },
+                    };
+
+                    add_profile(profile_base_name + " Main", profile_info, create_profile_info_chain, create_capabilities_chain,
+                                create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeH265ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H265_PROFILE_IDC_MAIN;
+                                });
+                    add_profile(profile_base_name + " Main 10", profile_info, create_profile_info_chain, create_capabilities_chain,
+                                create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeH265ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H265_PROFILE_IDC_MAIN_10;
+                                });
+                    add_profile(profile_base_name + " Main Still Picture", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeH265ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H265_PROFILE_IDC_MAIN_STILL_PICTURE;
+                                });
+                    add_profile(profile_base_name + " Format range extensions", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeH265ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H265_PROFILE_IDC_FORMAT_RANGE_EXTENSIONS;
+                                });
+                    add_profile(profile_base_name + " Screen content coding extensions", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeH265ProfileInfoKHR.stdProfileIdc =
+                                        STD_VIDEO_H265_PROFILE_IDC_SCC_EXTENSIONS;
+                                });
+                }
+            }
+        }
+    }
+
+    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_av1)) {
+        const std::string codec_name = "AV1 Encode";
+
+        for (auto chroma_subsampling : chroma_subsampling_list) {
+            for (auto luma_bit_depth : bit_depth_list) {
+                for (auto chroma_bit_depth : bit_depth_list) {
+                    if (chroma_subsampling.value == VK_VIDEO_CHROMA_SUBSAMPLING_MONOCHROME_BIT_KHR &&
+                        luma_bit_depth.value != chroma_bit_depth.value) {
+                        // Ignore the chroma bit depth dimension for monochrome
+                        continue;
+                    }
+
+                    std::string profile_base_name = codec_name + base_format(chroma_subsampling, luma_bit_depth, chroma_bit_depth);
+                    VkVideoProfileInfoKHR profile_info{VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR,
+                                                       nullptr,
+                                                       VK_VIDEO_CODEC_OPERATION_ENCODE_AV1_BIT_KHR,
+                                                       chroma_subsampling.value,
+                                                       luma_bit_depth.value,
+                                                       chroma_bit_depth.value};
+
+                    auto create_profile_info_chain = [&](const void **ppnext) -> std::unique_ptr<video_profile_info_chain> {
+                        auto profile_info_chain = std::make_unique<video_profile_info_chain>();
+                        if (profile_info_chain != nullptr) {
+                            profile_info_chain->VideoEncodeAV1ProfileInfoKHR.sType =
+                                VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_PROFILE_INFO_KHR;
+                            profile_info_chain->VideoEncodeAV1ProfileInfoKHR.pNext = nullptr;
+                            *ppnext = &profile_info_chain->VideoEncodeAV1ProfileInfoKHR;
+                            ppnext = &profile_info_chain->VideoEncodeAV1ProfileInfoKHR.pNext;
+                        }
+                        return profile_info_chain;
+                    };
+
+                    auto create_capabilities_chain = [&](void **ppnext) -> std::unique_ptr<video_capabilities_chain> {
+                        auto capabilities_chain = std::make_unique<video_capabilities_chain>();
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_queue)) {
+                                capabilities_chain->VideoEncodeCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUANTIZATION_MAP_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeQuantizationMapCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_intra_refresh)) {
+                                capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_INTRA_REFRESH_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeIntraRefreshCapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_feedback2)) {
+                                capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_FEEDBACK_2_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeFeedback2CapabilitiesKHR.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::VALVE_video_encode_rgb_conversion)) {
+                                capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_RGB_CONVERSION_CAPABILITIES_VALVE;
+                                capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE;
+                                ppnext = &capabilities_chain->VideoEncodeRgbConversionCapabilitiesVALVE.pNext;
+                            }
+                        }
+                        if (capabilities_chain != nullptr) {
+                            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_av1)) {
+                                capabilities_chain->VideoEncodeAV1CapabilitiesKHR.sType =
+                                    VK_STRUCTURE_TYPE_VIDEO_ENCODE_AV1_CAPABILITIES_KHR;
+                                capabilities_chain->VideoEncodeAV1CapabilitiesKHR.pNext = nullptr;
+                                *ppnext = &capabilities_chain->VideoEncodeAV1CapabilitiesKHR;
+                                ppnext = &capabilities_chain->VideoEncodeAV1CapabilitiesKHR.pNext;
+                            }
+                        }
+                        return capabilities_chain;
+                    };
+
+                    const AppVideoProfile::CreateFormatPropertiesChainCbList create_format_properties_chain_list = {
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Encode Input",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_SRC_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "DPB",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_DPB_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Quantization Delta Map",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_QUANTIZATION_DELTA_MAP_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_queue)) {
+                                    auto caps = reinterpret_cast<const VkVideoEncodeCapabilitiesKHR *>(
+                                        find_caps_struct(capabilities, VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR));
+                                    if (caps != nullptr) {
+                                        supported =
+                                            supported &&
+                                            ((caps->flags & VK_VIDEO_ENCODE_CAPABILITY_QUANTIZATION_DELTA_MAP_BIT_KHR) != 0);
+                                    } else {
+                                        supported = false;
+                                    }
+                                } else {
+                                    supported = false;
+                                }
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                if (format_properties_chain != nullptr) {
+                                    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.sType =
+                                            VK_STRUCTURE_TYPE_VIDEO_FORMAT_QUANTIZATION_MAP_PROPERTIES_KHR;
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext = nullptr;
+                                        *ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR;
+                                        ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext;
+                                    }
+                                }
+                                if (format_properties_chain != nullptr) {
+                                    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                        format_properties_chain->VideoFormatAV1QuantizationMapPropertiesKHR.sType =
+                                            VK_STRUCTURE_TYPE_VIDEO_FORMAT_AV1_QUANTIZATION_MAP_PROPERTIES_KHR;
+                                        format_properties_chain->VideoFormatAV1QuantizationMapPropertiesKHR.pNext = nullptr;
+                                        *ppnext = &format_properties_chain->VideoFormatAV1QuantizationMapPropertiesKHR;
+                                        ppnext = &format_properties_chain->VideoFormatAV1QuantizationMapPropertiesKHR.pNext;
+                                    }
+                                }
+                                return format_properties_chain;
+                            },
+                        },
+                        AppVideoProfile::CreateFormatPropertiesChainCb{
+                            "Emphasis Map",
+                            VK_IMAGE_USAGE_VIDEO_ENCODE_EMPHASIS_MAP_BIT_KHR,
+                            [&](const VkVideoCapabilitiesKHR &capabilities) -> bool {
+                                bool supported = true;
+                                if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_queue)) {
+                                    auto caps = reinterpret_cast<const VkVideoEncodeCapabilitiesKHR *>(
+                                        find_caps_struct(capabilities, VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR));
+                                    if (caps != nullptr) {
+                                        supported =
+                                            supported && ((caps->flags & VK_VIDEO_ENCODE_CAPABILITY_EMPHASIS_MAP_BIT_KHR) != 0);
+                                    } else {
+                                        supported = false;
+                                    }
+                                } else {
+                                    supported = false;
+                                }
+                                return supported;
+                            },
+                            [&](void **ppnext) -> std::unique_ptr<video_format_properties_chain> {
+                                auto format_properties_chain = std::make_unique<video_format_properties_chain>();
+                                if (format_properties_chain != nullptr) {
+                                    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.sType =
+                                            VK_STRUCTURE_TYPE_VIDEO_FORMAT_QUANTIZATION_MAP_PROPERTIES_KHR;
+                                        format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext = nullptr;
+                                        *ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR;
+                                        ppnext = &format_properties_chain->VideoFormatQuantizationMapPropertiesKHR.pNext;
+                                    }
+                                }
+                                if (format_properties_chain != nullptr) {
+                                    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_video_encode_quantization_map)) {
+                                        format_properties_chain->VideoFormatAV1QuantizationMapPropertiesKHR.sType =
+                                            VK_STRUCTURE_TYPE_VIDEO_FORMAT_AV1_QUANTIZATION_MAP_PROPERTIES_KHR;
+                                        format_properties_chain->VideoFormatAV1QuantizationMapPropertiesKHR.pNext = nullptr;
+                                        *ppnext = &format_properties_chain->VideoFormatAV1QuantizationMapPropertiesKHR;
+                                        ppnext = &format_properties_chain->VideoFormatAV1QuantizationMapPropertiesKHR.pNext;
+                                    }
+                                }
+                                return format_properties_chain;
+                            },
+                        },
+                    };
+
+                    add_profile(profile_base_name + " Main", profile_info, create_profile_info_chain, create_capabilities_chain,
+                                create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeAV1ProfileInfoKHR.stdProfile =
+                                        STD_VIDEO_AV1_PROFILE_MAIN;
+                                });
+                    add_profile(profile_base_name + " High", profile_info, create_profile_info_chain, create_capabilities_chain,
+                                create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeAV1ProfileInfoKHR.stdProfile =
+                                        STD_VIDEO_AV1_PROFILE_HIGH;
+                                });
+                    add_profile(profile_base_name + " Professional", profile_info, create_profile_info_chain,
+                                create_capabilities_chain, create_format_properties_chain_list, [](AppVideoProfile &profile) {
+                                    profile.profile_info_chain->VideoEncodeAV1ProfileInfoKHR.stdProfile =
+                                        STD_VIDEO_AV1_PROFILE_PROFESSIONAL;
+                                });
+                }
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<AppVideoProfile>> probed(probes.size());
+    auto probe = [&](size_t i) {
+        const ProfileProbe &info = probes[i];
+        probed[i] = std::make_unique<AppVideoProfile>(gpu, gpu.phys_device, info.name, info.profile_info,
+                                                      info.create_profile_info_chain, info.create_capabilities_chain,
+                                                      info.create_format_properties_chain_list, info.init_profile);
+    };
+    RunParallelTasks(base_probes.size(), gpu.video_profile_jobs, [&](size_t i) { probe(base_probes[i]); });
+
+    std::vector<size_t> remaining_probes;
+    for (size_t i = 0; i < probes.size(); i++) {
+        if (probed[i] == nullptr &&
+            probed[probes[i].base_probe]->capabilities_result != VK_ERROR_VIDEO_PROFILE_CODEC_NOT_SUPPORTED_KHR) {
+            remaining_probes.push_back(i);
+        }
+    }
+    RunParallelTasks(remaining_probes.size(), gpu.video_profile_jobs, [&](size_t i) { probe(remaining_probes[i]); });
+
+    // Every probe wrote only to its own slot, so the profiles keep the order they were listed in
+    for (auto &profile : probed) {
+        if (profile != nullptr && profile->supported) {
+            result.push_back(std::move(profile));
+        }
+    }
+    return result;
+}
@@ -0,0 +1,999 @@
+
+/*
+ * Copyright (c) 2019-2026 The Khronos Group Inc.
+ * Copyright (c) 2019-2026 Valve Corporation
+ * Copyright (c) 2019-2026 LunarG, Inc.
+ * Copyright (c) 2023-2024 RasterGrid Kft.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Author: Charles Giessen <charles@lunarg.com>
+ *
+ */
+
+/*
+ * This file is generated from the Khronos Vulkan XML API Registry.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+// Every extension in the registry, sorted by name so the value of an extension is its index in app_extension_names
+enum class AppExtension : uint32_t {
+    AMDX_dense_geometry_format,
+    AMDX_shader_enqueue,
+    AMD_anti_lag,
+    AMD_buffer_marker,
+    AMD_device_coherent_memory,
+    AMD_display_native_hdr,
+    AMD_draw_indirect_count,
+    AMD_gcn_shader,
+    AMD_gpa_interface,
+    AMD_gpu_shader_half_float,
+    AMD_gpu_shader_int16,
+    AMD_memory_overallocation_behavior,
+    AMD_mixed_attachment_samples,
+    AMD_negative_viewport_height,
+    AMD_pipeline_compiler_control,
+    AMD_rasterization_order,
+    AMD_shader_ballot,
+    AMD_shader_core_properties,
+    AMD_shader_core_properties2,
+    AMD_shader_early_and_late_fragment_tests,
+    AMD_shader_explicit_vertex_parameter,
+    AMD_shader_fragment_mask,
+    AMD_shader_image_load_store_lod,
+    AMD_shader_info,
+    AMD_shader_trinary_minmax,
+    AMD_texture_gather_bias_lod,
+    ANDROID_external_format_resolve,
+    ANDROID_external_memory_android_hardware_buffer,
+    ARM_data_graph,
+    ARM_data_graph_instruction_set_tosa,
+    ARM_data_graph_neural_accelerator_statistics,
+    ARM_data_graph_optical_flow,
+    ARM_format_pack,
+    ARM_performance_counters_by_region,
+    ARM_pipeline_opacity_micromap,
+    ARM_rasterization_order_attachment_access,
+    ARM_render_pass_striped,
+    ARM_scheduling_controls,
+    ARM_shader_core_builtins,
+    ARM_shader_core_properties,
+    ARM_shader_instrumentation,
+    ARM_tensor_controls,
+    ARM_tensors,
+    EXT_4444_formats,
+    EXT_acquire_drm_display,
+    EXT_acquire_xlib_display,
+    EXT_astc_decode_mode,
+    EXT_attachment_feedback_loop_dynamic_state,
+    EXT_attachment_feedback_loop_layout,
+    EXT_blend_operation_advanced,
+    EXT_border_color_swizzle,
+    EXT_buffer_device_address,
+    EXT_calibrated_timestamps,
+    EXT_color_write_enable,
+    EXT_conditional_rendering,
+    EXT_conservative_rasterization,
+    EXT_cooperative_matrix_maintenance1,
+    EXT_custom_border_color,
+    EXT_custom_resolve,
+    EXT_debug_marker,
+    EXT_debug_report,
+    EXT_debug_utils,
+    EXT_depth_bias_control,
+    EXT_depth_clamp_control,
+    EXT_depth_clamp_zero_one,
+    EXT_depth_clip_control,
+    EXT_depth_clip_enable,
+    EXT_depth_range_unrestricted,
+    EXT_descriptor_buffer,
+    EXT_descriptor_heap,
+    EXT_descriptor_indexing,
+    EXT_device_address_binding_report,
+    EXT_device_fault,
+    EXT_device_generated_commands,
+    EXT_device_memory_report,
+    EXT_direct_mode_display,
+    EXT_directfb_surface,
+    EXT_discard_rectangles,
+    EXT_display_control,
+    EXT_display_surface_counter,
+    EXT_dynamic_rendering_unused_attachments,
+    EXT_extended_dynamic_state,
+    EXT_extended_dynamic_state2,
+    EXT_extended_dynamic_state3,
+    EXT_external_memory_acquire_unmodified,
+    EXT_external_memory_dma_buf,
+    EXT_external_memory_host,
+    EXT_external_memory_metal,
+    EXT_filter_cubic,
+    EXT_fragment_density_map,
+    EXT_fragment_density_map2,
+    EXT_fragment_density_map_offset,
+    EXT_fragment_shader_interlock,
+    EXT_frame_boundary,
+    EXT_full_screen_exclusive,
+    EXT_global_priority,
+    EXT_global_priority_query,
+    EXT_graphics_pipeline_library,
+    EXT_hdr_metadata,
+    EXT_headless_surface,
+    EXT_host_image_copy,
+    EXT_host_query_reset,
+    EXT_image_2d_view_of_3d,
+    EXT_image_compression_control,
+    EXT_image_compression_control_swapchain,
+    EXT_image_drm_format_modifier,
+    EXT_image_robustness,
+    EXT_image_sliced_view_of_3d,
+    EXT_image_tiling_control,
+    EXT_image_view_min_lod,
+    EXT_index_type_uint8,
+    EXT_inline_uniform_block,
+    EXT_layer_settings,
+    EXT_legacy_dithering,
+    EXT_legacy_vertex_attributes,
+    EXT_line_rasterization,
+    EXT_load_store_op_none,
+    EXT_map_memory_placed,
+    EXT_memory_budget,
+    EXT_memory_decompression,
+    EXT_memory_priority,
+    EXT_mesh_shader,
+    EXT_metal_objects,
+    EXT_metal_surface,
+    EXT_multi_draw,
+    EXT_multisampled_render_to_single_sampled,
+    EXT_multisampled_render_to_swapchain,
+    EXT_mutable_descriptor_type,
+    EXT_nested_command_buffer,
+    EXT_non_seamless_cube_map,
+    EXT_opacity_micromap,
+    EXT_pageable_device_local_memory,
+    EXT_pci_bus_info,
+    EXT_physical_device_drm,
+    EXT_pipeline_creation_cache_control,
+    EXT_pipeline_creation_feedback,
+    EXT_pipeline_library_group_handles,
+    EXT_pipeline_properties,
+    EXT_pipeline_protected_access,
+    EXT_pipeline_robustness,
+    EXT_post_depth_coverage,
+    EXT_present_mode_fifo_latest_ready,
+    EXT_present_timing,
+    EXT_primitive_restart_index,
+    EXT_primitive_topology_list_restart,
+    EXT_primitives_generated_query,
+    EXT_private_data,
+    EXT_provoking_vertex,
+    EXT_queue_family_foreign,
+    EXT_rasterization_order_attachment_access,
+    EXT_ray_tracing_invocation_reorder,
+    EXT_rgba10x6_formats,
+    EXT_robustness2,
+    EXT_sample_locations,
+    EXT_sampler_filter_minmax,
+    EXT_scalar_block_layout,
+    EXT_separate_stencil_usage,
+    EXT_shader_64bit_indexing,
+    EXT_shader_atomic_float,
+    EXT_shader_atomic_float2,
+    EXT_shader_demote_to_helper_invocation,
+    EXT_shader_float8,
+    EXT_shader_image_atomic_int64,
+    EXT_shader_long_vector,
+    EXT_shader_module_identifier,
+    EXT_shader_object,
+    EXT_shader_ocp_microscaling_types,
+    EXT_shader_replicated_composites,
+    EXT_shader_split_barrier,
+    EXT_shader_stencil_export,
+    EXT_shader_subgroup_ballot,
+    EXT_shader_subgroup_partitioned,
+    EXT_shader_subgroup_vote,
+    EXT_shader_tile_image,
+    EXT_shader_uniform_buffer_unsized_array,
+    EXT_shader_viewport_index_layer,
+    EXT_subgroup_size_control,
+    EXT_subpass_merge_feedback,
+    EXT_surface_maintenance1,
+    EXT_swapchain_colorspace,
+    EXT_swapchain_maintenance1,
+    EXT_texel_buffer_alignment,
+    EXT_texture_compression_astc_3d,
+    EXT_texture_compression_astc_hdr,
+    EXT_tooling_info,
+    EXT_transform_feedback,
+    EXT_validation_cache,
+    EXT_validation_features,
+    EXT_validation_flags,
+    EXT_vertex_attribute_divisor,
+    EXT_vertex_attribute_robustness,
+    EXT_vertex_input_dynamic_state,
+    EXT_ycbcr_2plane_444_formats,
+    EXT_ycbcr_image_arrays,
+    EXT_zero_initialize_device_memory,
+    FUCHSIA_buffer_collection,
+    FUCHSIA_external_memory,
+    FUCHSIA_external_semaphore,
+    FUCHSIA_imagepipe_surface,
+    GGP_frame_token,
+    GGP_stream_descriptor_surface,
+    GOOGLE_decorate_string,
+    GOOGLE_display_timing,
+    GOOGLE_hlsl_functionality1,
+    GOOGLE_surfaceless_query,
+    GOOGLE_user_type,
+    HUAWEI_cluster_culling_shader,
+    HUAWEI_hdr_vivid,
+    HUAWEI_invocation_mask,
+    HUAWEI_subpass_shading,
+    IMG_filter_cubic,
+    IMG_filter_linear_2d,
+    IMG_format_pvrtc,
+    IMG_relaxed_line_rasterization,
+    INTEL_performance_query,
+    INTEL_shader_integer_functions2,
+    KHR_16bit_storage,
+    KHR_8bit_storage,
+    KHR_acceleration_structure,
+    KHR_android_surface,
+    KHR_bind_memory2,
+    KHR_buffer_device_address,
+    KHR_calibrated_timestamps,
+    KHR_compute_shader_derivatives,
+    KHR_cooperative_matrix,
+    KHR_copy_commands2,
+    KHR_copy_memory_indirect,
+    KHR_create_renderpass2,
+    KHR_dedicated_allocation,
+    KHR_deferred_host_operations,
+    KHR_depth_clamp_zero_one,
+    KHR_depth_stencil_resolve,
+    KHR_descriptor_update_template,
+    KHR_device_address_commands,
+    KHR_device_fault,
+    KHR_device_group,
+    KHR_device_group_creation,
+    KHR_display,
+    KHR_display_swapchain,
+    KHR_draw_indirect_count,
+    KHR_driver_properties,
+    KHR_dynamic_rendering,
+    KHR_dynamic_rendering_local_read,
+    KHR_extended_flags,
+    KHR_external_fence,
+    KHR_external_fence_capabilities,
+    KHR_external_fence_fd,
+    KHR_external_fence_win32,
+    KHR_external_memory,
+    KHR_external_memory_capabilities,
+    KHR_external_memory_fd,
+    KHR_external_memory_win32,
+    KHR_external_semaphore,
+    KHR_external_semaphore_capabilities,
+    KHR_external_semaphore_fd,
+    KHR_external_semaphore_win32,
+    KHR_format_feature_flags2,
+    KHR_fragment_shader_barycentric,
+    KHR_fragment_shading_rate,
+    KHR_get_display_properties2,
+    KHR_get_memory_requirements2,
+    KHR_get_physical_device_properties2,
+    KHR_get_surface_capabilities2,
+    KHR_global_priority,
+    KHR_image_format_list,
+    KHR_imageless_framebuffer,
+    KHR_incremental_present,
+    KHR_index_type_uint8,
+    KHR_internally_synchronized_queues,
+    KHR_line_rasterization,
+    KHR_load_store_op_none,
+    KHR_maintenance1,
+    KHR_maintenance10,
+    KHR_maintenance11,
+    KHR_maintenance2,
+    KHR_maintenance3,
+    KHR_maintenance4,
+    KHR_maintenance5,
+    KHR_maintenance6,
+    KHR_maintenance7,
+    KHR_maintenance8,
+    KHR_maintenance9,
+    KHR_map_memory2,
+    KHR_multiview,
+    KHR_opacity_micromap,
+    KHR_performance_query,
+    KHR_pipeline_binary,
+    KHR_pipeline_executable_properties,
+    KHR_pipeline_library,
+    KHR_portability_enumeration,
+    KHR_portability_subset,
+    KHR_present_id,
+    KHR_present_id2,
+    KHR_present_mode_fifo_latest_ready,
+    KHR_present_wait,
+    KHR_present_wait2,
+    KHR_push_descriptor,
+    KHR_ray_query,
+    KHR_ray_tracing_maintenance1,
+    KHR_ray_tracing_pipeline,
+    KHR_ray_tracing_position_fetch,
+    KHR_relaxed_block_layout,
+    KHR_robustness2,
+    KHR_sampler_mirror_clamp_to_edge,
+    KHR_sampler_ycbcr_conversion,
+    KHR_separate_depth_stencil_layouts,
+    KHR_shader_abort,
+    KHR_shader_atomic_int64,
+    KHR_shader_bfloat16,
+    KHR_shader_clock,
+    KHR_shader_constant_data,
+    KHR_shader_draw_parameters,
+    KHR_shader_expect_assume,
+    KHR_shader_float16_int8,
+    KHR_shader_float_controls,
+    KHR_shader_float_controls2,
+    KHR_shader_fma,
+    KHR_shader_integer_dot_product,
+    KHR_shader_maximal_reconvergence,
+    KHR_shader_non_semantic_info,
+    KHR_shader_quad_control,
+    KHR_shader_relaxed_extended_instruction,
+    KHR_shader_subgroup_extended_types,
+    KHR_shader_subgroup_rotate,
+    KHR_shader_subgroup_uniform_control_flow,
+    KHR_shader_terminate_invocation,
+    KHR_shader_untyped_pointers,
+    KHR_shared_presentable_image,
+    KHR_spirv_1_4,
+    KHR_storage_buffer_storage_class,
+    KHR_surface,
+    KHR_surface_maintenance1,
+    KHR_surface_protected_capabilities,
+    KHR_swapchain,
+    KHR_swapchain_maintenance1,
+    KHR_swapchain_mutable_format,
+    KHR_synchronization2,
+    KHR_timeline_semaphore,
+    KHR_unified_image_layouts,
+    KHR_uniform_buffer_standard_layout,
+    KHR_variable_pointers,
+    KHR_vertex_attribute_divisor,
+    KHR_video_decode_av1,
+    KHR_video_decode_h264,
+    KHR_video_decode_h265,
+    KHR_video_decode_queue,
+    KHR_video_decode_vp9,
+    KHR_video_encode_av1,
+    KHR_video_encode_feedback2,
+    KHR_video_encode_h264,
+    KHR_video_encode_h265,
+    KHR_video_encode_intra_refresh,
+    KHR_video_encode_quantization_map,
+    KHR_video_encode_queue,
+    KHR_video_maintenance1,
+    KHR_video_maintenance2,
+    KHR_video_queue,
+    KHR_vulkan_memory_model,
+    KHR_wayland_surface,
+    KHR_win32_keyed_mutex,
+    KHR_win32_surface,
+    KHR_workgroup_memory_explicit_layout,
+    KHR_xcb_surface,
+    KHR_xlib_surface,
+    KHR_zero_initialize_workgroup_memory,
+    LUNARG_direct_driver_loading,
+    MESA_image_alignment_control,
+    MSFT_layered_driver,
+    MVK_ios_surface,
+    MVK_macos_surface,
+    NN_vi_surface,
+    NVX_binary_import,
+    NVX_image_view_handle,
+    NVX_multiview_per_view_attributes,
+    NV_acquire_winrt_display,
+    NV_clip_space_w_scaling,
+    NV_cluster_acceleration_structure,
+    NV_command_buffer_inheritance,
+    NV_compute_occupancy_priority,
+    NV_compute_shader_derivatives,
+    NV_cooperative_matrix,
+    NV_cooperative_matrix2,
+    NV_cooperative_matrix_decode_vector,
+    NV_cooperative_vector,
+    NV_copy_memory_indirect,
+    NV_corner_sampled_image,
+    NV_coverage_reduction_mode,
+    NV_cuda_kernel_launch,
+    NV_dedicated_allocation,
+    NV_dedicated_allocation_image_aliasing,
+    NV_descriptor_pool_overallocation,
+    NV_device_diagnostic_checkpoints,
+    NV_device_diagnostics_config,
+    NV_device_generated_commands,
+    NV_device_generated_commands_compute,
+    NV_displacement_micromap,
+    NV_display_stereo,
+    NV_extended_sparse_address_space,
+    NV_external_compute_queue,
+    NV_external_memory,
+    NV_external_memory_capabilities,
+    NV_external_memory_rdma,
+    NV_external_memory_win32,
+    NV_fill_rectangle,
+    NV_fragment_coverage_to_color,
+    NV_fragment_shader_barycentric,
+    NV_fragment_shading_rate_enums,
+    NV_framebuffer_mixed_samples,
+    NV_geometry_shader_passthrough,
+    NV_glsl_shader,
+    NV_inherited_viewport_scissor,
+    NV_linear_color_attachment,
+    NV_low_latency,
+    NV_low_latency2,
+    NV_memory_decompression,
+    NV_mesh_shader,
+    NV_optical_flow,
+    NV_partitioned_acceleration_structure,
+    NV_per_stage_descriptor_set,
+    NV_present_barrier,
+    NV_present_metering,
+    NV_push_constant_bank,
+    NV_raw_access_chains,
+    NV_ray_tracing,
+    NV_ray_tracing_invocation_reorder,
+    NV_ray_tracing_linear_swept_spheres,
+    NV_ray_tracing_motion_blur,
+    NV_ray_tracing_validation,
+    NV_representative_fragment_test,
+    NV_sample_mask_override_coverage,
+    NV_scissor_exclusive,
+    NV_shader_atomic_float16_vector,
+    NV_shader_image_footprint,
+    NV_shader_sm_builtins,
+    NV_shader_subgroup_partitioned,
+    NV_shading_rate_image,
+    NV_viewport_array2,
+    NV_viewport_swizzle,
+    NV_win32_keyed_mutex,
+    OHOS_external_memory,
+    OHOS_surface,
+    QCOM_cooperative_matrix_conversion,
+    QCOM_data_graph_model,
+    QCOM_elapsed_timer_query,
+    QCOM_filter_cubic_clamp,
+    QCOM_filter_cubic_weights,
+    QCOM_fragment_density_map_offset,
+    QCOM_image_processing,
+    QCOM_image_processing2,
+    QCOM_image_processing3,
+    QCOM_multiview_per_view_render_areas,
+    QCOM_multiview_per_view_viewports,
+    QCOM_queue_perf_hint,
+    QCOM_render_pass_shader_resolve,
+    QCOM_render_pass_store_ops,
+    QCOM_render_pass_transform,
+    QCOM_rotated_copy_commands,
+    QCOM_shader_multiple_wait_queues,
+    QCOM_tile_memory_heap,
+    QCOM_tile_properties,
+    QCOM_tile_shading,
+    QCOM_ycbcr_degamma,
+    QNX_external_memory_screen_buffer,
+    QNX_screen_surface,
+    SEC_amigo_profiling,
+    SEC_pipeline_cache_incremental_mode,
+    SEC_throttle_hint,
+    SEC_ubm_surface,
+    VALVE_descriptor_set_host_mapping,
+    VALVE_fragment_density_map_layered,
+    VALVE_mutable_descriptor_type,
+    VALVE_shader_mixed_float_dot_product,
+    VALVE_video_encode_rgb_conversion,
+};
+
+constexpr size_t app_extension_count = 473;
+
+using AppExtensionSet = std::bitset<app_extension_count>;
+
+constexpr std::string_view app_extension_names[app_extension_count] = {
+    "VK_AMDX_dense_geometry_format",
+    "VK_AMDX_shader_enqueue",
+    "VK_AMD_anti_lag",
+    "VK_AMD_buffer_marker",
+    "VK_AMD_device_coherent_memory",
+    "VK_AMD_display_native_hdr",
+    "VK_AMD_draw_indirect_count",
+    "VK_AMD_gcn_shader",
+    "VK_AMD_gpa_interface",
+    "VK_AMD_gpu_shader_half_float",
+    "VK_AMD_gpu_shader_int16",
+    "VK_AMD_memory_overallocation_behavior",
+    "VK_AMD_mixed_attachment_samples",
+    "VK_AMD_negative_viewport_height",
+    "VK_AMD_pipeline_compiler_control",
+    "VK_AMD_rasterization_order",
+    "VK_AMD_shader_ballot",
+    "VK_AMD_shader_core_properties",
+    "VK_AMD_shader_core_properties2",
+    "VK_AMD_shader_early_and_late_fragment_tests",
+    "VK_AMD_shader_explicit_vertex_parameter",
+    "VK_AMD_shader_fragment_mask",
+    "VK_AMD_shader_image_load_store_lod",
+    "VK_AMD_shader_info",
+    "VK_AMD_shader_trinary_minmax",
+    "VK_AMD_texture_gather_bias_lod",
+    "VK_ANDROID_external_format_resolve",
+    "VK_ANDROID_external_memory_android_hardware_buffer",
+    "VK_ARM_data_graph",
+    "VK_ARM_data_graph_instruction_set_tosa",
+    "VK_ARM_data_graph_neural_accelerator_statistics",
+    "VK_ARM_data_graph_optical_flow",
+    "VK_ARM_format_pack",
+    "VK_ARM_performance_counters_by_region",
+    "VK_ARM_pipeline_opacity_micromap",
+    "VK_ARM_rasterization_order_attachment_access",
+    "VK_ARM_render_pass_striped",
+    "VK_ARM_scheduling_controls",
+    "VK_ARM_shader_core_builtins",
+    "VK_ARM_shader_core_properties",
+    "VK_ARM_shader_instrumentation",
+    "VK_ARM_tensor_controls",
+    "VK_ARM_tensors",
+    "VK_EXT_4444_formats",
+    "VK_EXT_acquire_drm_display",
+    "VK_EXT_acquire_xlib_display",
+    "VK_EXT_astc_decode_mode",
+    "VK_EXT_attachment_feedback_loop_dynamic_state",
+    "VK_EXT_attachment_feedback_loop_layout",
+    "VK_EXT_blend_operation_advanced",
+    "VK_EXT_border_color_swizzle",
+    "VK_EXT_buffer_device_address",
+    "VK_EXT_calibrated_timestamps",
+    "VK_EXT_color_write_enable",
+    "VK_EXT_conditional_rendering",
+    "VK_EXT_conservative_rasterization",
+    "VK_EXT_cooperative_matrix_maintenance1",
+    "VK_EXT_custom_border_color",
+    "VK_EXT_custom_resolve",
+    "VK_EXT_debug_marker",
+    "VK_EXT_debug_report",
+    "VK_EXT_debug_utils",
+    "VK_EXT_depth_bias_control",
+    "VK_EXT_depth_clamp_control",
+    "VK_EXT_depth_clamp_zero_one",
+    "VK_EXT_depth_clip_control",
+    "VK_EXT_depth_clip_enable",
+    "VK_EXT_depth_range_unrestricted",
+    "VK_EXT_descriptor_buffer",
+    "VK_EXT_descriptor_heap",
+    "VK_EXT_descriptor_indexing",
+    "VK_EXT_device_address_binding_report",
+    "VK_EXT_device_fault",
+    "VK_EXT_device_generated_commands",
+    "VK_EXT_device_memory_report",
+    "VK_EXT_direct_mode_display",
+    "VK_EXT_directfb_surface",
+    "VK_EXT_discard_rectangles",
+    "VK_EXT_display_control",
+    "VK_EXT_display_surface_counter",
+    "VK_EXT_dynamic_rendering_unused_attachments",
+    "VK_EXT_extended_dynamic_state",
+    "VK_EXT_extended_dynamic_state2",
+    "VK_EXT_extended_dynamic_state3",
+    "VK_EXT_external_memory_acquire_unmodified",
+    "VK_EXT_external_memory_dma_buf",
+    "VK_EXT_external_memory_host",
+    "VK_EXT_external_memory_metal",
+    "VK_EXT_filter_cubic",
+    "VK_EXT_fragment_density_map",
+    "VK_EXT_fragment_density_map2",
+    "VK_EXT_fragment_density_map_offset",
+    "VK_EXT_fragment_shader_interlock",
+    "VK_EXT_frame_boundary",
+    "VK_EXT_full_screen_exclusive",
+    "VK_EXT_global_priority",
+    "VK_EXT_global_priority_query",
+    "VK_EXT_graphics_pipeline_library",
+    "VK_EXT_hdr_metadata",
+    "VK_EXT_headless_surface",
+    "VK_EXT_host_image_copy",
+    "VK_EXT_host_query_reset",
+    "VK_EXT_image_2d_view_of_3d",
+    "VK_EXT_image_compression_control",
+    "VK_EXT_image_compression_control_swapchain",
+    "VK_EXT_image_drm_format_modifier",
+    "VK_EXT_image_robustness",
+    "VK_EXT_image_sliced_view_of_3d",
+    "VK_EXT_image_tiling_control",
+    "VK_EXT_image_view_min_lod",
+    "VK_EXT_index_type_uint8",
+    "VK_EXT_inline_uniform_block",
+    "VK_EXT_layer_settings",
+    "VK_EXT_legacy_dithering",
+    "VK_EXT_legacy_vertex_attributes",
+    "VK_EXT_line_rasterization",
+    "VK_EXT_load_store_op_none",
+    "VK_EXT_map_memory_placed",
+    "VK_EXT_memory_budget",
+    "VK_EXT_memory_decompression",
+    "VK_EXT_memory_priority",
+    "VK_EXT_mesh_shader",
+    "VK_EXT_metal_objects",
+    "VK_EXT_metal_surface",
+    "VK_EXT_multi_draw",
+    "VK_EXT_multisampled_render_to_single_sampled",
+    "VK_EXT_multisampled_render_to_swapchain",
+    "VK_EXT_mutable_descriptor_type",
+    "VK_EXT_nested_command_buffer",
+    "VK_EXT_non_seamless_cube_map",
+    "VK_EXT_opacity_micromap",
+    "VK_EXT_pageable_device_local_memory",
+    "VK_EXT_pci_bus_info",
+    "VK_EXT_physical_device_drm",
+    "VK_EXT_pipeline_creation_cache_control",
+    "VK_EXT_pipeline_creation_feedback",
+    "VK_EXT_pipeline_library_group_handles",
+    "VK_EXT_pipeline_properties",
+    "VK_EXT_pipeline_protected_access",
+    "VK_EXT_pipeline_robustness",
+    "VK_EXT_post_depth_coverage",
+    "VK_EXT_present_mode_fifo_latest_ready",
+    "VK_EXT_present_timing",
+    "VK_EXT_primitive_restart_index",
+    "VK_EXT_primitive_topology_list_restart",
+    "VK_EXT_primitives_generated_query",
+    "VK_EXT_private_data",
+    "VK_EXT_provoking_vertex",
+    "VK_EXT_queue_family_foreign",
+    "VK_EXT_rasterization_order_attachment_access",
+    "VK_EXT_ray_tracing_invocation_reorder",
+    "VK_EXT_rgba10x6_formats",
+    "VK_EXT_robustness2",
+    "VK_EXT_sample_locations",
+    "VK_EXT_sampler_filter_minmax",
+    "VK_EXT_scalar_block_layout",
+    "VK_EXT_separate_stencil_usage",
+    "VK_EXT_shader_64bit_indexing",
+    "VK_EXT_shader_atomic_float",
+    "VK_EXT_shader_atomic_float2",
+    "VK_EXT_shader_demote_to_helper_invocation",
+    "VK_EXT_shader_float8",
+    "VK_EXT_shader_image_atomic_int64",
+    "VK_EXT_shader_long_vector",
+    "VK_EXT_shader_module_identifier",
+    "VK_EXT_shader_object",
+    "VK_EXT_shader_ocp_microscaling_types",
+    "VK_EXT_shader_replicated_composites",
+    "VK_EXT_shader_split_barrier",
+    "VK_EXT_shader_stencil_export",
+    "VK_EXT_shader_subgroup_ballot",
+    "VK_EXT_shader_subgroup_partitioned",
+    "VK_EXT_shader_subgroup_vote",
+    "VK_EXT_shader_tile_image",
+    "VK_EXT_shader_uniform_buffer_unsized_array",
+    "VK_EXT_shader_viewport_index_layer",
+    "VK_EXT_subgroup_size_control",
+    "VK_EXT_subpass_merge_feedback",
+    "VK_EXT_surface_maintenance1",
+    "VK_EXT_swapchain_colorspace",
+    "VK_EXT_swapchain_maintenance1",
+    "VK_EXT_texel_buffer_alignment",
+    "VK_EXT_texture_compression_astc_3d",
+    "VK_EXT_texture_compression_astc_hdr",
+    "VK_EXT_tooling_info",
+    "VK_EXT_transform_feedback",
+    "VK_EXT_validation_cache",
+    "VK_EXT_validation_features",
+    "VK_EXT_validation_flags",
+    "VK_EXT_vertex_attribute_divisor",
+    "VK_EXT_vertex_attribute_robustness",
+    "VK_EXT_vertex_input_dynamic_state",
+    "VK_EXT_ycbcr_2plane_444_formats",
+    "VK_EXT_ycbcr_image_arrays",
+    "VK_EXT_zero_initialize_device_memory",
+    "VK_FUCHSIA_buffer_collection",
+    "VK_FUCHSIA_external_memory",
+    "VK_FUCHSIA_external_semaphore",
+    "VK_FUCHSIA_imagepipe_surface",
+    "VK_GGP_frame_token",
+    "VK_GGP_stream_descriptor_surface",
+    "VK_GOOGLE_decorate_string",
+    "VK_GOOGLE_display_timing",
+    "VK_GOOGLE_hlsl_functionality1",
+    "VK_GOOGLE_surfaceless_query",
+    "VK_GOOGLE_user_type",
+    "VK_HUAWEI_cluster_culling_shader",
+    "VK_HUAWEI_hdr_vivid",
+    "VK_HUAWEI_invocation_mask",
+    "VK_HUAWEI_subpass_shading",
+    "VK_IMG_filter_cubic",
+    "VK_IMG_filter_linear_2d",
+    "VK_IMG_format_pvrtc",
+    "VK_IMG_relaxed_line_rasterization",
+    "VK_INTEL_performance_query",
+    "VK_INTEL_shader_integer_functions2",
+    "VK_KHR_16bit_storage",
+    "VK_KHR_8bit_storage",
+    "VK_KHR_acceleration_structure",
+    "VK_KHR_android_surface",
+    "VK_KHR_bind_memory2",
+    "VK_KHR_buffer_device_address",
+    "VK_KHR_calibrated_timestamps",
+    "VK_KHR_compute_shader_derivatives",
+    "VK_KHR_cooperative_matrix",
+    "VK_KHR_copy_commands2",
+    "VK_KHR_copy_memory_indirect",
+    "VK_KHR_create_renderpass2",
+    "VK_KHR_dedicated_allocation",
+    "VK_KHR_deferred_host_operations",
+    "VK_KHR_depth_clamp_zero_one",
+    "VK_KHR_depth_stencil_resolve",
+    "VK_KHR_descriptor_update_template",
+    "VK_KHR_device_address_commands",
+    "VK_KHR_device_fault",
+    "VK_KHR_device_group",
+    "VK_KHR_device_group_creation",
+    "VK_KHR_display",
+    "VK_KHR_display_swapchain",
+    "VK_KHR_draw_indirect_count",
+    "VK_KHR_driver_properties",
+    "VK_KHR_dynamic_rendering",
+    "VK_KHR_dynamic_rendering_local_read",
+    "VK_KHR_extended_flags",
+    "VK_KHR_external_fence",
+    "VK_KHR_external_fence_capabilities",
+    "VK_KHR_external_fence_fd",
+    "VK_KHR_external_fence_win32",
+    "VK_KHR_external_memory",
+    "VK_KHR_external_memory_capabilities",
+    "VK_KHR_external_memory_fd",
+    "VK_KHR_external_memory_win32",
+    "VK_KHR_external_semaphore",
+    "VK_KHR_external_semaphore_capabilities",
+    "VK_KHR_external_semaphore_fd",
+    "VK_KHR_external_semaphore_win32",
+    "VK_KHR_format_feature_flags2",
+    "VK_KHR_fragment_shader_barycentric",
+    "VK_KHR_fragment_shading_rate",
+    "VK_KHR_get_display_properties2",
+    "VK_KHR_get_memory_requirements2",
+    "VK_KHR_get_physical_device_properties2",
+    "VK_KHR_get_surface_capabilities2",
+    "VK_KHR_global_priority",
+    "VK_KHR_image_format_list",
+    "VK_KHR_imageless_framebuffer",
+    "VK_KHR_incremental_present",
+    "VK_KHR_index_type_uint8",
+    "VK_KHR_internally_synchronized_queues",
+    "VK_KHR_line_rasterization",
+    "VK_KHR_load_store_op_none",
+    "VK_KHR_maintenance1",
+    "VK_KHR_maintenance10",
+    "VK_KHR_maintenance11",
+    "VK_KHR_maintenance2",
+    "VK_KHR_maintenance3",
+    "VK_KHR_maintenance4",
+    "VK_KHR_maintenance5",
+    "VK_KHR_maintenance6",
+    "VK_KHR_maintenance7",
+    "VK_KHR_maintenance8",
+    "VK_KHR_maintenance9",
+    "VK_KHR_map_memory2",
+    "VK_KHR_multiview",
+    "VK_KHR_opacity_micromap",
+    "VK_KHR_performance_query",
+    "VK_KHR_pipeline_binary",
+    "VK_KHR_pipeline_executable_properties",
+    "VK_KHR_pipeline_library",
+    "VK_KHR_portability_enumeration",
+    "VK_KHR_portability_subset",
+    "VK_KHR_present_id",
+    "VK_KHR_present_id2",
+    "VK_KHR_present_mode_fifo_latest_ready",
+    "VK_KHR_present_wait",
+    "VK_KHR_present_wait2",
+    "VK_KHR_push_descriptor",
+    "VK_KHR_ray_query",
+    "VK_KHR_ray_tracing_maintenance1",
+    "VK_KHR_ray_tracing_pipeline",
+    "VK_KHR_ray_tracing_position_fetch",
+    "VK_KHR_relaxed_block_layout",
+    "VK_KHR_robustness2",
+    "VK_KHR_sampler_mirror_clamp_to_edge",
+    "VK_KHR_sampler_ycbcr_conversion",
+    "VK_KHR_separate_depth_stencil_layouts",
+    "VK_KHR_shader_abort",
+    "VK_KHR_shader_atomic_int64",
+    "VK_KHR_shader_bfloat16",
+    "VK_KHR_shader_clock",
+    "VK_KHR_shader_constant_data",
+    "VK_KHR_shader_draw_parameters",
+    "VK_KHR_shader_expect_assume",
+    "VK_KHR_shader_float16_int8",
+    "VK_KHR_shader_float_controls",
+    "VK_KHR_shader_float_controls2",
+    "VK_KHR_shader_fma",
+    "VK_KHR_shader_integer_dot_product",
+    "VK_KHR_shader_maximal_reconvergence",
+    "VK_KHR_shader_non_semantic_info",
+    "VK_KHR_shader_quad_control",
+    "VK_KHR_shader_relaxed_extended_instruction",
+    "VK_KHR_shader_subgroup_extended_types",
+    "VK_KHR_shader_subgroup_rotate",
+    "VK_KHR_shader_subgroup_uniform_control_flow",
+    "VK_KHR_shader_terminate_invocation",
+    "VK_KHR_shader_untyped_pointers",
+    "VK_KHR_shared_presentable_image",
+    "VK_KHR_spirv_1_4",
+    "VK_KHR_storage_buffer_storage_class",
+    "VK_KHR_surface",
+    "VK_KHR_surface_maintenance1",
+    "VK_KHR_surface_protected_capabilities",
+    "VK_KHR_swapchain",
+    "VK_KHR_swapchain_maintenance1",
+    "VK_KHR_swapchain_mutable_format",
+    "VK_KHR_synchronization2",
+    "VK_KHR_timeline_semaphore",
+    "VK_KHR_unified_image_layouts",
+    "VK_KHR_uniform_buffer_standard_layout",
+    "VK_KHR_variable_pointers",
+    "VK_KHR_vertex_attribute_divisor",
+    "VK_KHR_video_decode_av1",
+    "VK_KHR_video_decode_h264",
+    "VK_KHR_video_decode_h265",
+    "VK_KHR_video_decode_queue",
+    "VK_KHR_video_decode_vp9",
+    "VK_KHR_video_encode_av1",
+    "VK_KHR_video_encode_feedback2",
+    "VK_KHR_video_encode_h264",
+    "VK_KHR_video_encode_h265",
+    "VK_KHR_video_encode_intra_refresh",
+    "VK_KHR_video_encode_quantization_map",
+    "VK_KHR_video_encode_queue",
+    "VK_KHR_video_maintenance1",
+    "VK_KHR_video_maintenance2",
+    "VK_KHR_video_queue",
+    "VK_KHR_vulkan_memory_model",
+    "VK_KHR_wayland_surface",
+    "VK_KHR_win32_keyed_mutex",
+    "VK_KHR_win32_surface",
+    "VK_KHR_workgroup_memory_explicit_layout",
+    "VK_KHR_xcb_surface",
+    "VK_KHR_xlib_surface",
+    "VK_KHR_zero_initialize_workgroup_memory",
+    "VK_LUNARG_direct_driver_loading",
+    "VK_MESA_image_alignment_control",
+    "VK_MSFT_layered_driver",
+    "VK_MVK_ios_surface",
+    "VK_MVK_macos_surface",
+    "VK_NN_vi_surface",
+    "VK_NVX_binary_import",
+    "VK_NVX_image_view_handle",
+    "VK_NVX_multiview_per_view_attributes",
+    "VK_NV_acquire_winrt_display",
+    "VK_NV_clip_space_w_scaling",
+    "VK_NV_cluster_acceleration_structure",
+    "VK_NV_command_buffer_inheritance",
+    "VK_NV_compute_occupancy_priority",
+    "VK_NV_compute_shader_derivatives",
+    "VK_NV_cooperative_matrix",
+    "VK_NV_cooperative_matrix2",
+    "VK_NV_cooperative_matrix_decode_vector",
+    "VK_NV_cooperative_vector",
+    "VK_NV_copy_memory_indirect",
+    "VK_NV_corner_sampled_image",
+    "VK_NV_coverage_reduction_mode",
+    "VK_NV_cuda_kernel_launch",
+    "VK_NV_dedicated_allocation",
+    "VK_NV_dedicated_allocation_image_aliasing",
+    "VK_NV_descriptor_pool_overallocation",
+    "VK_NV_device_diagnostic_checkpoints",
+    "VK_NV_device_diagnostics_config",
+    "VK_NV_device_generated_commands",
+    "VK_NV_device_generated_commands_compute",
+    "VK_NV_displacement_micromap",
+    "VK_NV_display_stereo",
+    "VK_NV_extended_sparse_address_space",
+    "VK_NV_external_compute_queue",
+    "VK_NV_external_memory",
+    "VK_NV_external_memory_capabilities",
+    "VK_NV_external_memory_rdma",
+    "VK_NV_external_memory_win32",
+    "VK_NV_fill_rectangle",
+    "VK_NV_fragment_coverage_to_color",
+    "VK_NV_fragment_shader_barycentric",
+    "VK_NV_fragment_shading_rate_enums",
+    "VK_NV_framebuffer_mixed_samples",
+    "VK_NV_geometry_shader_passthrough",
+    "VK_NV_glsl_shader",
+    "VK_NV_inherited_viewport_scissor",
+    "VK_NV_linear_color_attachment",
+    "VK_NV_low_latency",
+    "VK_NV_low_latency2",
+    "VK_NV_memory_decompression",
+    "VK_NV_mesh_shader",
+    "VK_NV_optical_flow",
+    "VK_NV_partitioned_acceleration_structure",
+    "VK_NV_per_stage_descriptor_set",
+    "VK_NV_present_barrier",
+    "VK_NV_present_metering",
+    "VK_NV_push_constant_bank",
+    "VK_NV_raw_access_chains",
+    "VK_NV_ray_tracing",
+    "VK_NV_ray_tracing_invocation_reorder",
+    "VK_NV_ray_tracing_linear_swept_spheres",
+    "VK_NV_ray_tracing_motion_blur",
+    "VK_NV_ray_tracing_validation",
+    "VK_NV_representative_fragment_test",
+    "VK_NV_sample_mask_override_coverage",
+    "VK_NV_scissor_exclusive",
+    "VK_NV_shader_atomic_float16_vector",
+    "VK_NV_shader_image_footprint",
+    "VK_NV_shader_sm_builtins",
+    "VK_NV_shader_subgroup_partitioned",
+    "VK_NV_shading_rate_image",
+    "VK_NV_viewport_array2",
+    "VK_NV_viewport_swizzle",
+    "VK_NV_win32_keyed_mutex",
+    "VK_OHOS_external_memory",
+    "VK_OHOS_surface",
+    "VK_QCOM_cooperative_matrix_conversion",
+    "VK_QCOM_data_graph_model",
+    "VK_QCOM_elapsed_timer_query",
+    "VK_QCOM_filter_cubic_clamp",
+    "VK_QCOM_filter_cubic_weights",
+    "VK_QCOM_fragment_density_map_offset",
+    "VK_QCOM_image_processing",
+    "VK_QCOM_image_processing2",
+    "VK_QCOM_image_processing3",
+    "VK_QCOM_multiview_per_view_render_areas",
+    "VK_QCOM_multiview_per_view_viewports",
+    "VK_QCOM_queue_perf_hint",
+    "VK_QCOM_render_pass_shader_resolve",
+    "VK_QCOM_render_pass_store_ops",
+    "VK_QCOM_render_pass_transform",
+    "VK_QCOM_rotated_copy_commands",
+    "VK_QCOM_shader_multiple_wait_queues",
+    "VK_QCOM_tile_memory_heap",
+    "VK_QCOM_tile_properties",
+    "VK_QCOM_tile_shading",
+    "VK_QCOM_ycbcr_degamma",
+    "VK_QNX_external_memory_screen_buffer",
+    "VK_QNX_screen_surface",
+    "VK_SEC_amigo_profiling",
+    "VK_SEC_pipeline_cache_incremental_mode",
+    "VK_SEC_throttle_hint",
+    "VK_SEC_ubm_surface",
+    "VK_VALVE_descriptor_set_host_mapping",
+    "VK_VALVE_fragment_density_map_layered",
+    "VK_VALVE_mutable_descriptor_type",
+    "VK_VALVE_shader_mixed_float_dot_product",
+    "VK_VALVE_video_encode_rgb_conversion",
+};
+
+// Returns false if the extension is newer than the registry vulkaninfo was generated from
+inline bool FindAppExtension(std::string_view name, AppExtension &extension) {
+    auto it = std::lower_bound(std::begin(app_extension_names), std::end(app_extension_names), name);
+    if (it == std::end(app_extension_names) || *it != name) return false;
+    extension = static_cast<AppExtension>(it - std::begin(app_extension_names));
+    return true;
+}
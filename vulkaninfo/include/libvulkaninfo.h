@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// libvulkaninfo collects what vulkaninfo reports about the Vulkan instance and physical devices, and returns it as the
+// Vulkan structs the driver filled in. It loads the Vulkan loader itself, so the application doesn't need a VkInstance.
+//
+//     libvulkaninfo::InstanceInfo info = libvulkaninfo::Capture();
+//     for (const auto &gpu : info.physical_devices) {
+//         auto *vulkan12 = gpu.features_chain.Find<VkPhysicalDeviceVulkan12Features>(
+//             VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES);
+//     }
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+namespace libvulkaninfo {
+
+// The structs of a pNext chain as the driver filled them in, including the arrays they point to. Copies share the structs,
+// which are freed with the last copy.
+class StructChain {
+  public:
+    StructChain() = default;
+    StructChain(std::shared_ptr<const void> owner, const void *head)
+        : owner(std::move(owner)), head(static_cast<const VkBaseInStructure *>(head)) {}
+
+    // The first struct of the chain, follow pNext for the others. nullptr if the chain is empty.
+    const VkBaseInStructure *Head() const { return head; }
+
+    // Returns the struct with the given sType, or nullptr if the chain doesn't contain it
+    template <typename T>
+    const T *Find(VkStructureType sType) const {
+        for (const VkBaseInStructure *structure = head; structure != nullptr; structure = structure->pNext) {
+            if (structure->sType == sType) return reinterpret_cast<const T *>(structure);
+        }
+        return nullptr;
+    }
+
+  private:
+    std::shared_ptr<const void> owner;
+    const VkBaseInStructure *head = nullptr;
+};
+
+struct LayerInfo {
+    VkLayerProperties properties;
+    std::vector<VkExtensionProperties> extensions;
+};
+
+struct QueueFamilyInfo {
+    VkQueueFamilyProperties properties;
+    StructChain chain;  // VkQueueFamilyProperties2::pNext
+};
+
+struct FormatInfo {
+    VkFormat format;
+    VkFormatProperties properties;
+    VkFormatProperties3 properties3;  // only the feature flags, pNext is always nullptr
+    StructChain chain;                // VkFormatProperties2::pNext
+};
+
+struct PhysicalDeviceInfo {
+    VkPhysicalDeviceProperties properties;
+    StructChain properties_chain;  // VkPhysicalDeviceProperties2::pNext
+    VkPhysicalDeviceFeatures features;
+    StructChain features_chain;  // VkPhysicalDeviceFeatures2::pNext
+    VkPhysicalDeviceMemoryProperties memory_properties;
+    // Zero unless CaptureOptions::memory_budget is set and the device supports VK_EXT_memory_budget
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> heap_budget;
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> heap_usage;
+    std::vector<VkExtensionProperties> extensions;
+    std::vector<QueueFamilyInfo> queue_families;
+    std::vector<FormatInfo> formats;  // sorted by format, empty unless CaptureOptions::formats is set
+};
+
+struct InstanceInfo {
+    uint32_t api_version;
+    std::vector<VkExtensionProperties> extensions;
+    std::vector<LayerInfo> layers;
+    std::vector<PhysicalDeviceInfo> physical_devices;  // in enumeration order
+};
+
+struct CaptureOptions {
+    bool formats = false;        // every format of the supported format ranges, a few hundred queries per device
+    bool memory_budget = false;  // heap_budget and heap_usage
+    bool promoted_structs = false;  // also chain the extension structs that were promoted to the version the device supports
+    uint32_t jobs = 0;              // physical devices queried at the same time, 0 means one per hardware thread
+};
+
+// Creates an instance, collects the information of every physical device and destroys the instance again. Throws an
+// exception derived from std::runtime_error if the Vulkan loader can't be loaded or a call vulkaninfo relies on fails.
+InstanceInfo Capture(const CaptureOptions &options = {});
+
+}  // namespace libvulkaninfo
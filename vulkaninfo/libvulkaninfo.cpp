@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "libvulkaninfo.h"
+
+// The system headers the vulkaninfo headers use, included here so that including those headers inside of the namespace
+// below doesn't put any system declarations into it.
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <condition_variable>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include <vulkan/vulkan.h>
+
+// The vulkaninfo headers define their functions and globals at global scope, as they are meant for the single translation
+// unit of vulkaninfo. Keeping them out of the global namespace lets the library be linked into applications that define a
+// vulkan_library, RunParallelTasks or vkCreateInstance of their own. vulkaninfo_collect.h is the part of vulkaninfo that
+// doesn't print, the vulkaninfo executable builds from the same header.
+namespace libvulkaninfo::detail {
+#include "vulkaninfo_collect.h"
+}  // namespace libvulkaninfo::detail
+
+namespace libvulkaninfo {
+
+// Moves the data of gpu into info. gpu must not be used afterwards, the chains info points into are taken from it.
+static void MoveGpuInfo(detail::AppGpu &gpu, const CaptureOptions &options, PhysicalDeviceInfo &info) {
+    info.properties = gpu.GetDeviceProperties();
+    info.properties_chain = StructChain(std::move(gpu.chain_for_phys_device_props2), gpu.props2.pNext);
+    info.features = gpu.features;
+    const void *features_head = gpu.GetFeatures2().pNext;
+    info.features_chain = StructChain(gpu.ReleaseFeatures2Chain(), features_head);
+    info.memory_properties = gpu.memory_props;
+    info.heap_budget = {};
+    info.heap_usage = {};
+    if (options.memory_budget) {
+        info.heap_budget = gpu.GetHeapBudget();
+        info.heap_usage = gpu.GetHeapUsage();
+    }
+    info.extensions = gpu.device_extensions;
+
+    const auto &queue_families = gpu.GetQueueFamilies();
+    // Every queue family shares the owner of all queue family chains, they are only freed together
+    std::shared_ptr<const void> queue_chains =
+        std::make_shared<std::vector<std::unique_ptr<detail::queue_properties2_chain>>>(gpu.ReleaseQueueProperties2Chains());
+    for (const auto &queue_family : queue_families) {
+        info.queue_families.push_back(QueueFamilyInfo{queue_family.props, StructChain(queue_chains, queue_family.pNext)});
+    }
+
+    if (options.formats) {
+        gpu.GetFormatProperties();
+        for (auto &entry : gpu.ReleaseFormatProperties()) {
+            const void *head = entry.chain ? entry.chain->start_of_chain : nullptr;
+            info.formats.push_back(
+                FormatInfo{entry.format, entry.flags.props, entry.flags.props3, StructChain(std::move(entry.chain), head)});
+        }
+    }
+}
+
+InstanceInfo Capture(const CaptureOptions &options) {
+    detail::AppInstance instance;
+
+    InstanceInfo info{};
+    info.api_version =
+        VK_MAKE_API_VERSION(0, instance.api_version.Major(), instance.api_version.Minor(), instance.api_version.Patch());
+    info.extensions = instance.global_extensions;
+    for (const auto &layer : instance.global_layers) {
+        info.layers.push_back(LayerInfo{layer.layer_properties, layer.extension_properties});
+    }
+
+    const auto phys_devices = instance.FindPhysicalDevices();
+    info.physical_devices.resize(phys_devices.size());
+    detail::RunParallelTasks(phys_devices.size(), options.jobs, [&](size_t i) {
+        detail::AppGpu gpu(instance, static_cast<uint32_t>(i), phys_devices[i], options.promoted_structs, {});
+        MoveGpuInfo(gpu, options, info.physical_devices[i]);
+    });
+    return info;
+}
+
+}  // namespace libvulkaninfo
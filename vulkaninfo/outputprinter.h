@@ -22,37 +22,38 @@
 
 #pragma once
 
-#include <iomanip>
+#include <charconv>
 #include <iostream>
 #include <ostream>
 #include <stack>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 
 #include <assert.h>
+#include <stdio.h>
 
 #include "vulkaninfo.h"
 
 std::string insert_quotes(std::string s) { return "\"" + s + "\""; }
 
-std::string to_string(const std::array<uint8_t, 16> &uid) {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    for (int i = 0; i < 16; ++i) {
-        if (i == 4 || i == 6 || i == 8 || i == 10) ss << '-';
-        ss << std::setw(2) << static_cast<unsigned>(uid[i]);
+// Formats the bytes of a UUID or LUID as lowercase hex, with dashes inserted before the given byte indices
+template <size_t N>
+std::string uid_to_string(const std::array<uint8_t, N> &uid, std::initializer_list<size_t> dashes) {
+    static constexpr char hex_digits[] = "0123456789abcdef";
+    std::string str;
+    str.reserve(N * 2 + dashes.size());
+    for (size_t i = 0; i < N; ++i) {
+        if (std::find(dashes.begin(), dashes.end(), i) != dashes.end()) str.push_back('-');
+        str.push_back(hex_digits[uid[i] >> 4]);
+        str.push_back(hex_digits[uid[i] & 0xF]);
     }
-    return ss.str();
-}
-std::string to_string(const std::array<uint8_t, 8> &uid) {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    for (int i = 0; i < 8; ++i) {
-        if (i == 4) ss << '-';
-        ss << std::setw(2) << static_cast<unsigned>(uid[i]);
-    }
-    return ss.str();
+    return str;
 }
+std::string to_string(const std::array<uint8_t, 16> &uid) { return uid_to_string(uid, {4, 6, 8, 10}); }
+std::string to_string(const std::array<uint8_t, 8> &uid) { return uid_to_string(uid, {4}); }
 
 std::ostream &operator<<(std::ostream &out, const VkConformanceVersion &v) {
     return out << static_cast<unsigned>(v.major) << "." << static_cast<unsigned>(v.minor) << "."
@@ -66,118 +67,134 @@ struct PrinterCreateDetails {
     bool print_to_file = false;
     std::string file_name = APP_SHORT_NAME ".txt";
     std::string start_string = "";
+    bool single_line = false;  // json and vkconfig_output without line breaks or indentation, used for --ndjson records
+    bool cbor = false;         // vkconfig_output encoded as CBOR (RFC 8949) instead of json, used for --cbor
 };
 
+// All output is formatted into an internal buffer which is handed to the ostream in large blocks, so printing a key or value
+// does not go through the ostream (or allocate) unless the value is of a type that only has an operator<<.
 class Printer {
   public:
     Printer(const PrinterCreateDetails &details, std::ostream &out, const APIVersion vulkan_version)
-        : output_type(details.output_type), out(out) {
+        : output_type(details.output_type), single_line(details.single_line), cbor(details.cbor), out(out) {
+        buffer.reserve(flush_threshold + flush_threshold / 4);
         StackNode node{};
         node.is_first_item = false;
         node.indents = 0;
         switch (output_type) {
             case (OutputType::text):
-                out << std::string(strlen(APP_UPPER_CASE_NAME), '=') << "\n";
-                out << APP_UPPER_CASE_NAME "\n";
-                out << std::string(strlen(APP_UPPER_CASE_NAME), '=') << "\n\n";
-                out << API_NAME " Instance Version: " << APIVersion(vulkan_version) << "\n\n\n";
+                WriteRepeated('=', strlen(APP_UPPER_CASE_NAME));
+                Write("\n" APP_UPPER_CASE_NAME "\n");
+                WriteRepeated('=', strlen(APP_UPPER_CASE_NAME));
+                Write("\n\n" API_NAME " Instance Version: ");
+                Write(APIVersion(vulkan_version).str());
+                Write("\n\n\n");
                 break;
             case (OutputType::html):
-                out << "<!doctype html>\n";
-                out << "<html lang='en'>\n";
-                out << "\t<head>\n";
-                out << "\t\t<title>" APP_SHORT_NAME "</title>\n";
-                out << "\t\t<style>\n";
-                out << "\t\thtml {\n";
-                out << "\t\t\tbackground-color: #0b1e48;\n";
-                out << "\t\t\tbackground-image: url(\"https://vulkan.lunarg.com/img/bg-starfield.jpg\");\n";
-                out << "\t\t\tbackground-position: center;\n";
-                out << "\t\t\t-webkit-background-size: cover;\n";
-                out << "\t\t\t-moz-background-size: cover;\n";
-                out << "\t\t\t-o-background-size: cover;\n";
-                out << "\t\t\tbackground-size: cover;\n";
-                out << "\t\t\tbackground-attachment: fixed;\n";
-                out << "\t\t\tbackground-repeat: no-repeat;\n";
-                out << "\t\t\theight: 100%;\n";
-                out << "\t\t}\n";
-                out << "\t\t#header {\n";
-                out << "\t\t\tz-index: -1;\n";
-                out << "\t\t}\n";
-                out << "\t\t#header>img {\n";
-                out << "\t\t\tposition: absolute;\n";
-                out << "\t\t\twidth: 160px;\n";
-                out << "\t\t\tmargin-left: -280px;\n";
-                out << "\t\t\ttop: -10px;\n";
-                out << "\t\t\tleft: 50%;\n";
-                out << "\t\t}\n";
-                out << "\t\t#header>h1 {\n";
-                out << "\t\t\tfont-family: Arial, \"Helvetica Neue\", Helvetica, sans-serif;\n";
-                out << "\t\t\tfont-size: 44px;\n";
-                out << "\t\t\tfont-weight: 200;\n";
-                out << "\t\t\ttext-shadow: 4px 4px 5px #000;\n";
-                out << "\t\t\tcolor: #eee;\n";
-                out << "\t\t\tposition: absolute;\n";
-                out << "\t\t\twidth: 400px;\n";
-                out << "\t\t\tmargin-left: -80px;\n";
-                out << "\t\t\ttop: 8px;\n";
-                out << "\t\t\tleft: 50%;\n";
-                out << "\t\t}\n";
-                out << "\t\tbody {\n";
-                out << "\t\t\tfont-family: Consolas, monaco, monospace;\n";
-                out << "\t\t\tfont-size: 14px;\n";
-                out << "\t\t\tline-height: 20px;\n";
-                out << "\t\t\tcolor: #eee;\n";
-                out << "\t\t\theight: 100%;\n";
-                out << "\t\t\tmargin: 0;\n";
-                out << "\t\t\toverflow: hidden;\n";
-                out << "\t\t}\n";
-                out << "\t\t#wrapper {\n";
-                out << "\t\t\tbackground-color: rgba(0, 0, 0, 0.7);\n";
-                out << "\t\t\tborder: 1px solid #446;\n";
-                out << "\t\t\tbox-shadow: 0px 0px 10px #000;\n";
-                out << "\t\t\tpadding: 8px 12px;\n\n";
-                out << "\t\t\tdisplay: inline-block;\n";
-                out << "\t\t\tposition: absolute;\n";
-                out << "\t\t\ttop: 80px;\n";
-                out << "\t\t\tbottom: 25px;\n";
-                out << "\t\t\tleft: 50px;\n";
-                out << "\t\t\tright: 50px;\n";
-                out << "\t\t\toverflow: auto;\n";
-                out << "\t\t}\n";
-                out << "\t\tdetails>details {\n";
-                out << "\t\t\tmargin-left: 22px;\n";
-                out << "\t\t}\n";
-                out << "\t\tdetails>summary:only-child::-webkit-details-marker {\n";
-                out << "\t\t\tdisplay: none;\n";
-                out << "\t\t}\n";
-                out << "\t\t.var, .type, .val {\n";
-                out << "\t\t\tdisplay: inline;\n";
-                out << "\t\t}\n";
-                out << "\t\t.var {\n";
-                out << "\t\t}\n";
-                out << "\t\t.type {\n";
-                out << "\t\t\tcolor: #acf;\n";
-                out << "\t\t\tmargin: 0 12px;\n";
-                out << "\t\t}\n";
-                out << "\t\t.val {\n";
-                out << "\t\t\tcolor: #afa;\n";
-                out << "\t\t\tbackground: #222;\n";
-                out << "\t\t\ttext-align: right;\n";
-                out << "\t\t}\n";
-                out << "\t\t</style>\n";
-                out << "\t</head>\n";
-                out << "\t<body>\n";
-                out << "\t\t<div id='header'>\n";
-                out << "\t\t\t<h1>" APP_SHORT_NAME "</h1>\n";
-                out << "\t\t</div>\n";
-                out << "\t\t<div id='wrapper'>\n";
-                out << "\t\t\t<details><summary>" API_NAME " Instance Version: <span class='val'>" << APIVersion(vulkan_version)
-                    << "</span></summary></details>\n\t\t\t<br />\n";
+                Write("<!doctype html>\n");
+                Write("<html lang='en'>\n");
+                Write("\t<head>\n");
+                Write("\t\t<title>" APP_SHORT_NAME "</title>\n");
+                Write("\t\t<style>\n");
+                Write("\t\thtml {\n");
+                Write("\t\t\tbackground-color: #0b1e48;\n");
+                Write("\t\t\tbackground-image: url(\"https://vulkan.lunarg.com/img/bg-starfield.jpg\");\n");
+                Write("\t\t\tbackground-position: center;\n");
+                Write("\t\t\t-webkit-background-size: cover;\n");
+                Write("\t\t\t-moz-background-size: cover;\n");
+                Write("\t\t\t-o-background-size: cover;\n");
+                Write("\t\t\tbackground-size: cover;\n");
+                Write("\t\t\tbackground-attachment: fixed;\n");
+                Write("\t\t\tbackground-repeat: no-repeat;\n");
+                Write("\t\t\theight: 100%;\n");
+                Write("\t\t}\n");
+                Write("\t\t#header {\n");
+                Write("\t\t\tz-index: -1;\n");
+                Write("\t\t}\n");
+                Write("\t\t#header>img {\n");
+                Write("\t\t\tposition: absolute;\n");
+                Write("\t\t\twidth: 160px;\n");
+                Write("\t\t\tmargin-left: -280px;\n");
+                Write("\t\t\ttop: -10px;\n");
+                Write("\t\t\tleft: 50%;\n");
+                Write("\t\t}\n");
+                Write("\t\t#header>h1 {\n");
+                Write("\t\t\tfont-family: Arial, \"Helvetica Neue\", Helvetica, sans-serif;\n");
+                Write("\t\t\tfont-size: 44px;\n");
+                Write("\t\t\tfont-weight: 200;\n");
+                Write("\t\t\ttext-shadow: 4px 4px 5px #000;\n");
+                Write("\t\t\tcolor: #eee;\n");
+                Write("\t\t\tposition: absolute;\n");
+                Write("\t\t\twidth: 400px;\n");
+                Write("\t\t\tmargin-left: -80px;\n");
+                Write("\t\t\ttop: 8px;\n");
+                Write("\t\t\tleft: 50%;\n");
+                Write("\t\t}\n");
+                Write("\t\tbody {\n");
+                Write("\t\t\tfont-family: Consolas, monaco, monospace;\n");
+                Write("\t\t\tfont-size: 14px;\n");
+                Write("\t\t\tline-height: 20px;\n");
+                Write("\t\t\tcolor: #eee;\n");
+                Write("\t\t\theight: 100%;\n");
+                Write("\t\t\tmargin: 0;\n");
+                Write("\t\t\toverflow: hidden;\n");
+                Write("\t\t}\n");
+                Write("\t\t#wrapper {\n");
+                Write("\t\t\tbackground-color: rgba(0, 0, 0, 0.7);\n");
+                Write("\t\t\tborder: 1px solid #446;\n");
+                Write("\t\t\tbox-shadow: 0px 0px 10px #000;\n");
+                Write("\t\t\tpadding: 8px 12px;\n\n");
+                Write("\t\t\tdisplay: inline-block;\n");
+                Write("\t\t\tposition: absolute;\n");
+                Write("\t\t\ttop: 80px;\n");
+                Write("\t\t\tbottom: 25px;\n");
+                Write("\t\t\tleft: 50px;\n");
+                Write("\t\t\tright: 50px;\n");
+                Write("\t\t\toverflow: auto;\n");
+                Write("\t\t}\n");
+                Write("\t\tdetails>details {\n");
+                Write("\t\t\tmargin-left: 22px;\n");
+                Write("\t\t}\n");
+                Write("\t\tdetails>summary:only-child::-webkit-details-marker {\n");
+                Write("\t\t\tdisplay: none;\n");
+                Write("\t\t}\n");
+                Write("\t\t.var, .type, .val {\n");
+                Write("\t\t\tdisplay: inline;\n");
+                Write("\t\t}\n");
+                Write("\t\t.var {\n");
+                Write("\t\t}\n");
+                Write("\t\t.type {\n");
+                Write("\t\t\tcolor: #acf;\n");
+                Write("\t\t\tmargin: 0 12px;\n");
+                Write("\t\t}\n");
+                Write("\t\t.val {\n");
+                Write("\t\t\tcolor: #afa;\n");
+                Write("\t\t\tbackground: #222;\n");
+                Write("\t\t\ttext-align: right;\n");
+                Write("\t\t}\n");
+                Write("\t\t</style>\n");
+                Write("\t</head>\n");
+                Write("\t<body>\n");
+                Write("\t\t<div id='header'>\n");
+                Write("\t\t\t<h1>" APP_SHORT_NAME "</h1>\n");
+                Write("\t\t</div>\n");
+                Write("\t\t<div id='wrapper'>\n");
+                Write("\t\t\t<details><summary>" API_NAME " Instance Version: <span class='val'>");
+                Write(APIVersion(vulkan_version).str());
+                Write("</span></summary></details>\n\t\t\t<br />\n");
                 node.indents = 3;
                 break;
             case (OutputType::json):
             case (OutputType::vkconfig_output):
-                out << details.start_string;
+                if (cbor) {
+                    // The self-describe tag marks the file as CBOR, the stringref namespace tag allows repeated strings to be
+                    // written as an index into the strings which came before
+                    WriteCborHead(6, 55799);
+                    WriteCborHead(6, 256);
+                    Write(cbor_indefinite_map);
+                } else {
+                    Write(details.start_string);
+                }
                 node.indents = 1;
                 break;
             default:
@@ -190,15 +207,21 @@ class Printer {
             case (OutputType::text):
                 break;
             case (OutputType::html):
-                out << "\t\t</div>\n";
-                out << "\t</body>\n";
-                out << "</html>\n";
+                Write("\t\t</div>\n");
+                Write("\t</body>\n");
+                Write("</html>\n");
                 break;
             case (OutputType::json):
             case (OutputType::vkconfig_output):
-                out << "\n}\n";
+                if (cbor) {
+                    Write(cbor_break);
+                    break;
+                }
+                WriteLineBreak();
+                Write("}\n");
                 break;
         }
+        Flush();
         assert(!object_stack.empty() && "mismatched number of ObjectStart/ObjectEnd or ArrayStart/ArrayEnd's");
         object_stack.pop();
         assert(object_stack.empty() && "indents must be zero at program end");
@@ -217,16 +240,21 @@ class Printer {
                     break;
                 case (OutputType::html):
                     while (get_top().indents > 3) {
-                        out << "</details>\n";
+                        Write("</details>\n");
                     }
                     break;
                 case (OutputType::json):
                 case (OutputType::vkconfig_output):
-                    out << "\n" << std::string(static_cast<size_t>(get_top().indents), '\t');
+                    if (cbor) {
+                        Write(cbor_break);
+                        break;
+                    }
+                    WriteLineBreak();
+                    WriteIndent();
                     if (get_top().is_array) {
-                        out << "]";
+                        Write(']');
                     } else {
-                        out << "}";
+                        Write('}');
                     }
                     break;
                 default:
@@ -234,6 +262,16 @@ class Printer {
             }
             object_stack.pop();
         }
+        Flush();
+    }
+
+    // Hands everything printed so far to the output stream
+    void Flush() {
+        if (!buffer.empty()) {
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+        out.flush();
     }
 
     // Custom Formatting
@@ -289,94 +327,117 @@ class Printer {
         return *this;
     }
 
-    void ObjectStart(std::string object_name, int32_t count_subobjects = -1) {
+    void ObjectStart(std::string_view object_name, int32_t count_subobjects = -1) {
         switch (output_type) {
             case (OutputType::text): {
-                out << std::string(static_cast<size_t>(get_top().indents), '\t') << object_name;
+                WriteIndent();
+                Write(object_name);
                 if (!value_description.empty()) {
-                    out << " (" << value_description << ")";
+                    Write(" (");
+                    Write(value_description);
+                    Write(')');
                     value_description = {};
                 }
-                if (get_top().element_index != -1) {
-                    out << "[" << get_top().element_index << "]";
-                }
-                out << ":";
-                if (count_subobjects >= 0) {
-                    out << " count = " << count_subobjects;
-                }
-                out << "\n";
                 size_t headersize = object_name.size() + 1;
-                if (count_subobjects >= 0) {
-                    headersize += 9 + std::to_string(count_subobjects).size();
-                }
                 if (get_top().element_index != -1) {
-                    headersize += 2 + std::to_string(get_top().element_index).size();
+                    Write('[');
+                    headersize += 2 + WriteInteger(get_top().element_index);
+                    Write(']');
                     get_top().element_index = -1;
                 }
+                Write(':');
+                if (count_subobjects >= 0) {
+                    Write(" count = ");
+                    headersize += 9 + WriteInteger(count_subobjects);
+                }
+                Write('\n');
                 PrintHeaderUnderlines(headersize);
                 break;
             }
             case (OutputType::html):
-                out << std::string(static_cast<size_t>(get_top().indents), '\t');
+                WriteIndent();
                 if (get_top().set_details_open || get_top().should_always_open) {
-                    out << "<details open>";
+                    Write("<details open>");
                     get_top().set_details_open = false;
                 } else {
-                    out << "<details>";
+                    Write("<details>");
                 }
-                out << "<summary>";
+                Write("<summary>");
                 if (get_top().set_object_name_as_type) {
-                    out << "<span class='type'>" << object_name << "</span>";
+                    Write("<span class='type'>");
+                    Write(object_name);
+                    Write("</span>");
                     get_top().set_object_name_as_type = false;
                 } else {
-                    out << object_name;
+                    Write(object_name);
                 }
                 if (!value_description.empty()) {
-                    out << " (" << value_description << ")";
+                    Write(" (");
+                    Write(value_description);
+                    Write(')');
                     value_description = {};
                 }
                 if (get_top().element_index != -1) {
-                    out << "[<span class='val'>" << get_top().element_index << "</span>]";
+                    Write("[<span class='val'>");
+                    WriteInteger(get_top().element_index);
+                    Write("</span>]");
                     get_top().element_index = -1;
                 }
                 if (count_subobjects >= 0) {
-                    out << ": count = <span class='val'>" << std::to_string(count_subobjects) << "</span>";
+                    Write(": count = <span class='val'>");
+                    WriteInteger(count_subobjects);
+                    Write("</span>");
                 }
-                out << "</summary>\n";
+                Write("</summary>\n");
                 break;
             case (OutputType::json):
-                if (!get_top().is_first_item) {
-                    out << ",\n";
-                } else {
-                    get_top().is_first_item = false;
-                }
-                out << std::string(static_cast<size_t>(get_top().indents), '\t');
+                WriteItemSeparator();
+                WriteIndent();
                 // Objects with no name are elements in an array of objects
-                if (get_top().is_array || object_name == "" || get_top().element_index != -1) {
-                    out << "{\n";
+                if (get_top().is_array || object_name.empty() || get_top().element_index != -1) {
+                    Write('{');
                     get_top().element_index = -1;
                 } else {
-                    out << "\"" << object_name << "\": {\n";
+                    Write('"');
+                    Write(object_name);
+                    Write("\": {");
                 }
+                WriteLineBreak();
                 if (!value_description.empty()) {
                     value_description = {};
                 }
                 break;
             case (OutputType::vkconfig_output):
-                if (!get_top().is_first_item) {
-                    out << ",\n";
-                } else {
-                    get_top().is_first_item = false;
+                if (cbor) {
+                    // Unlike the json keys, the element index is kept in the key so that decoders don't drop the objects with
+                    // duplicate keys
+                    if (!get_top().is_array && get_top().element_index != -1) {
+                        WriteCborText(std::string(object_name) + "[" + std::to_string(get_top().element_index) + "]");
+                    } else if (!get_top().is_array) {
+                        WriteCborText(object_name);
+                    }
+                    get_top().element_index = -1;
+                    Write(cbor_indefinite_map);
+                    value_description = {};
+                    break;
                 }
-                out << std::string(static_cast<size_t>(get_top().indents), '\t');
+                WriteItemSeparator();
+                WriteIndent();
 
                 if (get_top().is_array && get_top().element_index != -1) {
-                    out << "\"" << object_name << "[" << get_top().element_index << "]\": ";
+                    Write('"');
+                    Write(object_name);
+                    Write('[');
+                    WriteInteger(get_top().element_index);
+                    Write("]\": ");
                     get_top().element_index = -1;
                 } else if (!get_top().is_array) {
-                    out << "\"" << object_name << "\": ";
+                    Write('"');
+                    Write(object_name);
+                    Write("\": ");
                 }
-                out << "{\n";
+                Write('{');
+                WriteLineBreak();
                 if (!value_description.empty()) {
                     value_description = {};
                 }
@@ -395,55 +456,71 @@ class Printer {
 
                 break;
             case (OutputType::html):
-                out << std::string(static_cast<size_t>(get_top().indents), '\t') << "</details>\n";
+                WriteIndent();
+                Write("</details>\n");
                 break;
             case (OutputType::json):
             case (OutputType::vkconfig_output):
-                out << "\n" << std::string(static_cast<size_t>(get_top().indents), '\t') << "}";
+                if (cbor) {
+                    Write(cbor_break);
+                    break;
+                }
+                WriteLineBreak();
+                WriteIndent();
+                Write('}');
                 break;
             default:
                 break;
         }
     }
-    void ArrayStart(std::string array_name, size_t element_count = 0) {
+    void ArrayStart(std::string_view array_name, size_t element_count = 0) {
         switch (output_type) {
             case (OutputType::text): {
-                out << std::string(static_cast<size_t>(get_top().indents), '\t') << array_name << ":";
+                WriteIndent();
+                Write(array_name);
+                Write(':');
                 size_t underline_count = array_name.size() + 1;
                 if (element_count > 0) {
-                    out << " count = " << element_count;
-                    underline_count += 9 + std::to_string(element_count).size();
+                    Write(" count = ");
+                    underline_count += 9 + WriteInteger(element_count);
                 }
-                out << "\n";
+                Write('\n');
                 PrintHeaderUnderlines(underline_count);
                 break;
             }
             case (OutputType::html):
-                out << std::string(static_cast<size_t>(get_top().indents), '\t');
+                WriteIndent();
                 if (get_top().set_details_open || get_top().should_always_open) {
-                    out << "<details open>";
+                    Write("<details open>");
                     get_top().set_details_open = false;
                 } else {
-                    out << "<details>";
+                    Write("<details>");
                 }
-                out << "<summary>" << array_name;
+                Write("<summary>");
+                Write(array_name);
                 if (element_count > 0) {
-                    out << ": count = <span class='val'>" << element_count << "</span>";
+                    Write(": count = <span class='val'>");
+                    WriteInteger(element_count);
+                    Write("</span>");
                 }
-                out << "</summary>\n";
+                Write("</summary>\n");
                 break;
             case (OutputType::json):
             case (OutputType::vkconfig_output):
-                if (!get_top().is_first_item) {
-                    out << ",\n";
-                } else {
-                    get_top().is_first_item = false;
+                if (cbor) {
+                    if (!get_top().is_array) WriteCborText(array_name);
+                    Write(cbor_indefinite_array);
+                    break;
                 }
-                out << std::string(static_cast<size_t>(get_top().indents), '\t');
+                WriteItemSeparator();
+                WriteIndent();
                 if (!get_top().is_array) {
-                    out << "\"" << array_name << "\": ";
+                    Write('"');
+                    Write(array_name);
+                    Write("\": ");
                 }
-                out << "[\n";
+                Write('[');
+                WriteLineBreak();
                 break;
             default:
                 break;
@@ -458,11 +535,18 @@ class Printer {
             case (OutputType::text):
                 break;
             case (OutputType::html):
-                out << std::string(static_cast<size_t>(get_top().indents), '\t') << "</details>\n";
+                WriteIndent();
+                Write("</details>\n");
                 break;
             case (OutputType::json):
             case (OutputType::vkconfig_output):
-                out << "\n" << std::string(static_cast<size_t>(get_top().indents), '\t') << "]";
+                if (cbor) {
+                    Write(cbor_break);
+                    break;
+                }
+                WriteLineBreak();
+                WriteIndent();
+                Write(']');
                 break;
             default:
                 break;
@@ -472,7 +556,7 @@ class Printer {
     // For printing key-value pairs.
     // value_description is for reference information and is displayed inside parenthesis after the value
     template <typename T>
-    void PrintKeyValue(std::string key, T value) {
+    void PrintKeyValue(std::string_view key, T value) {
         // If we are inside of an array, Print the value as an element
         if (get_top().is_array) {
             PrintElement(value);
@@ -481,59 +565,77 @@ class Printer {
 
         switch (output_type) {
             case (OutputType::text):
-                out << std::string(static_cast<size_t>(get_top().indents), '\t') << key;
+                WriteIndent();
+                Write(key);
                 if (get_top().min_key_width > key.size() && !get_top().ignore_min_width_parameter) {
-                    out << std::string(get_top().min_key_width - key.size(), ' ');
+                    WriteRepeated(' ', get_top().min_key_width - key.size());
                 }
-                out << " = " << value;
-                if (value_description != "") {
-                    out << " (" << value_description << ")";
+                Write(" = ");
+                WriteValue(value);
+                if (!value_description.empty()) {
+                    Write(" (");
+                    Write(value_description);
+                    Write(')');
                     value_description = {};
                 }
-                out << "\n";
+                Write('\n');
                 break;
             case (OutputType::html):
-                out << std::string(static_cast<size_t>(get_top().indents), '\t') << "<details><summary>" << key;
+                WriteIndent();
+                Write("<details><summary>");
+                Write(key);
                 if (get_top().min_key_width > key.size()) {
-                    out << std::string(get_top().min_key_width - key.size(), ' ');
+                    WriteRepeated(' ', get_top().min_key_width - key.size());
                 }
                 if (get_top().set_as_type) {
                     get_top().set_as_type = false;
-                    out << " = <span class='type'>" << value << "</span>";
+                    Write(" = <span class='type'>");
                 } else {
-                    out << " = <span class='val'>" << value << "</span>";
+                    Write(" = <span class='val'>");
                 }
+                WriteValue(value);
+                Write("</span>");
                 if (!value_description.empty()) {
-                    out << " (<span class='val'>" << value_description << "</span>)";
+                    Write(" (<span class='val'>");
+                    Write(value_description);
+                    Write("</span>)");
                     value_description = {};
                 }
-                out << "</summary></details>\n";
+                Write("</summary></details>\n");
                 break;
             case (OutputType::json):
             case (OutputType::vkconfig_output):
-                if (!get_top().is_first_item) {
-                    out << ",\n";
-                } else {
-                    get_top().is_first_item = false;
+                if (cbor) {
+                    WriteCborText(key);
+                    WriteCborValue(value);
+                    break;
                 }
-                out << std::string(static_cast<size_t>(get_top().indents), '\t');
+                WriteItemSeparator();
+                WriteIndent();
                 if (!get_top().is_array) {
-                    out << "\"" << key << "\": ";
+                    Write('"');
+                    Write(key);
+                    Write("\": ");
                 }
                 if (!value_description.empty()) {
-                    out << "\"" << value << " (" << value_description << ")\"";
+                    Write('"');
+                    WriteValue(value);
+                    Write(" (");
+                    Write(value_description);
+                    Write(")\"");
                     value_description = {};
                 } else {
-                    out << value;
+                    WriteValue(value);
                 }
             default:
                 break;
         }
+        MaybeFlush();
     }
 
     // Need a specialization to handle C style arrays since they are implicitly converted to pointers
     template <size_t N>
-    void PrintKeyValue(std::string key, const uint8_t (&values)[N]) {
+    void PrintKeyValue(std::string_view key, const uint8_t (&values)[N]) {
         switch (output_type) {
             case (OutputType::json): {
                 ArrayStart(key, N);
@@ -553,7 +655,7 @@ class Printer {
     }
 
     // For printing key - string pairs (necessary because of json)
-    void PrintKeyString(std::string key, std::string value) {
+    void PrintKeyString(std::string_view key, std::string_view value) {
         switch (output_type) {
             case (OutputType::text):
             case (OutputType::html):
@@ -561,12 +663,8 @@ class Printer {
                 break;
             case (OutputType::json):
             case (OutputType::vkconfig_output):
-                if (!value_description.empty()) {
-                    // PrintKeyValue adds the necessary quotes when printing with a value description set
-                    PrintKeyValue(key, EscapeJSONCString(value));
-                } else {
-                    PrintKeyValue(key, std::string("\"") + EscapeJSONCString(value) + "\"");
-                }
+                // PrintKeyValue adds the necessary quotes when printing with a value description set
+                PrintKeyValue(key, JsonString{value, value_description.empty()});
                 break;
             default:
                 break;
@@ -574,7 +672,13 @@ class Printer {
     }
 
     // For printing key - string pairs (necessary because of json)
-    void PrintKeyBool(std::string key, bool value) { PrintKeyValue(key, value ? "true" : "false"); }
+    void PrintKeyBool(std::string_view key, bool value) {
+        if (cbor) {
+            PrintKeyValue(key, value);
+        } else {
+            PrintKeyValue(key, value ? "true" : "false");
+        }
+    }
 
     // print inside array
     template <typename T>
@@ -586,32 +690,38 @@ class Printer {
         }
         switch (output_type) {
             case (OutputType::text):
-                out << std::string(static_cast<size_t>(get_top().indents), '\t') << element << "\n";
+                WriteIndent();
+                WriteValue(element);
+                Write('\n');
                 break;
             case (OutputType::html):
-                out << std::string(static_cast<size_t>(get_top().indents), '\t') << "<details><summary>";
+                WriteIndent();
+                Write("<details><summary>");
                 if (get_top().set_as_type) {
                     get_top().set_as_type = false;
-                    out << "<span class='type'>" << element << "</span>";
+                    Write("<span class='type'>");
                 } else {
-                    out << "<span class='val'>" << element << "</span>";
+                    Write("<span class='val'>");
                 }
-                out << "</summary></details>\n";
+                WriteValue(element);
+                Write("</span></summary></details>\n");
                 break;
             case (OutputType::json):
             case (OutputType::vkconfig_output):
-                if (!get_top().is_first_item) {
-                    out << ",\n";
-                } else {
-                    get_top().is_first_item = false;
+                if (cbor) {
+                    WriteCborValue(element);
+                    break;
                 }
-                out << std::string(static_cast<size_t>(get_top().indents), '\t') << element;
+                WriteItemSeparator();
+                WriteIndent();
+                WriteValue(element);
                 break;
             default:
                 break;
         }
+        MaybeFlush();
     }
-    void PrintString(std::string string) {
+    void PrintString(std::string_view string) {
         switch (output_type) {
             case (OutputType::text):
             case (OutputType::html):
@@ -619,21 +729,30 @@ class Printer {
                 break;
             case (OutputType::json):
             case (OutputType::vkconfig_output):
-                PrintElement("\"" + EscapeJSONCString(string) + "\"");
+                PrintElement(JsonString{string, true});
             default:
                 break;
         }
     }
-    void PrintExtension(std::string ext_name, uint32_t revision, size_t min_width = 0) {
+    void PrintExtension(std::string_view ext_name, uint32_t revision, size_t min_width = 0) {
         switch (output_type) {
             case (OutputType::text):
-                out << std::string(static_cast<size_t>(get_top().indents), '\t') << ext_name
-                    << std::string(min_width - ext_name.size(), ' ') << " : extension revision " << revision << "\n";
+                WriteIndent();
+                Write(ext_name);
+                WriteRepeated(' ', min_width - ext_name.size());
+                Write(" : extension revision ");
+                WriteInteger(revision);
+                Write('\n');
                 break;
             case (OutputType::html):
-                out << std::string(static_cast<size_t>(get_top().indents), '\t') << "<details><summary>" << DecorateAsType(ext_name)
-                    << std::string(min_width - ext_name.size(), ' ') << " : extension revision "
-                    << DecorateAsValue(std::to_string(revision)) << "</summary></details>\n";
+                WriteIndent();
+                Write("<details><summary><span class='type'>");
+                Write(ext_name);
+                Write("</span>");
+                WriteRepeated(' ', min_width - ext_name.size());
+                Write(" : extension revision <span class='val'>");
+                WriteInteger(revision);
+                Write("</span></summary></details>\n");
                 break;
             case (OutputType::json):
                 PrintKeyValue(ext_name, revision);
@@ -649,7 +768,7 @@ class Printer {
     }
     void AddNewline() {
         if (output_type == OutputType::text) {
-            out << "\n";
+            Write('\n');
         }
     }
     void IndentIncrease() {
@@ -664,24 +783,49 @@ class Printer {
         }
     }
 
-    std::string DecorateAsType(const std::string &input) {
+    std::string DecorateAsType(std::string_view input) {
         if (output_type == OutputType::html)
-            return "<span class='type'>" + input + "</span>";
+            return "<span class='type'>" + std::string(input) + "</span>";
         else
-            return input;
+            return std::string(input);
     }
 
-    std::string DecorateAsValue(const std::string &input) {
+    std::string DecorateAsValue(std::string_view input) {
         if (output_type == OutputType::html)
-            return "<span class='val'>" + input + "</span>";
+            return "<span class='val'>" + std::string(input) + "</span>";
         else
-            return input;
+            return std::string(input);
     }
 
   protected:
     OutputType output_type;
+    bool single_line;
+    bool cbor;
     std::ostream &out;
 
+    // Output waiting to be written to out, flushed once it grows past flush_threshold
+    static constexpr size_t flush_threshold = 1024 * 1024;
+    std::string buffer;
+
+    // Only used for values which can't be formatted directly into the buffer
+    std::ostringstream fallback_stream;
+
+    // cbor: the index of every string written so far which a stringref (tag 25) may refer to
+    std::unordered_map<std::string, uint64_t> cbor_strings;
+
+    static constexpr char cbor_indefinite_map = static_cast<char>(0xbf);
+    static constexpr char cbor_indefinite_array = static_cast<char>(0x9f);
+    static constexpr char cbor_break = static_cast<char>(0xff);
+
+    // Indentation is a slice of this table, deeper levels are written in several slices
+    static constexpr std::string_view indent_table = "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t";
+
+    // A string which gets json escaped on output, and optionally surrounded with quotes
+    struct JsonString {
+        std::string_view string;
+        bool quoted;
+    };
+
     struct StackNode {
         int indents = 0;
 
@@ -736,6 +880,7 @@ class Printer {
         node.is_first_item = true;
         node.ignore_min_width_parameter = get_top().ignore_min_width_parameter_in_child;
         object_stack.push(node);
+        MaybeFlush();
     }
 
     // utility
@@ -743,52 +888,233 @@ class Printer {
         assert(get_top().indents >= 0 && "indents must not be negative");
         assert(length <= 10000 && "length shouldn't be unreasonably large");
         if (get_top().set_next_header) {
-            out << std::string(static_cast<size_t>(get_top().indents), '\t') << std::string(length, '=') << "\n";
+            WriteIndent();
+            WriteRepeated('=', length);
+            Write('\n');
             get_top().set_next_header = false;
         } else if (get_top().set_next_subheader) {
-            out << std::string(static_cast<size_t>(get_top().indents), '\t') << std::string(length, '-') << "\n";
+            WriteIndent();
+            WriteRepeated('-', length);
+            Write('\n');
             get_top().set_next_subheader = false;
         }
     }
 
+    void MaybeFlush() {
+        if (buffer.size() >= flush_threshold) Flush();
+    }
+
+    void Write(std::string_view str) { buffer.append(str.data(), str.size()); }
+    void Write(char c) { buffer.push_back(c); }
+    void WriteRepeated(char c, size_t count) { buffer.append(count, c); }
+
+    void WriteLineBreak() {
+        if (!single_line) Write('\n');
+    }
+
+    void WriteIndent() {
+        assert(get_top().indents >= 0 && "indents must not be negative");
+        if (single_line) return;
+        size_t count = static_cast<size_t>(get_top().indents);
+        while (count > 0) {
+            size_t slice = (std::min)(count, indent_table.size());
+            Write(indent_table.substr(0, slice));
+            count -= slice;
+        }
+    }
+
+    // json needs a comma in front of every item but the first one of an object or array
+    void WriteItemSeparator() {
+        if (!get_top().is_first_item) {
+            Write(',');
+            WriteLineBreak();
+        } else {
+            get_top().is_first_item = false;
+        }
+    }
+
+    // Writes the initial byte of a data item of the given major type with its argument in the shortest encoding
+    void WriteCborHead(uint8_t major_type, uint64_t argument) {
+        char head[9];
+        size_t length = 0;
+        if (argument < 24) {
+            head[length++] = static_cast<char>((major_type << 5) | argument);
+        } else {
+            size_t argument_size = argument <= 0xFF ? 1 : argument <= 0xFFFF ? 2 : argument <= 0xFFFFFFFF ? 4 : 8;
+            uint8_t additional_info = argument_size == 1 ? 24 : argument_size == 2 ? 25 : argument_size == 4 ? 26 : 27;
+            head[length++] = static_cast<char>((major_type << 5) | additional_info);
+            for (size_t i = argument_size; i > 0; i--) {
+                head[length++] = static_cast<char>((argument >> ((i - 1) * 8)) & 0xFF);
+            }
+        }
+        Write(std::string_view(head, length));
+    }
+
+    template <typename T>
+    void WriteCborInteger(T value) {
+        if constexpr (std::is_signed_v<T>) {
+            if (value < 0) {
+                WriteCborHead(1, static_cast<uint64_t>(-(static_cast<int64_t>(value) + 1)));
+                return;
+            }
+        }
+        WriteCborHead(0, static_cast<uint64_t>(value));
+    }
+
+    // Text strings which were written before are replaced with a stringref to them. Like the stringref specification
+    // requires, a string is only added to the table if it is long enough for a reference to it to be shorter than the string.
+    void WriteCborText(std::string_view text) {
+        auto it = cbor_strings.find(std::string(text));
+        if (it != cbor_strings.end()) {
+            WriteCborHead(6, 25);
+            WriteCborHead(0, it->second);
+            return;
+        }
+        uint64_t index = cbor_strings.size();
+        size_t min_length = index < 24 ? 3 : index < 0x100 ? 4 : index < 0x10000 ? 5 : index < 0x100000000 ? 7 : 11;
+        if (text.size() >= min_length) cbor_strings.emplace(std::string(text), index);
+        WriteCborHead(3, text.size());
+        Write(text);
+    }
+
+    // Values which are passed as a string are already formatted as a json value, so they are converted back to the data item
+    // the json value stands for
+    void WriteCborJsonValue(std::string_view value) {
+        if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+            WriteCborText(value.substr(1, value.size() - 2));
+        } else if (value == "true") {
+            Write(static_cast<char>(0xf5));
+        } else if (value == "false") {
+            Write(static_cast<char>(0xf4));
+        } else {
+            int64_t integer = 0;
+            auto result = std::from_chars(value.data(), value.data() + value.size(), integer);
+            if (!value.empty() && result.ec == std::errc() && result.ptr == value.data() + value.size()) {
+                WriteCborInteger(integer);
+            } else {
+                WriteCborText(value);
+            }
+        }
+    }
+
+    // Writes the value as a data item of the matching type, or as a text string if it has a value description
+    template <typename T>
+    void WriteCborValue(T &value) {
+        using U = std::remove_cv_t<T>;
+        if (!value_description.empty()) {
+            std::string text;
+            if constexpr (std::is_same_v<U, JsonString>) {
+                text = std::string(value.string);
+            } else {
+                size_t start = buffer.size();
+                WriteValue(value);
+                text = buffer.substr(start);
+                buffer.resize(start);
+                if (text.size() >= 2 && text.front() == '"' && text.back() == '"') text = text.substr(1, text.size() - 2);
+            }
+            text += " (" + value_description + ")";
+            value_description = {};
+            WriteCborText(text);
+        } else if constexpr (std::is_same_v<U, JsonString>) {
+            WriteCborText(value.string);
+        } else if constexpr (std::is_convertible_v<T &, std::string_view>) {
+            WriteCborJsonValue(std::string_view(value));
+        } else if constexpr (std::is_same_v<U, bool>) {
+            Write(static_cast<char>(value ? 0xf5 : 0xf4));
+        } else if constexpr (std::is_same_v<U, char>) {
+            WriteCborText(std::string_view(&value, 1));
+        } else if constexpr (std::is_enum_v<U>) {
+            WriteCborInteger(static_cast<std::underlying_type_t<U>>(value));
+        } else if constexpr (std::is_integral_v<U>) {
+            WriteCborInteger(value);
+        } else if constexpr (std::is_same_v<U, float>) {
+            uint32_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            Write(static_cast<char>(0xfa));
+            for (int i = 3; i >= 0; i--) Write(static_cast<char>((bits >> (i * 8)) & 0xFF));
+        } else if constexpr (std::is_floating_point_v<U>) {
+            double as_double = static_cast<double>(value);
+            uint64_t bits;
+            memcpy(&bits, &as_double, sizeof(bits));
+            Write(static_cast<char>(0xfb));
+            for (int i = 7; i >= 0; i--) Write(static_cast<char>((bits >> (i * 8)) & 0xFF));
+        } else {
+            fallback_stream.str(std::string());
+            fallback_stream << value;
+            WriteCborText(fallback_stream.str());
+        }
+    }
+
+    // Returns the number of characters written
+    template <typename T>
+    size_t WriteInteger(T value) {
+        char digits[24];
+        auto result = std::to_chars(std::begin(digits), std::end(digits), value);
+        size_t length = static_cast<size_t>(result.ptr - digits);
+        Write(std::string_view(digits, length));
+        return length;
+    }
+
+    // Formats values the same way an ostream with default flags would
+    template <typename T>
+    void WriteValue(T &value) {
+        using U = std::remove_cv_t<T>;
+        if constexpr (std::is_same_v<U, JsonString>) {
+            if (value.quoted) Write('"');
+            WriteJSONEscaped(value.string);
+            if (value.quoted) Write('"');
+        } else if constexpr (std::is_convertible_v<T &, std::string_view>) {
+            Write(std::string_view(value));
+        } else if constexpr (std::is_same_v<U, bool>) {
+            Write(value ? '1' : '0');
+        } else if constexpr (std::is_same_v<U, char> || std::is_same_v<U, signed char> || std::is_same_v<U, unsigned char>) {
+            Write(static_cast<char>(value));
+        } else if constexpr (std::is_enum_v<U>) {
+            WriteInteger(static_cast<std::underlying_type_t<U>>(value));
+        } else if constexpr (std::is_integral_v<U>) {
+            WriteInteger(value);
+        } else if constexpr (std::is_floating_point_v<U>) {
+            char digits[32];
+            int length = snprintf(digits, sizeof(digits), "%g", static_cast<double>(value));
+            Write(std::string_view(digits, static_cast<size_t>(length)));
+        } else {
+            fallback_stream.str(std::string());
+            fallback_stream << value;
+            Write(fallback_stream.str());
+        }
+    }
+
     // Replace special characters in strings with their escaped versions.
     // <https://www.json.org/json-en.html>
-    std::string EscapeJSONCString(std::string string) {
-        if (output_type == OutputType::text || output_type == OutputType::html) return string;
-        std::string out{};
-        for (size_t i = 0; i < string.size(); i++) {
-            char c = string[i];
-            char out_c = c;
+    void WriteJSONEscaped(std::string_view string) {
+        for (char c : string) {
             switch (c) {
                 case '\"':
+                    Write("\\\"");
+                    break;
                 case '\\':
-                    out.push_back('\\');
+                    Write("\\\\");
                     break;
                 case '\b':
-                    out.push_back('\\');
-                    out_c = 'b';
+                    Write("\\b");
                     break;
                 case '\f':
-                    out.push_back('\\');
-                    out_c = 'f';
+                    Write("\\f");
                     break;
                 case '\n':
-                    out.push_back('\\');
-                    out_c = 'n';
+                    Write("\\n");
                     break;
                 case '\r':
-                    out.push_back('\\');
-                    out_c = 'r';
+                    Write("\\r");
                     break;
                 case '\t':
-                    out.push_back('\\');
-                    out_c = 't';
+                    Write("\\t");
+                    break;
+                default:
+                    Write(c);
                     break;
             }
-            out.push_back(out_c);
         }
-
-        return out;
     }
 };
 // Purpose: When a Printer starts an object or array it will automatically indent the output. This isn't
@@ -809,8 +1135,8 @@ class IndentWrapper {
 
 class ObjectWrapper {
   public:
-    ObjectWrapper(Printer &p, std::string object_name) : p(p) { p.ObjectStart(object_name); }
-    ObjectWrapper(Printer &p, std::string object_name, size_t count_subobjects) : p(p) {
+    ObjectWrapper(Printer &p, std::string_view object_name) : p(p) { p.ObjectStart(object_name); }
+    ObjectWrapper(Printer &p, std::string_view object_name, size_t count_subobjects) : p(p) {
         p.ObjectStart(object_name, static_cast<int32_t>(count_subobjects));
     }
     ~ObjectWrapper() { p.ObjectEnd(); }
@@ -821,7 +1147,9 @@ class ObjectWrapper {
 
 class ArrayWrapper {
   public:
-    ArrayWrapper(Printer &p, std::string array_name, size_t element_count = 0) : p(p) { p.ArrayStart(array_name, element_count); }
+    ArrayWrapper(Printer &p, std::string_view array_name, size_t element_count = 0) : p(p) {
+        p.ArrayStart(array_name, element_count);
+    }
     ~ArrayWrapper() { p.ArrayEnd(); }
 
   private:
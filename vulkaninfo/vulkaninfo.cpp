@@ -28,25 +28,19 @@
  *
  */
 
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <sstream>
 #include <string>
 #ifdef _WIN32
 #include <crtdbg.h>
 #endif
 #include "vulkaninfo.hpp"
-
-// Used to sort the formats into buckets by their properties.
-std::unordered_map<PropFlags, std::set<VkFormat>> FormatPropMap(AppGpu &gpu) {
-    std::unordered_map<PropFlags, std::set<VkFormat>> map;
-    for (const auto fmtRange : format_ranges) {
-        if (gpu.FormatRangeSupported(fmtRange)) {
-            for (int32_t fmt = fmtRange.first_format; fmt <= fmtRange.last_format; ++fmt) {
-                PropFlags pf = get_format_properties(gpu, static_cast<VkFormat>(fmt));
-                map[pf].insert(static_cast<VkFormat>(fmt));
-            }
-        }
-    }
-    return map;
-}
+#include "vulkaninfo_collect.h"
+#include "vulkaninfo_cache.h"
+#include "vulkaninfo_diff.h"
 
 // =========== Dump Functions ========= //
 
@@ -97,8 +91,8 @@ void DumpLayers(Printer &p, std::vector<LayerExtensionList> layers, const std::v
                 ObjectWrapper arr_devices(p, "Devices", gpus.size());
                 for (auto &gpu : gpus) {
                     p.SetValueDescription(std::string(gpu->props.deviceName)).PrintKeyValue("GPU id", gpu->id);
-                    auto exts = gpu->inst.AppGetPhysicalDeviceLayerExtensions(gpu->phys_device, props.layerName);
-                    DumpExtensions(p, "Layer-Device Extensions", exts);
+                    const auto *exts = gpu->FindLayerExtensions(props.layerName);
+                    DumpExtensions(p, "Layer-Device Extensions", exts ? *exts : std::vector<VkExtensionProperties>{});
                     p.AddNewline();
                 }
             }
@@ -123,8 +117,8 @@ void DumpLayers(Printer &p, std::vector<LayerExtensionList> layers, const std::v
                 for (auto &gpu : gpus) {
                     ObjectWrapper obj_gpu(p, gpu->props.deviceName);
                     p.SetValueDescription(std::string(gpu->props.deviceName)).PrintKeyValue("GPU id", gpu->id);
-                    auto exts = gpu->inst.AppGetPhysicalDeviceLayerExtensions(gpu->phys_device, layer.layer_properties.layerName);
-                    DumpExtensions(p, "Layer-Device Extensions", exts);
+                    const auto *exts = gpu->FindLayerExtensions(layer.layer_properties.layerName);
+                    DumpExtensions(p, "Layer-Device Extensions", exts ? *exts : std::vector<VkExtensionProperties>{});
                 }
             }
             break;
@@ -134,7 +128,7 @@ void DumpLayers(Printer &p, std::vector<LayerExtensionList> layers, const std::v
 
 void DumpSurfaceFormats(Printer &p, AppInstance &inst, AppSurface &surface) {
     std::vector<VkSurfaceFormatKHR> formats;
-    if (inst.CheckExtensionEnabled(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::KHR_get_surface_capabilities2)) {
         for (auto &format : surface.surf_formats2) {
             formats.push_back(format.surfaceFormat);
         }
@@ -163,18 +157,18 @@ void DumpSurfaceCapabilities(Printer &p, AppInstance &inst, AppGpu &gpu, AppSurf
     p.SetSubHeader().SetIgnoreMinWidthInChild();
     DumpVkSurfaceCapabilitiesKHR(p, "VkSurfaceCapabilitiesKHR", surf_cap);
 
-    if (inst.CheckExtensionEnabled(VK_EXT_DISPLAY_SURFACE_COUNTER_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::EXT_display_surface_counter)) {
         p.SetSubHeader();
         ObjectWrapper obj(p, "VkSurfaceCapabilities2EXT");
         DumpVkSurfaceCounterFlagsEXT(p, "supportedSurfaceCounters", surface.surface_capabilities2_ext.supportedSurfaceCounters);
     }
-    if (inst.CheckExtensionEnabled(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::KHR_get_surface_capabilities2)) {
         chain_iterator_surface_capabilities2(p, inst, gpu, surface.surface_capabilities2_khr.pNext);
     }
-    if (inst.CheckExtensionEnabled(VK_EXT_SURFACE_MAINTENANCE_1_EXTENSION_NAME) ||
-        inst.CheckExtensionEnabled(VK_KHR_SURFACE_MAINTENANCE_1_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::EXT_surface_maintenance1) ||
+        inst.CheckExtensionEnabled(AppExtension::KHR_surface_maintenance1)) {
         const char *surf_ext_name = VK_KHR_SURFACE_MAINTENANCE_1_EXTENSION_NAME;
-        if (!inst.CheckExtensionEnabled(VK_KHR_SURFACE_MAINTENANCE_1_EXTENSION_NAME)) {
+        if (!inst.CheckExtensionEnabled(AppExtension::KHR_surface_maintenance1)) {
             surf_ext_name = VK_EXT_SURFACE_MAINTENANCE_1_EXTENSION_NAME;
         }
         p.SetSubHeader();
@@ -313,7 +307,7 @@ void DumpPresentableSurfaces(Printer &p, AppInstance &inst, const std::vector<st
 #endif  // defined(VULKANINFO_WSI_ENABLED)
 
 void DumpGroups(Printer &p, AppInstance &inst) {
-    if (inst.CheckExtensionEnabled(VK_KHR_DEVICE_GROUP_CREATION_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::KHR_device_group_creation)) {
         auto groups = GetGroups(inst);
         if (groups.size() == 0) {
             p.SetHeader();
@@ -397,7 +391,7 @@ void GpuDumpProps(Printer &p, AppGpu &gpu, bool show_promoted_structs) {
     p.AddNewline();
     DumpVkPhysicalDeviceSparseProperties(p, "VkPhysicalDeviceSparseProperties", gpu.props.sparseProperties);
     p.AddNewline();
-    if (gpu.inst.CheckExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
+    if (gpu.inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2)) {
         void *place = gpu.props2.pNext;
         chain_iterator_phys_device_props2(p, gpu.inst, gpu, show_promoted_structs, place);
     }
@@ -480,9 +474,9 @@ void GpuDumpMemoryProps(Printer &p, AppGpu &gpu) {
             ObjectWrapper obj_mem_heap(p, "memoryHeaps");
             p.SetMinKeyWidth(6);
             p.PrintKeyString("size", append_human_readable(gpu.memory_props.memoryHeaps[i].size));
-            if (gpu.CheckPhysicalDeviceExtensionIncluded(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)) {
-                p.PrintKeyString("budget", append_human_readable(gpu.heapBudget[i]));
-                p.PrintKeyString("usage", append_human_readable(gpu.heapUsage[i]));
+            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_memory_budget)) {
+                p.PrintKeyString("budget", append_human_readable(gpu.GetHeapBudget()[i]));
+                p.PrintKeyString("usage", append_human_readable(gpu.GetHeapUsage()[i]));
             }
             DumpVkMemoryHeapFlags(p, "flags", gpu.memory_props.memoryHeaps[i].flags);
         }
@@ -502,7 +496,7 @@ void GpuDumpMemoryProps(Printer &p, AppGpu &gpu) {
             const uint32_t memtype_bit = 1U << i;
 
             // only linear and optimal tiling considered
-            for (auto &image_tiling : gpu.memory_image_support_types) {
+            for (auto &image_tiling : gpu.GetMemoryImageSupportTypes()) {
                 p.SetOpenDetails();
                 ArrayWrapper arr(p, VkImageTilingString(VkImageTiling(image_tiling.tiling)));
                 bool has_any_support_types = false;
@@ -550,13 +544,13 @@ void GpuDumpFeatures(Printer &p, AppGpu &gpu, bool show_promoted_structs) {
     p.SetHeader();
     DumpVkPhysicalDeviceFeatures(p, "VkPhysicalDeviceFeatures", gpu.features);
     p.AddNewline();
-    if (gpu.inst.CheckExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
-        void *place = gpu.features2.pNext;
+    if (gpu.inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2)) {
+        void *place = gpu.GetFeatures2().pNext;
         chain_iterator_phys_device_features2(p, gpu, show_promoted_structs, place);
     }
 }
 
-void GpuDumpTextFormatProperty(Printer &p, const AppGpu &gpu, PropFlags formats, const std::set<VkFormat> &format_list,
+void GpuDumpTextFormatProperty(Printer &p, const AppGpu &gpu, PropFlags formats, const std::vector<VkFormat> &format_list,
                                uint32_t counter) {
     p.SetElementIndex(counter);
     ObjectWrapper obj_common_group(p, "Common Format Group");
@@ -568,7 +562,7 @@ void GpuDumpTextFormatProperty(Printer &p, const AppGpu &gpu, PropFlags formats,
         }
     }
     ObjectWrapper obj(p, "Properties");
-    if (gpu.CheckPhysicalDeviceExtensionIncluded(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)) {
+    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_format_feature_flags2)) {
         DumpVkFormatFeatureFlags2(p, "linearTilingFeatures", formats.props3.linearTilingFeatures);
         DumpVkFormatFeatureFlags2(p, "optimalTilingFeatures", formats.props3.optimalTilingFeatures);
         DumpVkFormatFeatureFlags2(p, "bufferFeatures", formats.props3.bufferFeatures);
@@ -652,18 +646,33 @@ void GpuDevDump(Printer &p, AppGpu &gpu) {
     IndentWrapper indent_outer(p);
 
     if (p.Type() == OutputType::text) {
-        auto fmtPropMap = FormatPropMap(gpu);
-        int counter = 0;
-        std::set<VkFormat> unsupported_formats;
-        for (auto &prop : fmtPropMap) {
-            VkFormatProperties props = prop.first.props;
-            VkFormatProperties3 props3 = prop.first.props3;
-            if (props.linearTilingFeatures == 0 && props.optimalTilingFeatures == 0 && props.bufferFeatures == 0 &&
-                props3.linearTilingFeatures == 0 && props3.optimalTilingFeatures == 0 && props3.bufferFeatures == 0) {
-                unsupported_formats = prop.second;
+        // Group the formats with identical properties. The sort is stable so the formats of a group stay in order.
+        std::vector<const AppFormatProperties *> sorted_formats;
+        for (const auto &entry : gpu.GetFormatProperties()) {
+            sorted_formats.push_back(&entry);
+        }
+        std::stable_sort(sorted_formats.begin(), sorted_formats.end(),
+                         [](const AppFormatProperties *a, const AppFormatProperties *b) { return a->flags < b->flags; });
+
+        std::vector<std::pair<PropFlags, std::vector<VkFormat>>> format_groups;
+        std::vector<VkFormat> unsupported_formats;
+        for (const auto *entry : sorted_formats) {
+            if (!entry->flags.Supported()) {
+                unsupported_formats.push_back(entry->format);
                 continue;
             }
-            GpuDumpTextFormatProperty(p, gpu, prop.first, prop.second, counter++);
+            if (format_groups.empty() || !(format_groups.back().first == entry->flags)) {
+                format_groups.emplace_back(entry->flags, std::vector<VkFormat>{});
+            }
+            format_groups.back().second.push_back(entry->format);
+        }
+        // List the groups in the order of their first format
+        std::sort(format_groups.begin(), format_groups.end(),
+                  [](const auto &a, const auto &b) { return a.second.front() < b.second.front(); });
+
+        uint32_t counter = 0;
+        for (const auto &group : format_groups) {
+            GpuDumpTextFormatProperty(p, gpu, group.first, group.second, counter++);
         }
 
         ArrayWrapper arr_unsupported_formats(p, "Unsupported Formats", unsupported_formats.size());
@@ -671,21 +680,12 @@ void GpuDevDump(Printer &p, AppGpu &gpu) {
             p.SetAsType().PrintString(VkFormatString(fmt));
         }
     } else {
-        std::set<VkFormat> formats_to_print;
-        for (auto &format_range : format_ranges) {
-            if (gpu.FormatRangeSupported(format_range)) {
-                for (int32_t fmt_counter = format_range.first_format; fmt_counter <= format_range.last_format; ++fmt_counter) {
-                    formats_to_print.insert(static_cast<VkFormat>(fmt_counter));
-                }
-            }
-        }
-        for (const auto &fmt : formats_to_print) {
-            auto formats = get_format_properties(gpu, fmt);
+        for (const auto &entry : gpu.GetFormatProperties()) {
             p.SetTitleAsType();
-            if (gpu.CheckPhysicalDeviceExtensionIncluded(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)) {
-                DumpVkFormatProperties3(p, VkFormatString(fmt), formats.props3);
+            if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_format_feature_flags2)) {
+                DumpVkFormatProperties3(p, VkFormatString(entry.format), entry.flags.props3);
             } else {
-                DumpVkFormatProperties(p, VkFormatString(fmt), formats.props);
+                DumpVkFormatProperties(p, VkFormatString(entry.format), entry.flags.props);
             }
         }
     }
@@ -693,7 +693,7 @@ void GpuDevDump(Printer &p, AppGpu &gpu) {
     p.AddNewline();
 }
 
-void DumpVkVideoProfileInfoKHRCustom(Printer &p, std::string name, const VkVideoProfileInfoKHR &obj) {
+void DumpVkVideoProfileInfoKHRCustom(Printer &p, std::string_view name, const VkVideoProfileInfoKHR &obj) {
     // We use custom dumping here because we do not want to output ignored fields
     // e.g. for monochrome chromaBitDepth is ignored
     ObjectWrapper object{p, name};
@@ -709,12 +709,12 @@ void DumpVkVideoProfileInfoKHRCustom(Printer &p, std::string name, const VkVideo
 
 void GpuDumpVideoProfiles(Printer &p, AppGpu &gpu, bool show_video_props) {
     p.SetHeader();
-    ObjectWrapper video_profiles_obj(p, "Video Profiles", gpu.video_profiles.size());
+    ObjectWrapper video_profiles_obj(p, "Video Profiles", gpu.GetVideoProfiles().size());
     IndentWrapper indent_outer(p);
 
     if (p.Type() != OutputType::text || show_video_props) {
         // Video profile details per profile
-        for (const auto &video_profile : gpu.video_profiles) {
+        for (const auto &video_profile : gpu.GetVideoProfiles()) {
             p.SetSubHeader();
             ObjectWrapper video_profile_obj(p, video_profile->name);
             IndentWrapper indent_inner(p);
@@ -752,7 +752,7 @@ void GpuDumpVideoProfiles(Printer &p, AppGpu &gpu, bool show_video_props) {
         }
     } else {
         // Video profile list only
-        for (const auto &video_profile : gpu.video_profiles) {
+        for (const auto &video_profile : gpu.GetVideoProfiles()) {
             p.PrintString(video_profile->name);
         }
     }
@@ -760,86 +760,15 @@ void GpuDumpVideoProfiles(Printer &p, AppGpu &gpu, bool show_video_props) {
     p.AddNewline();
 }
 
-AppDisplayPlane::AppDisplayPlane(AppGpu &gpu, uint32_t index, const VkDisplayPlanePropertiesKHR &in_prop)
-    : global_index(index), properties(in_prop) {
-    std::ostringstream display_name;
-
-    supported_displays = GetVector<VkDisplayKHR>("vkGetDisplayPlaneSupportedDisplaysKHR", vkGetDisplayPlaneSupportedDisplaysKHR,
-                                                 gpu.phys_device, global_index);
-}
-
-std::vector<AppDisplayPlane> enumerate_display_planes(AppGpu &gpu) {
-    std::vector<AppDisplayPlane> result;
-    if (vkGetPhysicalDeviceDisplayPlanePropertiesKHR) {
-        auto planes = GetVector<VkDisplayPlanePropertiesKHR>("vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
-                vkGetPhysicalDeviceDisplayPlanePropertiesKHR, gpu.phys_device);
-        for (uint32_t i = 0; i < planes.size(); i++) {
-            result.emplace_back(gpu, i, planes[i]);
-        }
-    }
-    return result;
-}
-
-AppDisplayMode::AppDisplayMode(AppGpu &gpu, const VkDisplayModePropertiesKHR &in_properties,
-                               const std::set<uint32_t> &supported_planes)
-    : properties(in_properties) {
-    for (auto plane : supported_planes) {
-        VkDisplayPlaneCapabilitiesKHR cap;
-
-        vkGetDisplayPlaneCapabilitiesKHR(gpu.phys_device, properties.displayMode, plane, &cap);
-        capabilities[plane] = cap;
-    }
-}
-
-static std::string MakeName(uint32_t index, const VkDisplayPropertiesKHR &prop) {
-    std::stringstream name;
-    name << "Display id : " << index << " (" << (prop.displayName ? prop.displayName : "<null>") << ")";
-    return name.str();
-}
-
-AppDisplay::AppDisplay(AppGpu &gpu, uint32_t index, const VkDisplayPropertiesKHR &in_properties,
-                       const std::vector<AppDisplayPlane> &all_planes)
-    : global_index(index), name(MakeName(index, in_properties)), properties(in_properties) {
-    auto mode_props = GetVector<VkDisplayModePropertiesKHR>("vkGetDisplayModePropertiesKHR", vkGetDisplayModePropertiesKHR,
-                                                            gpu.phys_device, properties.display);
-
-    std::set<uint32_t> supported_planes;
-    for (const auto &plane : all_planes) {
-        for (const auto &display : plane.supported_displays) {
-            if (display == properties.display) {
-                supported_planes.insert(plane.global_index);
-            }
-        }
-    }
-
-    for (const auto &prop : mode_props) {
-        modes.emplace_back(gpu, prop, supported_planes);
-    }
-}
-
-std::vector<AppDisplay> enumerate_displays(AppGpu &gpu, const std::vector<AppDisplayPlane> &all_planes) {
-    std::vector<AppDisplay> result;
-
-    if (vkGetPhysicalDeviceDisplayPropertiesKHR) {
-        auto properties = GetVector<VkDisplayPropertiesKHR>("vkGetPhysicalDeviceDisplayPropertiesKHR",
-                vkGetPhysicalDeviceDisplayPropertiesKHR, gpu.phys_device);
-
-        for (uint32_t i = 0; i < properties.size(); i++) {
-            result.emplace_back(gpu, i, properties[i], all_planes);
-        }
-    }
-    return result;
-}
-
 void GpuDumpDisplays(Printer &p, AppGpu &gpu) {
-    if (gpu.displays.size() == 0) {
+    if (gpu.GetDisplays().size() == 0) {
         return;
     }
 
     p.SetHeader();
-    ObjectWrapper display_props_obj(p, "Display Properties", gpu.displays.size());
+    ObjectWrapper display_props_obj(p, "Display Properties", gpu.GetDisplays().size());
 
-    for (const auto &display : gpu.displays) {
+    for (const auto &display : gpu.GetDisplays()) {
         p.SetSubHeader();
         ObjectWrapper display_obj(p, display.name);
 
@@ -871,14 +800,14 @@ void GpuDumpDisplays(Printer &p, AppGpu &gpu) {
 }
 
 void GpuDumpDisplayPlanes(Printer &p, AppGpu &gpu) {
-    if (gpu.display_planes.size() == 0) {
+    if (gpu.GetDisplayPlanes().size() == 0) {
         return;
     }
 
     p.SetHeader();
-    ObjectWrapper display_props_obj(p, "Display Plane Properties", gpu.display_planes.size());
+    ObjectWrapper display_props_obj(p, "Display Plane Properties", gpu.GetDisplayPlanes().size());
 
-    for (const auto &plane : gpu.display_planes) {
+    for (const auto &plane : gpu.GetDisplayPlanes()) {
         p.SetSubHeader();
         ObjectWrapper display_obj(p, std::string("Display Plane id : ") + p.DecorateAsValue(std::to_string(plane.global_index)));
 
@@ -916,7 +845,7 @@ void DumpGpu(Printer &p, AppGpu &gpu, const ShowSettings &show) {
     {
         p.SetHeader();
         ObjectWrapper obj_family_props(p, "VkQueueFamilyProperties");
-        for (const auto &queue_prop : gpu.extended_queue_props) {
+        for (const auto &queue_prop : gpu.GetQueueFamilies()) {
             GpuDumpQueueProps(p, gpu, queue_prop);
         }
     }
@@ -937,26 +866,35 @@ void DumpGpu(Printer &p, AppGpu &gpu, const ShowSettings &show) {
         GpuDevDump(p, gpu);
     }
 
-    if (!gpu.video_profiles.empty()) {
+    if (!gpu.GetVideoProfiles().empty()) {
         GpuDumpVideoProfiles(p, gpu, show.video_props);
     }
 
-    if (!gpu.displays.empty()) {
+    if (!gpu.GetDisplays().empty()) {
         GpuDumpDisplays(p, gpu);
     }
 
-    if (!gpu.display_planes.empty()) {
+    if (!gpu.GetDisplayPlanes().empty()) {
         GpuDumpDisplayPlanes(p, gpu);
     }
 
     p.AddNewline();
 }
 
-// Print capabilities section of profiles schema
-void DumpGpuProfileCapabilities(Printer &p, AppGpu &gpu, bool show_promoted_structs) {
-    ObjectWrapper capabilities(p, "capabilities");
+// The name of the profile of a GPU, which is also the name of the file --json writes it to
+std::string GetGpuProfileName(AppGpu &gpu) {
+    std::string name =
+        std::string("VP_" APP_UPPER_CASE_NAME "_") + std::string(gpu.props.deviceName) + "_" + gpu.GetDriverVersionString();
+    for (auto &c : name) {
+        if (c == ' ' || c == '.') c = '_';
+    }
+    return name;
+}
+
+// Print the capability blocks of a GPU, named "device" and "macos-specific" followed by block_suffix
+void DumpGpuProfileCapabilityBlocks(Printer &p, AppGpu &gpu, bool show_promoted_structs, const std::string &block_suffix) {
     {
-        ObjectWrapper temp_name_obj(p, "device");
+        ObjectWrapper temp_name_obj(p, "device" + block_suffix);
         DumpExtensions(p, "extensions", gpu.device_extensions);
         {
             ObjectWrapper obj(p, "features");
@@ -981,49 +919,28 @@ void DumpGpuProfileCapabilities(Printer &p, AppGpu &gpu, bool show_promoted_stru
                 DumpVkPhysicalDeviceSparseProperties(p, "VkPhysicalDeviceSparseProperties", gpu.props.sparseProperties);
                 p.PrintKeyValue("vendorID", props.vendorID);
             }
-            if (gpu.inst.CheckExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
+            if (gpu.inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2)) {
                 void *place = gpu.props2.pNext;
                 chain_iterator_phys_device_props2(p, gpu.inst, gpu, show_promoted_structs, place);
             }
         }
         {
             ObjectWrapper obj(p, "formats");
-            std::set<VkFormat> already_printed_formats;
-            for (const auto &format : format_ranges) {
-                if (gpu.FormatRangeSupported(format)) {
-                    for (int32_t fmt_counter = format.first_format; fmt_counter <= format.last_format; ++fmt_counter) {
-                        VkFormat fmt = static_cast<VkFormat>(fmt_counter);
-                        if (already_printed_formats.count(fmt) > 0) {
-                            continue;
-                        }
-                        auto formats = get_format_properties(gpu, fmt);
-
-                        // don't print format properties that are unsupported
-                        if (formats.props.linearTilingFeatures == 0 && formats.props.optimalTilingFeatures == 0 &&
-                            formats.props.bufferFeatures == 0 && formats.props3.linearTilingFeatures == 0 &&
-                            formats.props3.optimalTilingFeatures == 0 && formats.props3.bufferFeatures == 0)
-                            continue;
-
-                        ObjectWrapper format_obj(p, std::string("VK_") + VkFormatString(fmt));
-                        {
-                            // Want to explicitly list VkFormatProperties in addition to VkFormatProperties3 if available
-                            DumpVkFormatProperties(p, "VkFormatProperties", formats.props);
-                            VkFormatProperties2 format_props2{};
-                            format_props2.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2;
-                            format_props2.formatProperties = formats.props;
-                            std::unique_ptr<format_properties2_chain> chain_for_format_props2;
-                            setup_format_properties2_chain(format_props2, chain_for_format_props2, gpu);
-                            vkGetPhysicalDeviceFormatProperties2KHR(gpu.phys_device, fmt, &format_props2);
-                            chain_iterator_format_properties2(p, gpu, format_props2.pNext);
-                        }
-                        already_printed_formats.insert(fmt);
-                    }
+            for (const auto &entry : gpu.GetFormatProperties()) {
+                // don't print format properties that are unsupported
+                if (!entry.flags.Supported()) continue;
+
+                ObjectWrapper format_obj(p, std::string("VK_") + VkFormatString(entry.format));
+                // Want to explicitly list VkFormatProperties in addition to VkFormatProperties3 if available
+                DumpVkFormatProperties(p, "VkFormatProperties", entry.flags.props);
+                if (entry.chain) {
+                    chain_iterator_format_properties2(p, gpu, entry.chain->start_of_chain);
                 }
             }
         }
         {
             ArrayWrapper arr(p, "queueFamiliesProperties");
-            for (const auto &extended_queue_prop : gpu.extended_queue_props) {
+            for (const auto &extended_queue_prop : gpu.GetQueueFamilies()) {
                 ObjectWrapper queue_obj(p, "");
                 {
                     ObjectWrapper obj_queue_props(p, "VkQueueFamilyProperties");
@@ -1036,9 +953,9 @@ void DumpGpuProfileCapabilities(Printer &p, AppGpu &gpu, bool show_promoted_stru
                 chain_iterator_queue_properties2(p, gpu, extended_queue_prop.pNext);
             }
         }
-        if (!gpu.video_profiles.empty()) {
+        if (!gpu.GetVideoProfiles().empty()) {
             ArrayWrapper video_profiles(p, "videoProfiles");
-            for (const auto &video_profile : gpu.video_profiles) {
+            for (const auto &video_profile : gpu.GetVideoProfiles()) {
                 ObjectWrapper video_profile_obj(p, "");
                 {
                     ObjectWrapper profile_info_obj(p, "profile");
@@ -1063,10 +980,10 @@ void DumpGpuProfileCapabilities(Printer &p, AppGpu &gpu, bool show_promoted_stru
     }
 #if defined(VK_ENABLE_BETA_EXTENSIONS)
     // Print portability subset extension, features, and properties if available
-    if (gpu.CheckPhysicalDeviceExtensionIncluded(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME) &&
-        (gpu.inst.CheckExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) ||
+    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_portability_subset) &&
+        (gpu.inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2) ||
          gpu.inst.api_version >= VK_API_VERSION_1_1)) {
-        ObjectWrapper macos_obj(p, "macos-specific");
+        ObjectWrapper macos_obj(p, "macos-specific" + block_suffix);
         {
             ObjectWrapper ext_obj(p, "extensions");
             const std::string portability_ext_name = VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME;
@@ -1078,7 +995,7 @@ void DumpGpuProfileCapabilities(Printer &p, AppGpu &gpu, bool show_promoted_stru
         }
         {
             ObjectWrapper features_obj(p, "features");
-            void *feats_place = gpu.features2.pNext;
+            void *feats_place = gpu.GetFeatures2().pNext;
             while (feats_place) {
                 VkBaseOutStructure *structure = static_cast<VkBaseOutStructure *>(feats_place);
                 if (structure->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR) {
@@ -1105,6 +1022,23 @@ void DumpGpuProfileCapabilities(Printer &p, AppGpu &gpu, bool show_promoted_stru
     }
 #endif  // defined(VK_ENABLE_BETA_EXTENSIONS)
 }
+
+// Print capabilities section of profiles schema
+void DumpGpuProfileCapabilities(Printer &p, AppGpu &gpu, bool show_promoted_structs) {
+    ObjectWrapper capabilities(p, "capabilities");
+    DumpGpuProfileCapabilityBlocks(p, gpu, show_promoted_structs, "");
+}
+
+// The date profiles are exported on, computed once since std::localtime isn't safe to call from several threads
+const std::string &GetProfileExportDate() {
+    static const std::string date = [] {
+        std::time_t t = std::time(0);  // get time now
+        std::tm *now = std::localtime(&t);
+        return std::to_string(now->tm_year + 1900) + '-' + std::to_string(now->tm_mon + 1) + '-' + std::to_string(now->tm_mday);
+    }();
+    return date;
+}
+
 void PrintProfileBaseInfo(Printer &p, const std::string &device_name, uint32_t apiVersion, const std::string &device_label,
                           const std::vector<std::string> &capabilities) {
     ObjectWrapper vk_info(p, device_name);
@@ -1119,11 +1053,7 @@ void PrintProfileBaseInfo(Printer &p, const std::string &device_name, uint32_t a
         ArrayWrapper contributors(p, "history");
         ObjectWrapper element(p, "");
         p.PrintKeyValue("revision", 1);
-        std::time_t t = std::time(0);  // get time now
-        std::tm *now = std::localtime(&t);
-        std::string date =
-            std::to_string(now->tm_year + 1900) + '-' + std::to_string(now->tm_mon + 1) + '-' + std::to_string(now->tm_mday);
-        p.PrintKeyString("date", date);
+        p.PrintKeyString("date", GetProfileExportDate());
         p.PrintKeyString("author", std::string("Automated export from ") + APP_SHORT_NAME);
         p.PrintKeyString("comment", "");
     }
@@ -1131,28 +1061,27 @@ void PrintProfileBaseInfo(Printer &p, const std::string &device_name, uint32_t a
     for (const auto &str : capabilities) p.PrintString(str);
 }
 
-// Prints profiles section of profiles schema
-void DumpGpuProfileInfo(Printer &p, AppGpu &gpu) {
-    ObjectWrapper profiles(p, "profiles");
-
+// Print the profiles of a GPU named device_name, using the capability blocks DumpGpuProfileCapabilityBlocks printed with
+// block_suffix
+void DumpGpuProfileEntries(Printer &p, AppGpu &gpu, const std::string &device_name, const std::string &block_suffix) {
     std::string device_label = std::string(gpu.props.deviceName) + " driver " + gpu.GetDriverVersionString();
-    std::string device_name =
-        std::string("VP_" APP_UPPER_CASE_NAME "_") + std::string(gpu.props.deviceName) + "_" + gpu.GetDriverVersionString();
-    ;
-    for (auto &c : device_name) {
-        if (c == ' ' || c == '.') c = '_';
-    }
-    PrintProfileBaseInfo(p, device_name, gpu.props.apiVersion, device_label, {"device"});
+    PrintProfileBaseInfo(p, device_name, gpu.props.apiVersion, device_label, {"device" + block_suffix});
 #if defined(VK_ENABLE_BETA_EXTENSIONS)
-    if (gpu.CheckPhysicalDeviceExtensionIncluded(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME) &&
-        (gpu.inst.CheckExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) ||
+    if (gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_portability_subset) &&
+        (gpu.inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2) ||
          gpu.inst.api_version >= VK_API_VERSION_1_1)) {
         PrintProfileBaseInfo(p, device_name + "_portability_subset", gpu.props.apiVersion, device_label + " subset",
-                             {"device", "macos-specific"});
+                             {"device" + block_suffix, "macos-specific" + block_suffix});
     }
 #endif  // defined(VK_ENABLE_BETA_EXTENSIONS)
 }
 
+// Prints profiles section of profiles schema
+void DumpGpuProfileInfo(Printer &p, AppGpu &gpu) {
+    ObjectWrapper profiles(p, "profiles");
+    DumpGpuProfileEntries(p, gpu, GetGpuProfileName(gpu), "");
+}
+
 // Print summary of system
 void DumpSummaryInstance(Printer &p, AppInstance &inst) {
     p.SetSubHeader();
@@ -1244,7 +1173,7 @@ static void ConsoleEnlarge() {
 #endif
 
 // Global configuration
-enum class OutputCategory { text, html, profile_json, vkconfig_output, summary };
+enum class OutputCategory { text, html, profile_json, vkconfig_output, summary, ndjson, cbor };
 const char *help_message_body =
     "OPTIONS:\n"
     "[-h, --help]         Print this help.\n"
@@ -1272,6 +1201,20 @@ const char *help_message_body =
     "                     interest. This number can be determined by running\n"
     "                     " APP_SHORT_NAME
     " without any options specified.\n"
+    "[-j=all, --json=all] Produce the json of every gpu in the system in one run, each\n"
+    "                     saved to the file --json names it. GPUs which would get the\n"
+    "                     same file name have _gpu<gpu-number> added to it. With -o,\n"
+    "                     all of them are written to that file as one document,\n"
+    "                     which --diff and vulkaninfo-fleet read GPU by GPU.\n"
+    "[--ndjson]           Produce line delimited json, one record per section of the\n"
+    "                     instance and of each physical device, each one written as\n"
+    "                     soon as it is gathered. Records have a \"record\" name and\n"
+    "                     device records a \"gpu\" number, in the order they finish.\n"
+    "[--cbor]             Produce a compact binary version of " APP_SHORT_NAME
+    " output in CBOR,\n"
+    "                     saved as \"" APP_SHORT_NAME
+    ".cbor\" in the directory in which the\n"
+    "                     command is run. Repeated strings are encoded as references.\n"
     "[--show-all]         Show everything (includes all the below options)\n"
     "[--show-tool-props]  Show the active VkPhysicalDeviceToolPropertiesEXT that " APP_SHORT_NAME
     " finds.\n"
@@ -1283,7 +1226,36 @@ const char *help_message_body =
     "                     video format properties of each video profile supported\n"
     "                     by each physical device.\n"
     "                     Note: This only affects text output which by default\n"
-    "                     only contains the list of supported video profile names.\n";
+    "                     only contains the list of supported video profile names.\n"
+    "[--jobs=<count>]     Gather the information of up to count physical devices at\n"
+    "                     the same time, splitting count between them to probe their\n"
+    "                     video profiles.\n"
+    "                     Output order does not depend on it. Defaults to the number\n"
+    "                     of hardware threads, 1 disables threading.\n"
+    "[--cache=<directory>]\n"
+    "                     Keep the format properties and image memory support of\n"
+    "                     each physical device in directory and reuse them while the\n"
+    "                     driver, layers and " APP_SHORT_NAME " version stay the same.\n"
+    "[--watch=<hz>]       Sample the memory budget and usage of every physical device\n"
+    "                     hz times per second until stopped, printing one line of\n"
+    "                     json per sample. Other output options are ignored.\n"
+    "[--timings[=<file>]] Time every " API_NAME " call and print how long each call and\n"
+    "                     each phase took to stderr once done. With a file, the\n"
+    "                     timings are also written to it as json.\n"
+    "[--headless]         Probe surface support with a VK_EXT_headless_surface surface\n"
+    "                     instead of creating windows, if the instance supports it.\n"
+    "[--display-timeout=<ms>]\n"
+    "                     Skip the surfaces of a display server which can't be\n"
+    "                     connected to within ms milliseconds.\n"
+    "[--diff <a.json> [<b.json>]]\n"
+    "                     List the values that differ between two json files written\n"
+    "                     by --json or --vkconfig_output. With one file, compare it to\n"
+    "                     the profile --json would write for the selected GPU.\n"
+    "[--diff-gpu=<gpu-number>]\n"
+    "                     The GPU --diff compares a file to, and whose blocks of a\n"
+    "                     --json=all document are compared with a single profile,\n"
+    "                     0 if not given.\n"
+    "[--diff-json]        Write the --diff change list as json instead of text.\n";
 
 void print_usage(const std::string &executable_name) {
     std::cout << "\n" APP_SHORT_NAME " - Summarize " API_NAME " information in relation to the current environment.\n\n";
@@ -1291,13 +1263,23 @@ void print_usage(const std::string &executable_name) {
     std::cout << "    " << executable_name << " --summary\n";
     std::cout << "    " << executable_name << " -o <filename> | --output <filename>\n";
     std::cout << "    " << executable_name << " -j | -j=<gpu-number> | --json | --json=<gpu-number>\n";
+    std::cout << "    " << executable_name << " -j=all | --json=all\n";
     std::cout << "    " << executable_name << " --text\n";
     std::cout << "    " << executable_name << " --html\n";
+    std::cout << "    " << executable_name << " --ndjson\n";
+    std::cout << "    " << executable_name << " --cbor\n";
     std::cout << "    " << executable_name << " --show-all\n";
     std::cout << "    " << executable_name << " --show-formats\n";
     std::cout << "    " << executable_name << " --show-tool-props\n";
     std::cout << "    " << executable_name << " --show-promoted-structs\n";
     std::cout << "    " << executable_name << " --show-video-props\n";
+    std::cout << "    " << executable_name << " --jobs=<count>\n";
+    std::cout << "    " << executable_name << " --cache=<directory>\n";
+    std::cout << "    " << executable_name << " --watch=<hz>\n";
+    std::cout << "    " << executable_name << " --timings[=<file>]\n";
+    std::cout << "    " << executable_name << " --headless\n";
+    std::cout << "    " << executable_name << " --display-timeout=<ms>\n";
+    std::cout << "    " << executable_name << " --diff <a.json> [<b.json>] [--diff-gpu=<gpu-number>] [--diff-json]\n";
     std::cout << "\n" << help_message_body << std::endl;
 }
 
@@ -1305,10 +1287,20 @@ struct ParsedResults {
     OutputCategory output_category = OutputCategory::text;
     uint32_t selected_gpu = 0;
     bool has_selected_gpu = false;  // differentiate between selecting the 0th gpu and using the default 0th value
+    bool all_gpus_json = false;     // --json=all
     ShowSettings show;
     bool print_to_file = false;
     std::string filename;  // set if explicitly given, or if vkconfig_output has a <path> argument
     std::string default_filename;
+    uint32_t jobs = 0;  // 0 means one per hardware thread
+    std::string cache_directory;  // capability cache is disabled if empty
+    double watch_rate = 0;        // samples per second of --watch, 0 if not watching
+    bool timings = false;
+    bool headless = false;
+    uint32_t display_timeout_ms = 0;  // 0 waits for display connections as long as they take
+    std::string timings_file;  // json output of --timings, none if empty
+    std::vector<std::string> diff_files;  // --diff, a single file is compared to the selected GPU
+    bool diff_json = false;
 };
 
 util::vulkaninfo_optional<ParsedResults> parse_arguments(int argc, char **argv, std::string executable_name) {
@@ -1331,11 +1323,12 @@ util::vulkaninfo_optional<ParsedResults> parse_arguments(int argc, char **argv,
                 ++i;
             }
         } else if (strncmp("--json", argv[i], 6) == 0 || strncmp(argv[i], "-j", 2) == 0) {
-            if (strlen(argv[i]) > 7 && strncmp("--json=", argv[i], 7) == 0) {
+            if (strcmp("--json=all", argv[i]) == 0 || strcmp("-j=all", argv[i]) == 0) {
+                results.all_gpus_json = true;
+            } else if (strlen(argv[i]) > 7 && strncmp("--json=", argv[i], 7) == 0) {
                 results.selected_gpu = static_cast<uint32_t>(strtol(argv[i] + 7, nullptr, 10));
                 results.has_selected_gpu = true;
-            }
-            if (strlen(argv[i]) > 3 && strncmp("-j=", argv[i], 3) == 0) {
+            } else if (strlen(argv[i]) > 3 && strncmp("-j=", argv[i], 3) == 0) {
                 results.selected_gpu = static_cast<uint32_t>(strtol(argv[i] + 3, nullptr, 10));
                 results.has_selected_gpu = true;
             }
@@ -1351,6 +1344,13 @@ util::vulkaninfo_optional<ParsedResults> parse_arguments(int argc, char **argv,
             results.output_category = OutputCategory::html;
             results.print_to_file = true;
             results.default_filename = APP_SHORT_NAME ".html";
+        } else if (strcmp(argv[i], "--ndjson") == 0) {
+            results.output_category = OutputCategory::ndjson;
+            results.default_filename = APP_SHORT_NAME ".ndjson";
+        } else if (strcmp(argv[i], "--cbor") == 0) {
+            results.output_category = OutputCategory::cbor;
+            results.print_to_file = true;
+            results.default_filename = APP_SHORT_NAME ".cbor";
         } else if (strcmp(argv[i], "--show-all") == 0) {
             results.show.all = true;
             results.show.tool_props = true;
@@ -1365,6 +1365,67 @@ util::vulkaninfo_optional<ParsedResults> parse_arguments(int argc, char **argv,
             results.show.promoted_structs = true;
         } else if (strcmp(argv[i], "--show-video-props") == 0) {
             results.show.video_props = true;
+        } else if (strncmp(argv[i], "--jobs=", 7) == 0) {
+            char *end = nullptr;
+            long jobs = strtol(argv[i] + 7, &end, 10);
+            if (end == argv[i] + 7 || *end != '\0' || jobs < 1) {
+                std::cout << "--jobs must be given a job count of at least 1\n";
+                return {};
+            }
+            results.jobs = static_cast<uint32_t>(jobs);
+        } else if (strncmp(argv[i], "--cache=", 8) == 0) {
+            if (argv[i][8] == '\0') {
+                std::cout << "--cache must be given a directory\n";
+                return {};
+            }
+            results.cache_directory = argv[i] + 8;
+        } else if (strncmp(argv[i], "--watch=", 8) == 0) {
+            char *end = nullptr;
+            double rate = strtod(argv[i] + 8, &end);
+            if (end == argv[i] + 8 || *end != '\0' || !(rate > 0)) {
+                std::cout << "--watch must be given a positive sample rate\n";
+                return {};
+            }
+            results.watch_rate = rate;
+        } else if (strcmp(argv[i], "--headless") == 0) {
+            results.headless = true;
+        } else if (strncmp(argv[i], "--display-timeout=", 18) == 0) {
+            char *end = nullptr;
+            long timeout = strtol(argv[i] + 18, &end, 10);
+            if (end == argv[i] + 18 || *end != '\0' || timeout < 1) {
+                std::cout << "--display-timeout must be given a timeout of at least 1 millisecond\n";
+                return {};
+            }
+            results.display_timeout_ms = static_cast<uint32_t>(timeout);
+        } else if (strcmp(argv[i], "--timings") == 0) {
+            results.timings = true;
+        } else if (strncmp(argv[i], "--timings=", 10) == 0) {
+            if (argv[i][10] == '\0') {
+                std::cout << "--timings= must be given a file name\n";
+                return {};
+            }
+            results.timings = true;
+            results.timings_file = argv[i] + 10;
+        } else if (strcmp(argv[i], "--diff") == 0) {
+            while (argc > (i + 1) && argv[i + 1][0] != '-' && results.diff_files.size() < 2) {
+                results.diff_files.push_back(argv[i + 1]);
+                ++i;
+            }
+            if (results.diff_files.empty()) {
+                std::cout << "--diff must be followed by one or two json files\n";
+                return {};
+            }
+        } else if (strncmp(argv[i], "--diff-gpu=", 11) == 0) {
+            char *end = nullptr;
+            long gpu = strtol(argv[i] + 11, &end, 10);
+            if (end == argv[i] + 11 || *end != '\0' || gpu < 0) {
+                std::cout << "--diff-gpu must be given a GPU number\n";
+                return {};
+            }
+            results.selected_gpu = static_cast<uint32_t>(gpu);
+            results.has_selected_gpu = true;
+        } else if (strcmp(argv[i], "--diff-json") == 0) {
+            results.diff_json = true;
         } else if ((strcmp(argv[i], "--output") == 0 || strcmp(argv[i], "-o") == 0) && argc > (i + 1)) {
             if (argv[i + 1][0] == '-') {
                 std::cout << "-o or --output must be followed by a filename\n";
@@ -1402,24 +1463,210 @@ PrinterCreateDetails get_printer_create_details(ParsedResults &parse_data, AppIn
             create.start_string =
                 std::string("{\n\t\"$schema\": ") + "\"https://schema.khronos.org/vulkan/profiles-0.8-latest.json\"";
             if (parse_data.filename.empty()) {
-                create.file_name = std::string("VP_" APP_UPPER_CASE_NAME "_") + std::string(selected_gpu.props.deviceName) + "_" +
-                                   selected_gpu.GetDriverVersionString();
-                for (auto &c : create.file_name) {
-                    if (c == ' ' || c == '.') c = '_';
-                }
-                create.file_name += ".json";
+                create.file_name = GetGpuProfileName(selected_gpu) + ".json";
             }
             break;
         case (OutputCategory::vkconfig_output):
             create.output_type = OutputType::vkconfig_output;
             create.start_string = "{\n\t\"" API_NAME " Instance Version\": \"" + inst.api_version.str() + "\"";
             break;
+        case (OutputCategory::cbor):
+            // The same document as vkconfig_output, RunPrinter prints the instance version the start_string holds for it
+            create.output_type = OutputType::vkconfig_output;
+            create.cbor = true;
+            break;
     }
     return create;
 }
 
+// Samples the memory budget and usage of every GPU watch_rate times per second until out can't be written to anymore, as one
+// line of json per sample. Only the first sample queries anything besides VkPhysicalDeviceMemoryBudgetPropertiesEXT.
+void WatchMemoryBudget(AppInstance &instance, const ParsedResults &parse_data, std::ostream &out) {
+    auto phys_devices = instance.FindPhysicalDevices();
+    std::vector<std::unique_ptr<AppGpu>> gpus;
+    for (size_t i = 0; i < phys_devices.size(); i++) {
+        gpus.push_back(std::unique_ptr<AppGpu>(new AppGpu(instance, static_cast<uint32_t>(i), phys_devices[i], false, {})));
+    }
+
+    const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / parse_data.watch_rate));
+    auto next_sample = std::chrono::steady_clock::now();
+    std::string record;
+    auto append_heaps = [&record](const char *name, const std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> &values, uint32_t count) {
+        record += ",\"" + std::string(name) + "\":[";
+        for (uint32_t i = 0; i < count; i++) {
+            if (i != 0) record += ',';
+            record += std::to_string(values[i]);
+        }
+        record += ']';
+    };
+    while (out) {
+        const auto now = std::chrono::steady_clock::now();
+        record = "{\"timestamp_ns\":";
+        record += std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count());
+        record += ",\"gpus\":[";
+        for (auto &gpu : gpus) {
+            if (gpu->id != 0) record += ',';
+            record += "{\"id\":" + std::to_string(gpu->id);
+            if (gpu->HasHeapBudget()) {
+                gpu->ResampleHeapBudget();
+                append_heaps("heapBudget", gpu->GetHeapBudget(), gpu->memory_props.memoryHeapCount);
+                append_heaps("heapUsage", gpu->GetHeapUsage(), gpu->memory_props.memoryHeapCount);
+            }
+            record += '}';
+        }
+        record += "]}\n";
+        out << record << std::flush;
+
+        // Skip the samples that are already late instead of taking them back to back
+        next_sample += period;
+        if (next_sample < now) next_sample = now + period;
+        std::this_thread::sleep_until(next_sample);
+    }
+}
+
+// Writes the records of --ndjson output. Each record is printed by a Printer of its own into a local buffer, so that the GPU
+// tasks can print records at the same time and only the write to out is serialized.
+class RecordWriter {
+  public:
+    RecordWriter(std::ostream &out, APIVersion api_version) : out(out), api_version(api_version) {}
+
+    // Writes a single line json object with the record name and the gpu id, if given, followed by what dump prints
+    void Write(std::string_view record, const AppGpu *gpu, const std::function<void(Printer &)> &dump) {
+        TimingPhase phase("output");
+        PrinterCreateDetails details{};
+        details.output_type = OutputType::vkconfig_output;
+        details.single_line = true;
+        details.start_string = "{\"record\": \"" + std::string(record) + "\"";
+        if (gpu) details.start_string += ", \"gpu\": " + std::to_string(gpu->id);
+
+        std::ostringstream record_out;
+        {
+            Printer p(details, record_out, api_version);
+            dump(p);
+        }
+        std::lock_guard<std::mutex> lock(out_mutex);
+        out << record_out.str() << std::flush;
+    }
+
+  private:
+    std::ostream &out;
+    APIVersion api_version;
+    std::mutex out_mutex;
+};
+
+// Compares the first --diff file to the second one, or to the profile of the selected GPU if an instance is given. The profile
+// is dumped to memory exactly as --json would write it, so the comparison sees the same values either way.
+void RunDiff(const ParsedResults &parse_data, AppInstance *instance, std::ostream &out) {
+    auto open_file = [](const std::string &name) {
+        std::ifstream file(name, std::ios::binary);
+        if (!file) throw std::runtime_error("--diff can't open " + name);
+        return file;
+    };
+    std::ifstream from = open_file(parse_data.diff_files[0]);
+    std::ifstream to_file;
+    std::istringstream to_live;
+    std::istream *to = &to_file;
+    if (instance == nullptr) {
+        to_file = open_file(parse_data.diff_files[1]);
+    } else {
+        auto phys_devices = instance->FindPhysicalDevices();
+        if (parse_data.selected_gpu >= phys_devices.size()) {
+            throw std::runtime_error("--diff-gpu " + std::to_string(parse_data.selected_gpu) + " is not a valid GPU number");
+        }
+        AppGpu gpu(*instance, parse_data.selected_gpu, phys_devices[parse_data.selected_gpu], parse_data.show.promoted_structs,
+                   {});
+        PrinterCreateDetails details{};
+        details.output_type = OutputType::json;
+        details.start_string = std::string("{\n\t\"$schema\": ") + "\"https://schema.khronos.org/vulkan/profiles-0.8-latest.json\"";
+        std::ostringstream profile_out;
+        {
+            Printer p(details, profile_out, instance->api_version);
+            DumpGpuProfileCapabilities(p, gpu, parse_data.show.promoted_structs);
+            DumpGpuProfileInfo(p, gpu);
+        }
+        to_live.str(profile_out.str());
+        to = &to_live;
+    }
+
+    JsonDiff diff;
+    try {
+        DiffVulkaninfoJson(from, *to, diff, parse_data.selected_gpu);
+    } catch (std::runtime_error &e) {
+        throw std::runtime_error("--diff can't read the json: " + std::string(e.what()));
+    }
+    if (parse_data.diff_json) {
+        PrintDiffJson(out, diff);
+    } else {
+        PrintDiffText(out, diff);
+    }
+}
+
+// The --ndjson counterpart of DumpGpu, every section is queried right before its record is written
+void WriteGpuRecords(RecordWriter &writer, AppGpu &gpu, const ShowSettings &show) {
+    writer.Write("properties", &gpu, [&](Printer &p) {
+        GpuDumpProps(p, gpu, show.promoted_structs);
+        DumpExtensions(p, "Device Extensions", gpu.device_extensions);
+    });
+    writer.Write("queues", &gpu, [&](Printer &p) {
+        ObjectWrapper obj_family_props(p, "VkQueueFamilyProperties");
+        for (const auto &queue_prop : gpu.GetQueueFamilies()) {
+            GpuDumpQueueProps(p, gpu, queue_prop);
+        }
+    });
+    writer.Write("memory", &gpu, [&](Printer &p) { GpuDumpMemoryProps(p, gpu); });
+    writer.Write("features", &gpu, [&](Printer &p) { GpuDumpFeatures(p, gpu, show.promoted_structs); });
+    if (show.tool_props) {
+        writer.Write("tools", &gpu, [&](Printer &p) { GpuDumpToolingInfo(p, gpu); });
+    }
+    if (show.all) {
+        writer.Write("device_info", &gpu, [&](Printer &p) {
+            GpuDumpCooperativeMatrix(p, gpu);
+            GpuDumpCalibrateableTimeDomain(p, gpu);
+            GpuDumpFragmentShadingRate(p, gpu);
+            GpuDumpSampleLocations(p, gpu);
+        });
+    }
+    writer.Write("formats", &gpu, [&](Printer &p) { GpuDevDump(p, gpu); });
+    if (!gpu.GetVideoProfiles().empty()) {
+        writer.Write("video", &gpu, [&](Printer &p) { GpuDumpVideoProfiles(p, gpu, true); });
+    }
+    if (!gpu.GetDisplays().empty() || !gpu.GetDisplayPlanes().empty()) {
+        writer.Write("displays", &gpu, [&](Printer &p) {
+            if (!gpu.GetDisplays().empty()) GpuDumpDisplays(p, gpu);
+            if (!gpu.GetDisplayPlanes().empty()) GpuDumpDisplayPlanes(p, gpu);
+        });
+    }
+}
+
+// AppGpu queries most sections on first use, this queries the ones RunPrinter will print so that it happens in the per GPU
+// tasks instead of one GPU after another while printing
+void QueryPrintedGpuSections(AppGpu &gpu, const ParsedResults &parse_data) {
+    if (parse_data.output_category == OutputCategory::summary) return;
+    // WriteGpuRecords queries the device sections while writing them, only the layers record is written after the GPU tasks
+    if (parse_data.output_category == OutputCategory::ndjson) {
+        gpu.GetLayerExtensions();
+        return;
+    }
+    if (parse_data.output_category == OutputCategory::profile_json && !parse_data.all_gpus_json &&
+        gpu.id != parse_data.selected_gpu)
+        return;
+
+    gpu.GetFeatures2();
+    gpu.GetQueueFamilies();
+    gpu.GetFormatProperties();
+    gpu.GetVideoProfiles();
+    if (parse_data.output_category == OutputCategory::profile_json) return;
+
+    gpu.GetLayerExtensions();
+    gpu.GetHeapBudget();
+    gpu.GetMemoryImageSupportTypes();
+    gpu.GetDisplays();
+}
+
 void RunPrinter(Printer &p, ParsedResults parse_data, AppInstance &instance, std::vector<std::unique_ptr<AppGpu>> &gpus,
                 std::vector<std::unique_ptr<AppSurface>> &surfaces) {
+    TimingPhase phase("output");
 #ifdef VK_USE_PLATFORM_IOS_MVK
     p.SetAlwaysOpenDetails(true);
 #endif
@@ -1435,7 +1682,10 @@ void RunPrinter(Printer &p, ParsedResults parse_data, AppInstance &instance, std
         DumpGpuProfileCapabilities(p, *(gpus.at(parse_data.selected_gpu).get()), parse_data.show.promoted_structs);
         DumpGpuProfileInfo(p, *(gpus.at(parse_data.selected_gpu).get()));
     } else {
-        // text, html, vkconfig_output
+        // text, html, vkconfig_output, cbor
+        if (parse_data.output_category == OutputCategory::cbor) {
+            p.PrintKeyString(API_NAME " Instance Version", instance.api_version.str());
+        }
         p.SetHeader();
         DumpExtensions(p, "Instance Extensions", instance.global_extensions);
         p.AddNewline();
@@ -1457,6 +1707,49 @@ void RunPrinter(Printer &p, ParsedResults parse_data, AppInstance &instance, std
     }
 }
 
+// --json=all: writes the profile of every GPU to the file --json would write it to, all at once since the GPU tasks already
+// queried everything a profile holds. If a file name was given, the profiles are written to it as a single document instead,
+// with the capability blocks of each GPU named after its number, which is how --diff and vulkaninfo-fleet tell the GPUs apart.
+void WriteAllGpuProfiles(ParsedResults &parse_data, AppInstance &instance, std::vector<std::unique_ptr<AppGpu>> &gpus,
+                         const std::string &executable_name) {
+    TimingPhase phase("output");
+    // Identical GPUs with the same driver would overwrite each other's file
+    std::vector<std::string> profile_names;
+    for (auto &gpu : gpus) profile_names.push_back(GetGpuProfileName(*gpu));
+    std::vector<std::string> unique_names = profile_names;
+    for (size_t i = 0; i < gpus.size(); i++) {
+        if (std::count(profile_names.begin(), profile_names.end(), profile_names[i]) > 1) {
+            unique_names[i] += "_gpu" + std::to_string(gpus[i]->id);
+        }
+    }
+
+    if (!parse_data.filename.empty()) {
+        auto printer_data = get_printer_create_details(parse_data, instance, *gpus.at(0), executable_name);
+        std::ofstream file_out(printer_data.file_name);
+        Printer p(printer_data, file_out, instance.api_version);
+        {
+            ObjectWrapper capabilities(p, "capabilities");
+            for (auto &gpu : gpus) {
+                DumpGpuProfileCapabilityBlocks(p, *gpu, parse_data.show.promoted_structs, "_gpu" + std::to_string(gpu->id));
+            }
+        }
+        ObjectWrapper profiles(p, "profiles");
+        for (size_t i = 0; i < gpus.size(); i++) {
+            DumpGpuProfileEntries(p, *gpus[i], unique_names[i], "_gpu" + std::to_string(gpus[i]->id));
+        }
+        return;
+    }
+
+    RunParallelTasks(gpus.size(), parse_data.jobs, [&](size_t i) {
+        auto printer_data = get_printer_create_details(parse_data, instance, *gpus[i], executable_name);
+        printer_data.file_name = unique_names[i] + ".json";
+        std::ofstream file_out(printer_data.file_name);
+        Printer p(printer_data, file_out, instance.api_version);
+        DumpGpuProfileCapabilities(p, *gpus[i], parse_data.show.promoted_structs);
+        DumpGpuProfileInfo(p, *gpus[i]);
+    });
+}
+
 #ifdef VK_USE_PLATFORM_IOS_MVK
 // On iOS, we'll call this ourselves from a parent routine in the GUI
 int vulkanInfoMain(int argc, char **argv) {
@@ -1500,6 +1793,12 @@ int main(int argc, char **argv) {
     }
 #endif
 
+    std::unique_ptr<CallTimings> timings;
+    if (parse_data.timings) {
+        timings = std::unique_ptr<CallTimings>(new CallTimings());
+        call_timings = timings.get();
+    }
+
     int return_code = 0;  // set in case of error
     std::unique_ptr<Printer> printer;
     std::ostream std_out(std::cout.rdbuf());
@@ -1508,49 +1807,64 @@ int main(int argc, char **argv) {
 
     // if any essential vulkan call fails, it throws an exception
     try {
-        AppInstance instance = {};
-        SetupWindowExtensions(instance);
+        if (!parse_data.diff_files.empty()) {
+            if (!parse_data.filename.empty()) {
+                file_out = std::ofstream(parse_data.filename);
+                out = &file_out;
+            }
+            // Comparing two files doesn't need Vulkan at all
+            if (parse_data.diff_files.size() == 2) {
+                RunDiff(parse_data, nullptr, *out);
+            } else {
+                AppInstance instance = {};
+                RunDiff(parse_data, &instance, *out);
+            }
+        } else if (parse_data.watch_rate > 0) {
+            AppInstance instance = {};
+            if (!parse_data.filename.empty()) {
+                file_out = std::ofstream(parse_data.filename);
+                out = &file_out;
+            }
+            WatchMemoryBudget(instance, parse_data, *out);
+        } else {
+            AppInstance instance = {};
+            SetupWindowExtensions(instance, parse_data.headless, parse_data.display_timeout_ms);
 
-        auto phys_devices = instance.FindPhysicalDevices();
+            auto phys_devices = instance.FindPhysicalDevices();
 
-#if defined(VULKANINFO_WSI_ENABLED)
-        for (auto &surface_extension : instance.surface_extensions) {
-            // If the surface extension has a create_window function then call it to create the single shared window
-            if (surface_extension.create_window) {
-                try {
-                    surface_extension.create_window(instance);
-                } catch (std::exception &e) {
-                    std::cerr << "ERROR while creating window for surface extension " << surface_extension.name << " : " << e.what()
-                              << "\n";
-                    continue;
+            // --ndjson writes records while the GPUs are being queried, so its output is set up before the GPU tasks start
+            std::unique_ptr<RecordWriter> record_writer;
+            if (parse_data.output_category == OutputCategory::ndjson) {
+                if (!parse_data.filename.empty()) {
+                    file_out = std::ofstream(parse_data.filename);
+                    out = &file_out;
                 }
+                record_writer = std::unique_ptr<RecordWriter>(new RecordWriter(*out, instance.api_version));
+                record_writer->Write("instance", nullptr, [&](Printer &p) {
+                    p.PrintKeyString(API_NAME " Instance Version", instance.api_version.str());
+                    DumpExtensions(p, "Instance Extensions", instance.global_extensions);
+                });
+                record_writer->Write("groups", nullptr, [&](Printer &p) { DumpGroups(p, instance); });
             }
 
-            // If the surface extension has a create_surface function then call it to create the single shared surface
-            if (surface_extension.create_surface) {
-                try {
-                    surface_extension.surface = surface_extension.create_surface(instance);
-                } catch (std::exception &e) {
-                    std::cerr << "ERROR while creating surface for extension " << surface_extension.name << " : " << e.what()
-                              << "\n";
+#if defined(VULKANINFO_WSI_ENABLED)
+            for (auto &surface_extension : instance.surface_extensions) {
+                TimingPhase phase("surface creation");
+                // If the surface extension has a create_window function then call it to create the single shared window
+                if (surface_extension.create_window) {
+                    try {
+                        surface_extension.create_window(instance);
+                    } catch (std::exception &e) {
+                        std::cerr << "ERROR while creating window for surface extension " << surface_extension.name << " : "
+                                  << e.what() << "\n";
+                        continue;
+                    }
                 }
-            }
-        }
-#endif  // defined(VULKANINFO_WSI_ENABLED)
 
-        std::vector<std::unique_ptr<AppGpu>> gpus;
-
-        uint32_t gpu_counter = 0;
-        for (auto &phys_device : phys_devices) {
-            // Take a copy of the surface extensions list as some may be per physical device (e.g. VK_KHR_display)
-            auto surface_extensions = instance.surface_extensions;
-#if defined(VULKANINFO_WSI_ENABLED)
-            for (auto &surface_extension : surface_extensions) {
-                // If the surface extension has a create_surface_for_physical_device function then call it to create
-                // the physical device specific surface
-                if (surface_extension.create_surface_for_physical_device) {
+                // If the surface extension has a create_surface function then call it to create the single shared surface
+                if (surface_extension.create_surface) {
                     try {
-                        surface_extension.surface = surface_extension.create_surface_for_physical_device(instance, phys_device);
+                        surface_extension.surface = surface_extension.create_surface(instance);
                     } catch (std::exception &e) {
                         std::cerr << "ERROR while creating surface for extension " << surface_extension.name << " : " << e.what()
                                   << "\n";
@@ -1558,78 +1872,149 @@ int main(int argc, char **argv) {
                 }
             }
 #endif  // defined(VULKANINFO_WSI_ENABLED)
-            gpus.push_back(std::unique_ptr<AppGpu>(
-                new AppGpu(instance, gpu_counter++, phys_device, parse_data.show.promoted_structs, std::move(surface_extensions))));
-        }
 
-        std::vector<std::unique_ptr<AppSurface>> surfaces;
+            // Surfaces are created up front on this thread since window system connections are not guaranteed to be thread safe
+            std::vector<std::vector<SurfaceExtension>> gpu_surface_extensions;
+            for (auto &phys_device : phys_devices) {
+                TimingPhase phase("surface creation");
+                // Take a copy of the surface extensions list as some may be per physical device (e.g. VK_KHR_display)
+                auto surface_extensions = instance.surface_extensions;
 #if defined(VULKANINFO_WSI_ENABLED)
-        for (auto &gpu : gpus) {
-            for (auto &surface_extension : gpu->surface_extensions) {
-                if (surface_extension.surface == VK_NULL_HANDLE) continue;
-                try {
-                    // check if the surface is supported by the physical device before adding it to the list
-                    VkBool32 supported = VK_FALSE;
-                    VkResult err = vkGetPhysicalDeviceSurfaceSupportKHR(gpu->phys_device, 0, surface_extension.surface, &supported);
-                    if (err != VK_SUCCESS || supported == VK_FALSE) continue;
-
-                    surfaces.push_back(
-                        std::unique_ptr<AppSurface>(new AppSurface(instance, *gpu.get(), gpu->phys_device, surface_extension)));
-                } catch (std::exception &e) {
-                    std::cerr << "ERROR while creating surface for extension " << surface_extension.name << " : " << e.what()
-                              << "\n";
+                for (auto &surface_extension : surface_extensions) {
+                    // If the surface extension has a create_surface_for_physical_device function then call it to create
+                    // the physical device specific surface
+                    if (surface_extension.create_surface_for_physical_device) {
+                        try {
+                            surface_extension.surface =
+                                surface_extension.create_surface_for_physical_device(instance, phys_device);
+                        } catch (std::exception &e) {
+                            std::cerr << "ERROR while creating surface for extension " << surface_extension.name << " : "
+                                      << e.what() << "\n";
+                        }
+                    }
                 }
+#endif  // defined(VULKANINFO_WSI_ENABLED)
+                gpu_surface_extensions.push_back(std::move(surface_extensions));
             }
-        }
+
+            // Each physical device is queried by its own task, every task writes only to its own slot so the output order is
+            // the enumeration order no matter which task finishes first
+            std::vector<std::unique_ptr<AppGpu>> gpus(phys_devices.size());
+            std::vector<std::vector<std::unique_ptr<AppSurface>>> gpu_surfaces(phys_devices.size());
+            std::vector<std::string> gpu_surface_errors(phys_devices.size());
+            // The video profile probes of every GPU run at the same time as the GPU tasks, so they split the jobs between them
+            // rather than each starting as many threads as the GPU tasks do
+            uint32_t job_count = parse_data.jobs != 0 ? parse_data.jobs : (std::max)(std::thread::hardware_concurrency(), 1u);
+            uint32_t video_profile_jobs = (std::max)(job_count / (std::max)(static_cast<uint32_t>(phys_devices.size()), 1u), 1u);
+            RunParallelTasks(phys_devices.size(), parse_data.jobs, [&](size_t i) {
+                gpus[i] = std::unique_ptr<AppGpu>(new AppGpu(instance, static_cast<uint32_t>(i), phys_devices[i],
+                                                             parse_data.show.promoted_structs,
+                                                             std::move(gpu_surface_extensions[i])));
+                gpus[i]->video_profile_jobs = video_profile_jobs;
+                uint32_t cached_sections = 0;
+                if (!parse_data.cache_directory.empty()) {
+                    cached_sections = LoadCapabilityCache(*gpus[i], parse_data.cache_directory);
+                }
+                QueryPrintedGpuSections(*gpus[i], parse_data);
+                if (record_writer) WriteGpuRecords(*record_writer, *gpus[i], parse_data.show);
+                if (!parse_data.cache_directory.empty()) {
+                    UpdateCapabilityCache(*gpus[i], parse_data.cache_directory, cached_sections);
+                }
+#if defined(VULKANINFO_WSI_ENABLED)
+                auto &gpu = gpus[i];
+                for (auto &surface_extension : gpu->surface_extensions) {
+                    if (surface_extension.surface == VK_NULL_HANDLE) continue;
+                    try {
+                        // check if the surface is supported by the physical device before adding it to the list
+                        VkBool32 supported = VK_FALSE;
+                        VkResult err =
+                            vkGetPhysicalDeviceSurfaceSupportKHR(gpu->phys_device, 0, surface_extension.surface, &supported);
+                        if (err != VK_SUCCESS || supported == VK_FALSE) continue;
+
+                        gpu_surfaces[i].push_back(
+                            std::unique_ptr<AppSurface>(new AppSurface(instance, *gpu.get(), gpu->phys_device, surface_extension)));
+                    } catch (std::exception &e) {
+                        gpu_surface_errors[i] +=
+                            "ERROR while creating surface for extension " + surface_extension.name + " : " + e.what() + "\n";
+                    }
+                }
 #endif  // defined(VULKANINFO_WSI_ENABLED)
+            });
 
-        if (parse_data.selected_gpu >= gpus.size()) {
-            if (parse_data.has_selected_gpu) {
-                std::cout << "The selected gpu (" << parse_data.selected_gpu << ") is not a valid GPU index. ";
-                if (gpus.size() == 0) {
+            std::vector<std::unique_ptr<AppSurface>> surfaces;
+            for (size_t i = 0; i < phys_devices.size(); i++) {
+                std::cerr << gpu_surface_errors[i];
+                for (auto &surface : gpu_surfaces[i]) {
+                    surfaces.push_back(std::move(surface));
+                }
+            }
+
+            if (record_writer) {
+                record_writer->Write("layers", nullptr, [&](Printer &p) { DumpLayers(p, instance.global_layers, gpus); });
+#if defined(VULKANINFO_WSI_ENABLED)
+                if (!surfaces.empty()) {
+                    record_writer->Write("surfaces", nullptr,
+                                         [&](Printer &p) { DumpPresentableSurfaces(p, instance, gpus, surfaces); });
+                }
+#endif  // defined(VULKANINFO_WSI_ENABLED)
+            } else if (parse_data.all_gpus_json) {
+                if (gpus.empty()) {
                     std::cout << APP_SHORT_NAME " could not find any GPU's.\n";
                     return 1;
-                } else {
-                    if (gpus.size() == 1) {
-                        std::cout << "The only available GPU selection is 0.\n";
-                    } else {
-                        std::cout << "The available GPUs are in the range of 0 to " << gpus.size() - 1 << ".\n";
+                }
+                WriteAllGpuProfiles(parse_data, instance, gpus, executable_name);
+            } else {
+                if (parse_data.selected_gpu >= gpus.size()) {
+                    if (parse_data.has_selected_gpu) {
+                        std::cout << "The selected gpu (" << parse_data.selected_gpu << ") is not a valid GPU index. ";
+                        if (gpus.size() == 0) {
+                            std::cout << APP_SHORT_NAME " could not find any GPU's.\n";
+                            return 1;
+                        } else {
+                            if (gpus.size() == 1) {
+                                std::cout << "The only available GPU selection is 0.\n";
+                            } else {
+                                std::cout << "The available GPUs are in the range of 0 to " << gpus.size() - 1 << ".\n";
+                            }
+                            return 1;
+                        }
+                    } else if (parse_data.output_category == OutputCategory::profile_json) {
+                        std::cout << APP_SHORT_NAME " could not find any GPU's.\n";
                     }
-                    return 1;
                 }
-            } else if (parse_data.output_category == OutputCategory::profile_json) {
-                std::cout << APP_SHORT_NAME " could not find any GPU's.\n";
-            }
-        }
 
-        auto printer_data = get_printer_create_details(parse_data, instance, *gpus.at(parse_data.selected_gpu), executable_name);
-        if (printer_data.print_to_file) {
-            file_out = std::ofstream(printer_data.file_name);
-            out = &file_out;
-        }
-        printer = std::unique_ptr<Printer>(new Printer(printer_data, *out, instance.api_version));
+                auto printer_data =
+                    get_printer_create_details(parse_data, instance, *gpus.at(parse_data.selected_gpu), executable_name);
+                if (printer_data.print_to_file) {
+                    file_out = std::ofstream(printer_data.file_name,
+                                             printer_data.cbor ? std::ios::out | std::ios::binary : std::ios::out);
+                    out = &file_out;
+                }
+                printer = std::unique_ptr<Printer>(new Printer(printer_data, *out, instance.api_version));
 
-        RunPrinter(*(printer.get()), parse_data, instance, gpus, surfaces);
+                RunPrinter(*(printer.get()), parse_data, instance, gpus, surfaces);
 
-        // Call the printer's destructor before the file handle gets closed
-        printer.reset(nullptr);
+                // Call the printer's destructor before the file handle gets closed
+                printer.reset(nullptr);
+            }
 
-        // Clean up the AppSurface objects to destroy the underlying VkSurfaceKHR objects
-        surfaces.clear();
+            // Clean up the AppSurface objects to destroy the underlying VkSurfaceKHR objects
+            surfaces.clear();
 
 #if defined(VULKANINFO_WSI_ENABLED)
-        for (auto &surface_extension : instance.surface_extensions) {
-            // If the surface is shared across physical devices then we have to destroy it here as there's a single shared
-            // surface for the AppInstance object (contrarily to per physical device surfaces that are maintained by AppSurface)
-            if (surface_extension.create_surface) {
-                vkDestroySurfaceKHR(instance.instance, surface_extension.surface, nullptr);
-            }
-            // If the surface extension has a destroy_window function then call it to destroy the single shared window
-            if (surface_extension.destroy_window) {
-                surface_extension.destroy_window(instance);
+            for (auto &surface_extension : instance.surface_extensions) {
+                // If the surface is shared across physical devices then we have to destroy it here as there's a single shared
+                // surface for the AppInstance object (contrarily to per physical device surfaces that are maintained by AppSurface)
+                if (surface_extension.create_surface) {
+                    vkDestroySurfaceKHR(instance.instance, surface_extension.surface, nullptr);
+                }
+                // If the surface extension has a destroy_window function then call it to destroy the single shared window
+                if (surface_extension.destroy_window) {
+                    surface_extension.destroy_window(instance);
+                }
             }
-        }
 #endif  // defined(VULKANINFO_WSI_ENABLED)
+        }
     } catch (std::exception &e) {
         // Print the error to stderr and leave all outputs in a valid state (mainly for json)
         std::cerr << "ERROR at " << e.what() << "\n";
@@ -1642,6 +2027,15 @@ int main(int argc, char **argv) {
         printer.reset(nullptr);
     }
 
+    if (timings) {
+        timings->PrintTable(std::cerr);
+        if (!parse_data.timings_file.empty()) {
+            std::ofstream timings_out(parse_data.timings_file);
+            timings->WriteJson(timings_out);
+        }
+        call_timings = nullptr;
+    }
+
 #ifdef _WIN32
     if (parse_data.output_category == OutputCategory::text && !parse_data.print_to_file) wait_for_console_destroy();
 #endif
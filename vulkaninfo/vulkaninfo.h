@@ -30,20 +30,29 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <exception>
 #include <iostream>
 #include <fstream>
 #include <map>
 #include <memory>
+#include <new>
 #include <ostream>
 #include <set>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <set>
 #include <vector>
 #include <utility>
 #include <functional>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <system_error>
 
 #include <assert.h>
 #include <stdint.h>
@@ -90,6 +99,8 @@
 
 #include <vulkan/vulkan.h>
 
+#include "vulkaninfo_extensions.hpp"
+
 static std::string VkResultString(VkResult err);
 
 // General error: Get file + line and a short message
@@ -255,6 +266,104 @@ auto GetVector(const char *func_name, F &&f, Ts &&...ts) -> std::vector<T> {
     return GetVectorInit(func_name, f, T(), ts...);
 }
 
+// Runs task(0) .. task(task_count - 1) on at most job_count threads (0 picks one per hardware thread). Tasks are handed out
+// in index order and the call returns once all of them are done. With a single job everything runs on the calling thread.
+// The Vulkan calls of the tasks are timed in the phase of the caller. If tasks throw, the other tasks still run and the
+// exception of the lowest numbered task that threw is rethrown once all of them are done.
+inline void RunParallelTasks(size_t task_count, uint32_t job_count, const std::function<void(size_t)> &task) {
+    std::vector<std::exception_ptr> exceptions(task_count);
+    auto run = [&](size_t i) {
+        try {
+            task(i);
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+    };
+    size_t thread_count = job_count != 0 ? job_count : (std::max)(std::thread::hardware_concurrency(), 1u);
+    thread_count = (std::min)(thread_count, task_count);
+    if (thread_count <= 1) {
+        for (size_t i = 0; i < task_count; i++) run(i);
+    } else {
+        std::atomic<size_t> next_task{0};
+        const char *timing_phase = current_timing_phase;
+        auto worker = [&]() {
+            current_timing_phase = timing_phase;
+            for (size_t i = next_task++; i < task_count; i = next_task++) run(i);
+        };
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < thread_count; i++) threads.emplace_back(worker);
+        worker();
+        for (auto &thread : threads) thread.join();
+    }
+    for (auto &exception : exceptions) {
+        if (exception) std::rethrow_exception(exception);
+    }
+}
+
+// Holds the structs of a pNext chain in a single allocation, so that a chain only pays for the structs it contains.
+// Add every struct that goes into the chain, then Allocate creates all of them at once and links them in the order added.
+class ChainArena {
+  public:
+    // member is pointed at the struct once Allocate is called. padding is extra zeroed space after the struct.
+    template <typename T>
+    void Add(T *&member, VkStructureType sType, size_t padding = 0) {
+        size = (size + alignof(T) - 1) / alignof(T) * alignof(T);
+        entries.push_back({size, sizeof(T) + padding, sType, &member, Create<T>});
+        size += sizeof(T) + padding;
+    }
+
+    // Returns the first struct of the chain, or nullptr if nothing was added
+    void *Allocate() {
+        if (entries.empty()) return nullptr;
+        storage.reset(new char[size]());
+        VkBaseOutStructure *previous = nullptr;
+        for (const auto &entry : entries) {
+            void *place = storage.get() + entry.offset;
+            entry.create(entry.member, place);
+            VkBaseOutStructure *structure = static_cast<VkBaseOutStructure *>(place);
+            structure->sType = entry.sType;
+            if (previous) previous->pNext = structure;
+            previous = structure;
+        }
+        return storage.get();
+    }
+
+    // The bytes of every struct of the chain, including the pNext pointers which are only meaningful to this chain
+    const char *Data() const { return storage.get(); }
+    size_t Size() const { return storage ? size : 0; }
+
+    // Copies the contents of every struct from Data() of a chain with the same structs, keeping the pNext links of this chain.
+    // Returns false and leaves the chain untouched if the structs don't match.
+    bool Restore(const char *data, size_t data_size) {
+        if (data_size != Size()) return false;
+        for (const auto &entry : entries) {
+            VkStructureType sType;
+            memcpy(&sType, data + entry.offset, sizeof(sType));
+            if (sType != entry.sType) return false;
+        }
+        for (const auto &entry : entries) {
+            const size_t header_size = sizeof(VkBaseOutStructure);
+            memcpy(storage.get() + entry.offset + header_size, data + entry.offset + header_size, entry.size - header_size);
+        }
+        return true;
+    }
+
+  private:
+    template <typename T>
+    static void Create(void *member, void *place) { *static_cast<T **>(member) = new (place) T{}; }
+
+    struct Entry {
+        size_t offset;
+        size_t size;
+        VkStructureType sType;
+        void *member;
+        void (*create)(void *member, void *place);
+    };
+    std::vector<Entry> entries;
+    size_t size = 0;
+    std::unique_ptr<char[]> storage;
+};
+
 // Forward declarations for pNext chains
 struct phys_device_props2_chain;
 struct phys_device_mem_props2_chain;
@@ -271,6 +380,7 @@ struct AppVideoProfile;
 struct AppDisplay;
 struct AppDisplayMode;
 struct AppDisplayPlane;
+struct AppFormatProperties;
 
 void setup_phys_device_props2_chain(VkPhysicalDeviceProperties2 &start, std::unique_ptr<phys_device_props2_chain> &chain,
                                     AppInstance &inst, AppGpu &gpu, bool show_promoted_structs);
@@ -288,6 +398,8 @@ bool prepare_phys_device_props2_twocall_chain_vectors(std::unique_ptr<phys_devic
 bool is_video_format_same(const VkVideoFormatPropertiesKHR &format_a, const VkVideoFormatPropertiesKHR &format_b);
 std::vector<std::unique_ptr<AppVideoProfile>> enumerate_supported_video_profiles(AppGpu &gpu);
 
+std::vector<AppFormatProperties> enumerate_format_properties(AppGpu &gpu);
+
 std::vector<AppDisplayPlane> enumerate_display_planes(AppGpu &gpu);
 std::vector<AppDisplay> enumerate_displays(AppGpu &gpu, const std::vector<AppDisplayPlane> &all_planes);
 
@@ -343,6 +455,8 @@ struct SurfaceExtension {
 
 struct AppVideoProfile {
     bool supported;
+    // What vkGetPhysicalDeviceVideoCapabilitiesKHR returned, VK_SUCCESS if it was never called
+    VkResult capabilities_result = VK_SUCCESS;
 
     std::string name;
 
@@ -394,6 +508,7 @@ struct AppVideoProfile {
         init_profile(*this);
 
         VkResult result = vkGetPhysicalDeviceVideoCapabilitiesKHR(phys_device, &profile_info, &capabilities);
+        capabilities_result = result;
         if (result != VK_SUCCESS) {
             supported = false;
             return;
@@ -534,6 +649,7 @@ struct AppInstance {
     std::vector<VkExtensionProperties> global_extensions;  // Instance Extensions
 
     std::vector<std::string> inst_extensions;
+    AppExtensionSet inst_extension_set;  // inst_extensions interned, for CheckExtensionEnabled
 
     std::vector<SurfaceExtension> surface_extensions;
 
@@ -544,12 +660,13 @@ struct AppInstance {
     HWND h_wnd;            // window handle
 #endif
 #ifdef VK_USE_PLATFORM_XCB_KHR
-    xcb_connection_t *xcb_connection;
+    xcb_connection_t *xcb_connection = nullptr;  // connected by SetupWindowExtensions, like the other display connections
+    int xcb_screen_number = 0;
     xcb_screen_t *xcb_screen;
     xcb_window_t xcb_window;
 #endif
 #ifdef VK_USE_PLATFORM_XLIB_KHR
-    Display *xlib_display;
+    Display *xlib_display = nullptr;
     Window xlib_window;
 #endif
 #ifdef VK_USE_PLATFORM_MACOS_MVK
@@ -559,7 +676,7 @@ struct AppInstance {
     void *metal_window;
 #endif
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    wl_display *wayland_display;
+    wl_display *wayland_display = nullptr;
     wl_surface *wayland_surface;
 #endif
 #ifdef VK_USE_PLATFORM_DIRECTFB_EXT
@@ -574,6 +691,7 @@ struct AppInstance {
     struct _screen_window *window;
 #endif
     AppInstance() {
+        TimingPhase phase("instance creation");
         VkResult dllErr = load_vulkan_library();
 
         if (dllErr != VK_SUCCESS) {
@@ -600,6 +718,10 @@ struct AppInstance {
             VK_STRUCTURE_TYPE_APPLICATION_INFO, nullptr, APP_SHORT_NAME, 1, nullptr, 0, instance_version};
 
         AppCompileInstanceExtensionsToEnable();
+        for (const auto &ext : inst_extensions) {
+            AppExtension extension;
+            if (FindAppExtension(ext, extension)) inst_extension_set.set(static_cast<size_t>(extension));
+        }
 
         std::vector<const char *> inst_exts;
         for (const auto &ext : inst_extensions) {
@@ -609,7 +731,7 @@ struct AppInstance {
         const VkInstanceCreateInfo inst_info = {
             VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
             &dbg_info,
-            (CheckExtensionEnabled(VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME)
+            (CheckExtensionEnabled(AppExtension::KHR_portability_enumeration)
                  ? static_cast<VkInstanceCreateFlags>(VK_INSTANCE_CREATE_ENUMERATE_PORTABILITY_BIT_KHR)
                  : 0),
             &app_info,
@@ -638,6 +760,7 @@ struct AppInstance {
     }
 
     ~AppInstance() {
+        TimingPhase phase("teardown");
         if (debug_callback) vkDestroyDebugReportCallbackEXT(instance, debug_callback, nullptr);
         if (vkDestroyInstance) vkDestroyInstance(instance, nullptr);
         unload_vulkan_library();
@@ -646,9 +769,10 @@ struct AppInstance {
     AppInstance(const AppInstance &) = delete;
     const AppInstance &operator=(const AppInstance &) = delete;
 
-    bool CheckExtensionEnabled(std::string extension_to_check) const {
-        return std::any_of(inst_extensions.begin(), inst_extensions.end(),
-                           [extension_to_check](std::string str) { return str == extension_to_check; });
+    bool CheckExtensionEnabled(AppExtension extension) const { return inst_extension_set.test(static_cast<size_t>(extension)); }
+    bool CheckExtensionEnabled(std::string_view extension_to_check) const {
+        AppExtension extension;
+        return FindAppExtension(extension_to_check, extension) && CheckExtensionEnabled(extension);
     }
 
     /* Gets a list of layer and instance extensions */
@@ -694,6 +818,9 @@ struct AppInstance {
             if (strcmp(VK_KHR_SURFACE_MAINTENANCE_1_EXTENSION_NAME, ext.extensionName) == 0) {
                 inst_extensions.push_back(ext.extensionName);
             }
+            if (strcmp(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME, ext.extensionName) == 0) {
+                inst_extensions.push_back(ext.extensionName);
+            }
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
             if (strcmp(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME, ext.extensionName) == 0) {
                 inst_extensions.push_back(ext.extensionName);
@@ -799,6 +926,7 @@ struct AppInstance {
     }
 
     std::vector<VkPhysicalDevice> FindPhysicalDevices() {
+        TimingPhase phase("physical device enumeration");
         return GetVector<VkPhysicalDevice>("vkEnumeratePhysicalDevices", vkEnumeratePhysicalDevices, instance);
     }
 
@@ -891,23 +1019,39 @@ static void AppDestroyWin32Window(AppInstance &inst) { user32_handles->pfnDestro
 
 //----------------------------XCB----------------------------
 #ifdef VK_USE_PLATFORM_XCB_KHR
-static void AppCreateXcbWindow(AppInstance &inst) {
-    //--Init Connection--
-    const xcb_setup_t *setup;
-    xcb_screen_iterator_t iter;
-    int scr;
+struct XcbConnection {
+    xcb_connection_t *connection = nullptr;
+    int screen_number = 0;
+};
 
+static XcbConnection AppConnectXcb() {
+    XcbConnection xcb;
     // API guarantees non-null xcb_connection
-    inst.xcb_connection = xcb_connect(nullptr, &scr);
-    int conn_error = xcb_connection_has_error(inst.xcb_connection);
+    xcb.connection = xcb_connect(nullptr, &xcb.screen_number);
+    int conn_error = xcb_connection_has_error(xcb.connection);
     if (conn_error) {
         fprintf(stderr, "XCB failed to connect to the X server due to error:%d.\n", conn_error);
         fflush(stderr);
-        xcb_disconnect(inst.xcb_connection);
-        inst.xcb_connection = nullptr;
+        xcb_disconnect(xcb.connection);
+        xcb.connection = nullptr;
+    }
+    return xcb;
+}
+
+static void AppDisconnectXcb(XcbConnection xcb) {
+    if (xcb.connection) xcb_disconnect(xcb.connection);
+}
+
+// Uses the connection SetupWindowExtensions made
+static void AppCreateXcbWindow(AppInstance &inst) {
+    if (!inst.xcb_connection) {
         return;
     }
 
+    const xcb_setup_t *setup;
+    xcb_screen_iterator_t iter;
+    int scr = inst.xcb_screen_number;
+
     setup = xcb_get_setup(inst.xcb_connection);
     iter = xcb_setup_roots_iterator(setup);
     while (scr-- > 0) {
@@ -957,11 +1101,17 @@ static void AppDestroyXcbWindow(AppInstance &inst) {
 
 //----------------------------XLib---------------------------
 #ifdef VK_USE_PLATFORM_XLIB_KHR
+static Display *AppConnectXlib() { return XOpenDisplay(nullptr); }
+
+static void AppDisconnectXlib(Display *display) {
+    if (display) XCloseDisplay(display);
+}
+
+// Uses the connection SetupWindowExtensions made
 static void AppCreateXlibWindow(AppInstance &inst) {
     long visualMask = VisualScreenMask;
     int numberOfVisuals{};
 
-    inst.xlib_display = XOpenDisplay(nullptr);
     if (inst.xlib_display == nullptr) {
         THROW_ERR("XLib failed to connect to the X server.");
     }
@@ -1067,8 +1217,22 @@ static void wayland_registry_global(void *data, struct wl_registry *registry, ui
 static void wayland_registry_global_remove(void *data, struct wl_registry *registry, uint32_t id) {}
 static const struct wl_registry_listener wayland_registry_listener = {wayland_registry_global, wayland_registry_global_remove};
 
+static wl_display *AppConnectWayland() {
+    wl_display *display = wl_display_connect(nullptr);
+    // The roundtrip makes sure the compositor answers, not only that its socket accepts connections
+    if (display != nullptr && wl_display_roundtrip(display) < 0) {
+        wl_display_disconnect(display);
+        return nullptr;
+    }
+    return display;
+}
+
+static void AppDisconnectWayland(wl_display *display) {
+    if (display) wl_display_disconnect(display);
+}
+
+// Uses the connection SetupWindowExtensions made
 static void AppCreateWaylandWindow(AppInstance &inst) {
-    inst.wayland_display = wl_display_connect(nullptr);
     struct wl_registry *registry = wl_display_get_registry(inst.wayland_display);
     wl_registry_add_listener(wl_display_get_registry(inst.wayland_display), &wayland_registry_listener, static_cast<void *>(&inst));
     wl_display_roundtrip(inst.wayland_display);
@@ -1273,10 +1437,69 @@ static VkSurfaceKHR AppCreateDisplaySurface(AppInstance &inst, VkPhysicalDevice
 }
 #endif  // VK_USE_PLATFORM_DISPLAY_KHR
 
+//-----------------------------------------------------------
+//--------------------EXT HEADLESS SURFACE-------------------
+static VkSurfaceKHR AppCreateHeadlessSurface(AppInstance &inst) {
+    VkHeadlessSurfaceCreateInfoEXT createInfo;
+    createInfo.sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+    createInfo.pNext = nullptr;
+    createInfo.flags = 0;
+
+    VkSurfaceKHR surface;
+    VkResult err = vkCreateHeadlessSurfaceEXT(inst.instance, &createInfo, nullptr, &surface);
+    if (err) THROW_VK_ERR("vkCreateHeadlessSurfaceEXT", err);
+    return surface;
+}
+
 //-----------------------------------------------------------
 // ------------ Setup Windows ------------- //
 
-void SetupWindowExtensions(AppInstance &inst) {
+#if defined(VK_USE_PLATFORM_XCB_KHR) || defined(VK_USE_PLATFORM_XLIB_KHR) || defined(VK_USE_PLATFORM_WAYLAND_KHR)
+// Returns what connect returns, which is then used for the windows and surfaces of its window system. With a timeout_ms
+// other than 0, connect runs on a detached thread. If it hasn't returned after timeout_ms, timed_out is set and an empty
+// Connection is returned. The thread isn't cancelled, since xcb, Xlib and libwayland can't be safely interrupted inside a
+// connection attempt. It finishes on its own and hands a connection that comes too late to disconnect, which must accept
+// the empty Connection of a failed attempt as well.
+template <typename Connection>
+Connection ConnectWithTimeout(Connection (*connect)(), void (*disconnect)(Connection), uint32_t timeout_ms, bool &timed_out) {
+    timed_out = false;
+    if (timeout_ms == 0) return connect();
+
+    // Shared with the thread, which outlives this call when the connection attempt times out
+    struct ConnectState {
+        std::mutex mutex;
+        std::condition_variable finished;
+        bool done = false;
+        bool abandoned = false;
+        Connection connection{};
+    };
+    auto state = std::make_shared<ConnectState>();
+    try {
+        std::thread([state, connect, disconnect] {
+            Connection connection = connect();
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->abandoned) {
+                disconnect(connection);
+                return;
+            }
+            state->connection = connection;
+            state->done = true;
+            state->finished.notify_one();
+        }).detach();
+    } catch (const std::system_error &) {
+        return connect();
+    }
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    timed_out = !state->finished.wait_for(lock, std::chrono::milliseconds(timeout_ms), [&state] { return state->done; });
+    state->abandoned = timed_out;
+    return state->connection;
+}
+#endif
+
+// The surfaces of the window systems, which need a window and on most platforms a display server. display_timeout_ms limits
+// how long connecting to a display server may take before its surfaces are skipped, 0 waits as long as it takes.
+static void SetupWindowSystemExtensions(AppInstance &inst, uint32_t display_timeout_ms) {
 #if defined(VK_USE_PLATFORM_XCB_KHR) || defined(VK_USE_PLATFORM_XLIB_KHR)
     bool has_display = true;
     const char *display_var = getenv("DISPLAY");
@@ -1284,15 +1507,7 @@ void SetupWindowExtensions(AppInstance &inst) {
         has_display = false;
         std::cerr << "'DISPLAY' environment variable not set... skipping surface info\n";
     }
-#endif
-
-#ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    wl_display *wayland_display = wl_display_connect(nullptr);
-    bool has_wayland_display = false;
-    if (wayland_display != nullptr) {
-        wl_display_disconnect(wayland_display);
-        has_wayland_display = true;
-    }
+    bool display_timed_out = false;
 #endif
 
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
@@ -1319,7 +1534,7 @@ void SetupWindowExtensions(AppInstance &inst) {
 //--WIN32--
 #ifdef VK_USE_PLATFORM_WIN32_KHR
     SurfaceExtension surface_ext_win32;
-    if (inst.CheckExtensionEnabled(VK_KHR_WIN32_SURFACE_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::KHR_win32_surface)) {
         surface_ext_win32.name = VK_KHR_WIN32_SURFACE_EXTENSION_NAME;
         surface_ext_win32.create_window = AppCreateWin32Window;
         surface_ext_win32.create_surface = AppCreateWin32Surface;
@@ -1331,12 +1546,19 @@ void SetupWindowExtensions(AppInstance &inst) {
 //--XCB--
 #ifdef VK_USE_PLATFORM_XCB_KHR
     SurfaceExtension surface_ext_xcb;
-    if (inst.CheckExtensionEnabled(VK_KHR_XCB_SURFACE_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::KHR_xcb_surface)) {
         surface_ext_xcb.name = VK_KHR_XCB_SURFACE_EXTENSION_NAME;
         surface_ext_xcb.create_window = AppCreateXcbWindow;
         surface_ext_xcb.create_surface = AppCreateXcbSurface;
         surface_ext_xcb.destroy_window = AppDestroyXcbWindow;
         if (has_display) {
+            XcbConnection xcb = ConnectWithTimeout(AppConnectXcb, AppDisconnectXcb, display_timeout_ms, display_timed_out);
+            inst.xcb_connection = xcb.connection;
+            inst.xcb_screen_number = xcb.screen_number;
+            // A timed out X server would only time out again for XLib
+            has_display = !display_timed_out;
+        }
+        if (inst.xcb_connection) {
             inst.AddSurfaceExtension(surface_ext_xcb);
         }
     }
@@ -1344,20 +1566,29 @@ void SetupWindowExtensions(AppInstance &inst) {
 //--XLIB--
 #ifdef VK_USE_PLATFORM_XLIB_KHR
     SurfaceExtension surface_ext_xlib;
-    if (inst.CheckExtensionEnabled(VK_KHR_XLIB_SURFACE_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::KHR_xlib_surface)) {
         surface_ext_xlib.name = VK_KHR_XLIB_SURFACE_EXTENSION_NAME;
         surface_ext_xlib.create_window = AppCreateXlibWindow;
         surface_ext_xlib.create_surface = AppCreateXlibSurface;
         surface_ext_xlib.destroy_window = AppDestroyXlibWindow;
         if (has_display) {
+            inst.xlib_display = ConnectWithTimeout(AppConnectXlib, AppDisconnectXlib, display_timeout_ms, display_timed_out);
+        }
+        if (inst.xlib_display) {
             inst.AddSurfaceExtension(surface_ext_xlib);
         }
     }
 #endif
+#if defined(VK_USE_PLATFORM_XCB_KHR) || defined(VK_USE_PLATFORM_XLIB_KHR)
+    if (display_timed_out) {
+        std::cerr << "Could not connect to the X server within " << display_timeout_ms << " ms... skipping surface info\n";
+    }
+#endif
 //--MACOS--
 #ifdef VK_USE_PLATFORM_MACOS_MVK
     SurfaceExtension surface_ext_macos;
-    if (inst.CheckExtensionEnabled(VK_MVK_MACOS_SURFACE_EXTENSION_NAME) && !inst.CheckExtensionEnabled("VK_EXT_metal_surface")) {
+    if (inst.CheckExtensionEnabled(AppExtension::MVK_macos_surface) &&
+        !inst.CheckExtensionEnabled(AppExtension::EXT_metal_surface)) {
         surface_ext_macos.name = VK_MVK_MACOS_SURFACE_EXTENSION_NAME;
         surface_ext_macos.create_window = AppCreateMacOSWindow;
         surface_ext_macos.create_surface = AppCreateMacOSSurface;
@@ -1369,7 +1600,7 @@ void SetupWindowExtensions(AppInstance &inst) {
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
     SurfaceExtension surface_ext_metal;
-    if (inst.CheckExtensionEnabled(VK_EXT_METAL_SURFACE_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::EXT_metal_surface)) {
         surface_ext_metal.name = VK_EXT_METAL_SURFACE_EXTENSION_NAME;
         surface_ext_metal.create_window = AppCreateMetalWindow;
         surface_ext_metal.create_surface = AppCreateMetalSurface;
@@ -1381,12 +1612,19 @@ void SetupWindowExtensions(AppInstance &inst) {
 //--WAYLAND--
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
     SurfaceExtension surface_ext_wayland;
-    if (inst.CheckExtensionEnabled(VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::KHR_wayland_surface)) {
         surface_ext_wayland.name = VK_KHR_WAYLAND_SURFACE_EXTENSION_NAME;
         surface_ext_wayland.create_window = AppCreateWaylandWindow;
         surface_ext_wayland.create_surface = AppCreateWaylandSurface;
         surface_ext_wayland.destroy_window = AppDestroyWaylandWindow;
-        if (has_wayland_display) {
+        bool wayland_timed_out = false;
+        inst.wayland_display =
+            ConnectWithTimeout(AppConnectWayland, AppDisconnectWayland, display_timeout_ms, wayland_timed_out);
+        if (wayland_timed_out) {
+            std::cerr << "Could not connect to the Wayland compositor within " << display_timeout_ms
+                      << " ms... skipping surface info\n";
+        }
+        if (inst.wayland_display) {
             inst.AddSurfaceExtension(surface_ext_wayland);
         }
     }
@@ -1394,7 +1632,7 @@ void SetupWindowExtensions(AppInstance &inst) {
 //--DIRECTFB--
 #ifdef VK_USE_PLATFORM_DIRECTFB_EXT
     SurfaceExtension surface_ext_directfb;
-    if (inst.CheckExtensionEnabled(VK_EXT_DIRECTFB_SURFACE_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::EXT_directfb_surface)) {
         surface_ext_directfb.name = VK_EXT_DIRECTFB_SURFACE_EXTENSION_NAME;
         surface_ext_directfb.create_window = AppCreateDirectFBWindow;
         surface_ext_directfb.create_surface = AppCreateDirectFBSurface;
@@ -1406,7 +1644,7 @@ void SetupWindowExtensions(AppInstance &inst) {
 //--ANDROID--
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
     SurfaceExtension surface_ext_android;
-    if (inst.CheckExtensionEnabled(VK_KHR_ANDROID_SURFACE_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::KHR_android_surface)) {
         surface_ext_android.name = VK_KHR_ANDROID_SURFACE_EXTENSION_NAME;
         surface_ext_android.create_window = AppCreateAndroidWindow;
         surface_ext_android.create_surface = AppCreateAndroidSurface;
@@ -1418,7 +1656,7 @@ void SetupWindowExtensions(AppInstance &inst) {
 //--GGP--
 #ifdef VK_USE_PLATFORM_GGP
     SurfaceExtension surface_ext_ggp;
-    if (inst.CheckExtensionEnabled(VK_GGP_STREAM_DESCRIPTOR_SURFACE_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::GGP_stream_descriptor_surface)) {
         surface_ext_ggp.name = VK_GGP_STREAM_DESCRIPTOR_SURFACE_EXTENSION_NAME;
         surface_ext_ggp.create_window = AppCreateGgpWindow;
         surface_ext_ggp.create_surface = AppCreateGgpSurface;
@@ -1430,7 +1668,7 @@ void SetupWindowExtensions(AppInstance &inst) {
 //--QNX_SCREEN--
 #ifdef VK_USE_PLATFORM_SCREEN_QNX
     SurfaceExtension surface_ext_qnx_screen;
-    if (inst.CheckExtensionEnabled(VK_QNX_SCREEN_SURFACE_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::QNX_screen_surface)) {
         surface_ext_qnx_screen.name = VK_QNX_SCREEN_SURFACE_EXTENSION_NAME;
         surface_ext_qnx_screen.create_window = AppCreateScreenWindow;
         surface_ext_qnx_screen.create_surface = AppCreateScreenSurface;
@@ -1441,10 +1679,27 @@ void SetupWindowExtensions(AppInstance &inst) {
         }
     }
 #endif
+}
+
+// headless uses VK_EXT_headless_surface instead of the window systems if the instance supports it. VK_KHR_display needs no
+// display server, so its surfaces are used either way.
+void SetupWindowExtensions(AppInstance &inst, bool headless = false, uint32_t display_timeout_ms = 0) {
+    if (headless && inst.CheckExtensionEnabled(AppExtension::EXT_headless_surface)) {
+        SurfaceExtension surface_ext_headless;
+        surface_ext_headless.name = VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME;
+        surface_ext_headless.create_surface = AppCreateHeadlessSurface;
+
+        inst.AddSurfaceExtension(surface_ext_headless);
+    } else {
+        if (headless) {
+            std::cerr << VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME " not supported... using the window system surfaces\n";
+        }
+        SetupWindowSystemExtensions(inst, display_timeout_ms);
+    }
 //--DISPLAY--
 #ifdef VK_USE_PLATFORM_DISPLAY_KHR
     SurfaceExtension surface_ext_khr_display;
-    if (inst.CheckExtensionEnabled(VK_KHR_DISPLAY_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::KHR_display)) {
         surface_ext_khr_display.name = VK_KHR_DISPLAY_EXTENSION_NAME;
         surface_ext_khr_display.create_surface_for_physical_device = AppCreateDisplaySurface;
 
@@ -1474,11 +1729,12 @@ class AppSurface {
 
     AppSurface(AppInstance &inst, AppGpu &gpu, VkPhysicalDevice phys_device, SurfaceExtension surface_extension)
         : inst(inst), phys_device(phys_device), surface_extension(surface_extension) {
+        TimingPhase phase("surface queries");
         surf_present_modes =
             GetVector<VkPresentModeKHR>("vkGetPhysicalDeviceSurfacePresentModesKHR", vkGetPhysicalDeviceSurfacePresentModesKHR,
                                         phys_device, surface_extension.surface);
 
-        if (inst.CheckExtensionEnabled(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)) {
+        if (inst.CheckExtensionEnabled(AppExtension::KHR_get_surface_capabilities2)) {
             const VkPhysicalDeviceSurfaceInfo2KHR surface_info2 = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR, nullptr,
                                                                    surface_extension.surface};
             VkSurfaceFormat2KHR init{};
@@ -1491,12 +1747,12 @@ class AppSurface {
                                               phys_device, surface_extension.surface);
         }
 
-        if (inst.CheckExtensionEnabled(VK_KHR_SURFACE_EXTENSION_NAME)) {
+        if (inst.CheckExtensionEnabled(AppExtension::KHR_surface)) {
             VkResult err = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(phys_device, surface_extension.surface, &surface_capabilities);
             if (err) THROW_VK_ERR("vkGetPhysicalDeviceSurfaceCapabilitiesKHR", err);
         }
 
-        if (inst.CheckExtensionEnabled(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME)) {
+        if (inst.CheckExtensionEnabled(AppExtension::KHR_get_surface_capabilities2)) {
             surface_capabilities2_khr.sType = VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR;
             setup_surface_capabilities2_chain(surface_capabilities2_khr, chain_for_surface_capabilities2, inst, gpu);
 
@@ -1514,7 +1770,7 @@ class AppSurface {
             if (err) THROW_VK_ERR("vkGetPhysicalDeviceSurfaceCapabilities2KHR", err);
         }
 
-        if (inst.CheckExtensionEnabled(VK_EXT_DISPLAY_SURFACE_COUNTER_EXTENSION_NAME)) {
+        if (inst.CheckExtensionEnabled(AppExtension::EXT_display_surface_counter)) {
             surface_capabilities2_ext.sType = VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_EXT;
             surface_capabilities2_ext.pNext = nullptr;
             VkResult err =
@@ -1530,7 +1786,7 @@ class AppSurface {
 // -------------------- Device Groups ------------------------//
 
 std::vector<VkPhysicalDeviceGroupProperties> GetGroups(AppInstance &inst) {
-    if (inst.CheckExtensionEnabled(VK_KHR_DEVICE_GROUP_CREATION_EXTENSION_NAME)) {
+    if (inst.CheckExtensionEnabled(AppExtension::KHR_device_group_creation)) {
         VkPhysicalDeviceGroupProperties group_props{};
         group_props.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES;
         return GetVectorInit<VkPhysicalDeviceGroupProperties>("vkEnumeratePhysicalDeviceGroupsKHR",
@@ -1603,7 +1859,7 @@ struct ImageTypeSupport {
     enum class Type { regular, sparse, transient } type;
     uint32_t memoryTypeBits;
 
-    bool Compatible(uint32_t memtype_bit) { return memoryTypeBits & memtype_bit; }
+    bool Compatible(uint32_t memtype_bit) const { return memoryTypeBits & memtype_bit; }
 };
 
 struct ImageTypeFormatInfo {
@@ -1634,7 +1890,9 @@ VkImageCreateInfo GetImageCreateInfo(VkImageCreateFlags flags, VkFormat format,
             VK_IMAGE_LAYOUT_UNDEFINED};
 }
 
+// get_image_requirements is vkGetDeviceImageMemoryRequirements or its KHR alias, if null a dummy image is created instead
 util::vulkaninfo_optional<ImageTypeSupport> FillImageTypeSupport(AppInstance &inst, VkPhysicalDevice phys_device, VkDevice device,
+                                                                 PFN_vkGetDeviceImageMemoryRequirements get_image_requirements,
                                                                  ImageTypeSupport::Type img_type, VkImageCreateInfo image_ci) {
     VkImageFormatProperties img_props;
     VkResult res = vkGetPhysicalDeviceImageFormatProperties(phys_device, image_ci.format, image_ci.imageType, image_ci.tiling,
@@ -1644,6 +1902,17 @@ util::vulkaninfo_optional<ImageTypeSupport> FillImageTypeSupport(AppInstance &in
         ImageTypeSupport img_type_support{};
         img_type_support.type = img_type;
 
+        if (get_image_requirements) {
+            VkDeviceImageMemoryRequirements image_requirements_info{};
+            image_requirements_info.sType = VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS;
+            image_requirements_info.pCreateInfo = &image_ci;
+            VkMemoryRequirements2 mem_req2{};
+            mem_req2.sType = VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2;
+            get_image_requirements(device, &image_requirements_info, &mem_req2);
+            img_type_support.memoryTypeBits = mem_req2.memoryRequirements.memoryTypeBits;
+            return img_type_support;
+        }
+
         VkImage dummy_img;
         res = vkCreateImage(device, &image_ci, nullptr, &dummy_img);
         if (res) THROW_VK_ERR("vkCreateImage", res);
@@ -1661,6 +1930,31 @@ util::vulkaninfo_optional<ImageTypeSupport> FillImageTypeSupport(AppInstance &in
     return {};
 }
 
+// --------- Format Properties ----------//
+struct PropFlags {
+    VkFormatProperties props;
+    VkFormatProperties3 props3;
+
+    bool Supported() const {
+        return props.linearTilingFeatures != 0 || props.optimalTilingFeatures != 0 || props.bufferFeatures != 0 ||
+               props3.linearTilingFeatures != 0 || props3.optimalTilingFeatures != 0 || props3.bufferFeatures != 0;
+    }
+    auto Tie() const {
+        return std::tie(props.linearTilingFeatures, props.optimalTilingFeatures, props.bufferFeatures, props3.linearTilingFeatures,
+                        props3.optimalTilingFeatures, props3.bufferFeatures);
+    }
+    bool operator==(const PropFlags &other) const { return Tie() == other.Tie(); }
+    bool operator<(const PropFlags &other) const { return Tie() < other.Tie(); }
+};
+
+// The properties of one format, queried once per physical device
+struct AppFormatProperties {
+    VkFormat format;
+    PropFlags flags;
+    // Every other struct vkGetPhysicalDeviceFormatProperties2 returned for this format, null if it wasn't called
+    std::unique_ptr<format_properties2_chain> chain;
+};
+
 struct FormatRange {
     // the Vulkan standard version that supports this format range, or 0 if non-standard
     APIVersion minimum_instance_version;
@@ -1725,60 +2019,51 @@ struct AppGpu {
     bool found_driver_props = false;
     bool found_device_id_props = false;
 
-    std::vector<VkQueueFamilyProperties> queue_props;
-    std::vector<VkQueueFamilyProperties2KHR> queue_props2;
-    std::vector<AppQueueFamilyProperties> extended_queue_props;
-
     VkPhysicalDeviceMemoryProperties memory_props{};
-    VkPhysicalDeviceMemoryProperties2KHR memory_props2{};
-
-    std::vector<ImageTypeInfos> memory_image_support_types;
 
     VkPhysicalDeviceFeatures features{};
-    VkPhysicalDeviceFeatures2KHR features2{};
+
+    bool show_promoted_structs = false;
+
+    // The video profiles are probed on up to this many threads, 0 picks one per hardware thread like --jobs
+    uint32_t video_profile_jobs = 1;
 
     std::vector<VkExtensionProperties> device_extensions;
+    // device_extensions interned, extensions newer than the registry vulkaninfo was generated from are left out
+    AppExtensionSet device_extension_set;
 
     // There are certain surface extensions that are physical device specific such as VK_KHR_display
     // The per physical device surfaces for these are maintained here instead at the AppInstance level
     std::vector<SurfaceExtension> surface_extensions;
 
-    VkDevice dev = VK_NULL_HANDLE;
-    VkPhysicalDeviceFeatures enabled_features{};
-
-    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> heapBudget;
-    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> heapUsage;
-
     std::unique_ptr<phys_device_props2_chain> chain_for_phys_device_props2;
-    std::unique_ptr<phys_device_mem_props2_chain> chain_for_phys_device_mem_props2;
-    std::unique_ptr<phys_device_features2_chain> chain_for_phys_device_features2;
-    std::vector<std::unique_ptr<queue_properties2_chain>> chain_for_queue_props2;
-
-    std::vector<std::unique_ptr<AppVideoProfile>> video_profiles;
-
-    std::vector<AppDisplay> displays;
-    std::vector<AppDisplayPlane> display_planes;
 
+    // Only the properties, the extensions, the memory properties and the features are queried here, the other sections are
+    // queried by their Get function the first time they are used so an output only pays for what it prints
     AppGpu(AppInstance &inst, uint32_t id, VkPhysicalDevice phys_device, bool show_promoted_structs,
            std::vector<SurfaceExtension> &&surface_extensions)
-        : inst(inst), id(id), phys_device(phys_device), surface_extensions(surface_extensions) {
+        : inst(inst),
+          id(id),
+          phys_device(phys_device),
+          show_promoted_structs(show_promoted_structs),
+          surface_extensions(surface_extensions) {
+        TimingPhase phase("device properties");
         vkGetPhysicalDeviceProperties(phys_device, &props);
 
         // needs to find the minimum of the instance and device version, and use that to print the device info
         api_version = APIVersion(props.apiVersion);
 
         device_extensions = inst.AppGetPhysicalDeviceLayerExtensions(phys_device, nullptr);
+        for (const auto &ext : device_extensions) {
+            AppExtension extension;
+            if (FindAppExtension(ext.extensionName, extension)) device_extension_set.set(static_cast<size_t>(extension));
+        }
 
         vkGetPhysicalDeviceMemoryProperties(phys_device, &memory_props);
 
         vkGetPhysicalDeviceFeatures(phys_device, &features);
 
-        uint32_t queue_count = 0;
-        vkGetPhysicalDeviceQueueFamilyProperties(phys_device, &queue_count, nullptr);
-        queue_props.resize(queue_count);
-        vkGetPhysicalDeviceQueueFamilyProperties(phys_device, &queue_count, queue_props.data());
-
-        if (inst.CheckExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
+        if (inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2)) {
             // VkPhysicalDeviceProperties2
             props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
             setup_phys_device_props2_chain(props2, chain_for_phys_device_props2, inst, *this, show_promoted_structs);
@@ -1787,31 +2072,7 @@ struct AppGpu {
             prepare_phys_device_props2_twocall_chain_vectors(chain_for_phys_device_props2);
             vkGetPhysicalDeviceProperties2KHR(phys_device, &props2);
 
-            // VkPhysicalDeviceMemoryProperties2
-            memory_props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR;
-            setup_phys_device_mem_props2_chain(memory_props2, chain_for_phys_device_mem_props2, *this);
-
-            vkGetPhysicalDeviceMemoryProperties2KHR(phys_device, &memory_props2);
-
-            // VkPhysicalDeviceFeatures2
-            features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
-            setup_phys_device_features2_chain(features2, chain_for_phys_device_features2, *this, show_promoted_structs);
-
-            vkGetPhysicalDeviceFeatures2KHR(phys_device, &features2);
-
-            // std::vector<VkPhysicalDeviceQueueFamilyProperties2>
-            uint32_t queue_prop2_count = 0;
-            vkGetPhysicalDeviceQueueFamilyProperties2KHR(phys_device, &queue_prop2_count, nullptr);
-            queue_props2.resize(queue_prop2_count);
-            chain_for_queue_props2.resize(queue_prop2_count);
-            for (size_t i = 0; i < queue_props2.size(); i++) {
-                queue_props2[i].sType = VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2_KHR;
-                setup_queue_properties2_chain(queue_props2[i], chain_for_queue_props2[i], *this);
-            }
-            vkGetPhysicalDeviceQueueFamilyProperties2KHR(phys_device, &queue_prop2_count, queue_props2.data());
-
-            if (CheckPhysicalDeviceExtensionIncluded(VK_KHR_DRIVER_PROPERTIES_EXTENSION_NAME) ||
-                api_version >= VK_API_VERSION_1_2) {
+            if (CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_driver_properties) || api_version >= VK_API_VERSION_1_2) {
                 void *place = props2.pNext;
                 while (place) {
                     VkBaseOutStructure *structure = static_cast<VkBaseOutStructure *>(place);
@@ -1853,6 +2114,120 @@ struct AppGpu {
                 }
             }
         }
+    }
+
+    ~AppGpu() {
+        TimingPhase phase("teardown");
+        for (auto &surface_extension : surface_extensions) {
+            // If the surface is per physical device then we have to destroy it here as there's a separate surface for the
+            // AppGpu object (contrarily to surfaces shared across the instance that are maintained by AppInstance)
+            if (surface_extension.create_surface_for_physical_device) {
+                vkDestroySurfaceKHR(inst.instance, surface_extension.surface, nullptr);
+            }
+        }
+
+        vkDestroyDevice(dev, nullptr);
+    }
+
+    AppGpu(const AppGpu &) = delete;
+    const AppGpu &operator=(const AppGpu &) = delete;
+
+    bool CheckPhysicalDeviceExtensionIncluded(AppExtension extension) const {
+        return device_extension_set.test(static_cast<size_t>(extension));
+    }
+    bool CheckPhysicalDeviceExtensionIncluded(std::string_view extension_to_check) const {
+        AppExtension extension;
+        if (FindAppExtension(extension_to_check, extension)) return CheckPhysicalDeviceExtensionIncluded(extension);
+        return std::any_of(
+            device_extensions.begin(), device_extensions.end(),
+            [extension_to_check](const VkExtensionProperties &prop) { return prop.extensionName == extension_to_check; });
+    }
+
+    // Helper function to determine whether a format range is currently supported.
+    bool FormatRangeSupported(const FormatRange &format_range) const {
+        // Formats from base vulkan spec
+        if (format_range.minimum_instance_version == 0 && format_range.extension_name == nullptr) {
+            return true;
+        }
+
+        // True if this extension is present
+        if (format_range.extension_name != nullptr) {
+            return CheckPhysicalDeviceExtensionIncluded(format_range.extension_name);
+        }
+
+        // True if standard and supported by both this instance and this GPU
+        if (inst.api_version >= format_range.minimum_instance_version &&
+            APIVersion(props.apiVersion) >= format_range.minimum_instance_version) {
+            return true;
+        }
+
+        // Otherwise, not supported.
+        return false;
+    }
+
+    VkPhysicalDeviceProperties GetDeviceProperties() {
+        if (inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2)) {
+            return props2.properties;
+        } else {
+            return props;
+        }
+    }
+
+    // Returns nullptr if the format isn't part of a format range this GPU supports
+    const AppFormatProperties *FindFormatProperties(VkFormat format) {
+        const auto &formats = GetFormatProperties();
+        auto it = std::lower_bound(formats.begin(), formats.end(), format,
+                                   [](const AppFormatProperties &entry, VkFormat value) { return entry.format < value; });
+        if (it == formats.end() || it->format != format) return nullptr;
+        return &*it;
+    }
+
+    // The extensions each instance layer adds to this GPU, in the order of inst.global_layers
+    const std::vector<std::vector<VkExtensionProperties>> &GetLayerExtensions() {
+        if (!queried_layer_extensions) {
+            TimingPhase phase("layer extensions");
+            layer_extensions.reserve(inst.global_layers.size());
+            for (const auto &layer : inst.global_layers) {
+                layer_extensions.push_back(inst.AppGetPhysicalDeviceLayerExtensions(phys_device, layer.layer_properties.layerName));
+            }
+            queried_layer_extensions = true;
+        }
+        return layer_extensions;
+    }
+
+    // Returns nullptr if the layer isn't one of inst.global_layers
+    const std::vector<VkExtensionProperties> *FindLayerExtensions(const char *layer_name) {
+        const auto &extensions = GetLayerExtensions();
+        for (size_t i = 0; i < inst.global_layers.size(); i++) {
+            if (strncmp(inst.global_layers[i].layer_properties.layerName, layer_name, VK_MAX_EXTENSION_NAME_SIZE) == 0) {
+                return &extensions[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // The properties and extra structs of every queue family, along with which surfaces each family can present to
+    const std::vector<AppQueueFamilyProperties> &GetQueueFamilies() {
+        if (queried_queue_families) return extended_queue_props;
+        TimingPhase phase("queue families");
+
+        uint32_t queue_count = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(phys_device, &queue_count, nullptr);
+        queue_props.resize(queue_count);
+        vkGetPhysicalDeviceQueueFamilyProperties(phys_device, &queue_count, queue_props.data());
+
+        if (inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2)) {
+            // std::vector<VkPhysicalDeviceQueueFamilyProperties2>
+            uint32_t queue_prop2_count = 0;
+            vkGetPhysicalDeviceQueueFamilyProperties2KHR(phys_device, &queue_prop2_count, nullptr);
+            queue_props2.resize(queue_prop2_count);
+            chain_for_queue_props2.resize(queue_prop2_count);
+            for (size_t i = 0; i < queue_props2.size(); i++) {
+                queue_props2[i].sType = VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2_KHR;
+                setup_queue_properties2_chain(queue_props2[i], chain_for_queue_props2[i], *this);
+            }
+            vkGetPhysicalDeviceQueueFamilyProperties2KHR(phys_device, &queue_prop2_count, queue_props2.data());
+        }
 
         // Use the queue_props2 if they exist, else fallback on vulkan 1.0 queue_props
         int queue_index = 0;
@@ -1867,12 +2242,96 @@ struct AppGpu {
                     AppQueueFamilyProperties(inst, phys_device, surface_extensions, queue_prop, queue_index++, nullptr));
             }
         }
+        queried_queue_families = true;
+        return extended_queue_props;
+    }
+
+    // pNext is the chain of every feature struct vulkaninfo knows about that the GPU supports
+    const VkPhysicalDeviceFeatures2KHR &GetFeatures2() {
+        if (queried_features2) return features2;
+        TimingPhase phase("features");
+
+        if (inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2)) {
+            // VkPhysicalDeviceFeatures2
+            features2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+            setup_phys_device_features2_chain(features2, chain_for_phys_device_features2, *this, show_promoted_structs);
+
+            vkGetPhysicalDeviceFeatures2KHR(phys_device, &features2);
+        }
+        queried_features2 = true;
+        return features2;
+    }
+
+    // Only written to if VK_EXT_memory_budget is supported
+    const std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> &GetHeapBudget() {
+        QueryMemoryProperties2();
+        return heapBudget;
+    }
+    const std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> &GetHeapUsage() {
+        QueryMemoryProperties2();
+        return heapUsage;
+    }
+    bool HasHeapBudget() const {
+        return inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2) &&
+               CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_memory_budget);
+    }
+    // Queries the budget and usage again with the chain of the first query, nothing else is redone
+    void ResampleHeapBudget() {
+        if (!queried_memory_props2 || !HasHeapBudget()) {
+            QueryMemoryProperties2();
+            return;
+        }
+        vkGetPhysicalDeviceMemoryProperties2KHR(phys_device, &memory_props2);
+        ReadHeapBudget();
+    }
+
+    // Every format of the supported format ranges, sorted by format
+    const std::vector<AppFormatProperties> &GetFormatProperties() {
+        if (!queried_format_properties) {
+            TimingPhase phase("formats");
+            format_properties = enumerate_format_properties(*this);
+            queried_format_properties = true;
+        }
+        return format_properties;
+    }
+
+    const std::vector<std::unique_ptr<AppVideoProfile>> &GetVideoProfiles() {
+        if (!queried_video_profiles) {
+            TimingPhase phase("video profiles");
+            video_profiles = enumerate_supported_video_profiles(*this);
+            queried_video_profiles = true;
+        }
+        return video_profiles;
+    }
+
+    const std::vector<AppDisplay> &GetDisplays() {
+        QueryDisplays();
+        return displays;
+    }
+    const std::vector<AppDisplayPlane> &GetDisplayPlanes() {
+        QueryDisplays();
+        return display_planes;
+    }
+
+    // The memory types that images of the common formats can be bound to. This needs a logical device, but no image objects
+    // when vkGetDeviceImageMemoryRequirements is available (Vulkan 1.3 or VK_KHR_maintenance4).
+    const std::vector<ImageTypeInfos> &GetMemoryImageSupportTypes() {
+        if (queried_memory_image_support_types) return memory_image_support_types;
+        TimingPhase phase("image memory support");
+
+        PFN_vkGetDeviceImageMemoryRequirements get_image_requirements = nullptr;
+        std::vector<const char *> extensions_to_enable;
+        if (inst.api_version >= VK_API_VERSION_1_3 && api_version >= VK_API_VERSION_1_3) {
+            get_image_requirements = vkGetDeviceImageMemoryRequirements;
+        } else if (CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_maintenance4) && vkGetDeviceImageMemoryRequirementsKHR) {
+            get_image_requirements = vkGetDeviceImageMemoryRequirementsKHR;
+            extensions_to_enable.push_back(VK_KHR_MAINTENANCE_4_EXTENSION_NAME);
+        }
 
         if (features.sparseBinding) {
             enabled_features.sparseBinding = VK_TRUE;
         }
 
-        std::vector<const char *> extensions_to_enable;
 #ifdef VK_ENABLE_BETA_EXTENSIONS
         for (const auto &extension : device_extensions) {
             if (std::string(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME) == extension.extensionName) {
@@ -1908,10 +2367,10 @@ struct AppGpu {
                 ImageTypeFormatInfo image_type_format_info;
                 image_type_format_info.format = format;
 
-                VkFormatProperties fmt_props;
-                vkGetPhysicalDeviceFormatProperties(phys_device, format, &fmt_props);
-                if ((tiling == VK_IMAGE_TILING_OPTIMAL && fmt_props.optimalTilingFeatures == 0) ||
-                    (tiling == VK_IMAGE_TILING_LINEAR && fmt_props.linearTilingFeatures == 0)) {
+                const AppFormatProperties *fmt_props = FindFormatProperties(format);
+                if (fmt_props == nullptr ||
+                    (tiling == VK_IMAGE_TILING_OPTIMAL && fmt_props->flags.props.optimalTilingFeatures == 0) ||
+                    (tiling == VK_IMAGE_TILING_LINEAR && fmt_props->flags.props.linearTilingFeatures == 0)) {
                     continue;
                 }
 
@@ -1940,20 +2399,20 @@ struct AppGpu {
                     }
                 }
 
-                auto image_ts_regular_ret =
-                    FillImageTypeSupport(inst, phys_device, dev, ImageTypeSupport::Type::regular, image_ci_regular);
+                auto image_ts_regular_ret = FillImageTypeSupport(inst, phys_device, dev, get_image_requirements,
+                                                                 ImageTypeSupport::Type::regular, image_ci_regular);
                 if (image_ts_regular_ret) {
                     image_type_format_info.type_support.push_back(image_ts_regular_ret.value());
                 }
-                auto image_ts_transient_ret =
-                    FillImageTypeSupport(inst, phys_device, dev, ImageTypeSupport::Type::transient, image_ci_transient);
+                auto image_ts_transient_ret = FillImageTypeSupport(inst, phys_device, dev, get_image_requirements,
+                                                                   ImageTypeSupport::Type::transient, image_ci_transient);
                 if (image_ts_transient_ret) {
                     image_type_format_info.type_support.push_back(image_ts_transient_ret.value());
                 }
 
                 if (enabled_features.sparseBinding) {
-                    auto image_ts_sparse_ret =
-                        FillImageTypeSupport(inst, phys_device, dev, ImageTypeSupport::Type::sparse, image_ci_sparse);
+                    auto image_ts_sparse_ret = FillImageTypeSupport(inst, phys_device, dev, get_image_requirements,
+                                                                    ImageTypeSupport::Type::sparse, image_ci_sparse);
                     if (image_ts_sparse_ret) {
                         image_type_format_info.type_support.push_back(image_ts_sparse_ret.value());
                     }
@@ -1963,88 +2422,35 @@ struct AppGpu {
             memory_image_support_types.push_back(image_type_infos);
         }
 
-        // Memory //
-
-        struct VkBaseOutStructure *structure = NULL;
-        if (inst.CheckExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
-            structure = (struct VkBaseOutStructure *)memory_props2.pNext;
-
-            while (structure) {
-                if (structure->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT &&
-                    CheckPhysicalDeviceExtensionIncluded(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME)) {
-                    VkPhysicalDeviceMemoryBudgetPropertiesEXT *mem_budget_props =
-                        reinterpret_cast<VkPhysicalDeviceMemoryBudgetPropertiesEXT *>(structure);
-                    for (uint32_t i = 0; i < VK_MAX_MEMORY_HEAPS; i++) {
-                        heapBudget[i] = mem_budget_props->heapBudget[i];
-                        heapUsage[i] = mem_budget_props->heapUsage[i];
-                    }
-                }
-
-                structure = structure->pNext;
-            }
-        }
-        // TODO buffer - memory type compatibility
-
-        // Video //
-        video_profiles = enumerate_supported_video_profiles(*this);
-
-        // Display //
-        display_planes = enumerate_display_planes(*this);
-        displays = enumerate_displays(*this, display_planes);
-
         vkDestroyDevice(dev, nullptr);
         dev = VK_NULL_HANDLE;
+        queried_memory_image_support_types = true;
+        return memory_image_support_types;
     }
 
-    ~AppGpu() {
-        for (auto &surface_extension : surface_extensions) {
-            // If the surface is per physical device then we have to destroy it here as there's a separate surface for the
-            // AppGpu object (contrarily to surfaces shared across the instance that are maintained by AppInstance)
-            if (surface_extension.create_surface_for_physical_device) {
-                vkDestroySurfaceKHR(inst.instance, surface_extension.surface, nullptr);
-            }
-        }
+    // Whether a section was queried, or filled in from the capability cache
+    bool FormatPropertiesQueried() const { return queried_format_properties; }
+    bool MemoryImageSupportTypesQueried() const { return queried_memory_image_support_types; }
 
-        vkDestroyDevice(dev, nullptr);
+    // Fill in a section without querying it, used by the capability cache
+    void SetFormatProperties(std::vector<AppFormatProperties> &&formats) {
+        format_properties = std::move(formats);
+        queried_format_properties = true;
     }
-
-    AppGpu(const AppGpu &) = delete;
-    const AppGpu &operator=(const AppGpu &) = delete;
-
-    bool CheckPhysicalDeviceExtensionIncluded(std::string extension_to_check) const {
-        return std::any_of(
-            device_extensions.begin(), device_extensions.end(),
-            [extension_to_check](const VkExtensionProperties &prop) { return prop.extensionName == extension_to_check; });
+    void SetMemoryImageSupportTypes(std::vector<ImageTypeInfos> &&image_support_types) {
+        memory_image_support_types = std::move(image_support_types);
+        queried_memory_image_support_types = true;
     }
 
-    // Helper function to determine whether a format range is currently supported.
-    bool FormatRangeSupported(const FormatRange &format_range) const {
-        // Formats from base vulkan spec
-        if (format_range.minimum_instance_version == 0 && format_range.extension_name == nullptr) {
-            return true;
-        }
-
-        // True if this extension is present
-        if (format_range.extension_name != nullptr) {
-            return CheckPhysicalDeviceExtensionIncluded(format_range.extension_name);
-        }
-
-        // True if standard and supported by both this instance and this GPU
-        if (inst.api_version >= format_range.minimum_instance_version &&
-            APIVersion(props.apiVersion) >= format_range.minimum_instance_version) {
-            return true;
-        }
-
-        // Otherwise, not supported.
-        return false;
+    // Move the chains out for a caller that keeps the structs after this AppGpu is destroyed, used by libvulkaninfo. The
+    // pNext pointers of features2 and of the queue families point into the released chains, so only read them afterwards.
+    std::unique_ptr<phys_device_features2_chain> ReleaseFeatures2Chain() { return std::move(chain_for_phys_device_features2); }
+    std::vector<std::unique_ptr<queue_properties2_chain>> ReleaseQueueProperties2Chains() {
+        return std::move(chain_for_queue_props2);
     }
-
-    VkPhysicalDeviceProperties GetDeviceProperties() {
-        if (inst.CheckExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME)) {
-            return props2.properties;
-        } else {
-            return props;
-        }
+    std::vector<AppFormatProperties> ReleaseFormatProperties() {
+        queried_format_properties = false;
+        return std::move(format_properties);
     }
 
     // Vendor specific driverVersion mapping scheme
@@ -2067,18 +2473,94 @@ struct AppGpu {
         }
     }
     const AppDisplay *FindDisplay(VkDisplayKHR handle) {
-        for (const auto &disp : displays) {
+        for (const auto &disp : GetDisplays()) {
             if (disp.properties.display == handle) {
                 return &disp;
             }
         }
         return NULL;
     }
+
+  private:
+    void QueryMemoryProperties2() {
+        if (queried_memory_props2) return;
+        TimingPhase phase("memory properties");
+
+        if (inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2)) {
+            // VkPhysicalDeviceMemoryProperties2
+            memory_props2.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2_KHR;
+            setup_phys_device_mem_props2_chain(memory_props2, chain_for_phys_device_mem_props2, *this);
+
+            vkGetPhysicalDeviceMemoryProperties2KHR(phys_device, &memory_props2);
+            ReadHeapBudget();
+        }
+        queried_memory_props2 = true;
+    }
+
+    void ReadHeapBudget() {
+        struct VkBaseOutStructure *structure = (struct VkBaseOutStructure *)memory_props2.pNext;
+        while (structure) {
+            if (structure->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT &&
+                CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_memory_budget)) {
+                VkPhysicalDeviceMemoryBudgetPropertiesEXT *mem_budget_props =
+                    reinterpret_cast<VkPhysicalDeviceMemoryBudgetPropertiesEXT *>(structure);
+                for (uint32_t i = 0; i < VK_MAX_MEMORY_HEAPS; i++) {
+                    heapBudget[i] = mem_budget_props->heapBudget[i];
+                    heapUsage[i] = mem_budget_props->heapUsage[i];
+                }
+            }
+
+            structure = structure->pNext;
+        }
+    }
+
+    void QueryDisplays() {
+        if (queried_displays) return;
+        TimingPhase phase("displays");
+
+        display_planes = enumerate_display_planes(*this);
+        displays = enumerate_displays(*this, display_planes);
+        queried_displays = true;
+    }
+
+    bool queried_queue_families = false;
+    std::vector<VkQueueFamilyProperties> queue_props;
+    std::vector<VkQueueFamilyProperties2KHR> queue_props2;
+    std::vector<std::unique_ptr<queue_properties2_chain>> chain_for_queue_props2;
+    std::vector<AppQueueFamilyProperties> extended_queue_props;
+
+    bool queried_features2 = false;
+    VkPhysicalDeviceFeatures2KHR features2{};
+    std::unique_ptr<phys_device_features2_chain> chain_for_phys_device_features2;
+
+    bool queried_memory_props2 = false;
+    VkPhysicalDeviceMemoryProperties2KHR memory_props2{};
+    std::unique_ptr<phys_device_mem_props2_chain> chain_for_phys_device_mem_props2;
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> heapBudget{};
+    std::array<VkDeviceSize, VK_MAX_MEMORY_HEAPS> heapUsage{};
+
+    bool queried_memory_image_support_types = false;
+    VkDevice dev = VK_NULL_HANDLE;
+    VkPhysicalDeviceFeatures enabled_features{};
+    std::vector<ImageTypeInfos> memory_image_support_types;
+
+    bool queried_format_properties = false;
+    std::vector<AppFormatProperties> format_properties;
+
+    bool queried_video_profiles = false;
+    std::vector<std::unique_ptr<AppVideoProfile>> video_profiles;
+
+    bool queried_displays = false;
+    std::vector<AppDisplay> displays;
+    std::vector<AppDisplayPlane> display_planes;
+
+    bool queried_layer_extensions = false;
+    std::vector<std::vector<VkExtensionProperties>> layer_extensions;
 };
 
 bool AppVideoProfile::IsImageUsageFlags2Supported(AppGpu &gpu) const {
     // VkImageUsageFlags2KHR requires VK_KHR_extended_flags
-    return gpu.CheckPhysicalDeviceExtensionIncluded(VK_KHR_EXTENDED_FLAGS_EXTENSION_NAME);
+    return gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_extended_flags);
 }
 
 std::vector<VkPhysicalDeviceToolPropertiesEXT> GetToolingInfo(AppGpu &gpu) {
@@ -2089,21 +2571,21 @@ std::vector<VkPhysicalDeviceToolPropertiesEXT> GetToolingInfo(AppGpu &gpu) {
 
 std::vector<VkCooperativeMatrixPropertiesKHR> GetCooperativeMatrixInfo(AppGpu &gpu) {
     if (vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR == nullptr ||
-        !gpu.CheckPhysicalDeviceExtensionIncluded("VK_KHR_cooperative_matrix"))
+        !gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_cooperative_matrix))
         return {};
     return GetVector<VkCooperativeMatrixPropertiesKHR>("vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR",
                                                        vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR, gpu.phys_device);
 }
 std::vector<VkTimeDomainKHR> GetTimeDomainInfo(AppGpu &gpu) {
     if (vkGetPhysicalDeviceCalibrateableTimeDomainsKHR == nullptr ||
-        !gpu.CheckPhysicalDeviceExtensionIncluded("VK_KHR_calibrated_timestamps"))
+        !gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_calibrated_timestamps))
         return {};
     return GetVector<VkTimeDomainKHR>("vkGetPhysicalDeviceCalibrateableTimeDomainsKHR",
                                       vkGetPhysicalDeviceCalibrateableTimeDomainsKHR, gpu.phys_device);
 }
 std::vector<VkPhysicalDeviceFragmentShadingRateKHR> GetFragmentShadingRateInfo(AppGpu &gpu) {
     if (vkGetPhysicalDeviceFragmentShadingRatesKHR == nullptr ||
-        !gpu.CheckPhysicalDeviceExtensionIncluded("VK_KHR_fragment_shading_rate"))
+        !gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_fragment_shading_rate))
         return {};
     return GetVector<VkPhysicalDeviceFragmentShadingRateKHR>("vkGetPhysicalDeviceFragmentShadingRatesKHR",
                                                              vkGetPhysicalDeviceFragmentShadingRatesKHR, gpu.phys_device);
@@ -2111,7 +2593,7 @@ std::vector<VkPhysicalDeviceFragmentShadingRateKHR> GetFragmentShadingRateInfo(A
 // Returns vector where each index maps to VkSampleCountFlagBits
 std::vector<VkMultisamplePropertiesEXT> GetSampleLocationInfo(AppGpu &gpu) {
     if (vkGetPhysicalDeviceMultisamplePropertiesEXT == nullptr ||
-        !gpu.CheckPhysicalDeviceExtensionIncluded("VK_EXT_sample_locations"))
+        !gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::EXT_sample_locations))
         return {};
     std::vector<VkMultisamplePropertiesEXT> result;
     // 7 covers VK_SAMPLE_COUNT_1_BIT to 64_BIT
@@ -2123,62 +2605,3 @@ std::vector<VkMultisamplePropertiesEXT> GetSampleLocationInfo(AppGpu &gpu) {
     }
     return result;
 }
-
-// --------- Format Properties ----------//
-// can't use autogen because that is put in a header that we can't include because that header depends on stuff defined here
-bool operator==(const VkFormatProperties &a, const VkFormatProperties b) {
-    return a.linearTilingFeatures == b.linearTilingFeatures && a.optimalTilingFeatures == b.optimalTilingFeatures &&
-           a.bufferFeatures == b.bufferFeatures;
-}
-bool operator==(const VkFormatProperties3 &a, const VkFormatProperties3 b) {
-    return a.linearTilingFeatures == b.linearTilingFeatures && a.optimalTilingFeatures == b.optimalTilingFeatures &&
-           a.bufferFeatures == b.bufferFeatures;
-}
-
-struct PropFlags {
-    VkFormatProperties props;
-    VkFormatProperties3 props3;
-
-    bool operator==(const PropFlags &other) const { return props == other.props && props3 == other.props3; }
-};
-
-PropFlags get_format_properties(const AppGpu &gpu, VkFormat fmt) {
-    VkFormatProperties props;
-    vkGetPhysicalDeviceFormatProperties(gpu.phys_device, fmt, &props);
-
-    VkFormatProperties3 props3{};
-    props3.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3;
-
-    if (gpu.inst.CheckExtensionEnabled(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) &&
-        gpu.CheckPhysicalDeviceExtensionIncluded(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME)) {
-        VkFormatProperties2 props2{};
-        props2.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2;
-        props2.formatProperties = props;
-        props2.pNext = static_cast<void *>(&props3);
-        vkGetPhysicalDeviceFormatProperties2KHR(gpu.phys_device, fmt, &props2);
-    }
-    return {props, props3};
-}
-
-namespace std {
-template <>
-struct hash<VkFormatProperties> {
-    std::size_t operator()(const VkFormatProperties &k) const {
-        return ((std::hash<uint32_t>()(k.linearTilingFeatures) ^ (std::hash<uint32_t>()(k.optimalTilingFeatures) << 1)) >> 1) ^
-               (std::hash<uint32_t>()(k.bufferFeatures) << 1);
-    }
-};
-template <>
-struct hash<VkFormatProperties3> {
-    std::size_t operator()(const VkFormatProperties3 &k) const {
-        return ((std::hash<uint64_t>()(k.linearTilingFeatures) ^ (std::hash<uint64_t>()(k.optimalTilingFeatures) << 1)) >> 1) ^
-               (std::hash<uint64_t>()(k.bufferFeatures) << 1);
-    }
-};
-template <>
-struct hash<PropFlags> {
-    std::size_t operator()(const PropFlags &k) const {
-        return (std::hash<VkFormatProperties>()(k.props) ^ std::hash<VkFormatProperties3>()(k.props3)) >> 1;
-    }
-};
-}  // namespace std
@@ -0,0 +1,346 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// The capability cache stores the AppGpu sections that take the most queries to collect, one file per physical device. A
+// file is only used if the deviceUUID, driverUUID and driverVersion of the device, the instance version, the header
+// version vulkaninfo was built with and the layer configuration all match, so a driver, loader or layer update makes
+// vulkaninfo query everything again. Layers can change what a device reports, so the layer configuration is a hash of the
+// name and versions of every enabled layer, of the VK_ environment variables and of the layer settings file.
+//
+// File layout, every value in the byte order of the machine that wrote it:
+//   CapabilityCacheHeader
+//   if sections has capability_cache_formats:
+//     uint32_t format count, then per format:
+//       uint32_t VkFormat, VkFormatProperties, 3 x VkFormatFeatureFlags2 (linear, optimal, buffer)
+//       uint32_t byte count, then the bytes of the format_properties2_chain structs (ChainArena::Data)
+//   if sections has capability_cache_memory_image_support:
+//     uint32_t tiling count, then per tiling:
+//       uint32_t VkImageTiling, uint32_t format count, then per format:
+//         uint32_t VkFormat, uint32_t support count, then per support: uint32_t ImageTypeSupport::Type, uint32_t memoryTypeBits
+
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+const uint32_t capability_cache_version = 2;
+
+// Bits of CapabilityCacheHeader::sections
+const uint32_t capability_cache_formats = 0x1;
+const uint32_t capability_cache_memory_image_support = 0x2;
+
+struct CapabilityCacheHeader {
+    char magic[8];
+    uint32_t cache_version;
+    uint32_t header_version;  // VK_HEADER_VERSION_COMPLETE, which structs vulkaninfo puts in the chains depends on it
+    uint32_t instance_api_version;
+    uint32_t driverVersion;
+    uint8_t deviceUUID[VK_UUID_SIZE];
+    uint8_t driverUUID[VK_UUID_SIZE];
+    uint64_t layer_config_hash;
+    uint32_t sections;
+    uint32_t reserved;  // Zero, keeps the struct free of padding since headers are compared with memcmp
+};
+
+#if !defined(_WIN32)
+extern char **environ;
+#endif
+
+class LayerConfigHash {
+  public:
+    void Add(const char *data, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            hash = (hash ^ static_cast<uint8_t>(data[i])) * 0x100000001b3;
+        }
+    }
+    void Add(const std::string &str) { Add(str.data(), str.size() + 1); }
+
+    uint64_t hash = 0xcbf29ce484222325;  // FNV-1a
+};
+
+// The VK_ environment variables, sorted so that their order in the environment doesn't matter. They enable and disable
+// layers and set the layer settings of layers using the layer settings library.
+std::vector<std::string> GetVulkanEnvironmentVariables() {
+    std::vector<std::string> variables;
+#if defined(_WIN32)
+    char *block = GetEnvironmentStringsA();
+    if (block != nullptr) {
+        for (const char *variable = block; *variable != '\0'; variable += strlen(variable) + 1) {
+            if (strncmp(variable, "VK_", 3) == 0) variables.push_back(variable);
+        }
+        FreeEnvironmentStringsA(block);
+    }
+#else
+    for (char **variable = environ; variable != nullptr && *variable != nullptr; variable++) {
+        if (strncmp(*variable, "VK_", 3) == 0) variables.push_back(*variable);
+    }
+#endif
+    std::sort(variables.begin(), variables.end());
+    return variables;
+}
+
+// The contents of the vk_layer_settings.txt file layers read, VK_LAYER_SETTINGS_PATH names either the file or its directory
+std::string GetLayerSettingsFile() {
+    std::vector<std::string> paths;
+    const char *settings_path = getenv("VK_LAYER_SETTINGS_PATH");
+    if (settings_path != nullptr) {
+        paths.push_back(settings_path);
+        paths.push_back(std::string(settings_path) + "/vk_layer_settings.txt");
+    } else {
+        paths.push_back("vk_layer_settings.txt");
+    }
+    for (const auto &path : paths) {
+        std::ifstream file(path, std::ios::binary);
+        if (file) return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    }
+    return "";
+}
+
+uint64_t GetLayerConfigHash(const AppGpu &gpu) {
+    LayerConfigHash hash;
+    // The loader reports the layers enabled on the instance of the device, implicit and environment enabled ones included
+    for (const auto &layer : GetVector<VkLayerProperties>("vkEnumerateDeviceLayerProperties", vkEnumerateDeviceLayerProperties,
+                                                          gpu.phys_device)) {
+        hash.Add(layer.layerName);
+        hash.Add(reinterpret_cast<const char *>(&layer.specVersion), sizeof(layer.specVersion));
+        hash.Add(reinterpret_cast<const char *>(&layer.implementationVersion), sizeof(layer.implementationVersion));
+    }
+    for (const auto &variable : GetVulkanEnvironmentVariables()) {
+        hash.Add(variable);
+    }
+    hash.Add(GetLayerSettingsFile());
+    return hash.hash;
+}
+
+CapabilityCacheHeader MakeCapabilityCacheHeader(const AppGpu &gpu) {
+    CapabilityCacheHeader header{};
+    memcpy(header.magic, "VKICACHE", sizeof(header.magic));
+    header.cache_version = capability_cache_version;
+    header.header_version = VK_HEADER_VERSION_COMPLETE;
+    header.instance_api_version =
+        VK_MAKE_API_VERSION(0, gpu.inst.api_version.Major(), gpu.inst.api_version.Minor(), gpu.inst.api_version.Patch());
+    header.driverVersion = gpu.props.driverVersion;
+    memcpy(header.deviceUUID, gpu.deviceUUID, VK_UUID_SIZE);
+    memcpy(header.driverUUID, gpu.driverUUID, VK_UUID_SIZE);
+    header.layer_config_hash = GetLayerConfigHash(gpu);
+    return header;
+}
+
+std::string GetCapabilityCachePath(const std::string &directory, const AppGpu &gpu) {
+    char file_name[2 * VK_UUID_SIZE + 1] = {};
+    for (uint32_t i = 0; i < VK_UUID_SIZE; i++) {
+        snprintf(file_name + 2 * i, 3, "%02x", gpu.deviceUUID[i]);
+    }
+    return directory + "/" + file_name + ".vkinfocache";
+}
+
+class CapabilityCacheWriter {
+  public:
+    template <typename T>
+    void Write(const T &value) {
+        WriteBytes(reinterpret_cast<const char *>(&value), sizeof(T));
+    }
+    void WriteBytes(const char *data, size_t count) { bytes.insert(bytes.end(), data, data + count); }
+
+    std::vector<char> bytes;
+};
+
+// Every Read fails once the end of the data is reached, so a truncated file is detected
+class CapabilityCacheReader {
+  public:
+    CapabilityCacheReader(const std::vector<char> &bytes) : bytes(bytes) {}
+
+    template <typename T>
+    bool Read(T &value) {
+        const char *data = nullptr;
+        if (!ReadBytes(sizeof(T), data)) return false;
+        memcpy(&value, data, sizeof(T));
+        return true;
+    }
+    bool ReadBytes(size_t count, const char *&data) {
+        if (count > bytes.size() - offset) return false;
+        data = bytes.data() + offset;
+        offset += count;
+        return true;
+    }
+
+  private:
+    const std::vector<char> &bytes;
+    size_t offset = 0;
+};
+
+void WriteCachedFormatProperties(CapabilityCacheWriter &writer, const std::vector<AppFormatProperties> &formats) {
+    writer.Write(static_cast<uint32_t>(formats.size()));
+    for (const auto &entry : formats) {
+        writer.Write(static_cast<uint32_t>(entry.format));
+        writer.Write(entry.flags.props);
+        writer.Write(entry.flags.props3.linearTilingFeatures);
+        writer.Write(entry.flags.props3.optimalTilingFeatures);
+        writer.Write(entry.flags.props3.bufferFeatures);
+        const size_t chain_size = entry.chain ? entry.chain->arena.Size() : 0;
+        writer.Write(static_cast<uint32_t>(chain_size));
+        if (chain_size > 0) writer.WriteBytes(entry.chain->arena.Data(), chain_size);
+    }
+}
+
+bool ReadCachedFormatProperties(CapabilityCacheReader &reader, AppGpu &gpu, std::vector<AppFormatProperties> &formats) {
+    const bool use_props2 = gpu.inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2);
+    uint32_t format_count = 0;
+    if (!reader.Read(format_count)) return false;
+    for (uint32_t i = 0; i < format_count; i++) {
+        AppFormatProperties entry{};
+        uint32_t format = 0;
+        uint32_t chain_size = 0;
+        const char *chain_data = nullptr;
+        if (!reader.Read(format) || !reader.Read(entry.flags.props) || !reader.Read(entry.flags.props3.linearTilingFeatures) ||
+            !reader.Read(entry.flags.props3.optimalTilingFeatures) || !reader.Read(entry.flags.props3.bufferFeatures) ||
+            !reader.Read(chain_size) || !reader.ReadBytes(chain_size, chain_data)) {
+            return false;
+        }
+        entry.format = static_cast<VkFormat>(format);
+        entry.flags.props3.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3;
+        if (use_props2) {
+            // Rebuilds the same chain enumerate_format_properties would have queried and fills it with the saved structs
+            VkFormatProperties2 props2{};
+            setup_format_properties2_chain(props2, entry.chain, gpu);
+            if (!entry.chain->arena.Restore(chain_data, chain_size)) return false;
+        } else if (chain_size != 0) {
+            return false;
+        }
+        formats.push_back(std::move(entry));
+    }
+    return true;
+}
+
+void WriteCachedMemoryImageSupportTypes(CapabilityCacheWriter &writer, const std::vector<ImageTypeInfos> &image_support_types) {
+    writer.Write(static_cast<uint32_t>(image_support_types.size()));
+    for (const auto &tiling : image_support_types) {
+        writer.Write(static_cast<uint32_t>(tiling.tiling));
+        writer.Write(static_cast<uint32_t>(tiling.formats.size()));
+        for (const auto &format : tiling.formats) {
+            writer.Write(static_cast<uint32_t>(format.format));
+            writer.Write(static_cast<uint32_t>(format.type_support.size()));
+            for (const auto &type_support : format.type_support) {
+                writer.Write(static_cast<uint32_t>(type_support.type));
+                writer.Write(type_support.memoryTypeBits);
+            }
+        }
+    }
+}
+
+bool ReadCachedMemoryImageSupportTypes(CapabilityCacheReader &reader, std::vector<ImageTypeInfos> &image_support_types) {
+    uint32_t tiling_count = 0;
+    if (!reader.Read(tiling_count)) return false;
+    for (uint32_t i = 0; i < tiling_count; i++) {
+        ImageTypeInfos tiling{};
+        uint32_t tiling_value = 0;
+        uint32_t format_count = 0;
+        if (!reader.Read(tiling_value) || !reader.Read(format_count)) return false;
+        tiling.tiling = static_cast<VkImageTiling>(tiling_value);
+        for (uint32_t j = 0; j < format_count; j++) {
+            ImageTypeFormatInfo format{};
+            uint32_t format_value = 0;
+            uint32_t support_count = 0;
+            if (!reader.Read(format_value) || !reader.Read(support_count)) return false;
+            format.format = static_cast<VkFormat>(format_value);
+            for (uint32_t k = 0; k < support_count; k++) {
+                ImageTypeSupport type_support{};
+                uint32_t type = 0;
+                if (!reader.Read(type) || !reader.Read(type_support.memoryTypeBits)) return false;
+                if (type > static_cast<uint32_t>(ImageTypeSupport::Type::transient)) return false;
+                type_support.type = static_cast<ImageTypeSupport::Type>(type);
+                format.type_support.push_back(type_support);
+            }
+            tiling.formats.push_back(std::move(format));
+        }
+        image_support_types.push_back(std::move(tiling));
+    }
+    return true;
+}
+
+// Fills in the sections of gpu found in its cache file and returns which ones those were. Nothing is filled in if the file
+// is missing, belongs to another driver or vulkaninfo build, or can't be read completely.
+uint32_t LoadCapabilityCache(AppGpu &gpu, const std::string &directory) {
+    if (!gpu.found_device_id_props) return 0;
+
+    std::ifstream file(GetCapabilityCachePath(directory, gpu), std::ios::binary);
+    if (!file) return 0;
+    const std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    CapabilityCacheReader reader(bytes);
+
+    CapabilityCacheHeader header{};
+    CapabilityCacheHeader expected = MakeCapabilityCacheHeader(gpu);
+    if (!reader.Read(header)) return 0;
+    expected.sections = header.sections;
+    if (memcmp(&header, &expected, sizeof(header)) != 0) return 0;
+
+    std::vector<AppFormatProperties> formats;
+    if ((header.sections & capability_cache_formats) && !ReadCachedFormatProperties(reader, gpu, formats)) return 0;
+    std::vector<ImageTypeInfos> image_support_types;
+    if ((header.sections & capability_cache_memory_image_support) &&
+        !ReadCachedMemoryImageSupportTypes(reader, image_support_types)) {
+        return 0;
+    }
+
+    if (header.sections & capability_cache_formats) gpu.SetFormatProperties(std::move(formats));
+    if (header.sections & capability_cache_memory_image_support) gpu.SetMemoryImageSupportTypes(std::move(image_support_types));
+    return header.sections & (capability_cache_formats | capability_cache_memory_image_support);
+}
+
+// Rewrites the cache file of gpu if more sections were queried than cached_sections, the value LoadCapabilityCache returned.
+// The cache is best effort, failing to write it is not an error.
+void UpdateCapabilityCache(AppGpu &gpu, const std::string &directory, uint32_t cached_sections) {
+    if (!gpu.found_device_id_props) return;
+
+    CapabilityCacheHeader header = MakeCapabilityCacheHeader(gpu);
+    if (gpu.FormatPropertiesQueried()) header.sections |= capability_cache_formats;
+    if (gpu.MemoryImageSupportTypesQueried()) header.sections |= capability_cache_memory_image_support;
+    if ((header.sections & ~cached_sections) == 0) return;
+
+    CapabilityCacheWriter writer;
+    writer.Write(header);
+    if (header.sections & capability_cache_formats) WriteCachedFormatProperties(writer, gpu.GetFormatProperties());
+    if (header.sections & capability_cache_memory_image_support) {
+        WriteCachedMemoryImageSupportTypes(writer, gpu.GetMemoryImageSupportTypes());
+    }
+
+    // Written to a temporary file first so that another vulkaninfo process never reads a partially written file
+    const std::string path = GetCapabilityCachePath(directory, gpu);
+    const std::string temp_path = path + "." + std::to_string(std::random_device{}()) + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file) return;
+        file.write(writer.bytes.data(), static_cast<std::streamsize>(writer.bytes.size()));
+        if (!file) {
+            file.close();
+            std::remove(temp_path.c_str());
+            return;
+        }
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        // rename doesn't replace an existing file on Windows
+        std::remove(path.c_str());
+        if (std::rename(temp_path.c_str(), path.c_str()) != 0) std::remove(temp_path.c_str());
+    }
+}
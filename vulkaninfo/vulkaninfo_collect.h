@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// The queries behind the AppGpu sections that need the generated chain structs, shared by the vulkaninfo executable and
+// libvulkaninfo. Nothing in here prints.
+
+#pragma once
+
+#include <algorithm>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "vulkaninfo_chains.hpp"
+
+// Queries the properties of every format in the format ranges the GPU supports, each format only once
+std::vector<AppFormatProperties> enumerate_format_properties(AppGpu &gpu) {
+    std::vector<VkFormat> formats;
+    for (const auto &format_range : format_ranges) {
+        if (gpu.FormatRangeSupported(format_range)) {
+            for (int32_t fmt = format_range.first_format; fmt <= format_range.last_format; ++fmt) {
+                formats.push_back(static_cast<VkFormat>(fmt));
+            }
+        }
+    }
+    // The ranges of promoted extensions overlap with the core ranges they were promoted to
+    std::sort(formats.begin(), formats.end());
+    formats.erase(std::unique(formats.begin(), formats.end()), formats.end());
+
+    const bool use_props2 = gpu.inst.CheckExtensionEnabled(AppExtension::KHR_get_physical_device_properties2);
+    const bool use_props3 = use_props2 && gpu.CheckPhysicalDeviceExtensionIncluded(AppExtension::KHR_format_feature_flags2);
+
+    std::vector<AppFormatProperties> format_properties(formats.size());
+    for (size_t i = 0; i < formats.size(); i++) {
+        AppFormatProperties &entry = format_properties[i];
+        entry.format = formats[i];
+        entry.flags = {};
+        entry.flags.props3.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3;
+        if (!use_props2) {
+            vkGetPhysicalDeviceFormatProperties(gpu.phys_device, entry.format, &entry.flags.props);
+            continue;
+        }
+
+        VkFormatProperties2 props2{};
+        props2.sType = VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2;
+        setup_format_properties2_chain(props2, entry.chain, gpu);
+
+        // The chain only contains a VkFormatProperties3 for devices older than 1.3, otherwise put one in front of it
+        const VkFormatProperties3 *chain_props3 = entry.chain->FormatProperties3;
+        if (use_props3 && chain_props3 == nullptr) {
+            entry.flags.props3.pNext = props2.pNext;
+            props2.pNext = &entry.flags.props3;
+        }
+
+        vkGetPhysicalDeviceFormatProperties2KHR(gpu.phys_device, entry.format, &props2);
+        entry.flags.props = props2.formatProperties;
+        if (use_props3 && chain_props3 != nullptr) {
+            entry.flags.props3 = *chain_props3;
+        }
+        entry.flags.props3.pNext = nullptr;
+    }
+    return format_properties;
+}
+
+AppDisplayPlane::AppDisplayPlane(AppGpu &gpu, uint32_t index, const VkDisplayPlanePropertiesKHR &in_prop)
+    : global_index(index), properties(in_prop) {
+    std::ostringstream display_name;
+
+    supported_displays = GetVector<VkDisplayKHR>("vkGetDisplayPlaneSupportedDisplaysKHR", vkGetDisplayPlaneSupportedDisplaysKHR,
+                                                 gpu.phys_device, global_index);
+}
+
+std::vector<AppDisplayPlane> enumerate_display_planes(AppGpu &gpu) {
+    std::vector<AppDisplayPlane> result;
+    if (vkGetPhysicalDeviceDisplayPlanePropertiesKHR) {
+        auto planes = GetVector<VkDisplayPlanePropertiesKHR>("vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+                vkGetPhysicalDeviceDisplayPlanePropertiesKHR, gpu.phys_device);
+        for (uint32_t i = 0; i < planes.size(); i++) {
+            result.emplace_back(gpu, i, planes[i]);
+        }
+    }
+    return result;
+}
+
+AppDisplayMode::AppDisplayMode(AppGpu &gpu, const VkDisplayModePropertiesKHR &in_properties,
+                               const std::set<uint32_t> &supported_planes)
+    : properties(in_properties) {
+    for (auto plane : supported_planes) {
+        VkDisplayPlaneCapabilitiesKHR cap;
+
+        vkGetDisplayPlaneCapabilitiesKHR(gpu.phys_device, properties.displayMode, plane, &cap);
+        capabilities[plane] = cap;
+    }
+}
+
+static std::string MakeName(uint32_t index, const VkDisplayPropertiesKHR &prop) {
+    std::stringstream name;
+    name << "Display id : " << index << " (" << (prop.displayName ? prop.displayName : "<null>") << ")";
+    return name.str();
+}
+
+AppDisplay::AppDisplay(AppGpu &gpu, uint32_t index, const VkDisplayPropertiesKHR &in_properties,
+                       const std::vector<AppDisplayPlane> &all_planes)
+    : global_index(index), name(MakeName(index, in_properties)), properties(in_properties) {
+    auto mode_props = GetVector<VkDisplayModePropertiesKHR>("vkGetDisplayModePropertiesKHR", vkGetDisplayModePropertiesKHR,
+                                                            gpu.phys_device, properties.display);
+
+    std::set<uint32_t> supported_planes;
+    for (const auto &plane : all_planes) {
+        for (const auto &display : plane.supported_displays) {
+            if (display == properties.display) {
+                supported_planes.insert(plane.global_index);
+            }
+        }
+    }
+
+    for (const auto &prop : mode_props) {
+        modes.emplace_back(gpu, prop, supported_planes);
+    }
+}
+
+std::vector<AppDisplay> enumerate_displays(AppGpu &gpu, const std::vector<AppDisplayPlane> &all_planes) {
+    std::vector<AppDisplay> result;
+
+    if (vkGetPhysicalDeviceDisplayPropertiesKHR) {
+        auto properties = GetVector<VkDisplayPropertiesKHR>("vkGetPhysicalDeviceDisplayPropertiesKHR",
+                vkGetPhysicalDeviceDisplayPropertiesKHR, gpu.phys_device);
+
+        for (uint32_t i = 0; i < properties.size(); i++) {
+            result.emplace_back(gpu, i, properties[i], all_planes);
+        }
+    }
+    return result;
+}
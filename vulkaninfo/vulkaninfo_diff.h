@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// --diff: compares two json documents vulkaninfo wrote value by value. Both documents are flattened into the values the
+// generated dump functions wrote, named by their path, and the values of one are looked up in a table of the other, so the
+// comparison is a single pass over each document no matter how differently they are laid out.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "vulkaninfo_json.h"
+
+struct JsonDiff {
+    struct Change {
+        const JsonFlatValue *from;  // nullptr if the value was added
+        const JsonFlatValue *to;    // nullptr if the value was removed
+    };
+    std::vector<JsonFlatValue> from_values;
+    std::vector<JsonFlatValue> to_values;
+    // Changed and added values in the order of the second document, followed by the removed ones in the order of the first
+    std::vector<Change> changes;
+};
+
+bool HasProfileGpuBlocks(const std::vector<JsonFlatValue> &values) {
+    return std::any_of(values.begin(), values.end(),
+                       [](const JsonFlatValue &value) { return !SplitProfileBlockPath(value.path).gpu.empty(); });
+}
+
+// Keeps the values in the capability blocks of GPU gpu of a --json=all document and names them the way the profile of that
+// GPU alone names them, so that they can be compared with it
+void SelectProfileGpu(std::vector<JsonFlatValue> &values, uint32_t gpu) {
+    const std::string gpu_number = std::to_string(gpu);
+    std::vector<JsonFlatValue> selected;
+    for (auto &value : values) {
+        ProfileBlockPath split = SplitProfileBlockPath(value.path);
+        if (split.gpu != gpu_number) continue;
+        std::string path = std::string(split.block) + (split.rest.empty() ? "" : "/") + std::string(split.rest);
+        selected.push_back(JsonFlatValue{std::move(path), value.type, std::move(value.text)});
+    }
+    if (selected.empty()) throw std::runtime_error("the --json=all document has no capabilities of GPU " + gpu_number);
+    values = std::move(selected);
+}
+
+// Values are paired by their path, so the capability blocks of two profiles are compared block by block, and so are the
+// blocks of each GPU of two --json=all documents. A --json=all document compared with the profile of a single GPU only has
+// the blocks of GPU gpu compared.
+void DiffVulkaninfoJson(std::istream &from, std::istream &to, JsonDiff &diff, uint32_t gpu = 0) {
+    FlattenVulkaninfoJson(from, diff.from_values);
+    FlattenVulkaninfoJson(to, diff.to_values);
+    bool from_all_gpus = HasProfileGpuBlocks(diff.from_values);
+    if (from_all_gpus != HasProfileGpuBlocks(diff.to_values)) {
+        SelectProfileGpu(from_all_gpus ? diff.from_values : diff.to_values, gpu);
+    }
+
+    std::unordered_map<std::string_view, size_t> from_index;
+    from_index.reserve(diff.from_values.size());
+    for (size_t i = 0; i < diff.from_values.size(); i++) from_index[diff.from_values[i].path] = i;
+
+    std::vector<bool> matched(diff.from_values.size());
+    for (const auto &to_value : diff.to_values) {
+        auto found = from_index.find(to_value.path);
+        if (found == from_index.end()) {
+            diff.changes.push_back(JsonDiff::Change{nullptr, &to_value});
+            continue;
+        }
+        const JsonFlatValue &from_value = diff.from_values[found->second];
+        matched[found->second] = true;
+        if (from_value.type != to_value.type || from_value.text != to_value.text) {
+            diff.changes.push_back(JsonDiff::Change{&from_value, &to_value});
+        }
+    }
+    for (size_t i = 0; i < diff.from_values.size(); i++) {
+        if (!matched[i]) diff.changes.push_back(JsonDiff::Change{&diff.from_values[i], nullptr});
+    }
+}
+
+// Splits the '|' separated strings of a flattened array
+std::vector<std::string_view> SplitJsonFlags(std::string_view text) {
+    std::vector<std::string_view> flags;
+    while (!text.empty()) {
+        size_t end = text.find('|');
+        flags.push_back(text.substr(0, end));
+        if (end == std::string_view::npos) break;
+        text.remove_prefix(end + 1);
+    }
+    return flags;
+}
+
+std::string DiffValueText(const JsonFlatValue &value) {
+    if (value.type == JsonType::string) return "\"" + value.text + "\"";
+    if (value.type == JsonType::begin_array) return "[" + value.text + "]";
+    return value.text;
+}
+
+// One line per change: "~ path: from -> to", "+ path: value" or "- path: value". Flags that changed only list the flags that
+// were added and removed.
+void PrintDiffText(std::ostream &out, const JsonDiff &diff) {
+    size_t changed = 0, added = 0, removed = 0;
+    for (const auto &change : diff.changes) {
+        if (change.from == nullptr) {
+            out << "+ " << change.to->path << ": " << DiffValueText(*change.to) << "\n";
+            added++;
+            continue;
+        }
+        if (change.to == nullptr) {
+            out << "- " << change.from->path << ": " << DiffValueText(*change.from) << "\n";
+            removed++;
+            continue;
+        }
+        changed++;
+        out << "~ " << change.to->path << ":";
+        if (change.from->type == JsonType::begin_array && change.to->type == JsonType::begin_array) {
+            auto from_flags = SplitJsonFlags(change.from->text);
+            auto to_flags = SplitJsonFlags(change.to->text);
+            for (auto flag : to_flags) {
+                if (std::find(from_flags.begin(), from_flags.end(), flag) == from_flags.end()) out << " +" << flag;
+            }
+            for (auto flag : from_flags) {
+                if (std::find(to_flags.begin(), to_flags.end(), flag) == to_flags.end()) out << " -" << flag;
+            }
+            out << "\n";
+        } else {
+            out << " " << DiffValueText(*change.from) << " -> " << DiffValueText(*change.to) << "\n";
+        }
+    }
+    out << changed << " changed, " << added << " added, " << removed << " removed\n";
+}
+
+void WriteDiffJsonString(std::ostream &out, std::string_view string) {
+    out << '"';
+    for (char c : string) {
+        switch (c) {
+            case '"':
+                out << "\\\"";
+                break;
+            case '\\':
+                out << "\\\\";
+                break;
+            case '\n':
+                out << "\\n";
+                break;
+            case '\r':
+                out << "\\r";
+                break;
+            case '\t':
+                out << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    const char *hex = "0123456789abcdef";
+                    out << "\\u00" << hex[(c >> 4) & 0xF] << hex[c & 0xF];
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+void WriteDiffJsonValue(std::ostream &out, const JsonFlatValue &value) {
+    if (value.type == JsonType::string) {
+        WriteDiffJsonString(out, value.text);
+    } else if (value.type == JsonType::begin_array) {
+        out << '[';
+        bool first = true;
+        for (auto flag : SplitJsonFlags(value.text)) {
+            if (!first) out << ", ";
+            WriteDiffJsonString(out, flag);
+            first = false;
+        }
+        out << ']';
+    } else {
+        out << value.text;
+    }
+}
+
+// {"changed": [{"path", "from", "to"}...], "added": [{"path", "value"}...], "removed": [{"path", "value"}...]}
+void PrintDiffJson(std::ostream &out, const JsonDiff &diff) {
+    auto write_list = [&](const char *name, bool want_from, bool want_to) {
+        out << "\t\"" << name << "\": [";
+        bool first = true;
+        for (const auto &change : diff.changes) {
+            if ((change.from != nullptr) != want_from || (change.to != nullptr) != want_to) continue;
+            out << (first ? "\n" : ",\n") << "\t\t{\"path\": ";
+            WriteDiffJsonString(out, (change.to ? change.to : change.from)->path);
+            if (want_from && want_to) {
+                out << ", \"from\": ";
+                WriteDiffJsonValue(out, *change.from);
+                out << ", \"to\": ";
+                WriteDiffJsonValue(out, *change.to);
+            } else {
+                out << ", \"value\": ";
+                WriteDiffJsonValue(out, want_to ? *change.to : *change.from);
+            }
+            out << "}";
+            first = false;
+        }
+        out << (first ? "]" : "\n\t]");
+    };
+    out << "{\n";
+    write_list("changed", true, true);
+    out << ",\n";
+    write_list("added", false, true);
+    out << ",\n";
+    write_list("removed", true, false);
+    out << "\n}\n";
+}
@@ -0,0 +1,567 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// vulkaninfo-fleet: reads the profile json files (VP_VULKANINFO_*.json) that vulkaninfo --json writes for many devices into
+// a columnar store, and answers how many of the devices have a capability.
+//
+// Every value under "capabilities" becomes a column named by its capability block and path, such as
+// "device/properties/VkPhysicalDeviceProperties/limits/maxImageDimension2D", with one row per device. A document that
+// vulkaninfo --json=all -o wrote for several GPUs has one row per GPU. Arrays of strings, which are how flags are written,
+// become a single value holding the set of flags. Each column keeps a dictionary of the distinct
+// values it holds and stores one code per device, so a fleet of similar devices takes a few bytes per device and column,
+// and a query evaluates its condition once per distinct value instead of once per device.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "vulkaninfo_json.h"
+
+enum class ValueKind : uint8_t { string, number, boolean, flags };
+
+struct Value {
+    ValueKind kind;
+    std::string text;  // flags are sorted and separated by '|'
+};
+
+// One code per device, stored in as few bytes as the largest code needs. Code 0 means the device has no value.
+class CodeVector {
+  public:
+    uint32_t Get(size_t index) const {
+        if (index >= size) return 0;
+        uint32_t code = 0;
+        for (uint32_t i = 0; i < width; i++) code |= static_cast<uint32_t>(bytes[index * width + i]) << (8 * i);
+        return code;
+    }
+    void Set(size_t index, uint32_t code) {
+        uint32_t needed = code > 0xFFFF ? 4 : code > 0xFF ? 2 : 1;
+        if (needed > width) Widen(needed);
+        if (index >= size) Resize(index + 1);
+        for (uint32_t i = 0; i < width; i++) bytes[index * width + i] = static_cast<uint8_t>(code >> (8 * i));
+    }
+    void Resize(size_t new_size) {
+        size = new_size;
+        bytes.resize(size * width);
+    }
+    uint32_t Width() const { return width; }
+    size_t Size() const { return size; }
+    std::vector<uint8_t> &Bytes() { return bytes; }
+    const std::vector<uint8_t> &Bytes() const { return bytes; }
+    void Assign(uint32_t new_width, std::vector<uint8_t> &&new_bytes) {
+        width = new_width;
+        bytes = std::move(new_bytes);
+        size = bytes.size() / width;
+    }
+
+  private:
+    uint32_t width = 1;
+    size_t size = 0;
+    std::vector<uint8_t> bytes;
+
+    void Widen(uint32_t new_width) {
+        std::vector<uint8_t> widened(size * new_width);
+        for (size_t index = 0; index < size; index++) {
+            for (uint32_t i = 0; i < width; i++) widened[index * new_width + i] = bytes[index * width + i];
+        }
+        width = new_width;
+        bytes = std::move(widened);
+    }
+};
+
+struct Column {
+    std::string name;
+    std::vector<Value> dictionary;  // the value of code c is dictionary[c - 1]
+    std::unordered_map<std::string, uint32_t> codes;
+    CodeVector rows;
+
+    static std::string Key(ValueKind kind, const std::string &text) {
+        return static_cast<char>('0' + static_cast<int>(kind)) + text;
+    }
+
+    uint32_t Intern(ValueKind kind, const std::string &text) {
+        std::string key = Key(kind, text);
+        auto found = codes.find(key);
+        if (found != codes.end()) return found->second;
+        dictionary.push_back(Value{kind, text});
+        uint32_t code = static_cast<uint32_t>(dictionary.size());
+        codes.emplace(std::move(key), code);
+        return code;
+    }
+};
+
+class CapabilityStore {
+  public:
+    size_t DeviceCount() const { return devices.size(); }
+    const std::vector<std::string> &Devices() const { return devices; }
+    const std::vector<Column> &Columns() const { return columns; }
+    bool HasFile(const std::string &file) const { return files.count(file) != 0; }
+
+    // file is the profile file the device was read from, which holds several devices for --json=all documents
+    size_t AddDevice(const std::string &name, const std::string &file) {
+        devices.push_back(name);
+        device_files.push_back(file);
+        files.insert(file);
+        return devices.size() - 1;
+    }
+
+    // The devices, columns and values a store had before a file was added, so that a file which turns out to be malformed
+    // can be taken back out
+    struct Checkpoint {
+        size_t device_count;
+        std::vector<size_t> dictionary_sizes;
+    };
+    Checkpoint MakeCheckpoint() const {
+        Checkpoint checkpoint{devices.size(), {}};
+        checkpoint.dictionary_sizes.reserve(columns.size());
+        for (const auto &column : columns) checkpoint.dictionary_sizes.push_back(column.dictionary.size());
+        return checkpoint;
+    }
+    void Rollback(const Checkpoint &checkpoint) {
+        for (size_t row = checkpoint.device_count; row < devices.size(); row++) files.erase(device_files[row]);
+        devices.resize(checkpoint.device_count);
+        device_files.resize(checkpoint.device_count);
+        for (size_t i = checkpoint.dictionary_sizes.size(); i < columns.size(); i++) column_index.erase(columns[i].name);
+        columns.resize(checkpoint.dictionary_sizes.size());
+        for (size_t i = 0; i < columns.size(); i++) {
+            Column &column = columns[i];
+            for (size_t code = checkpoint.dictionary_sizes[i]; code < column.dictionary.size(); code++) {
+                column.codes.erase(Column::Key(column.dictionary[code].kind, column.dictionary[code].text));
+            }
+            column.dictionary.resize(checkpoint.dictionary_sizes[i]);
+            if (column.rows.Size() > checkpoint.device_count) column.rows.Resize(checkpoint.device_count);
+        }
+    }
+
+    void Set(size_t row, const std::string &column_name, ValueKind kind, const std::string &text) {
+        auto found = column_index.find(column_name);
+        if (found == column_index.end()) {
+            found = column_index.emplace(column_name, columns.size()).first;
+            columns.push_back(Column{column_name, {}, {}, {}});
+        }
+        Column &column = columns[found->second];
+        column.rows.Set(row, column.Intern(kind, text));
+    }
+    const Column *FindColumn(const std::string &name) const {
+        auto found = column_index.find(name);
+        return found == column_index.end() ? nullptr : &columns[found->second];
+    }
+
+    // The store file holds the device names and files, then for every column its name, its dictionary and its codes
+    void Save(const std::string &path) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw std::runtime_error("can't open " + path + " for writing");
+        out.write(magic, sizeof(magic));
+        WriteInt(out, version);
+        WriteInt(out, devices.size());
+        for (size_t i = 0; i < devices.size(); i++) {
+            WriteString(out, devices[i]);
+            WriteString(out, device_files[i]);
+        }
+        WriteInt(out, columns.size());
+        for (auto &column : columns) {
+            column.rows.Resize(devices.size());
+            WriteString(out, column.name);
+            WriteInt(out, column.dictionary.size());
+            for (const auto &value : column.dictionary) {
+                WriteInt(out, static_cast<uint64_t>(value.kind));
+                WriteString(out, value.text);
+            }
+            WriteInt(out, column.rows.Width());
+            WriteInt(out, column.rows.Bytes().size());
+            out.write(reinterpret_cast<const char *>(column.rows.Bytes().data()),
+                      static_cast<std::streamsize>(column.rows.Bytes().size()));
+        }
+        if (!out) throw std::runtime_error("failed to write " + path);
+    }
+    void Load(const std::string &path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw std::runtime_error("can't open " + path);
+        in.seekg(0, std::ios::end);
+        file_size = static_cast<uint64_t>(in.tellg());
+        in.seekg(0, std::ios::beg);
+        char file_magic[sizeof(magic)] = {};
+        in.read(file_magic, sizeof(file_magic));
+        if (memcmp(file_magic, magic, sizeof(magic)) != 0 || ReadInt(in) != version) {
+            throw std::runtime_error(path + " is not a vulkaninfo-fleet store");
+        }
+        for (uint64_t device_count = ReadInt(in); device_count > 0; device_count--) {
+            std::string name = ReadString(in);
+            AddDevice(name, ReadString(in));
+        }
+        for (uint64_t column_count = ReadInt(in); column_count > 0; column_count--) {
+            Column column;
+            column.name = ReadString(in);
+            if (column_index.count(column.name) != 0) throw std::runtime_error(path + " is corrupt");
+            for (uint64_t value_count = ReadInt(in); value_count > 0; value_count--) {
+                uint64_t kind = ReadInt(in);
+                if (kind > static_cast<uint64_t>(ValueKind::flags)) throw std::runtime_error(path + " is corrupt");
+                // A value in the dictionary twice would shift the codes of every value after it
+                size_t dictionary_size = column.dictionary.size();
+                column.Intern(static_cast<ValueKind>(kind), ReadString(in));
+                if (column.dictionary.size() == dictionary_size) throw std::runtime_error(path + " is corrupt");
+            }
+            auto width = static_cast<uint32_t>(ReadInt(in));
+            uint64_t byte_count = ReadInt(in);
+            if ((width != 1 && width != 2 && width != 4) || byte_count % width != 0 || byte_count > Remaining(in) ||
+                byte_count / width > devices.size()) {
+                throw std::runtime_error(path + " is corrupt");
+            }
+            std::vector<uint8_t> bytes(static_cast<size_t>(byte_count));
+            in.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+            if (!in) throw std::runtime_error(path + " is corrupt");
+            column.rows.Assign(width, std::move(bytes));
+            // The queries index their per value tables with the codes
+            for (size_t row = 0; row < column.rows.Size(); row++) {
+                if (column.rows.Get(row) > column.dictionary.size()) throw std::runtime_error(path + " is corrupt");
+            }
+            column_index.emplace(column.name, columns.size());
+            columns.push_back(std::move(column));
+        }
+        if (!in) throw std::runtime_error(path + " is truncated");
+    }
+
+  private:
+    static constexpr char magic[8] = {'V', 'K', 'I', 'F', 'L', 'E', 'E', 'T'};
+    static constexpr uint64_t version = 2;
+
+    std::vector<std::string> devices;
+    std::vector<std::string> device_files;
+    std::unordered_set<std::string> files;
+    std::vector<Column> columns;
+    std::unordered_map<std::string, size_t> column_index;
+    uint64_t file_size = 0;  // of the store being loaded, no size read from it may be larger than what is left of it
+
+    // Integers are little endian no matter the host
+    static void WriteInt(std::ostream &out, uint64_t value) {
+        char bytes[8];
+        for (int i = 0; i < 8; i++) bytes[i] = static_cast<char>(value >> (8 * i));
+        out.write(bytes, sizeof(bytes));
+    }
+    static void WriteString(std::ostream &out, const std::string &string) {
+        WriteInt(out, string.size());
+        out.write(string.data(), static_cast<std::streamsize>(string.size()));
+    }
+    uint64_t Remaining(std::istream &in) const {
+        auto offset = in.tellg();
+        if (offset < 0) return 0;
+        return file_size - std::min(file_size, static_cast<uint64_t>(offset));
+    }
+    static uint64_t ReadInt(std::istream &in) {
+        unsigned char bytes[8] = {};
+        in.read(reinterpret_cast<char *>(bytes), sizeof(bytes));
+        uint64_t value = 0;
+        for (int i = 0; i < 8; i++) value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+        return value;
+    }
+    std::string ReadString(std::istream &in) const {
+        uint64_t size = ReadInt(in);
+        if (!in || size > Remaining(in)) throw std::runtime_error("the store is corrupt");
+        std::string string(size, '\0');
+        in.read(string.data(), static_cast<std::streamsize>(size));
+        return string;
+    }
+};
+
+// Adds a device for the profile file, or one for each GPU of a --json=all document, named by the file and "#gpu<number>".
+// The columns of every device are named the way the profile of a single GPU names them. The values are added as the file
+// is streamed, and the devices of a file that turns out to be malformed are taken back out.
+void AddProfileFile(CapabilityStore &store, const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) throw std::runtime_error("can't open the file");
+
+    CapabilityStore::Checkpoint checkpoint = store.MakeCheckpoint();
+    std::unordered_map<std::string, size_t> gpu_rows;
+    try {
+        FlattenVulkaninfoJson(in, [&](JsonFlatValue &&value) {
+            ProfileBlockPath split = SplitProfileBlockPath(value.path);
+            std::string gpu(split.gpu);
+            auto row = gpu_rows.find(gpu);
+            if (row == gpu_rows.end()) {
+                row = gpu_rows.emplace(gpu, store.AddDevice(gpu.empty() ? path : path + "#gpu" + gpu, path)).first;
+            }
+            ValueKind kind = value.type == JsonType::begin_array ? ValueKind::flags
+                             : value.type == JsonType::number    ? ValueKind::number
+                             : value.type == JsonType::boolean   ? ValueKind::boolean
+                                                                 : ValueKind::string;
+            if (gpu.empty()) {
+                store.Set(row->second, value.path, kind, value.text);
+            } else {
+                std::string column(split.block);
+                if (!split.rest.empty()) column.append("/").append(split.rest);
+                store.Set(row->second, column, kind, value.text);
+            }
+        });
+        if (gpu_rows.empty()) throw std::runtime_error("no capabilities in the file");
+    } catch (...) {
+        store.Rollback(checkpoint);
+        throw;
+    }
+}
+
+// A condition on one column, "<column>", "!<column>" or "<column><op><value>" with op one of == != >= <= > < ~
+// A column on its own holds for devices whose value is not false, 0 or an empty set. ~ checks that a set of flags
+// contains the value, or that a string contains it.
+struct Condition {
+    std::string column;
+    std::string op;
+    std::string operand;
+    bool negate = false;
+
+    static Condition Parse(const std::string &expression) {
+        Condition condition;
+        size_t start = 0;
+        if (!expression.empty() && expression[0] == '!') {
+            condition.negate = true;
+            start = 1;
+        }
+        size_t op_pos = expression.find_first_of("=!<>~", start);
+        condition.column = expression.substr(start, op_pos - start);
+        if (op_pos != std::string::npos) {
+            size_t op_length = 1;
+            if (op_pos + 1 < expression.size() && expression[op_pos + 1] == '=') op_length = 2;
+            condition.op = expression.substr(op_pos, op_length);
+            condition.operand = expression.substr(op_pos + op_length);
+            if (condition.op == "=") condition.op = "==";
+            if (condition.op == "!" || condition.op == "~=") throw std::runtime_error("invalid operator in " + expression);
+        }
+        if (condition.column.empty()) throw std::runtime_error("no column in " + expression);
+        return condition;
+    }
+
+    bool Holds(const Value &value) const {
+        bool result = Compare(value);
+        return negate ? !result : result;
+    }
+
+  private:
+    static bool ParseNumber(const std::string &text, double &number) {
+        if (text == "true" || text == "false") {
+            number = text == "true" ? 1.0 : 0.0;
+            return true;
+        }
+        char *end = nullptr;
+        number = strtod(text.c_str(), &end);
+        return !text.empty() && *end == '\0';
+    }
+
+    bool Compare(const Value &value) const {
+        if (op.empty()) return value.text != "false" && value.text != "0" && !value.text.empty();
+        if (op == "~") {
+            if (value.kind != ValueKind::flags) return value.text.find(operand) != std::string::npos;
+            size_t pos = 0;
+            while (pos <= value.text.size()) {
+                size_t end = value.text.find('|', pos);
+                if (end == std::string::npos) end = value.text.size();
+                if (value.text.compare(pos, end - pos, operand) == 0) return true;
+                pos = end + 1;
+            }
+            return false;
+        }
+        int order = 0;
+        double left = 0.0;
+        double right = 0.0;
+        if (value.kind != ValueKind::string && value.kind != ValueKind::flags && ParseNumber(value.text, left) &&
+            ParseNumber(operand, right)) {
+            order = left < right ? -1 : left > right ? 1 : 0;
+        } else {
+            order = value.text.compare(operand);
+        }
+        if (op == "==") return order == 0;
+        if (op == "!=") return order != 0;
+        if (op == ">=") return order >= 0;
+        if (op == "<=") return order <= 0;
+        if (op == ">") return order > 0;
+        return order < 0;
+    }
+};
+
+// Which devices satisfy every condition. A condition is evaluated once per distinct value of its column.
+std::vector<bool> SelectDevices(const CapabilityStore &store, const std::vector<Condition> &conditions) {
+    std::vector<bool> selected(store.DeviceCount(), true);
+    for (const auto &condition : conditions) {
+        const Column *column = store.FindColumn(condition.column);
+        // Devices without a value only satisfy a negated condition
+        std::vector<bool> holds(1, condition.negate);
+        if (column != nullptr) {
+            for (const auto &value : column->dictionary) holds.push_back(condition.Holds(value));
+        }
+        for (size_t row = 0; row < selected.size(); row++) {
+            if (selected[row]) selected[row] = holds[column != nullptr ? column->rows.Get(row) : 0];
+        }
+    }
+    return selected;
+}
+
+void PrintColumns(const CapabilityStore &store, const std::vector<bool> &selected, const std::string &filter) {
+    printf("%-100s %8s %8s\n", "Column", "Devices", "Values");
+    for (const auto &column : store.Columns()) {
+        if (column.name.find(filter) == std::string::npos) continue;
+        size_t devices = 0;
+        for (size_t row = 0; row < selected.size(); row++) devices += selected[row] && column.rows.Get(row) != 0;
+        printf("%-100s %8zu %8zu\n", column.name.c_str(), devices, column.dictionary.size());
+    }
+}
+
+void PrintHistogram(const CapabilityStore &store, const std::vector<bool> &selected, const std::string &column_name) {
+    const Column *column = store.FindColumn(column_name);
+    if (column == nullptr) throw std::runtime_error("no column named " + column_name);
+    std::vector<size_t> counts(column->dictionary.size() + 1);
+    for (size_t row = 0; row < selected.size(); row++) {
+        if (selected[row]) counts[column->rows.Get(row)]++;
+    }
+    std::vector<uint32_t> order;
+    for (uint32_t code = 0; code < counts.size(); code++) {
+        if (counts[code] != 0) order.push_back(code);
+    }
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return counts[a] > counts[b]; });
+    for (uint32_t code : order) {
+        printf("%8zu  %s\n", counts[code], code == 0 ? "(none)" : column->dictionary[code - 1].text.c_str());
+    }
+}
+
+// Directories stand for the .json files directly inside of them
+void AddInputPath(const std::string &path, std::vector<std::string> &inputs) {
+    std::error_code error;
+    if (!std::filesystem::is_directory(path, error)) {
+        inputs.push_back(path);
+        return;
+    }
+    std::vector<std::string> files;
+    for (const auto &entry : std::filesystem::directory_iterator(path, error)) {
+        if (entry.is_regular_file(error) && entry.path().extension() == ".json") files.push_back(entry.path().string());
+    }
+    std::sort(files.begin(), files.end());
+    inputs.insert(inputs.end(), files.begin(), files.end());
+}
+
+const char *help_message_body =
+    "OPTIONS:\n"
+    "[-h, --help]         Print this help.\n"
+    "[--store=<file>]     Load the devices of a store written before, and write the\n"
+    "                     store back to file once the input files were added.\n"
+    "[--list=<file>]      Read input file names from file, one per line. Use - to\n"
+    "                     read them from stdin.\n"
+    "[--where=<condition>]\n"
+    "                     Only count the devices that satisfy condition. Conditions\n"
+    "                     are <column>, !<column> or <column><op><value>, where op is\n"
+    "                     one of == != >= <= > < and ~ (the flags contain value).\n"
+    "                     Repeat to require several conditions.\n"
+    "[--columns[=<text>]] List the columns whose name contains text, with how many of\n"
+    "                     the selected devices have a value and how many distinct\n"
+    "                     values there are.\n"
+    "[--histogram=<column>]\n"
+    "                     Print every value of column with how many of the selected\n"
+    "                     devices have it.\n";
+
+void print_usage(const std::string &executable_name) {
+    std::cout << "\nvulkaninfo-fleet - Aggregate the profile json files vulkaninfo writes for many devices\n\n";
+    std::cout << "USAGE: \n";
+    std::cout << "    " << executable_name << " [options] [<file or directory>...]\n\n";
+    std::cout << help_message_body << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::string store_file;
+    std::vector<std::string> inputs;
+    std::vector<Condition> conditions;
+    bool list_columns = false;
+    std::string column_filter;
+    std::string histogram_column;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], "--help") == 0 || strcmp(argv[i], "-h") == 0) {
+                print_usage(argv[0]);
+                return 0;
+            } else if (strncmp(argv[i], "--store=", 8) == 0) {
+                store_file = argv[i] + 8;
+            } else if (strncmp(argv[i], "--list=", 7) == 0) {
+                std::ifstream list_file;
+                if (strcmp(argv[i] + 7, "-") != 0) {
+                    list_file.open(argv[i] + 7);
+                    if (!list_file) throw std::runtime_error(std::string("can't open ") + (argv[i] + 7));
+                }
+                std::istream &list = strcmp(argv[i] + 7, "-") == 0 ? std::cin : list_file;
+                for (std::string line; std::getline(list, line);) {
+                    if (!line.empty() && line.back() == '\r') line.pop_back();
+                    if (!line.empty()) AddInputPath(line, inputs);
+                }
+            } else if (strncmp(argv[i], "--where=", 8) == 0) {
+                conditions.push_back(Condition::Parse(argv[i] + 8));
+            } else if (strcmp(argv[i], "--columns") == 0) {
+                list_columns = true;
+            } else if (strncmp(argv[i], "--columns=", 10) == 0) {
+                list_columns = true;
+                column_filter = argv[i] + 10;
+            } else if (strncmp(argv[i], "--histogram=", 12) == 0) {
+                histogram_column = argv[i] + 12;
+            } else if (strncmp(argv[i], "--", 2) == 0) {
+                std::cout << "Unknown argument: " << argv[i] << "\n";
+                print_usage(argv[0]);
+                return 1;
+            } else {
+                AddInputPath(argv[i], inputs);
+            }
+        }
+
+        CapabilityStore store;
+        std::error_code error;
+        if (!store_file.empty() && std::filesystem::exists(store_file, error)) store.Load(store_file);
+
+        size_t added = 0;
+        for (const auto &input : inputs) {
+            if (store.HasFile(input)) continue;
+            try {
+                AddProfileFile(store, input);
+                added++;
+            } catch (const std::exception &e) {
+                std::cerr << "Skipping " << input << ": " << e.what() << "\n";
+            }
+        }
+        if (!store_file.empty() && added > 0) store.Save(store_file);
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<bool> selected = SelectDevices(store, conditions);
+        size_t matched = static_cast<size_t>(std::count(selected.begin(), selected.end(), true));
+        double query_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        if (list_columns) PrintColumns(store, selected, column_filter);
+        if (!histogram_column.empty()) PrintHistogram(store, selected, histogram_column);
+        printf("%zu of %zu devices (%.1f%%) in %.3f ms\n", matched, store.DeviceCount(),
+               store.DeviceCount() == 0 ? 0.0 : 100.0 * static_cast<double>(matched) / static_cast<double>(store.DeviceCount()),
+               query_ms);
+    } catch (const std::exception &e) {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -37,6 +37,8 @@
 
 #include <vulkan/vulkan.h>
 
+#include "vulkaninfo_timings.h"
+
 void* vulkan_library;
 
 // Global Functions
@@ -83,10 +85,12 @@ static PFN_vkCreateStreamDescriptorSurfaceGGP vkCreateStreamDescriptorSurfaceGGP
 // Instance functions
 static PFN_vkCreateDebugReportCallbackEXT vkCreateDebugReportCallbackEXT;
 static PFN_vkCreateDevice vkCreateDevice;
+static PFN_vkCreateHeadlessSurfaceEXT vkCreateHeadlessSurfaceEXT;
 static PFN_vkDestroyDebugReportCallbackEXT vkDestroyDebugReportCallbackEXT;
 static PFN_vkDestroyInstance vkDestroyInstance;
 static PFN_vkDestroySurfaceKHR vkDestroySurfaceKHR;
 static PFN_vkEnumerateDeviceExtensionProperties vkEnumerateDeviceExtensionProperties;
+static PFN_vkEnumerateDeviceLayerProperties vkEnumerateDeviceLayerProperties;
 static PFN_vkGetDisplayModePropertiesKHR vkGetDisplayModePropertiesKHR;
 static PFN_vkGetDisplayPlaneCapabilitiesKHR vkGetDisplayPlaneCapabilitiesKHR;
 static PFN_vkGetDisplayPlaneSupportedDisplaysKHR vkGetDisplayPlaneSupportedDisplaysKHR;
@@ -124,10 +128,16 @@ static PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT vkGetPhysicalDeviceMultis
 // Device functions
 static PFN_vkCreateImage vkCreateImage;
 static PFN_vkGetImageMemoryRequirements vkGetImageMemoryRequirements;
+static PFN_vkGetDeviceImageMemoryRequirements vkGetDeviceImageMemoryRequirements;
+static PFN_vkGetDeviceImageMemoryRequirementsKHR vkGetDeviceImageMemoryRequirementsKHR;
 static PFN_vkDestroyImage vkDestroyImage;
 static PFN_vkDestroyDevice vkDestroyDevice;
 
-#define LOAD_INSTANCE_FUNCTION(instance, function) function = (PFN_##function)vkGetInstanceProcAddr(instance, #function)
+#define LOAD_INSTANCE_FUNCTION(instance, function)                              \
+    do {                                                                       \
+        function = (PFN_##function)vkGetInstanceProcAddr(instance, #function); \
+        TIME_VULKAN_FUNCTION(function);                                        \
+    } while (0)
 
 static VkResult load_vulkan_library() {
     vulkan_library = NULL;
@@ -220,10 +230,12 @@ static void load_vulkan_instance_functions(VkInstance instance) {
 
     LOAD_INSTANCE_FUNCTION(instance, vkCreateDebugReportCallbackEXT);
     LOAD_INSTANCE_FUNCTION(instance, vkCreateDevice);
+    LOAD_INSTANCE_FUNCTION(instance, vkCreateHeadlessSurfaceEXT);
     LOAD_INSTANCE_FUNCTION(instance, vkDestroyDebugReportCallbackEXT);
     LOAD_INSTANCE_FUNCTION(instance, vkDestroyInstance);
     LOAD_INSTANCE_FUNCTION(instance, vkDestroySurfaceKHR);
     LOAD_INSTANCE_FUNCTION(instance, vkEnumerateDeviceExtensionProperties);
+    LOAD_INSTANCE_FUNCTION(instance, vkEnumerateDeviceLayerProperties);
     LOAD_INSTANCE_FUNCTION(instance, vkGetDisplayModePropertiesKHR);
     LOAD_INSTANCE_FUNCTION(instance, vkGetDisplayPlaneCapabilitiesKHR);
     LOAD_INSTANCE_FUNCTION(instance, vkGetDisplayPlaneSupportedDisplaysKHR);
@@ -261,6 +273,8 @@ static void load_vulkan_instance_functions(VkInstance instance) {
     // Load device functions using vkGetInstanceProcAddr, vulkaninfo doesn't care about the extra indirection it causes
     LOAD_INSTANCE_FUNCTION(instance, vkCreateImage);
     LOAD_INSTANCE_FUNCTION(instance, vkGetImageMemoryRequirements);
+    LOAD_INSTANCE_FUNCTION(instance, vkGetDeviceImageMemoryRequirements);
+    LOAD_INSTANCE_FUNCTION(instance, vkGetDeviceImageMemoryRequirementsKHR);
     LOAD_INSTANCE_FUNCTION(instance, vkDestroyImage);
     LOAD_INSTANCE_FUNCTION(instance, vkDestroyDevice);
 }
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// A streaming reader for the json vulkaninfo writes. The input is read through a fixed size buffer and only the containers
+// around the current value are kept, so the memory used does not grow with the size of the document.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+enum class JsonType { begin_object, end_object, begin_array, end_array, string, number, boolean, null };
+
+struct JsonToken {
+    JsonType type = JsonType::null;
+    std::string key;   // the key of the value when it is a member of an object, empty otherwise
+    std::string text;  // the string, the number as written, or "true" / "false"
+};
+
+class JsonReader {
+  public:
+    explicit JsonReader(std::istream &input) : in(input) {}
+
+    // Reads the next token, returns false once the document is complete. Malformed json throws std::runtime_error.
+    bool Next(JsonToken &token) {
+        SkipWhitespace();
+        token.key.clear();
+        if (levels.empty()) {
+            if (started) {
+                if (Peek() != eof) Fail("unexpected characters after the document");
+                return false;
+            }
+            started = true;
+            ReadValue(token);
+            return true;
+        }
+
+        bool object = levels.back().object;
+        if (Peek() == (object ? '}' : ']')) {
+            Get();
+            levels.pop_back();
+            token.type = object ? JsonType::end_object : JsonType::end_array;
+            return true;
+        }
+        if (!levels.back().first) {
+            Expect(',');
+            SkipWhitespace();
+        }
+        levels.back().first = false;
+        if (object) {
+            ReadString(token.key);
+            SkipWhitespace();
+            Expect(':');
+            SkipWhitespace();
+        }
+        ReadValue(token);
+        return true;
+    }
+
+    // Skips the rest of the object or array whose begin token was just read
+    void Skip() {
+        size_t depth = levels.size();
+        JsonToken token;
+        while (levels.size() >= depth && Next(token)) {
+        }
+    }
+
+    // How many objects and arrays the reader is inside of
+    size_t Depth() const { return levels.size(); }
+
+  private:
+    static constexpr int eof = -1;
+
+    struct Level {
+        bool object;
+        bool first;
+    };
+
+    std::istream &in;
+    char buffer[65536];
+    size_t buffer_pos = 0;
+    size_t buffer_size = 0;
+    uint64_t offset = 0;  // of buffer[0] in the input, for error messages
+    std::vector<Level> levels;
+    bool started = false;
+
+    int Peek() {
+        if (buffer_pos == buffer_size) {
+            offset += buffer_size;
+            buffer_pos = 0;
+            buffer_size = 0;
+            if (in) {
+                in.read(buffer, sizeof(buffer));
+                buffer_size = static_cast<size_t>(in.gcount());
+            }
+            if (buffer_size == 0) return eof;
+        }
+        return static_cast<unsigned char>(buffer[buffer_pos]);
+    }
+    int Get() {
+        int c = Peek();
+        if (c != eof) buffer_pos++;
+        return c;
+    }
+
+    [[noreturn]] void Fail(const char *message) {
+        throw std::runtime_error(std::string(message) + " at byte " + std::to_string(offset + buffer_pos));
+    }
+    void Expect(char c) {
+        if (Get() != c) Fail((std::string("expected '") + c + "'").c_str());
+    }
+
+    void SkipWhitespace() {
+        for (int c = Peek(); c == ' ' || c == '\t' || c == '\n' || c == '\r'; c = Peek()) Get();
+    }
+
+    void ReadValue(JsonToken &token) {
+        token.text.clear();
+        int c = Peek();
+        if (c == '{' || c == '[') {
+            Get();
+            levels.push_back(Level{c == '{', true});
+            token.type = c == '{' ? JsonType::begin_object : JsonType::begin_array;
+        } else if (c == '"') {
+            token.type = JsonType::string;
+            ReadString(token.text);
+        } else if (c == '-' || (c >= '0' && c <= '9')) {
+            token.type = JsonType::number;
+            for (c = Peek(); c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E' || (c >= '0' && c <= '9'); c = Peek()) {
+                token.text += static_cast<char>(Get());
+            }
+        } else if (c == 't' || c == 'f' || c == 'n') {
+            const char *literal = c == 't' ? "true" : c == 'f' ? "false" : "null";
+            for (const char *l = literal; *l != '\0'; l++) {
+                if (Get() != *l) Fail("invalid literal");
+            }
+            token.type = c == 'n' ? JsonType::null : JsonType::boolean;
+            if (c != 'n') token.text = literal;
+        } else {
+            Fail("expected a value");
+        }
+    }
+
+    void ReadString(std::string &out) {
+        Expect('"');
+        for (int c = Get(); c != '"'; c = Get()) {
+            if (c == eof) Fail("unterminated string");
+            if (c != '\\') {
+                out += static_cast<char>(c);
+                continue;
+            }
+            c = Get();
+            switch (c) {
+                case '"':
+                case '\\':
+                case '/':
+                    out += static_cast<char>(c);
+                    break;
+                case 'b':
+                    out += '\b';
+                    break;
+                case 'f':
+                    out += '\f';
+                    break;
+                case 'n':
+                    out += '\n';
+                    break;
+                case 'r':
+                    out += '\r';
+                    break;
+                case 't':
+                    out += '\t';
+                    break;
+                case 'u':
+                    AppendCodePoint(out, ReadEscapedCodePoint());
+                    break;
+                default:
+                    Fail("invalid escape sequence");
+            }
+        }
+    }
+
+    uint32_t ReadHex4() {
+        uint32_t value = 0;
+        for (int i = 0; i < 4; i++) {
+            int c = Get();
+            value <<= 4;
+            if (c >= '0' && c <= '9') {
+                value |= static_cast<uint32_t>(c - '0');
+            } else if (c >= 'a' && c <= 'f') {
+                value |= static_cast<uint32_t>(c - 'a' + 10);
+            } else if (c >= 'A' && c <= 'F') {
+                value |= static_cast<uint32_t>(c - 'A' + 10);
+            } else {
+                Fail("invalid \\u escape");
+            }
+        }
+        return value;
+    }
+    // The 'u' was already read, surrogate pairs are combined
+    uint32_t ReadEscapedCodePoint() {
+        uint32_t code_point = ReadHex4();
+        if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+            Expect('\\');
+            Expect('u');
+            uint32_t low = ReadHex4();
+            if (low < 0xDC00 || low > 0xDFFF) Fail("invalid surrogate pair");
+            code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+        }
+        return code_point;
+    }
+    static void AppendCodePoint(std::string &out, uint32_t code_point) {
+        if (code_point < 0x80) {
+            out += static_cast<char>(code_point);
+        } else if (code_point < 0x800) {
+            out += static_cast<char>(0xC0 | (code_point >> 6));
+            out += static_cast<char>(0x80 | (code_point & 0x3F));
+        } else if (code_point < 0x10000) {
+            out += static_cast<char>(0xE0 | (code_point >> 12));
+            out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code_point & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (code_point >> 18));
+            out += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code_point & 0x3F));
+        }
+    }
+};
+
+// A value of a json document named by its path, such as "features/VkPhysicalDeviceFeatures/geometryShader", with array
+// elements named "name[index]". Arrays of strings, which is how vulkaninfo writes flags, are a single value.
+struct JsonFlatValue {
+    std::string path;
+    JsonType type;     // string, number or boolean, or begin_array for an array of strings
+    std::string text;  // the strings of an array are sorted and separated by '|'
+};
+
+// Called with each value as soon as it was read
+using JsonFlatValueSink = std::function<void(JsonFlatValue &&value)>;
+
+// Passes the value whose first token was just read, and every value inside of it, to add
+void FlattenJsonValue(JsonReader &reader, const JsonToken &first, const std::string &path, const JsonFlatValueSink &add) {
+    JsonToken token;
+    switch (first.type) {
+        case JsonType::begin_object:
+            while (reader.Next(token) && token.type != JsonType::end_object) {
+                FlattenJsonValue(reader, token, path.empty() ? token.key : path + "/" + token.key, add);
+            }
+            break;
+        case JsonType::begin_array: {
+            std::vector<std::string> strings;
+            size_t index = 0;
+            while (reader.Next(token) && token.type != JsonType::end_array) {
+                if (token.type == JsonType::string) {
+                    strings.push_back(token.text);
+                } else {
+                    FlattenJsonValue(reader, token, path + "[" + std::to_string(index) + "]", add);
+                }
+                index++;
+            }
+            // An empty array is an empty set of flags, which differs from not having the value at all
+            if (!strings.empty() || index == 0) {
+                std::sort(strings.begin(), strings.end());
+                std::string text;
+                for (const auto &string : strings) text += (text.empty() ? "" : "|") + string;
+                add(JsonFlatValue{path, JsonType::begin_array, std::move(text)});
+            }
+            break;
+        }
+        case JsonType::string:
+        case JsonType::number:
+        case JsonType::boolean:
+            add(JsonFlatValue{path, first.type, first.text});
+            break;
+        default:
+            break;
+    }
+}
+
+// Flattens a json document vulkaninfo wrote. Profiles (--json) only have the values of their capability blocks added, named
+// by the block and their path inside of it ("device/extensions/VK_KHR_swapchain"), since the rest is the name and metadata
+// of the profile. Other documents, such as the --vkconfig_output one, have every value added. Each value is passed to add as
+// it is read, so flattening a document doesn't hold more of it than the reader does.
+void FlattenVulkaninfoJson(std::istream &in, const JsonFlatValueSink &add) {
+    JsonReader reader(in);
+    JsonToken token;
+    if (!reader.Next(token) || token.type != JsonType::begin_object) throw std::runtime_error("not a json object");
+    while (reader.Next(token) && token.type != JsonType::end_object) {
+        if (token.key == "capabilities" && token.type == JsonType::begin_object) {
+            while (reader.Next(token) && token.type != JsonType::end_object) FlattenJsonValue(reader, token, token.key, add);
+        } else if (token.key == "$schema" || token.key == "profiles") {
+            if (token.type == JsonType::begin_object || token.type == JsonType::begin_array) reader.Skip();
+        } else {
+            FlattenJsonValue(reader, token, token.key, add);
+        }
+    }
+    while (reader.Next(token)) {
+    }
+}
+
+// Adds every value of the document to out, for the callers which need all of them at once
+void FlattenVulkaninfoJson(std::istream &in, std::vector<JsonFlatValue> &out) {
+    FlattenVulkaninfoJson(in, [&out](JsonFlatValue &&value) { out.push_back(std::move(value)); });
+}
+
+// A flattened profile path split into the capability block it is in, the GPU number --json=all with -o appends to the names
+// of the blocks of each GPU, and the path inside of the block. "device_gpu1/extensions/VK_KHR_swapchain" is in block
+// "device" of GPU "1", gpu is empty for the blocks of a profile of a single GPU.
+struct ProfileBlockPath {
+    std::string_view block;
+    std::string_view gpu;
+    std::string_view rest;
+};
+
+ProfileBlockPath SplitProfileBlockPath(std::string_view path) {
+    ProfileBlockPath split;
+    size_t slash = path.find('/');
+    split.block = path.substr(0, slash);
+    if (slash != std::string_view::npos) split.rest = path.substr(slash + 1);
+    size_t suffix = split.block.rfind("_gpu");
+    if (suffix != std::string_view::npos && suffix + 4 < split.block.size() &&
+        split.block.find_first_not_of("0123456789", suffix + 4) == std::string_view::npos) {
+        split.gpu = split.block.substr(suffix + 4);
+        split.block = split.block.substr(0, suffix);
+    }
+    return split;
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 The Khronos Group Inc.
+ * Copyright (c) 2026 Valve Corporation
+ * Copyright (c) 2026 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// --timings: measures every Vulkan call vulkaninfo makes, grouped by the phase of vulkaninfo the call is made in.
+// The Vulkan function pointers are only replaced with timed wrappers when call_timings is set before they are loaded, so
+// nothing is measured or slowed down otherwise.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+class CallTimings {
+  public:
+    struct Entry {
+        uint64_t count = 0;
+        uint64_t total_ns = 0;
+        uint64_t max_ns = 0;
+
+        void Add(uint64_t ns) {
+            count++;
+            total_ns += ns;
+            max_ns = (std::max)(max_ns, ns);
+        }
+    };
+
+    CallTimings() : start(std::chrono::steady_clock::now()) {}
+
+    // Phases are reported in the order they first started
+    void RegisterPhase(const char *phase) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (phases.find(phase) == phases.end()) {
+            phases[phase] = {};
+            phase_order.push_back(phase);
+        }
+    }
+    void AddPhase(const char *phase, uint64_t ns) {
+        std::lock_guard<std::mutex> lock(mutex);
+        phases[phase].Add(ns);
+    }
+    void AddCall(const char *phase, const char *function, uint64_t ns) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (phases.find(phase) == phases.end()) {
+            phases[phase] = {};
+            phase_order.push_back(phase);
+        }
+        calls[phase][function].Add(ns);
+    }
+
+    static uint64_t ElapsedNs(std::chrono::steady_clock::time_point since) {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - since).count());
+    }
+
+    // A table of the phases followed by a table of every function and phase, slowest first
+    void PrintTable(std::ostream &out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        char line[160];
+        snprintf(line, sizeof(line), "%-40s %12s %8s %12s\n", "Phase", "Time (ms)", "Calls", "Calls (ms)");
+        out << "\n" << line;
+        for (const auto &phase : phase_order) {
+            Entry phase_calls = SumCalls(phase);
+            snprintf(line, sizeof(line), "%-40s %12.3f %8llu %12.3f\n", phase.c_str(), ToMs(phases[phase].total_ns),
+                     static_cast<unsigned long long>(phase_calls.count), ToMs(phase_calls.total_ns));
+            out << line;
+        }
+        snprintf(line, sizeof(line), "%-40s %12.3f\n", "total wall time", ToMs(ElapsedNs(start)));
+        out << line;
+
+        struct Row {
+            const std::string *function;
+            const std::string *phase;
+            const Entry *entry;
+        };
+        std::vector<Row> rows;
+        for (const auto &phase : calls) {
+            for (const auto &function : phase.second) rows.push_back(Row{&function.first, &phase.first, &function.second});
+        }
+        std::sort(rows.begin(), rows.end(), [](const Row &a, const Row &b) { return a.entry->total_ns > b.entry->total_ns; });
+        snprintf(line, sizeof(line), "\n%-52s %-28s %8s %12s %12s\n", "Function", "Phase", "Calls", "Total (ms)", "Max (ms)");
+        out << line;
+        for (const auto &row : rows) {
+            snprintf(line, sizeof(line), "%-52s %-28s %8llu %12.3f %12.3f\n", row.function->c_str(), row.phase->c_str(),
+                     static_cast<unsigned long long>(row.entry->count), ToMs(row.entry->total_ns), ToMs(row.entry->max_ns));
+            out << line;
+        }
+        out.flush();
+    }
+
+    // The same data as json, times in nanoseconds
+    void WriteJson(std::ostream &out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        out << "{\n\t\"total_ns\": " << ElapsedNs(start) << ",\n\t\"phases\": [";
+        for (size_t i = 0; i < phase_order.size(); i++) {
+            const auto &phase = phase_order[i];
+            out << (i == 0 ? "\n" : ",\n") << "\t\t{\"name\": \"" << phase << "\", ";
+            WriteEntry(out, phases[phase]);
+            out << ", \"calls\": [";
+            bool first = true;
+            for (const auto &function : calls[phase]) {
+                out << (first ? "\n" : ",\n") << "\t\t\t{\"function\": \"" << function.first << "\", ";
+                WriteEntry(out, function.second);
+                out << "}";
+                first = false;
+            }
+            out << (first ? "" : "\n\t\t") << "]}";
+        }
+        out << "\n\t]\n}\n";
+        out.flush();
+    }
+
+  private:
+    std::mutex mutex;
+    std::chrono::steady_clock::time_point start;
+    std::vector<std::string> phase_order;
+    std::map<std::string, Entry> phases;
+    std::map<std::string, std::map<std::string, Entry>> calls;  // phase -> function -> timing
+
+    static double ToMs(uint64_t ns) { return static_cast<double>(ns) / 1e6; }
+
+    Entry SumCalls(const std::string &phase) {
+        Entry sum;
+        for (const auto &function : calls[phase]) {
+            sum.count += function.second.count;
+            sum.total_ns += function.second.total_ns;
+        }
+        return sum;
+    }
+
+    static void WriteEntry(std::ostream &out, const Entry &entry) {
+        out << "\"count\": " << entry.count << ", \"total_ns\": " << entry.total_ns << ", \"max_ns\": " << entry.max_ns;
+    }
+};
+
+// Set by --timings before the instance is created
+static CallTimings *call_timings = nullptr;
+
+// The innermost phase running on this thread, calls are attributed to it
+static thread_local const char *current_timing_phase = "other";
+
+// Marks a scope as a phase. Phases nest, and the time of a phase includes the phases inside of it. Phases which run on several
+// threads at once, such as the queries of each GPU, add up the time of every thread.
+class TimingPhase {
+  public:
+    explicit TimingPhase(const char *name) : name(name), previous(current_timing_phase) {
+        if (call_timings == nullptr) return;
+        call_timings->RegisterPhase(name);
+        current_timing_phase = name;
+        start = std::chrono::steady_clock::now();
+    }
+    ~TimingPhase() {
+        if (call_timings == nullptr) return;
+        call_timings->AddPhase(name, CallTimings::ElapsedNs(start));
+        current_timing_phase = previous;
+    }
+
+    TimingPhase(const TimingPhase &) = delete;
+    const TimingPhase &operator=(const TimingPhase &) = delete;
+
+  private:
+    const char *name;
+    const char *previous;
+    std::chrono::steady_clock::time_point start;
+};
+
+class CallTimer {
+  public:
+    explicit CallTimer(const char *function) : function(function), start(std::chrono::steady_clock::now()) {}
+    ~CallTimer() { call_timings->AddCall(current_timing_phase, function, CallTimings::ElapsedNs(start)); }
+
+  private:
+    const char *function;
+    std::chrono::steady_clock::time_point start;
+};
+
+// The wrapper TIME_VULKAN_FUNCTION puts in place of a function. It has the calling convention of the PFN it replaces, which
+// a lambda doesn't on platforms where VKAPI_PTR isn't the default. Tag gives every function its own wrapper, several
+// functions share the same PFN type.
+template <typename Tag, typename PFN>
+struct TimedVulkanFunction;
+
+template <typename Tag, typename R, typename... Args>
+struct TimedVulkanFunction<Tag, R(VKAPI_PTR *)(Args...)> {
+    static inline const char *name = nullptr;
+    static inline R(VKAPI_PTR *next)(Args...) = nullptr;
+
+    static VKAPI_ATTR R VKAPI_CALL Call(Args... args) {
+        CallTimer timer(name);
+        return next(args...);
+    }
+};
+
+// Replaces the loaded function pointer with a wrapper which times every call of it
+#define TIME_VULKAN_FUNCTION(function)                                                    \
+    if (call_timings != nullptr && function != nullptr) {                                 \
+        struct function##_timing_tag {};                                                  \
+        using TimedFunction = TimedVulkanFunction<function##_timing_tag, PFN_##function>; \
+        TimedFunction::name = #function;                                                  \
+        TimedFunction::next = function;                                                   \
+        function = &TimedFunction::Call;                                                  \
+    }